@@ -0,0 +1,81 @@
+#ifndef HUFFMAN_H
+#define HUFFMAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pzip.h"
+
+/**
+ * Records per independently coded block.
+ */
+#define HUFFMAN_BLOCK_RECORDS (64 << 10)
+
+/**
+ * Longest code, in bits. Longer codes are avoided by flattening the
+ * frequencies until the tree fits.
+ */
+#define HUFFMAN_MAX_BITS 15
+
+#define HUFFMAN_MAGIC "PZH1"
+
+/**
+ * The header of a Huffman-coded archive, in host byte order. It is followed
+ * by n_blocks uint64_t block sizes in bytes, then the blocks themselves.
+ *
+ * Characters and occurences have a code table each, stored as the code
+ * length of every symbol (0 if unused); the codes are canonical. Every
+ * block holds HUFFMAN_BLOCK_RECORDS records (the last one may hold fewer),
+ * each coded as its character then its occurence, most significant bit
+ * first, padded to a whole byte.
+ */
+struct huffman_header {
+	char magic[4];
+	uint32_t block_records;
+	uint64_t n_records;
+	uint64_t n_blocks;
+	uint8_t character_bits[256];
+	uint8_t occurence_bits[256];
+};
+
+/**
+ * huffman_encode() - entropy-code narrow records
+ *
+ * Inputs:
+ * @ctx:		The context whose workers code the blocks, or NULL for
+ *			the calling thread only
+ * @records:		The records to code
+ * @n_records:		The number of records
+ *
+ * Outputs:
+ * @archive:		A malloc()ed archive: header, block sizes and blocks
+ * @archive_size:	Its size in bytes
+ *
+ * The workers first count how often each character and occurence appears in
+ * the records, each in its own table, and the tables are merged into the
+ * two code tables. The blocks are then coded in parallel, each on its own.
+ * Returns 0, or -1 if out of memory.
+ */
+int huffman_encode(struct pzip_ctx *ctx, const struct zipped_char *records,
+		   size_t n_records, void **archive, size_t *archive_size);
+
+/**
+ * huffman_decode() - decode an archive written by huffman_encode()
+ *
+ * Inputs:
+ * @ctx:		The context whose workers decode the blocks, or NULL
+ * @archive:		The archive
+ * @archive_size:	Its size in bytes
+ *
+ * Outputs:
+ * @records:		The malloc()ed records
+ * @n_records:		The number of records
+ *
+ * Blocks are decoded in parallel. Returns 0, or -1 if the archive is
+ * damaged (errno is EINVAL) or out of memory.
+ */
+int huffman_decode(struct pzip_ctx *ctx, const void *archive,
+		   size_t archive_size, struct zipped_char **records,
+		   size_t *n_records);
+
+#endif /* HUFFMAN_H */
@@ -0,0 +1,153 @@
+#ifndef PUNZIP_H
+#define PUNZIP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pzip.h"
+
+/**
+ * Uncompressed characters per block of a block index.
+ */
+#define PZIP_INDEX_BLOCK (1 << 20)
+
+/**
+ * One block of a block index: the record that holds the first character of
+ * the block, and how many characters of that record come before it.
+ */
+struct pzip_index_entry {
+	uint64_t record;
+	uint64_t skip;
+};
+
+/**
+ * A block index, as stored in an ARCHIVE.idx file next to an archive: the
+ * header below, then n_blocks entries, all in host byte order.
+ *
+ * fingerprint is a hash of the archive's length and of the records the
+ * entries point at, with the record before each of them and the last record.
+ * It takes O(n_blocks) to check, so an index can be matched to its archive
+ * without reading every record.
+ */
+struct pzip_index {
+	char magic[4];
+	uint32_t wide;
+	uint64_t block_size;
+	uint64_t n_records;
+	uint64_t size;
+	uint64_t n_blocks;
+	uint64_t fingerprint;
+	struct pzip_index_entry entries[];
+};
+
+#define PZIP_INDEX_MAGIC "PZI2"
+
+/**
+ * punzip_size() - the number of characters some records unzip to
+ *
+ * Inputs:
+ * @ctx:		The context whose workers add up the occurences, or
+ *			NULL for the calling thread only
+ * @records:		The zipped_char or zipped_char_wide records
+ * @n_records:		The number of records
+ * @wide:		Whether @records are zipped_char_wide
+ */
+uint64_t punzip_size(struct pzip_ctx *ctx, const void *records,
+		     size_t n_records, bool wide);
+
+/**
+ * punzip() - unzip records in parallel
+ *
+ * Inputs:
+ * @ctx:		The context whose workers unzip, or NULL for the
+ *			calling thread only
+ * @records:		The zipped_char or zipped_char_wide records
+ * @n_records:		The number of records
+ * @wide:		Whether @records are zipped_char_wide
+ *
+ * Outputs:
+ * @output:		The unzipped characters, punzip_size() of them
+ *
+ * The records are split evenly between the workers. Each worker adds up the
+ * occurences of its records, an exclusive prefix sum of those totals gives
+ * every worker the offset of its characters in @output, and the workers then
+ * write their runs there in parallel.
+ */
+void punzip(struct pzip_ctx *ctx, const void *records, size_t n_records,
+	    bool wide, char *output);
+
+/**
+ * punzip_index_build() - build the block index of some records
+ *
+ * Same inputs as punzip(), and @block_size, the characters per block.
+ * Returns a malloc()ed index (free it with free()), or NULL if out of memory.
+ */
+struct pzip_index *punzip_index_build(struct pzip_ctx *ctx, const void *records,
+				      size_t n_records, bool wide,
+				      uint64_t block_size);
+
+/**
+ * punzip_index_path() - the malloc()ed name of the index file of @archive
+ */
+char *punzip_index_path(const char *archive);
+
+/**
+ * punzip_index_save() - write a block index to a file
+ *
+ * Returns 0, or -1 with errno set.
+ */
+int punzip_index_save(const struct pzip_index *index, const char *file);
+
+/**
+ * punzip_index_load() - read a block index from a file
+ *
+ * Returns a malloc()ed index, or NULL with errno set (EINVAL if the file is
+ * not a block index, or its header does not match its length). The entries
+ * are not checked against an archive: see punzip_index_check().
+ */
+struct pzip_index *punzip_index_load(const char *file);
+
+/**
+ * punzip_index_check() - whether a block index belongs to some records
+ *
+ * Inputs:
+ * @index:		The block index
+ * @records:		The zipped_char or zipped_char_wide records
+ * @n_records:		The number of records
+ * @wide:		Whether @records are zipped_char_wide
+ *
+ * Compares the record count, width and fingerprint of the index with the
+ * records, and checks that every entry points inside its record, without
+ * reading the other records. An archive that was rewritten only in records
+ * the fingerprint does not cover goes undetected.
+ *
+ * Returns 0, or -1 with errno set to EINVAL if the index does not match.
+ */
+int punzip_index_check(const struct pzip_index *index, const void *records,
+		       size_t n_records, bool wide);
+
+/**
+ * punzip_range() - unzip part of the records
+ *
+ * Inputs:
+ * @records:		The zipped_char or zipped_char_wide records
+ * @n_records:		The number of records
+ * @wide:		Whether @records are zipped_char_wide
+ * @index:		The block index of @records, or NULL to scan them from
+ *			the start
+ * @offset:		The first character to unzip
+ * @length:		The number of characters to unzip
+ *
+ * Outputs:
+ * @output:		The unzipped characters
+ *
+ * With an index, only the records from the block holding @offset onwards are
+ * read. Returns the number of characters written, which is less than @length
+ * if the range goes past the end.
+ */
+size_t punzip_range(const void *records, size_t n_records, bool wide,
+		    const struct pzip_index *index, uint64_t offset,
+		    size_t length, char *output);
+
+#endif /* PUNZIP_H */
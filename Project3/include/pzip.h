@@ -1,8 +1,16 @@
 #ifndef PZIP_H
 #define PZIP_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+/**
+ * PZIP_ALPHABET - the number of entries of a char_frequency array, one per
+ * byte value. Any byte may appear in the input, not only a-z.
+ */
+#define PZIP_ALPHABET 256
+
 /**
  * The struct that holds consecutive character-occurence pairs.
  */
@@ -11,18 +19,70 @@ struct zipped_char {
 	uint8_t occurence;
 };
 
+/**
+ * The wide output record: one per run, so runs longer than 255 are not split.
+ * It is packed, so it takes 5 bytes in the output file.
+ */
+struct zipped_char_wide {
+	char character;
+	uint32_t occurence;
+} __attribute__((packed));
+
+/**
+ * zipped_record_size() - the size of one output record
+ */
+static inline size_t zipped_record_size(bool wide)
+{
+	return wide ? sizeof(struct zipped_char_wide) : sizeof(struct zipped_char);
+}
+
+/**
+ * zipped_record_character() - the character of record @i of either format
+ */
+static inline char zipped_record_character(const void *records, bool wide, size_t i)
+{
+	return wide ? ((const struct zipped_char_wide *)records)[i].character :
+		      ((const struct zipped_char *)records)[i].character;
+}
+
+/**
+ * zipped_record_occurence() - the occurence of record @i of either format
+ */
+static inline uint32_t zipped_record_occurence(const void *records, bool wide, size_t i)
+{
+	return wide ? ((const struct zipped_char_wide *)records)[i].occurence :
+		      ((const struct zipped_char *)records)[i].occurence;
+}
+
 /**
  * pzip() - zip an array of characters in parallel
  *
  * Inputs:
- * @n_threads:		   The number of threads to use in pzip
- * @input_chars:		   The input characters (a-z) to be zipped
+ * @n_threads:		   The maximum number of threads to use in pzip
+ * @input_chars:		   The input bytes (any of 0-255) to be zipped
  * @input_chars_size:	   The number of characaters in the input file
  *
+ * Any input size and thread count are accepted. The input is split into
+ * chunks of about 128 KiB (at least one per thread) whose sizes differ by at
+ * most one character; inputs with fewer than n_threads characters use one
+ * thread per character, and an empty input produces no output. Threads claim
+ * chunks one at a time, first from their own share and then from the others',
+ * so a thread given slow chunks (many short runs) is helped by the rest.
+ *
+ * Runs that straddle two chunks are stitched back together, so the output does
+ * not depend on n_threads. A run longer than 255 (the maximum occurence) is
+ * split into records of 255, followed by the remainder.
+ *
+ * The threads first count the records each chunk needs, then one thread turns
+ * the counts into output offsets (an exclusive prefix sum, in input order),
+ * and the chunks' records are written straight into @zipped_chars, with no
+ * serial copy.
+ *
  * Outputs:
  * @zipped_chars:       The array of zipped_char structs
  * @zipped_chars_count:   The total count of inserted elements into the zippedChars array.
- * @char_frequency[26]: Total number of occurences
+ * @char_frequency[PZIP_ALPHABET]: Total number of occurences of each byte,
+ *			indexed by its unsigned value ('a' is char_frequency['a'])
  *
  * NOTE: All outputs are already allocated. DO NOT MALLOC or REASSIGN THEM !!!
  *
@@ -31,5 +91,114 @@ void pzip(int n_threads, char *input_chars, int input_chars_size,
 	  struct zipped_char *zipped_chars, int *zipped_chars_count,
 	  int *char_frequency);
 
+/**
+ * pzip_wide() - zip an array of characters in parallel, one record per run
+ *
+ * Same as pzip(), but writes zipped_char_wide records, so every run is a single
+ * record however long it is. @zipped_chars must have room for
+ * @input_chars_size records.
+ */
+void pzip_wide(int n_threads, char *input_chars, int input_chars_size,
+	       struct zipped_char_wide *zipped_chars, int *zipped_chars_count,
+	       int *char_frequency);
+
+/**
+ * A reusable pzip context: a pool of worker threads that is started once and
+ * used by every pzip_ctx_zip() and pzip_batch() call, so repeated calls do not
+ * create and join threads.
+ */
+struct pzip_ctx;
+
+/**
+ * pzip_ctx_create() - start a context with a pool of worker threads
+ *
+ * Inputs:
+ * @n_threads:		The number of worker threads, at least one
+ *
+ * Returns the new context, or NULL if the threads could not be started.
+ */
+struct pzip_ctx *pzip_ctx_create(int n_threads);
+
+/**
+ * pzip_ctx_threads() - the number of worker threads of a context
+ *
+ * A NULL @ctx has a single thread, the caller's.
+ */
+int pzip_ctx_threads(const struct pzip_ctx *ctx);
+
+/**
+ * pzip_ctx_zip() - zip an array of characters on the workers of a context
+ *
+ * Same as pzip() (or pzip_wide() if @wide is set), but the input is split
+ * across the workers of @ctx instead of new threads. If @ctx is NULL the
+ * input is zipped in the calling thread only, which is what a worker uses
+ * for a small file. Must not be called from two threads at once with the
+ * same @ctx.
+ */
+void pzip_ctx_zip(struct pzip_ctx *ctx, char *input_chars, int input_chars_size,
+		  void *zipped_chars, bool wide, int *zipped_chars_count,
+		  int *char_frequency);
+
+/**
+ * pzip_ctx_run() - run a function once on every worker of a context
+ *
+ * @fn gets @arg and the index of the worker, and pzip_ctx_run() returns once
+ * every worker is done. Workers may call pzip_ctx_zip() with a NULL context,
+ * but not with @ctx. A NULL @ctx runs @fn once, as worker 0, in the calling
+ * thread.
+ */
+void pzip_ctx_run(struct pzip_ctx *ctx, void (*fn)(void *arg, int worker),
+		  void *arg);
+
+/**
+ * pzip_ctx_destroy() - stop the workers of a context and free it
+ */
+void pzip_ctx_destroy(struct pzip_ctx *ctx);
+
+/**
+ * pzip_batch() - zip many files with one context
+ *
+ * Inputs:
+ * @ctx:		The context whose workers do the zipping
+ * @n_files:		The number of files
+ * @input_files:	The files to zip
+ * @output_files:	Where to write each zipped file, in binary format
+ * @wide:		Write zipped_char_wide records instead of zipped_char
+ *
+ * Files smaller than PZIP_BATCH_SPLIT_SIZE are zipped whole by one worker,
+ * several at a time. Larger files are then zipped one after another, each
+ * split across all the workers. Returns the number of files that could not
+ * be zipped; the reason is printed on stderr.
+ */
+#define PZIP_BATCH_SPLIT_SIZE (1 << 20)
+
+int pzip_batch(struct pzip_ctx *ctx, int n_files, char *const input_files[],
+	       char *const output_files[], bool wide);
+
+/**
+ * pzip_stream() - zip a file descriptor window by window
+ *
+ * Inputs:
+ * @ctx:		The context whose workers zip each window
+ * @input_fd:		Where to read the characters, e.g. a pipe
+ * @output_fd:		Where to append the binary output
+ * @window_size:	The number of characters zipped at a time
+ * @wide:		Write zipped_char_wide records instead of zipped_char
+ *
+ * Outputs:
+ * @char_frequency[PZIP_ALPHABET]: Total number of occurences, added to
+ *
+ * A reader thread fills one window while the other is zipped, so reading and
+ * zipping overlap. The last run of a window is held back and continued by
+ * the next window, so the output is the same as zipping the whole input at
+ * once. Memory use is about (2 + record size) * @window_size, whatever the
+ * input size. Wide runs longer than UINT32_MAX are split. Returns 0, or -1
+ * if the input could not be read or the output written (the reason is
+ * printed on stderr).
+ */
+#define PZIP_STREAM_WINDOW (16 << 20)
+
+int pzip_stream(struct pzip_ctx *ctx, int input_fd, int output_fd,
+		int window_size, bool wide, int64_t *char_frequency);
 
 #endif /* PZIP_H */
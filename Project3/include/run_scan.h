@@ -0,0 +1,46 @@
+#ifndef RUN_SCAN_H
+#define RUN_SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A run of one character, as found by scan_runs().
+ */
+struct run {
+	char character;
+	uint32_t length;
+};
+
+/**
+ * scan_runs() - split the start of a buffer into runs
+ *
+ * Inputs:
+ * @data:		The characters to scan
+ * @size:		The number of characters in @data
+ * @max_runs:		The maximum number of runs to store in @runs
+ *
+ * Outputs:
+ * @runs:		The runs found, in order
+ * @n_runs:		The number of runs stored in @runs
+ *
+ * Only runs that end inside @data are stored: the last run may continue
+ * past @size, so it is left to the caller. Returns the number of characters
+ * covered by the stored runs. If fewer than @max_runs runs were stored, the
+ * characters from there to @size are all the same (one open run).
+ *
+ * Run boundaries are found a block at a time by comparing the block with
+ * itself shifted by one character, using AVX2 (32-byte blocks) or SSE4.2
+ * (16-byte blocks) when the CPU supports them and a scalar loop otherwise.
+ * Setting the PZIP_SIMD environment variable to "avx2", "sse4.2" or
+ * "scalar" forces a kernel, as long as the CPU supports it.
+ */
+size_t scan_runs(const char *data, size_t size, struct run *runs,
+		 size_t max_runs, size_t *n_runs);
+
+/**
+ * scan_runs_kernel() - the name of the kernel scan_runs() uses
+ */
+const char *scan_runs_kernel(void);
+
+#endif /* RUN_SCAN_H */
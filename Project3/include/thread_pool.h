@@ -0,0 +1,50 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+/**
+ * A fixed set of worker threads that are started once and reused for every
+ * call to thread_pool_run().
+ */
+struct thread_pool;
+
+/**
+ * thread_pool_fn - work run by every worker of a pool
+ *
+ * @arg:		The argument passed to thread_pool_run()
+ * @worker:		The index of the worker, from 0 to the pool size - 1
+ */
+typedef void (*thread_pool_fn)(void *arg, int worker);
+
+/**
+ * thread_pool_create() - start a pool of worker threads
+ *
+ * Inputs:
+ * @n_workers:		The number of threads to start, at least one
+ *
+ * Returns the new pool, or NULL if the threads could not be started.
+ */
+struct thread_pool *thread_pool_create(int n_workers);
+
+/**
+ * thread_pool_run() - run a function on every worker and wait for all of them
+ *
+ * Inputs:
+ * @pool:		The pool to run on
+ * @fn:			The function every worker calls once
+ * @arg:		The argument passed to @fn
+ *
+ * Must not be called from a worker of @pool, or from two threads at once.
+ */
+void thread_pool_run(struct thread_pool *pool, thread_pool_fn fn, void *arg);
+
+/**
+ * thread_pool_size() - the number of workers in a pool
+ */
+int thread_pool_size(const struct thread_pool *pool);
+
+/**
+ * thread_pool_destroy() - stop and join the workers, then free the pool
+ */
+void thread_pool_destroy(struct thread_pool *pool);
+
+#endif /* THREAD_POOL_H */
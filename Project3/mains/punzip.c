@@ -0,0 +1,282 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "huffman.h"
+#include "punzip.h"
+#include "pzip.h"
+
+/*
+ * punzip INPUT_FILE OUTPUT_FILE N_THREADS [--wide | --huffman] [--range OFFSET LENGTH]
+ *
+ * Unzips a binary pzip output (zipped_char records, zipped_char_wide ones
+ * with --wide, or a pzip --huffman archive with --huffman) back into the
+ * original characters. With --range, only LENGTH characters starting at
+ * OFFSET are unzipped, using the block index INPUT_FILE.idx written by
+ * pzip --index if there is one.
+ */
+static void usage(void)
+{
+	printf("\tUsage: punzip INPUT_FILE OUTPUT_FILE N_THREADS [--wide | --huffman] [--range OFFSET LENGTH]\n");
+	exit(EXIT_FAILURE);
+}
+
+/* Writes a whole buffer to OUTPUT_FILE */
+static void write_output(const char *output_file, const char *chars,
+			 size_t size)
+{
+	FILE *output_fd = fopen(output_file, "wb");
+
+	if (output_fd == NULL) {
+		perror("Error opening the output file");
+		exit(EXIT_FAILURE);
+	}
+	if (fwrite(chars, 1, size, output_fd) != size) {
+		perror("Error writing the output file");
+		exit(EXIT_FAILURE);
+	}
+	if (fclose(output_fd) != 0) {
+		perror("Error closing the output file");
+		exit(EXIT_FAILURE);
+	}
+}
+
+/* Parses a whole decimal number into @value, returning -1 if it is not one */
+static int parse_u64(const char *text, uint64_t *value)
+{
+	char *end;
+
+	/* strtoull() would quietly negate a minus sign */
+	if (text[0] == '-')
+		return -1;
+
+	errno = 0;
+	*value = strtoull(text, &end, 10);
+	if (end == text || *end != '\0' || errno != 0)
+		return -1;
+
+	return 0;
+}
+
+/* Unzips a range, seeking with the index next to the archive if there is one */
+static void unzip_range(const char *input_file, const char *output_file,
+			const void *records, size_t n_records, bool wide,
+			uint64_t offset, uint64_t length)
+{
+	char *index_file = punzip_index_path(input_file);
+	struct pzip_index *index;
+
+	if (index_file == NULL) {
+		perror("Error loading the index");
+		exit(EXIT_FAILURE);
+	}
+
+	index = punzip_index_load(index_file);
+	if (index == NULL && errno != ENOENT) {
+		fprintf(stderr, "Error loading the index %s: %s\n", index_file,
+			strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+	/* An index of another archive, or a stale one, would unzip the wrong characters */
+	if (index != NULL &&
+	    punzip_index_check(index, records, n_records, wide) < 0) {
+		fprintf(stderr, "Error: %s does not match %s\n", index_file,
+			input_file);
+		exit(EXIT_FAILURE);
+	}
+	free(index_file);
+
+	/* Without an index, the records are read from the start anyway */
+	uint64_t size = index != NULL ? index->size :
+		punzip_size(NULL, records, n_records, wide);
+
+	/* Only the characters that exist are unzipped */
+	if (offset >= size)
+		length = 0;
+	else if (length > size - offset)
+		length = size - offset;
+
+	if (length > SIZE_MAX - 1) {
+		errno = ENOMEM;
+		perror("Error allocating the output");
+		exit(EXIT_FAILURE);
+	}
+
+	char *chars = malloc(length + 1);
+
+	if (chars == NULL) {
+		perror("Error allocating the output");
+		exit(EXIT_FAILURE);
+	}
+
+	size_t written = punzip_range(records, n_records, wide, index, offset,
+				      length, chars);
+
+	write_output(output_file, chars, written);
+	free(chars);
+	free(index);
+}
+
+/* Unzips everything straight into the mmap()ed output file */
+static void unzip_all(const char *output_file, const void *records,
+		      size_t n_records, bool wide, int n_threads)
+{
+	struct pzip_ctx *ctx = pzip_ctx_create(n_threads);
+
+	if (ctx == NULL) {
+		printf("Error: Failed to start %d threads\n", n_threads);
+		exit(EXIT_FAILURE);
+	}
+
+	uint64_t size = punzip_size(ctx, records, n_records, wide);
+	int output_fd = open(output_file, O_RDWR | O_CREAT | O_TRUNC,
+			     (mode_t)0600);
+
+	if (output_fd < 0) {
+		perror("Error opening the output file");
+		exit(EXIT_FAILURE);
+	}
+
+	/* mmap() cannot map an empty file, and there is nothing to write */
+	if (size > 0) {
+		if (ftruncate(output_fd, size) < 0) {
+			perror("File operation error");
+			exit(EXIT_FAILURE);
+		}
+
+		char *chars = mmap(NULL, size, PROT_READ | PROT_WRITE,
+				   MAP_SHARED, output_fd, 0);
+
+		if (chars == MAP_FAILED) {
+			perror("Error mmapping the output file");
+			exit(EXIT_FAILURE);
+		}
+
+		punzip(ctx, records, n_records, wide, chars);
+		munmap(chars, size);
+	}
+
+	close(output_fd);
+	pzip_ctx_destroy(ctx);
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 4) {
+		printf("Error: Missing number of arguments!!\n");
+		usage();
+	}
+
+	const char *input_file = argv[1];
+	const char *output_file = argv[2];
+	int n_threads = atoi(argv[3]);
+
+	if (n_threads < 1) {
+		printf("Error: Invalid input for n_threads\n");
+		exit(EXIT_FAILURE);
+	}
+
+	bool wide = false;
+	bool huffman = false;
+	bool range = false;
+	uint64_t offset = 0;
+	uint64_t length = 0;
+
+	for (int i = 4; i < argc; i++) {
+		if (!strcmp(argv[i], "--wide")) {
+			wide = true;
+		} else if (!strcmp(argv[i], "--huffman")) {
+			huffman = true;
+		} else if (!strcmp(argv[i], "--range") && i + 2 < argc) {
+			range = true;
+			if (parse_u64(argv[i + 1], &offset) < 0 ||
+			    parse_u64(argv[i + 2], &length) < 0) {
+				printf("Error: Invalid --range %s %s\n", argv[i + 1],
+				       argv[i + 2]);
+				usage();
+			}
+			i += 2;
+		} else {
+			printf("Error: Unknown option %s\n", argv[i]);
+			usage();
+		}
+	}
+
+	if (wide && huffman) {
+		printf("Error: --huffman archives hold narrow records\n");
+		usage();
+	}
+
+	/* open & mmap() the archive and find the number of records */
+	int input_fd = open(input_file, O_RDONLY);
+
+	if (input_fd < 0) {
+		perror("Error opening input file");
+		exit(EXIT_FAILURE);
+	}
+
+	struct stat statbuf;
+
+	if (fstat(input_fd, &statbuf) < 0) {
+		perror("Error reading input file size");
+		exit(EXIT_FAILURE);
+	}
+
+	size_t input_size = statbuf.st_size;
+
+	if (!huffman && input_size % zipped_record_size(wide) != 0) {
+		printf("Error: %s is not a whole number of %s records\n",
+		       input_file, wide ? "wide" : "narrow");
+		exit(EXIT_FAILURE);
+	}
+
+	size_t n_records = input_size / zipped_record_size(wide);
+	void *records = NULL;
+
+	if (input_size > 0) {
+		records = mmap(NULL, input_size, PROT_READ, MAP_SHARED,
+			       input_fd, 0);
+		if (records == MAP_FAILED) {
+			perror("Error mmapping the input file");
+			exit(EXIT_FAILURE);
+		}
+	}
+	close(input_fd);
+
+	/* A Huffman archive is decoded into narrow records first */
+	struct zipped_char *decoded = NULL;
+
+	if (huffman) {
+		struct pzip_ctx *ctx = pzip_ctx_create(n_threads);
+
+		if (ctx == NULL ||
+		    huffman_decode(ctx, records, input_size, &decoded,
+				   &n_records) < 0) {
+			perror("Error decoding the Huffman archive");
+			exit(EXIT_FAILURE);
+		}
+		pzip_ctx_destroy(ctx);
+		if (input_size > 0)
+			munmap(records, input_size);
+		records = decoded;
+		input_size = 0;
+	}
+
+	if (range)
+		unzip_range(input_file, output_file, records, n_records, wide,
+			    offset, length);
+	else
+		unzip_all(output_file, records, n_records, wide, n_threads);
+
+	if (input_size > 0)
+		munmap(records, input_size);
+	free(decoded);
+
+	return 0;
+}
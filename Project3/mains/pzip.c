@@ -1,4 +1,6 @@
+#include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -8,13 +10,315 @@
 #include <unistd.h>
 
 #include "common.h"
+#include "huffman.h"
+#include "punzip.h"
 #include "pzip.h"
 
+/*
+ * pzip --batch LIST_FILE N_THREADS [--wide]
+ *
+ * LIST_FILE has one "INPUT_FILE OUTPUT_FILE" pair per line ("-" reads the
+ * list from stdin). Every file is zipped in binary format by one pool of
+ * N_THREADS threads, in a single process.
+ */
+static int batch_main(int argc, char *argv[])
+{
+	if (argc < 4) {
+		printf("Error: Missing number of arguments!!\n");
+		printf("\tUsage: pzip --batch LIST_FILE N_THREADS [--wide]\n");
+		exit(EXIT_FAILURE);
+	}
+
+	const char *list_file = argv[2];
+	int n_threads = atoi(argv[3]);
+	int wide = 0;
+
+	if (n_threads < 1) {
+		printf("Error: Invalid input for n_threads\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (int i = 4; i < argc; i++) {
+		if (!strcmp(argv[i], "--wide")) {
+			wide = 1;
+		} else {
+			printf("Error: Unknown option %s\n", argv[i]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	FILE *list = strcmp(list_file, "-") ? fopen(list_file, "r") : stdin;
+
+	if (list == NULL) {
+		perror("Error opening the list file");
+		exit(EXIT_FAILURE);
+	}
+
+	char **input_files = NULL;
+	char **output_files = NULL;
+	int n_files = 0;
+	int capacity = 0;
+	char *line = NULL;
+	size_t line_size = 0;
+	int line_number = 0;
+
+	while (getline(&line, &line_size, list) >= 0) {
+		char *save;
+		char *input = strtok_r(line, " \t\r\n", &save);
+		char *output = strtok_r(NULL, " \t\r\n", &save);
+
+		line_number++;
+		/* Blank lines are skipped */
+		if (input == NULL)
+			continue;
+		if (output == NULL || strtok_r(NULL, " \t\r\n", &save) != NULL) {
+			printf("Error: %s:%d: expected INPUT_FILE OUTPUT_FILE\n",
+			       list_file, line_number);
+			exit(EXIT_FAILURE);
+		}
+
+		if (n_files == capacity) {
+			capacity = capacity ? 2 * capacity : 64;
+			input_files = realloc(input_files,
+					      capacity * sizeof(char *));
+			output_files = realloc(output_files,
+					       capacity * sizeof(char *));
+			if (input_files == NULL || output_files == NULL) {
+				perror("Error reading the list file");
+				exit(EXIT_FAILURE);
+			}
+		}
+
+		input_files[n_files] = strdup(input);
+		output_files[n_files] = strdup(output);
+		if (input_files[n_files] == NULL ||
+		    output_files[n_files] == NULL) {
+			perror("Error reading the list file");
+			exit(EXIT_FAILURE);
+		}
+		n_files++;
+	}
+	free(line);
+	if (list != stdin)
+		fclose(list);
+
+	struct pzip_ctx *ctx = pzip_ctx_create(n_threads);
+
+	if (ctx == NULL) {
+		printf("Error: Failed to start %d threads\n", n_threads);
+		exit(EXIT_FAILURE);
+	}
+
+	int failures = pzip_batch(ctx, n_files, input_files, output_files,
+				  wide);
+
+	pzip_ctx_destroy(ctx);
+	for (int i = 0; i < n_files; i++) {
+		free(input_files[i]);
+		free(output_files[i]);
+	}
+	free(input_files);
+	free(output_files);
+
+	if (failures > 0) {
+		printf("Error: %d of %d files could not be zipped\n", failures,
+		       n_files);
+		return EXIT_FAILURE;
+	}
+
+	return 0;
+}
+
+/*
+ * pzip INPUT_FILE OUTPUT_FILE N_THREADS --stream [--wide]
+ *
+ * Reads INPUT_FILE ("-" for stdin) a window at a time and appends the binary
+ * output to OUTPUT_FILE ("-" for stdout), so neither has to fit in memory.
+ * The window size is PZIP_STREAM_WINDOW, or PZIP_WINDOW bytes if set.
+ */
+static int stream_main(const char *input_file, const char *output_file,
+		       int n_threads, int wide)
+{
+	int window_size = PZIP_STREAM_WINDOW;
+	const char *window_env = getenv("PZIP_WINDOW");
+
+	if (window_env != NULL) {
+		window_size = atoi(window_env);
+		if (window_size < 1) {
+			printf("Error: Invalid PZIP_WINDOW %s\n", window_env);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	int input_fd = strcmp(input_file, "-") ? open(input_file, O_RDONLY) :
+						 STDIN_FILENO;
+
+	if (input_fd < 0) {
+		perror("Error opening input file");
+		exit(EXIT_FAILURE);
+	}
+
+	int output_fd = strcmp(output_file, "-") ?
+				open(output_file, O_WRONLY | O_CREAT | O_TRUNC,
+				     (mode_t)0600) :
+				STDOUT_FILENO;
+
+	if (output_fd < 0) {
+		perror("Error opening the output file");
+		exit(EXIT_FAILURE);
+	}
+
+	struct pzip_ctx *ctx = pzip_ctx_create(n_threads);
+	int64_t char_frequency[PZIP_ALPHABET] = { 0 };
+
+	if (ctx == NULL) {
+		printf("Error: Failed to start %d threads\n", n_threads);
+		exit(EXIT_FAILURE);
+	}
+
+	int ret = pzip_stream(ctx, input_fd, output_fd, window_size, wide,
+			      char_frequency);
+
+	pzip_ctx_destroy(ctx);
+	if (input_fd != STDIN_FILENO)
+		close(input_fd);
+	if (output_fd != STDOUT_FILENO && close(output_fd) < 0) {
+		perror("Error closing the output file");
+		ret = -1;
+	}
+
+	return ret < 0 ? EXIT_FAILURE : 0;
+}
+
+/*
+ * pzip INPUT_FILE OUTPUT_FILE N_THREADS --huffman
+ *
+ * Zips INPUT_FILE, then Huffman-codes the records block by block (see
+ * include/huffman.h) into OUTPUT_FILE. punzip --huffman reverses it.
+ */
+static int huffman_main(const char *input_file, const char *output_file,
+			int n_threads)
+{
+	int input_fd = open(input_file, O_RDONLY);
+	struct stat statbuf;
+
+	if (input_fd < 0) {
+		perror("Error opening input file");
+		exit(EXIT_FAILURE);
+	}
+	if (fstat(input_fd, &statbuf) < 0) {
+		perror("Error reading input file size");
+		exit(EXIT_FAILURE);
+	}
+
+	/* pzip_ctx_zip() counts characters and records in an int */
+	if (statbuf.st_size > INT_MAX) {
+		errno = EFBIG;
+		perror("Error with input file size");
+		exit(EXIT_FAILURE);
+	}
+
+	int input_chars_size = statbuf.st_size;
+	char *input_chars = NULL;
+
+	/* mmap() cannot map an empty file, and there is nothing to read */
+	if (input_chars_size > 0) {
+		input_chars = mmap(NULL, input_chars_size, PROT_READ,
+				   MAP_SHARED, input_fd, 0);
+		if (input_chars == MAP_FAILED) {
+			perror("Error mmapping the input file");
+			exit(EXIT_FAILURE);
+		}
+	}
+	close(input_fd);
+
+	struct pzip_ctx *ctx = pzip_ctx_create(n_threads);
+
+	if (ctx == NULL) {
+		printf("Error: Failed to start %d threads\n", n_threads);
+		exit(EXIT_FAILURE);
+	}
+
+	struct zipped_char *zipped_chars =
+		malloc((size_t)input_chars_size * sizeof(struct zipped_char) + 1);
+	int zipped_chars_count = 0;
+	int char_frequency[PZIP_ALPHABET] = { 0 };
+
+	if (zipped_chars == NULL) {
+		perror("Error allocating the zipped records");
+		exit(EXIT_FAILURE);
+	}
+
+	pzip_ctx_zip(ctx, input_chars, input_chars_size, zipped_chars, false,
+		     &zipped_chars_count, char_frequency);
+
+	void *archive;
+	size_t archive_size;
+
+	if (huffman_encode(ctx, zipped_chars, zipped_chars_count, &archive,
+			   &archive_size) < 0) {
+		printf("Error: Failed to allocate the Huffman output\n");
+		exit(EXIT_FAILURE);
+	}
+
+	FILE *output_fd = fopen(output_file, "wb");
+
+	if (output_fd == NULL) {
+		perror("Error opening the output file");
+		exit(EXIT_FAILURE);
+	}
+	if (fwrite(archive, 1, archive_size, output_fd) != archive_size ||
+	    fclose(output_fd) != 0) {
+		perror("Error writing the output file");
+		exit(EXIT_FAILURE);
+	}
+
+	free(archive);
+	free(zipped_chars);
+	pzip_ctx_destroy(ctx);
+	if (input_chars_size > 0)
+		munmap(input_chars, input_chars_size);
+
+	return 0;
+}
+
+/* Writes the block index of the output next to it, as OUTPUT_FILE.idx */
+static void write_index(const char *output_file, const void *zipped_chars,
+			int zipped_chars_count, int wide, int n_threads)
+{
+	struct pzip_ctx *ctx = pzip_ctx_create(n_threads);
+	char *index_file = punzip_index_path(output_file);
+
+	if (ctx == NULL || index_file == NULL) {
+		printf("Error: Failed to build the index\n");
+		exit(EXIT_FAILURE);
+	}
+
+	struct pzip_index *index = punzip_index_build(ctx, zipped_chars,
+						      zipped_chars_count, wide,
+						      PZIP_INDEX_BLOCK);
+
+	if (index == NULL || punzip_index_save(index, index_file) < 0) {
+		perror("Error writing the index");
+		exit(EXIT_FAILURE);
+	}
+
+	free(index);
+	free(index_file);
+	pzip_ctx_destroy(ctx);
+}
+
 int main(int argc, char *argv[])
 {
+	if (argc >= 2 && !strcmp(argv[1], "--batch"))
+		return batch_main(argc, argv);
+
 	if (argc < 4) {
 		printf("Error: Missing number of arguments!!\n");
-		printf("\tUsage: pzip INPUT_FILE OUTPUT_FILE N_THREADS [--debug]\n");
+		printf("\tUsage: pzip INPUT_FILE OUTPUT_FILE N_THREADS [--debug] [--wide] [--index]\n");
+		printf("\t       pzip INPUT_FILE OUTPUT_FILE N_THREADS --stream [--wide]\n");
+		printf("\t       pzip INPUT_FILE OUTPUT_FILE N_THREADS --huffman\n");
+		printf("\t       pzip --batch LIST_FILE N_THREADS [--wide]\n");
 		exit(EXIT_FAILURE);
 	}
 
@@ -28,15 +332,61 @@ int main(int argc, char *argv[])
 	}
 
 	int debug = 0;
+	int wide = 0;
+	int stream = 0;
+	int index = 0;
+	int huffman = 0;
+
+	for (int i = 4; i < argc; i++) {
+		if (!strcmp(argv[i], "--debug")) {
+			debug = 1;
+		} else if (!strcmp(argv[i], "--wide")) {
+			wide = 1;
+		} else if (!strcmp(argv[i], "--stream")) {
+			stream = 1;
+		} else if (!strcmp(argv[i], "--index")) {
+			index = 1;
+		} else if (!strcmp(argv[i], "--huffman")) {
+			huffman = 1;
+		} else {
+			printf("Error: Unknown option %s\n", argv[i]);
+			exit(EXIT_FAILURE);
+		}
+	}
 
-	if (argc > 4 && !strcmp(argv[4], "--debug"))
-		debug = 1;
+	/* The block index points into the binary output */
+	if (index && (debug || stream)) {
+		printf("Error: --index cannot be combined with --debug or --stream\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* The Huffman stage codes narrow records into its own format */
+	if (huffman) {
+		if (debug || wide || stream || index) {
+			printf("Error: --huffman cannot be combined with other options\n");
+			exit(EXIT_FAILURE);
+		}
+		return huffman_main(input_file, output_file, n_threads);
+	}
+
+	if (stream) {
+		/* The text output needs every record in memory */
+		if (debug) {
+			printf("Error: --stream cannot be combined with --debug\n");
+			exit(EXIT_FAILURE);
+		}
+		return stream_main(input_file, output_file, n_threads, wide);
+	}
+
+	/* --wide writes one 5-byte record per run instead of 2-byte records */
+	size_t record_size = wide ? sizeof(struct zipped_char_wide) :
+				    sizeof(struct zipped_char);
 
 	char *input_chars;
 	int input_chars_size;
-	struct zipped_char *zipped_chars;
+	void *zipped_chars;
 	int zipped_chars_count = 0;
-	int char_frequency[26] = { 0 };
+	int char_frequency[PZIP_ALPHABET] = { 0 };
 
 	/* open & mmap() input file and find the number of characters */
 	int input_fd = open(input_file, O_RDONLY);
@@ -47,29 +397,36 @@ int main(int argc, char *argv[])
 	}
 	struct stat statbuf;
 
-	fstat(input_fd, &statbuf);
-	input_chars_size = statbuf.st_size;
-	size_t map_size = input_chars_size * sizeof(char);
-
-	input_chars = mmap(NULL, map_size, PROT_READ, MAP_SHARED, input_fd, 0);
-	if (input_chars == MAP_FAILED) {
-		close(input_fd);
-		perror("Error mmapping the input file");
+	if (fstat(input_fd, &statbuf) < 0) {
+		perror("Error reading input file size");
 		exit(EXIT_FAILURE);
 	}
-	close(input_fd);
 
-	/* Check input size */
-	if (input_chars_size / n_threads < 1 ||
-	    input_chars_size % n_threads != 0) {
-		printf("Error: Number of characters in the input file should be a product of n_threads and a positive integer\n");
-		printf("- n_threads: %d\n", n_threads);
-		printf("- inputSize: %d\n", input_chars_size);
+	/* pzip() counts characters and records in an int */
+	if (statbuf.st_size > INT_MAX) {
+		errno = EFBIG;
+		perror("Error with input file size");
 		exit(EXIT_FAILURE);
 	}
 
+	input_chars_size = statbuf.st_size;
+	size_t map_size = input_chars_size * sizeof(char);
+
+	/* mmap() cannot map an empty file, and there is nothing to read */
+	input_chars = NULL;
+	if (map_size > 0) {
+		input_chars = mmap(NULL, map_size, PROT_READ, MAP_SHARED,
+				   input_fd, 0);
+		if (input_chars == MAP_FAILED) {
+			close(input_fd);
+			perror("Error mmapping the input file");
+			exit(EXIT_FAILURE);
+		}
+	}
+	close(input_fd);
+
 	/* mmap() output file */
-	int max_output_size = input_chars_size * sizeof(struct zipped_char);
+	size_t max_output_size = (size_t)input_chars_size * record_size;
 	int output_fd;
 
 	if (!debug) {
@@ -100,14 +457,21 @@ int main(int argc, char *argv[])
 		zipped_chars = malloc(max_output_size);
 	}
 
-	/* Call student's function */
-	pzip(n_threads, input_chars, input_chars_size, zipped_chars,
-	     &zipped_chars_count, char_frequency);
+	if (wide)
+		pzip_wide(n_threads, input_chars, input_chars_size,
+			  zipped_chars, &zipped_chars_count, char_frequency);
+	else
+		pzip(n_threads, input_chars, input_chars_size, zipped_chars,
+		     &zipped_chars_count, char_frequency);
+
+	if (index)
+		write_index(output_file, zipped_chars, zipped_chars_count, wide,
+			    n_threads);
 
 	if (!debug) {
 		/* Truncate the file size back to the compressed size */
 		if (ftruncate(output_fd,
-			      zipped_chars_count * sizeof(struct zipped_char)) <
+			      zipped_chars_count * record_size) <
 		    0) {
 			close(output_fd);
 			perror("ftruncate error");
@@ -124,10 +488,19 @@ int main(int argc, char *argv[])
 		}
 
 		for (int i = 0; i < zipped_chars_count; i++) {
-			struct zipped_char temp = zipped_chars[i];
+			if (wide) {
+				struct zipped_char_wide temp =
+					((struct zipped_char_wide *)zipped_chars)[i];
 
-			fprintf(output_fd, "%c %d\n", temp.character,
-				temp.occurence);
+				fprintf(output_fd, "%c %u\n", temp.character,
+					temp.occurence);
+			} else {
+				struct zipped_char temp =
+					((struct zipped_char *)zipped_chars)[i];
+
+				fprintf(output_fd, "%c %d\n", temp.character,
+					temp.occurence);
+			}
 		}
 		fclose(output_fd);
 		free(zipped_chars);
@@ -140,8 +513,13 @@ int main(int argc, char *argv[])
 		printf("- inputSize: %d\n", input_chars_size);
 		printf("- zipped_chars_count: %d\n", zipped_chars_count);
 		printf("- char_frequency: ");
-		for (int i = 0; i < ARRAY_SIZE(char_frequency); i++)
-			printf("[%c,%d]", i + 97, char_frequency[i]);
+		for (int i = 'a'; i <= 'z'; i++)
+			printf("[%c,%d]", i, char_frequency[i]);
+		/* Other bytes are only listed if they occur */
+		for (int i = 0; i < ARRAY_SIZE(char_frequency); i++) {
+			if ((i < 'a' || i > 'z') && char_frequency[i] > 0)
+				printf("[0x%02x,%d]", i, char_frequency[i]);
+		}
 
 		printf("\n");
 		printf("- pzip output is written into the output file in plain text, type cat %s to display.\n",
@@ -0,0 +1,500 @@
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "huffman.h"
+
+// Worst case bytes of a coded block: two codes of HUFFMAN_MAX_BITS per record, plus padding
+#define BLOCK_BOUND(n_records) ((n_records) * (2 * HUFFMAN_MAX_BITS) / 8 + 1)
+
+struct code_table {
+	uint8_t bits[256];
+	uint16_t code[256];
+};
+
+// Canonical decoding tables: symbols sorted by code length, and how many there are per length
+struct decoder {
+	uint16_t count[HUFFMAN_MAX_BITS + 1];
+	uint8_t symbol[256];
+};
+
+struct bit_writer {
+	uint8_t *p;
+	uint64_t acc;
+	int bits;
+};
+
+struct bit_reader {
+	const uint8_t *p;
+	const uint8_t *end;
+	int bits;
+	// Set when a code runs past the end of the block
+	bool overrun;
+};
+
+// The state shared by the workers of one huffman_encode() or huffman_decode() call
+struct HuffmanJob {
+	struct zipped_char *records;
+	size_t n_records;
+	size_t n_blocks;
+	int n_workers;
+	atomic_size_t next_block;
+	atomic_bool failed;
+
+	// Encoding: symbol counts per worker, then the code tables
+	uint64_t (*character_counts)[256];
+	uint64_t (*occurence_counts)[256];
+	struct code_table characters;
+	struct code_table occurences;
+
+	// Coded blocks, their sizes and where they go in the archive
+	uint8_t **blocks;
+	uint64_t *block_sizes;
+	uint64_t *block_offsets;
+	uint8_t *payload;
+
+	// Decoding
+	const uint8_t *coded;
+	struct decoder character_decoder;
+	struct decoder occurence_decoder;
+};
+
+// Code lengths of a Huffman tree for @freq, returning the longest. Picks the two lightest
+// nodes by scanning, which is plenty for 256 symbols; ties go to the lowest node, so the
+// same counts always give the same codes.
+static int tree_bits(const uint64_t freq[256], uint8_t bits[256])
+{
+	uint64_t weight[511];
+	int parent[511];
+	bool alive[511] = { false };
+	int n_symbols = 0;
+	int last = 0;
+	int max_bits = 0;
+
+	memset(bits, 0, 256);
+	for (int s = 0; s < 256; s++) {
+		weight[s] = freq[s];
+		if (freq[s] > 0) {
+			alive[s] = true;
+			last = s;
+			n_symbols++;
+		}
+	}
+
+	// A lone symbol still needs one bit
+	if (n_symbols == 1) {
+		bits[last] = 1;
+		return 1;
+	}
+
+	int next = 256;
+
+	for (int merge = 1; merge < n_symbols; merge++, next++) {
+		int a = -1;
+		int b = -1;
+
+		for (int x = 0; x < next; x++) {
+			if (!alive[x])
+				continue;
+			if (a < 0 || weight[x] < weight[a]) {
+				b = a;
+				a = x;
+			} else if (b < 0 || weight[x] < weight[b]) {
+				b = x;
+			}
+		}
+
+		weight[next] = weight[a] + weight[b];
+		parent[a] = parent[b] = next;
+		alive[a] = alive[b] = false;
+		alive[next] = true;
+	}
+
+	for (int s = 0; s < 256; s++) {
+		if (freq[s] == 0)
+			continue;
+
+		int depth = 0;
+
+		for (int x = s; x != next - 1; x = parent[x])
+			depth++;
+		bits[s] = depth;
+		if (depth > max_bits)
+			max_bits = depth;
+	}
+
+	return max_bits;
+}
+
+// Builds a canonical code for @freq, no longer than HUFFMAN_MAX_BITS
+static void build_table(const uint64_t freq_in[256], struct code_table *table)
+{
+	uint64_t freq[256];
+	int count[HUFFMAN_MAX_BITS + 1] = { 0 };
+	uint16_t next_code[HUFFMAN_MAX_BITS + 1];
+	uint16_t code = 0;
+
+	memcpy(freq, freq_in, sizeof(freq));
+
+	// Halving the counts (keeping every used symbol) flattens the tree until it fits
+	while (tree_bits(freq, table->bits) > HUFFMAN_MAX_BITS) {
+		for (int s = 0; s < 256; s++) {
+			if (freq[s] > 0)
+				freq[s] = (freq[s] >> 1) | 1;
+		}
+	}
+
+	for (int s = 0; s < 256; s++)
+		count[table->bits[s]]++;
+	count[0] = 0;
+
+	for (int len = 1; len <= HUFFMAN_MAX_BITS; len++) {
+		code = (code + count[len - 1]) << 1;
+		next_code[len] = code;
+	}
+
+	for (int s = 0; s < 256; s++) {
+		if (table->bits[s] > 0)
+			table->code[s] = next_code[table->bits[s]]++;
+	}
+}
+
+// Returns -1 if the code lengths do not form a prefix code
+static int build_decoder(const uint8_t bits[256], struct decoder *decoder)
+{
+	uint16_t offset[HUFFMAN_MAX_BITS + 2];
+	int left = 1;
+
+	memset(decoder->count, 0, sizeof(decoder->count));
+	for (int s = 0; s < 256; s++) {
+		if (bits[s] > HUFFMAN_MAX_BITS)
+			return -1;
+		decoder->count[bits[s]]++;
+	}
+	decoder->count[0] = 0;
+
+	for (int len = 1; len <= HUFFMAN_MAX_BITS; len++) {
+		left = (left << 1) - decoder->count[len];
+		if (left < 0)
+			return -1;
+	}
+
+	offset[1] = 0;
+	for (int len = 1; len <= HUFFMAN_MAX_BITS; len++)
+		offset[len + 1] = offset[len] + decoder->count[len];
+
+	for (int s = 0; s < 256; s++) {
+		if (bits[s] > 0)
+			decoder->symbol[offset[bits[s]]++] = s;
+	}
+
+	return 0;
+}
+
+static inline void put_bits(struct bit_writer *writer, uint16_t code, int bits)
+{
+	writer->acc = (writer->acc << bits) | code;
+	writer->bits += bits;
+	while (writer->bits >= 8) {
+		writer->bits -= 8;
+		*writer->p++ = writer->acc >> writer->bits;
+	}
+}
+
+static inline int get_bit(struct bit_reader *reader)
+{
+	if (reader->p == reader->end) {
+		reader->overrun = true;
+		return 0;
+	}
+
+	int bit = (*reader->p >> (7 - reader->bits)) & 1;
+
+	if (++reader->bits == 8) {
+		reader->bits = 0;
+		reader->p++;
+	}
+
+	return bit;
+}
+
+// Canonical decoding, one bit at a time: codes of each length are consecutive numbers
+static inline int get_symbol(struct bit_reader *reader, const struct decoder *decoder)
+{
+	int code = 0;
+	int first = 0;
+	int index = 0;
+
+	for (int len = 1; len <= HUFFMAN_MAX_BITS; len++) {
+		code |= get_bit(reader);
+
+		int count = decoder->count[len];
+
+		if (code - first < count)
+			return decoder->symbol[index + code - first];
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+
+	return -1;
+}
+
+// Records of block @b
+static size_t block_records(const struct HuffmanJob *job, size_t b, size_t *first)
+{
+	*first = b * HUFFMAN_BLOCK_RECORDS;
+	return job->n_records - *first < HUFFMAN_BLOCK_RECORDS ?
+		       job->n_records - *first : HUFFMAN_BLOCK_RECORDS;
+}
+
+// Pass 1 of encoding: each worker counts the symbols of an equal share of the records
+static void count_worker(void *arg, int worker)
+{
+	struct HuffmanJob *job = arg;
+	size_t first = job->n_records * worker / job->n_workers;
+	size_t end = job->n_records * (worker + 1) / job->n_workers;
+	uint64_t *characters = job->character_counts[worker];
+	uint64_t *occurences = job->occurence_counts[worker];
+
+	memset(characters, 0, 256 * sizeof(uint64_t));
+	memset(occurences, 0, 256 * sizeof(uint64_t));
+	for (size_t r = first; r < end; r++) {
+		characters[(unsigned char)job->records[r].character]++;
+		occurences[job->records[r].occurence]++;
+	}
+}
+
+// Pass 2 of encoding: workers claim blocks and code each into its own buffer
+static void encode_worker(void *arg, int worker)
+{
+	struct HuffmanJob *job = arg;
+	size_t b;
+
+	while ((b = atomic_fetch_add(&job->next_block, 1)) < job->n_blocks) {
+		size_t first;
+		size_t n = block_records(job, b, &first);
+		uint8_t *block = malloc(BLOCK_BOUND(n));
+		struct bit_writer writer = { block, 0, 0 };
+
+		job->blocks[b] = block;
+		if (block == NULL) {
+			atomic_store(&job->failed, true);
+			continue;
+		}
+
+		for (size_t r = first; r < first + n; r++) {
+			unsigned char c = job->records[r].character;
+			uint8_t o = job->records[r].occurence;
+
+			put_bits(&writer, job->characters.code[c], job->characters.bits[c]);
+			put_bits(&writer, job->occurences.code[o], job->occurences.bits[o]);
+		}
+		if (writer.bits > 0)
+			*writer.p++ = writer.acc << (8 - writer.bits);
+
+		job->block_sizes[b] = writer.p - block;
+	}
+}
+
+// Pass 3 of encoding: workers claim blocks again and copy them to their place in the archive
+static void copy_worker(void *arg, int worker)
+{
+	struct HuffmanJob *job = arg;
+	size_t b;
+
+	while ((b = atomic_fetch_add(&job->next_block, 1)) < job->n_blocks) {
+		memcpy(job->payload + job->block_offsets[b], job->blocks[b], job->block_sizes[b]);
+		free(job->blocks[b]);
+	}
+}
+
+static void free_job(struct HuffmanJob *job)
+{
+	free(job->character_counts);
+	free(job->occurence_counts);
+	free(job->blocks);
+	free(job->block_sizes);
+	free(job->block_offsets);
+}
+
+int huffman_encode(struct pzip_ctx *ctx, const struct zipped_char *records,
+		   size_t n_records, void **archive, size_t *archive_size)
+{
+	struct HuffmanJob job = {
+		.records = (struct zipped_char *)records,
+		.n_records = n_records,
+		.n_blocks = (n_records + HUFFMAN_BLOCK_RECORDS - 1) / HUFFMAN_BLOCK_RECORDS,
+		.n_workers = pzip_ctx_threads(ctx),
+	};
+
+	job.character_counts = malloc(job.n_workers * sizeof(*job.character_counts));
+	job.occurence_counts = malloc(job.n_workers * sizeof(*job.occurence_counts));
+	job.blocks = calloc(job.n_blocks + 1, sizeof(*job.blocks));
+	job.block_sizes = calloc(job.n_blocks + 1, sizeof(*job.block_sizes));
+	job.block_offsets = calloc(job.n_blocks + 1, sizeof(*job.block_offsets));
+	if (job.character_counts == NULL || job.occurence_counts == NULL || job.blocks == NULL ||
+	    job.block_sizes == NULL || job.block_offsets == NULL) {
+		free_job(&job);
+		return -1;
+	}
+
+	pzip_ctx_run(ctx, count_worker, &job);
+
+	// Merge the workers' counts into the two code tables
+	uint64_t characters[256] = { 0 };
+	uint64_t occurences[256] = { 0 };
+
+	for (int w = 0; w < job.n_workers; w++) {
+		for (int s = 0; s < 256; s++) {
+			characters[s] += job.character_counts[w][s];
+			occurences[s] += job.occurence_counts[w][s];
+		}
+	}
+	build_table(characters, &job.characters);
+	build_table(occurences, &job.occurences);
+
+	atomic_init(&job.next_block, 0);
+	atomic_init(&job.failed, false);
+	pzip_ctx_run(ctx, encode_worker, &job);
+
+	// Exclusive prefix sum of the block sizes gives every block its offset
+	uint64_t payload_size = 0;
+
+	for (size_t b = 0; b < job.n_blocks; b++) {
+		job.block_offsets[b] = payload_size;
+		payload_size += job.block_sizes[b];
+	}
+
+	size_t header_size = sizeof(struct huffman_header) + job.n_blocks * sizeof(uint64_t);
+	uint8_t *out = atomic_load(&job.failed) ? NULL : malloc(header_size + payload_size);
+
+	if (out == NULL) {
+		for (size_t b = 0; b < job.n_blocks; b++)
+			free(job.blocks[b]);
+		free_job(&job);
+		return -1;
+	}
+
+	struct huffman_header header = {
+		.block_records = HUFFMAN_BLOCK_RECORDS,
+		.n_records = n_records,
+		.n_blocks = job.n_blocks,
+	};
+
+	memcpy(header.magic, HUFFMAN_MAGIC, sizeof(header.magic));
+	memcpy(header.character_bits, job.characters.bits, sizeof(header.character_bits));
+	memcpy(header.occurence_bits, job.occurences.bits, sizeof(header.occurence_bits));
+	memcpy(out, &header, sizeof(header));
+	memcpy(out + sizeof(header), job.block_sizes, job.n_blocks * sizeof(uint64_t));
+
+	job.payload = out + header_size;
+	atomic_store(&job.next_block, 0);
+	pzip_ctx_run(ctx, copy_worker, &job);
+
+	free_job(&job);
+	*archive = out;
+	*archive_size = header_size + payload_size;
+
+	return 0;
+}
+
+// Workers claim blocks and decode each into its place in the records
+static void decode_worker(void *arg, int worker)
+{
+	struct HuffmanJob *job = arg;
+	size_t b;
+
+	while ((b = atomic_fetch_add(&job->next_block, 1)) < job->n_blocks) {
+		size_t first;
+		size_t n = block_records(job, b, &first);
+		struct bit_reader reader = {
+			.p = job->coded + job->block_offsets[b],
+			.end = job->coded + job->block_offsets[b] + job->block_sizes[b],
+		};
+
+		for (size_t r = first; r < first + n; r++) {
+			int c = get_symbol(&reader, &job->character_decoder);
+			int o = get_symbol(&reader, &job->occurence_decoder);
+
+			if (c < 0 || o <= 0 || reader.overrun) {
+				atomic_store(&job->failed, true);
+				break;
+			}
+			job->records[r].character = c;
+			job->records[r].occurence = o;
+		}
+	}
+}
+
+int huffman_decode(struct pzip_ctx *ctx, const void *archive,
+		   size_t archive_size, struct zipped_char **records,
+		   size_t *n_records)
+{
+	struct huffman_header header;
+	struct HuffmanJob job = { .n_workers = pzip_ctx_threads(ctx) };
+
+	if (archive_size < sizeof(header))
+		goto invalid;
+	memcpy(&header, archive, sizeof(header));
+
+	if (memcmp(header.magic, HUFFMAN_MAGIC, sizeof(header.magic)) ||
+	    header.block_records != HUFFMAN_BLOCK_RECORDS ||
+	    header.n_blocks != (header.n_records + HUFFMAN_BLOCK_RECORDS - 1) / HUFFMAN_BLOCK_RECORDS ||
+	    header.n_blocks > (archive_size - sizeof(header)) / sizeof(uint64_t) ||
+	    build_decoder(header.character_bits, &job.character_decoder) < 0 ||
+	    build_decoder(header.occurence_bits, &job.occurence_decoder) < 0)
+		goto invalid;
+
+	job.n_records = header.n_records;
+	job.n_blocks = header.n_blocks;
+	job.block_sizes = malloc((job.n_blocks + 1) * sizeof(uint64_t));
+	job.block_offsets = malloc((job.n_blocks + 1) * sizeof(uint64_t));
+	job.records = malloc(job.n_records * sizeof(struct zipped_char) + 1);
+	if (job.block_sizes == NULL || job.block_offsets == NULL || job.records == NULL) {
+		free(job.records);
+		free_job(&job);
+		return -1;
+	}
+
+	size_t header_size = sizeof(header) + job.n_blocks * sizeof(uint64_t);
+	uint64_t payload_size = 0;
+
+	memcpy(job.block_sizes, (const uint8_t *)archive + sizeof(header),
+	       job.n_blocks * sizeof(uint64_t));
+	for (size_t b = 0; b < job.n_blocks; b++) {
+		job.block_offsets[b] = payload_size;
+		payload_size += job.block_sizes[b];
+		if (job.block_sizes[b] > archive_size)
+			break;
+	}
+
+	if (payload_size != archive_size - header_size) {
+		free(job.records);
+		free_job(&job);
+		goto invalid;
+	}
+
+	job.coded = (const uint8_t *)archive + header_size;
+	atomic_init(&job.next_block, 0);
+	atomic_init(&job.failed, false);
+	pzip_ctx_run(ctx, decode_worker, &job);
+
+	if (atomic_load(&job.failed)) {
+		free(job.records);
+		free_job(&job);
+		goto invalid;
+	}
+
+	free_job(&job);
+	*records = job.records;
+	*n_records = job.n_records;
+
+	return 0;
+
+invalid:
+	errno = EINVAL;
+	return -1;
+}
@@ -0,0 +1,342 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "punzip.h"
+
+// The records of one worker
+struct UnzipPart {
+	size_t first_record;
+	size_t end_record;
+	// Characters these records unzip to, then where they start in the output
+	uint64_t length;
+	uint64_t offset;
+};
+
+// The state shared by the workers of one unzip, one part per worker
+struct UnzipJob {
+	const void *records;
+	bool wide;
+	struct UnzipPart *parts;
+	int n_parts;
+	// Either may be NULL when only the other is wanted
+	char *output;
+	struct pzip_index *index;
+};
+
+// Pass 1: how many characters each part unzips to
+static void sum_worker(void *arg, int worker)
+{
+	struct UnzipJob *job = arg;
+	struct UnzipPart *part = &job->parts[worker];
+
+	part->length = 0;
+	for (size_t r = part->first_record; r < part->end_record; r++)
+		part->length += zipped_record_occurence(job->records, job->wide, r);
+}
+
+// Pass 2: write each part's runs, and its blocks' index entries, at its offset
+static void write_worker(void *arg, int worker)
+{
+	struct UnzipJob *job = arg;
+	struct UnzipPart *part = &job->parts[worker];
+	uint64_t block_size = job->index != NULL ? job->index->block_size : 0;
+	uint64_t pos = part->offset;
+
+	for (size_t r = part->first_record; r < part->end_record; r++) {
+		uint32_t occurence = zipped_record_occurence(job->records, job->wide, r);
+
+		if (job->output != NULL)
+			memset(job->output + pos, zipped_record_character(job->records, job->wide, r),
+			       occurence);
+
+		// Every block that starts inside this record points at it
+		if (job->index != NULL) {
+			for (uint64_t b = (pos + block_size - 1) / block_size;
+			     b * block_size < pos + occurence; b++) {
+				job->index->entries[b].record = r;
+				job->index->entries[b].skip = b * block_size - pos;
+			}
+		}
+		pos += occurence;
+	}
+}
+
+// Splits the records between the workers and computes every part's offset: pass 1, then an
+// exclusive prefix sum. Returns the total number of characters.
+static uint64_t plan_unzip(struct pzip_ctx *ctx, struct UnzipJob *job, size_t n_records)
+{
+	uint64_t offset = 0;
+
+	for (int i = 0; i < job->n_parts; i++) {
+		job->parts[i].first_record = n_records * i / job->n_parts;
+		job->parts[i].end_record = n_records * (i + 1) / job->n_parts;
+	}
+
+	pzip_ctx_run(ctx, sum_worker, job);
+
+	for (int i = 0; i < job->n_parts; i++) {
+		job->parts[i].offset = offset;
+		offset += job->parts[i].length;
+	}
+
+	return offset;
+}
+
+static struct UnzipPart *alloc_parts(struct pzip_ctx *ctx, int *n_parts)
+{
+	*n_parts = pzip_ctx_threads(ctx);
+
+	struct UnzipPart *parts = malloc(*n_parts * sizeof(struct UnzipPart));
+
+	if (parts == NULL) {
+		fprintf(stderr, "Failed to malloc the unzip parts\n");
+		exit(1);
+	}
+
+	return parts;
+}
+
+uint64_t punzip_size(struct pzip_ctx *ctx, const void *records,
+		     size_t n_records, bool wide)
+{
+	struct UnzipJob job = { .records = records, .wide = wide };
+
+	job.parts = alloc_parts(ctx, &job.n_parts);
+
+	uint64_t size = plan_unzip(ctx, &job, n_records);
+
+	free(job.parts);
+
+	return size;
+}
+
+void punzip(struct pzip_ctx *ctx, const void *records, size_t n_records,
+	    bool wide, char *output)
+{
+	struct UnzipJob job = { .records = records, .wide = wide, .output = output };
+
+	job.parts = alloc_parts(ctx, &job.n_parts);
+	plan_unzip(ctx, &job, n_records);
+	pzip_ctx_run(ctx, write_worker, &job);
+	free(job.parts);
+}
+
+// FNV-1a over @size bytes, continuing from @hash
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t size)
+{
+	const unsigned char *bytes = data;
+
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+// The fingerprint of an index's archive: see struct pzip_index
+static uint64_t index_fingerprint(const struct pzip_index *index, const void *records)
+{
+	size_t record_size = zipped_record_size(index->wide);
+	uint64_t archive_size = index->n_records * record_size;
+	uint64_t hash = fnv1a(0xcbf29ce484222325ULL, &archive_size, sizeof(archive_size));
+
+	for (uint64_t b = 0; b < index->n_blocks; b++) {
+		uint64_t r = index->entries[b].record;
+		uint64_t first = r > 0 ? r - 1 : r;
+
+		hash = fnv1a(hash, (const char *)records + first * record_size,
+			     (r - first + 1) * record_size);
+	}
+	if (index->n_records > 0)
+		hash = fnv1a(hash, (const char *)records + (index->n_records - 1) * record_size,
+			     record_size);
+
+	return hash;
+}
+
+struct pzip_index *punzip_index_build(struct pzip_ctx *ctx, const void *records,
+				      size_t n_records, bool wide,
+				      uint64_t block_size)
+{
+	struct UnzipJob job = { .records = records, .wide = wide };
+
+	job.parts = alloc_parts(ctx, &job.n_parts);
+
+	uint64_t size = plan_unzip(ctx, &job, n_records);
+	uint64_t n_blocks = (size + block_size - 1) / block_size;
+	struct pzip_index *index = malloc(sizeof(*index) +
+					  n_blocks * sizeof(struct pzip_index_entry));
+
+	if (index != NULL) {
+		memcpy(index->magic, PZIP_INDEX_MAGIC, sizeof(index->magic));
+		index->wide = wide;
+		index->block_size = block_size;
+		index->n_records = n_records;
+		index->size = size;
+		index->n_blocks = n_blocks;
+
+		job.index = index;
+		pzip_ctx_run(ctx, write_worker, &job);
+		index->fingerprint = index_fingerprint(index, records);
+	}
+
+	free(job.parts);
+
+	return index;
+}
+
+char *punzip_index_path(const char *archive)
+{
+	size_t size = strlen(archive) + sizeof(".idx");
+	char *path = malloc(size);
+
+	if (path != NULL)
+		snprintf(path, size, "%s.idx", archive);
+
+	return path;
+}
+
+static size_t index_file_size(const struct pzip_index *index)
+{
+	return sizeof(*index) + index->n_blocks * sizeof(struct pzip_index_entry);
+}
+
+int punzip_index_save(const struct pzip_index *index, const char *file)
+{
+	FILE *f = fopen(file, "wb");
+
+	if (f == NULL)
+		return -1;
+
+	size_t written = fwrite(index, 1, index_file_size(index), f);
+	int error = ferror(f) ? errno : 0;
+
+	if (fclose(f) != 0 && error == 0)
+		error = errno;
+	if (error == 0 && written != index_file_size(index))
+		error = EIO;
+
+	errno = error;
+	return error ? -1 : 0;
+}
+
+struct pzip_index *punzip_index_load(const char *file)
+{
+	struct pzip_index header;
+	struct stat statbuf;
+	FILE *f = fopen(file, "rb");
+
+	if (f == NULL)
+		return NULL;
+
+	if (fstat(fileno(f), &statbuf) < 0) {
+		fclose(f);
+		return NULL;
+	}
+
+	// The entries must fill the rest of the file exactly, which also keeps
+	// index_file_size() from overflowing
+	if (fread(&header, sizeof(header), 1, f) != 1 ||
+	    memcmp(header.magic, PZIP_INDEX_MAGIC, sizeof(header.magic)) ||
+	    header.block_size == 0 ||
+	    header.n_blocks != header.size / header.block_size +
+				       (header.size % header.block_size != 0) ||
+	    (uint64_t)statbuf.st_size < sizeof(header) ||
+	    ((uint64_t)statbuf.st_size - sizeof(header)) % sizeof(struct pzip_index_entry) ||
+	    ((uint64_t)statbuf.st_size - sizeof(header)) / sizeof(struct pzip_index_entry) !=
+		    header.n_blocks) {
+		fclose(f);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	struct pzip_index *index = malloc(index_file_size(&header));
+
+	if (index == NULL) {
+		fclose(f);
+		return NULL;
+	}
+
+	*index = header;
+	if (fread(index->entries, sizeof(struct pzip_index_entry), header.n_blocks, f) !=
+	    header.n_blocks) {
+		fclose(f);
+		free(index);
+		errno = EINVAL;
+		return NULL;
+	}
+	fclose(f);
+
+	return index;
+}
+
+int punzip_index_check(const struct pzip_index *index, const void *records,
+		       size_t n_records, bool wide)
+{
+	if (index->n_records != n_records || index->wide != wide) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	// Every block must start inside the record its entry points at
+	for (uint64_t b = 0; b < index->n_blocks; b++) {
+		const struct pzip_index_entry *entry = &index->entries[b];
+
+		if (entry->record >= n_records ||
+		    entry->skip >= zipped_record_occurence(records, wide, entry->record)) {
+			errno = EINVAL;
+			return -1;
+		}
+	}
+
+	if (index->fingerprint != index_fingerprint(index, records)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return 0;
+}
+
+size_t punzip_range(const void *records, size_t n_records, bool wide,
+		    const struct pzip_index *index, uint64_t offset,
+		    size_t length, char *output)
+{
+	size_t r = 0;
+	// Characters of record r that come before @offset
+	uint64_t skip = offset;
+	size_t written = 0;
+
+	if (index != NULL) {
+		uint64_t block = offset / index->block_size;
+
+		// Past the end: nothing to unzip
+		if (block >= index->n_blocks)
+			return 0;
+
+		r = index->entries[block].record;
+		skip = index->entries[block].skip + offset - block * index->block_size;
+	}
+
+	for (; r < n_records && written < length; r++) {
+		uint64_t occurence = zipped_record_occurence(records, wide, r);
+
+		if (skip >= occurence) {
+			skip -= occurence;
+			continue;
+		}
+
+		size_t n = occurence - skip;
+
+		if (n > length - written)
+			n = length - written;
+		memset(output + written, zipped_record_character(records, wide, r), n);
+		written += n;
+		skip = 0;
+	}
+
+	return written;
+}
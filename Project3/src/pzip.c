@@ -1,64 +1,406 @@
 #include <pthread.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "pzip.h"
+#include "run_scan.h"
+#include "thread_pool.h"
 
-struct ThreadData {
-	// Passing pointer of list of characters to the thread
+// Number of runs a thread scans at a time, in a buffer on its stack
+#define RUN_BATCH 1024
+
+// Sub-histograms per thread. Consecutive runs go to different ones, so an update never waits for
+// the previous store to the same counter (e.g. in "abab..." every other run hits the same byte).
+#define SUB_HISTOGRAMS 4
+
+struct pzip_ctx {
+	struct thread_pool *pool;
+};
+
+// Characters per chunk. The input is cut into many chunks, more than threads, that idle
+// threads claim one at a time, so a thread stuck with expensive chunks (many short runs)
+// does not hold up the others.
+#define CHUNK_SIZE (128 << 10)
+
+// Every worker starts with an equal, contiguous range of chunks, and claims them from the
+// front with an atomic increment. Once its range is used up it steals from the other
+// workers' ranges the same way, so claiming never takes a lock.
+struct WorkerData {
+	_Alignas(64) atomic_int next_chunk;
+	int end_chunk;
+	// Occurences of each byte value in the chunks this worker counted
+	int char_frequency[PZIP_ALPHABET];
+};
+
+// The state shared by all the threads of one pzip() call
+struct ZipJob {
 	char *input_chars;
-	// Passing where the thread should start
+	// Output records, zipped_char or zipped_char_wide depending on wide
+	void *zipped_chars;
+	bool wide;
+	// Index of the first record to write
+	size_t first_record;
+	int n_chunks;
+	struct ChunkData *chunks;
+	int n_workers;
+	struct WorkerData *workers;
+	// Separates counting runs, computing offsets and writing records
+	pthread_barrier_t barrier;
+};
+
+struct ChunkData {
+	struct ZipJob *job;
+	// Passing where the chunk starts
 	int start_index;
-	// Passing how big the chunk of characters is for the thread
-	int chuck_size;
-	// Number of elements in local result array
-	int zipped_char_count;
-	// Array to hold the zipped local result
-	struct zipped_char *local_result;
+	// Passing how big the chunk of characters is
+	int chunk_size;
+
+	// Phase 1: the first and last run of the chunk (the same run if single), clipped to the
+	// chunk, and the number of records needed for the runs in between
+	struct run head;
+	struct run tail;
+	bool single;
+	size_t middle_records;
+
+	// Phase 2: the head run is not owned if it continues a run from an earlier chunk, and
+	// an owned tail run may continue into later chunks, for tail_length characters in total
+	bool owns_head;
+	bool owns_tail;
+	size_t tail_length;
+	// Number of records for the runs this chunk owns, and where they go in the output
+	size_t records;
+	size_t offset;
 };
 
-// Thread compression function
-static void *compress(void *arg) {
-	struct ThreadData *data = (struct ThreadData *)arg;
-	char current_char;
-	int local_result_index = 0;
-
-	// Looping through section of string assigned to this thread
-	for (int i = data->start_index; i < (data->start_index + data->chuck_size); i++) {
-		// Saving current character
-		current_char = data->input_chars[i];
-
-		// Checking if the results array already is storing a character, if it is we check if current char and stored one are the same
-		if(data->local_result[local_result_index].character == '\0' || data->local_result[local_result_index].character == current_char) {
-			data->local_result[local_result_index].character = current_char;
-			data->local_result[local_result_index].occurence++;
+// Number of records a run takes: one wide record, or narrow records of at most 255
+static size_t run_records(size_t length, bool wide)
+{
+	return wide ? 1 : (length + UINT8_MAX - 1) / UINT8_MAX;
+}
+
+// Writes a whole run at zipped_chars[*index], advancing *index past its records
+static void write_run(char character, size_t length, void *zipped_chars, bool wide, size_t *index)
+{
+	if (wide) {
+		struct zipped_char_wide *records = zipped_chars;
+
+		records[*index].character = character;
+		records[*index].occurence = length;
+		*index += 1;
+		return;
+	}
+
+	struct zipped_char *records = zipped_chars;
+
+	while (length > 0) {
+		uint8_t occurence = length > UINT8_MAX ? UINT8_MAX : length;
+
+		records[*index].character = character;
+		records[*index].occurence = occurence;
+		*index += 1;
+		length -= occurence;
+	}
+}
+
+// Phase 1: find the head and tail runs and count the records of the runs in between, adding
+// the chunk's byte counts to @char_frequency
+static void count_chunk(struct ChunkData *data, int *char_frequency)
+{
+	const char *chunk = data->job->input_chars + data->start_index;
+	size_t size = data->chunk_size;
+	struct run runs[RUN_BATCH];
+	size_t pos = 0;
+	size_t n_runs;
+	bool first = true;
+
+	uint32_t histograms[SUB_HISTOGRAMS][PZIP_ALPHABET] = { { 0 } };
+
+	data->middle_records = 0;
+
+	do {
+		pos += scan_runs(chunk + pos, size - pos, runs, RUN_BATCH, &n_runs);
+
+		for (size_t j = 0; j < n_runs; j++) {
+			histograms[j % SUB_HISTOGRAMS][(unsigned char)runs[j].character] += runs[j].length;
+
+			if (first) {
+				data->head = runs[j];
+				first = false;
+			} else {
+				data->middle_records += run_records(runs[j].length, data->job->wide);
+			}
+		}
+	} while (n_runs == RUN_BATCH);
+
+	// Everything after the last complete run is the (open) tail run
+	data->tail.character = chunk[pos];
+	data->tail.length = size - pos;
+	histograms[0][(unsigned char)data->tail.character] += data->tail.length;
+
+	for (int c = 0; c < PZIP_ALPHABET; c++) {
+		for (int h = 0; h < SUB_HISTOGRAMS; h++)
+			char_frequency[c] += histograms[h][c];
+	}
+
+	data->single = first;
+	if (data->single)
+		data->head = data->tail;
+}
+
+// Between the phases: stitch runs across chunks, then an exclusive prefix sum of the record
+// counts gives each chunk its output offset, in input order whichever thread counted it.
+// Only O(n_chunks) work, done by one thread.
+static void plan_chunks(struct ZipJob *job)
+{
+	struct ChunkData *owner = NULL;
+	size_t offset = job->first_record;
+
+	for (int i = 0; i < job->n_chunks; i++) {
+		struct ChunkData *data = &job->chunks[i];
+		// The previous chunk's last character is the one right before this chunk
+		bool continues = owner != NULL && job->input_chars[data->start_index - 1] == data->head.character;
+
+		if (continues)
+			owner->tail_length += data->head.length;
+
+		if (data->single) {
+			// A chunk that is one run either extends the open run or starts a new one
+			data->owns_head = false;
+			data->owns_tail = !continues;
 		} else {
-			local_result_index++;
-			data->local_result[local_result_index].character = current_char;
-			data->local_result[local_result_index].occurence++;
+			data->owns_head = !continues;
+			data->owns_tail = true;
+		}
+
+		if (data->owns_tail) {
+			data->tail_length = data->tail.length;
+			owner = data;
 		}
 	}
 
-	// Updating count for amount of zipped characters
-	data->zipped_char_count = local_result_index;
+	for (int i = 0; i < job->n_chunks; i++) {
+		struct ChunkData *data = &job->chunks[i];
+
+		data->records = data->middle_records;
+		if (data->owns_head)
+			data->records += run_records(data->head.length, job->wide);
+		if (data->owns_tail)
+			data->records += run_records(data->tail_length, job->wide);
+
+		data->offset = offset;
+		offset += data->records;
+	}
+}
+
+// Phase 2: scan the chunk again and write the runs it owns straight into the output
+static void write_chunk(struct ChunkData *data)
+{
+	struct ZipJob *job = data->job;
+	const char *chunk = job->input_chars + data->start_index;
+	size_t size = data->chunk_size;
+	struct run runs[RUN_BATCH];
+	size_t index = data->offset;
+	size_t pos = 0;
+	size_t n_runs;
+	bool first = true;
+
+	do {
+		pos += scan_runs(chunk + pos, size - pos, runs, RUN_BATCH, &n_runs);
+
+		for (size_t j = 0; j < n_runs; j++) {
+			// The head run is written by the chunk where it started
+			if (!first || data->owns_head)
+				write_run(runs[j].character, runs[j].length, job->zipped_chars, job->wide, &index);
+			first = false;
+		}
+	} while (n_runs == RUN_BATCH);
 
-	return NULL;
+	if (data->owns_tail)
+		write_run(data->tail.character, data->tail_length, job->zipped_chars, job->wide, &index);
+}
+
+// Start index of part i of n, computed in 64 bits so size * i cannot overflow
+static int chunk_boundary(int size, int n, int i)
+{
+	return (int)((int64_t)size * i / n);
+}
+
+// Gives every worker an equal share of the chunks to claim
+static void assign_chunks(struct ZipJob *job)
+{
+	for (int w = 0; w < job->n_workers; w++) {
+		atomic_store(&job->workers[w].next_chunk, chunk_boundary(job->n_chunks, job->n_workers, w));
+		job->workers[w].end_chunk = chunk_boundary(job->n_chunks, job->n_workers, w + 1);
+	}
+}
+
+// Claims the next chunk of @worker's range, or steals one from the next worker that has any
+// left. Returns -1 once every chunk is claimed.
+static int claim_chunk(struct ZipJob *job, int worker)
+{
+	for (int k = 0; k < job->n_workers; k++) {
+		struct WorkerData *victim = &job->workers[(worker + k) % job->n_workers];
+
+		if (atomic_load_explicit(&victim->next_chunk, memory_order_relaxed) >= victim->end_chunk)
+			continue;
+
+		int chunk = atomic_fetch_add_explicit(&victim->next_chunk, 1, memory_order_relaxed);
+
+		if (chunk < victim->end_chunk)
+			return chunk;
+	}
+
+	return -1;
+}
+
+// Runs every phase in one worker, on whichever chunks it claims
+static void compress(struct ZipJob *job, int worker)
+{
+	int chunk;
+
+	while ((chunk = claim_chunk(job, worker)) >= 0)
+		count_chunk(&job->chunks[chunk], job->workers[worker].char_frequency);
+
+	// Wait for every chunk to be counted; exactly one thread then plans the output and
+	// hands the chunks out again
+	if (pthread_barrier_wait(&job->barrier) == PTHREAD_BARRIER_SERIAL_THREAD) {
+		plan_chunks(job);
+		assign_chunks(job);
+	}
+	pthread_barrier_wait(&job->barrier);
+
+	while ((chunk = claim_chunk(job, worker)) >= 0)
+		write_chunk(&job->chunks[chunk]);
+}
+
+// Pool worker function: workers past the number of chunks have nothing to do
+static void compress_worker(void *arg, int worker)
+{
+	struct ZipJob *job = arg;
+
+	if (worker < job->n_workers)
+		compress(job, worker);
+}
+
+// Shared implementation of pzip(), pzip_wide() and pzip_ctx_zip(). The input is split across
+// the workers of @pool, or zipped in the calling thread alone if @pool is NULL.
+static void zip(struct thread_pool *pool, char *input_chars, int input_chars_size,
+		void *zipped_chars, bool wide, int *zipped_chars_count,
+		int *char_frequency)
+{
+	// Nothing to zip, and no thread should be given an empty chunk
+	if (input_chars_size <= 0)
+		return;
+
+	int n_workers = pool != NULL ? thread_pool_size(pool) : 1;
+	// Enough chunks to keep every worker busy, but never an empty one
+	int n_chunks = input_chars_size / CHUNK_SIZE;
+
+	if (n_chunks < n_workers)
+		n_chunks = n_workers;
+	if (n_chunks > input_chars_size)
+		n_chunks = input_chars_size;
+	// A worker without a chunk would have nothing to do
+	if (n_workers > n_chunks)
+		n_workers = n_chunks;
+
+	// Creating arrays to hold every chunk's counts and every worker's range
+	struct ChunkData *chunks = malloc(n_chunks * sizeof(struct ChunkData));
+	struct WorkerData *workers = aligned_alloc(_Alignof(struct WorkerData),
+						   n_workers * sizeof(struct WorkerData));
+
+	if (chunks == NULL || workers == NULL) {
+		fprintf(stderr, "Failed to malloc the chunks\n");
+		exit(1);
+	}
+
+	struct ZipJob job = {
+		.input_chars = input_chars,
+		.zipped_chars = zipped_chars,
+		.wide = wide,
+		.first_record = *zipped_chars_count,
+		.n_chunks = n_chunks,
+		.chunks = chunks,
+		.n_workers = n_workers,
+		.workers = workers,
+	};
+
+	if (pthread_barrier_init(&job.barrier, NULL, n_workers) != 0) {
+		fprintf(stderr, "Failed to initialize barrier\n");
+		exit(1);
+	}
+
+	for (int i = 0; i < n_chunks; i++) {
+		// Balanced chunk boundaries: chunk i is [i * size / n, (i + 1) * size / n), so chunk
+		// sizes differ by at most one character when the size is not a multiple of n_chunks
+		int start_index = chunk_boundary(input_chars_size, n_chunks, i);
+
+		chunks[i].job = &job;
+		chunks[i].start_index = start_index;
+		chunks[i].chunk_size = chunk_boundary(input_chars_size, n_chunks, i + 1) - start_index;
+	}
+
+	for (int w = 0; w < n_workers; w++)
+		memset(workers[w].char_frequency, 0, sizeof(workers[w].char_frequency));
+	assign_chunks(&job);
+
+	// Returns once every worker is done
+	if (pool != NULL)
+		thread_pool_run(pool, compress_worker, &job);
+	else
+		compress(&job, 0);
+
+	// Records are already in place, so only the counts are left to add up
+	for (int i = 0; i < n_chunks; i++)
+		*zipped_chars_count += chunks[i].records;
+	for (int w = 0; w < n_workers; w++) {
+		for (int c = 0; c < PZIP_ALPHABET; c++)
+			char_frequency[c] += workers[w].char_frequency[c];
+	}
+
+	pthread_barrier_destroy(&job.barrier);
+	free(workers);
+	free(chunks);
+}
+
+// One-shot zip: the threads only live for this call
+static void zip_once(int n_threads, char *input_chars, int input_chars_size,
+		     void *zipped_chars, bool wide, int *zipped_chars_count,
+		     int *char_frequency)
+{
+	if (input_chars_size <= 0)
+		return;
+
+	if (n_threads > input_chars_size)
+		n_threads = input_chars_size;
+
+	struct thread_pool *pool = thread_pool_create(n_threads);
+
+	if (pool == NULL) {
+		fprintf(stderr, "Failed to create thread\n");
+		exit(1);
+	}
+
+	zip(pool, input_chars, input_chars_size, zipped_chars, wide,
+	    zipped_chars_count, char_frequency);
+	thread_pool_destroy(pool);
 }
 
 /**
  * pzip() - zip an array of characters in parallel
  *
  * Inputs:
- * @n_threads:		   The number of threads to use in pzip
- * @input_chars:		   The input characters (a-z) to be zipped
+ * @n_threads:		   The maximum number of threads to use in pzip
+ * @input_chars:		   The input bytes (any of 0-255) to be zipped
  * @input_chars_size:	   The number of characaters in the input file
  *
  * Outputs:
  * @zipped_chars:       The array of zipped_char structs
  * @zipped_chars_count:   The total count of inserted elements into the zippedChars array.
- * @char_frequency[26]: Total number of occurences
+ * @char_frequency[PZIP_ALPHABET]: Total number of occurences of each byte
  *
  * NOTE: All outputs are already allocated. DO NOT MALLOC or REASSIGN THEM !!!
  *
@@ -67,70 +409,66 @@ void pzip(int n_threads, char *input_chars, int input_chars_size,
 	  struct zipped_char *zipped_chars, int *zipped_chars_count,
 	  int *char_frequency)
 {
-	// Creating array that holds thread IDs
-	pthread_t *thread_ids;
-	thread_ids = (pthread_t *)malloc(n_threads * sizeof(pthread_t));
+	zip_once(n_threads, input_chars, input_chars_size, zipped_chars, false,
+	    zipped_chars_count, char_frequency);
+}
 
-	if (thread_ids == NULL) {
-		fprintf(stderr, "Failed to malloc thread_ids\n");
-		exit(1);
-	}
+/**
+ * pzip_wide() - zip an array of characters in parallel, one record per run
+ *
+ * Same as pzip(), but every run is a single zipped_char_wide, however long it is.
+ */
+void pzip_wide(int n_threads, char *input_chars, int input_chars_size,
+	       struct zipped_char_wide *zipped_chars, int *zipped_chars_count,
+	       int *char_frequency)
+{
+	zip_once(n_threads, input_chars, input_chars_size, zipped_chars, true,
+	    zipped_chars_count, char_frequency);
+}
 
-	// Creating array to hold all local results
-	struct ThreadData *thread_data;
-	thread_data = (struct ThreadData *)malloc(n_threads * sizeof(struct ThreadData));
+struct pzip_ctx *pzip_ctx_create(int n_threads)
+{
+	struct pzip_ctx *ctx = malloc(sizeof(*ctx));
 
-	if (thread_data == NULL) {
-		fprintf(stderr, "Failed to malloc thread_data\n");
-		exit(1);
-	}
+	if (ctx == NULL)
+		return NULL;
 
-	// Calculating chunk size for each thread
-	int chunk_size = input_chars_size / n_threads;
+	ctx->pool = thread_pool_create(n_threads);
+	if (ctx->pool == NULL) {
+		free(ctx);
+		return NULL;
+	}
 
-	int start_index = 0;
-	for(int i = 0; i < n_threads; i++) {
-		// Setting up thread data object to be passed to each thread
-		thread_data[i].input_chars = input_chars;
-		thread_data[i].start_index = start_index;
-		thread_data[i].chuck_size = chunk_size;
-		thread_data[i].local_result = calloc(chunk_size, sizeof(struct zipped_char));
+	return ctx;
+}
 
-		if (thread_data[i].local_result == NULL) {
-			fprintf(stderr, "Failed to malloc local_result\n");
-			exit(1);
-		}
+int pzip_ctx_threads(const struct pzip_ctx *ctx)
+{
+	return ctx != NULL ? thread_pool_size(ctx->pool) : 1;
+}
 
-		// Initializing thread
-		pthread_create(&thread_ids[i], NULL, compress, (void *)&thread_data[i]);
+void pzip_ctx_zip(struct pzip_ctx *ctx, char *input_chars, int input_chars_size,
+		  void *zipped_chars, bool wide, int *zipped_chars_count,
+		  int *char_frequency)
+{
+	zip(ctx != NULL ? ctx->pool : NULL, input_chars, input_chars_size,
+	    zipped_chars, wide, zipped_chars_count, char_frequency);
+}
 
-		// Updating start index for next thread
-		start_index += chunk_size; 
-	}
-	
-	// Wait for threads to all finish
-	for (int i = 0; i < n_threads; i++) {
-		pthread_join(thread_ids[i], NULL);
-	}
+void pzip_ctx_run(struct pzip_ctx *ctx, void (*fn)(void *arg, int worker),
+		  void *arg)
+{
+	if (ctx != NULL)
+		thread_pool_run(ctx->pool, fn, arg);
+	else
+		fn(arg, 0);
+}
 
-	// Moving through all the data tuples the threads populate
-	for (int i = 0; i < n_threads; i++) {
-		// Moving through the local result array for each data tuple
-		for (int j = 0; j <= thread_data[i].zipped_char_count; j++) {
-			// Updating zipped_chars array element with local_result tuple and moving to next element
-			zipped_chars[*zipped_chars_count] = thread_data[i].local_result[j];
-			// Updating occurence of character in the fequency array, a=97 and z=122 in Ascii to translate to index 0 and 25 we % 97
-			char_frequency[thread_data[i].local_result[j].character % 97] += thread_data[i].local_result[j].occurence;
-			*zipped_chars_count += 1;
-		}
-	}
+void pzip_ctx_destroy(struct pzip_ctx *ctx)
+{
+	if (ctx == NULL)
+		return;
 
-	// Freeing all allocated memory starting from deepest to highest
-	for (int i = 0; i < n_threads; i++) {
-		free(thread_data[i].local_result);
-	}
-	// Freeing thread data structs
-	free(thread_data);
-	// Freeing thread id array
-	free(thread_ids);
+	thread_pool_destroy(ctx->pool);
+	free(ctx);
 }
@@ -0,0 +1,207 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "pzip.h"
+
+// The state shared by the workers of one pzip_batch() call
+struct batch {
+	struct pzip_ctx *ctx;
+	int n_files;
+	char *const *input_files;
+	char *const *output_files;
+	bool wide;
+	// Next file for a worker to take
+	atomic_int next_file;
+	atomic_int failures;
+	// Files left for the second pass, split across all the workers
+	bool *large;
+};
+
+// A mapped input file
+struct input {
+	char *chars;
+	int size;
+};
+
+static void report(const char *file, const char *what)
+{
+	fprintf(stderr, "%s: %s: %s\n", file, what, strerror(errno));
+}
+
+static int map_input(const char *file, struct input *input)
+{
+	struct stat statbuf;
+	int fd = open(file, O_RDONLY);
+
+	if (fd < 0) {
+		report(file, "Error opening input file");
+		return -1;
+	}
+
+	if (fstat(fd, &statbuf) < 0) {
+		report(file, "Error reading input file size");
+		close(fd);
+		return -1;
+	}
+
+	if (statbuf.st_size > INT_MAX) {
+		errno = EFBIG;
+		report(file, "Error with input file size");
+		close(fd);
+		return -1;
+	}
+
+	input->size = statbuf.st_size;
+	input->chars = NULL;
+
+	// mmap() cannot map an empty file, and there is nothing to read
+	if (input->size > 0) {
+		input->chars = mmap(NULL, input->size, PROT_READ, MAP_SHARED, fd, 0);
+		if (input->chars == MAP_FAILED) {
+			report(file, "Error mmapping the input file");
+			close(fd);
+			return -1;
+		}
+	}
+	close(fd);
+
+	return 0;
+}
+
+static void unmap_input(struct input *input)
+{
+	if (input->size > 0)
+		munmap(input->chars, input->size);
+}
+
+// Zips @input into @output_file, on the workers of @ctx or in this thread if @ctx is NULL
+static int zip_to_file(struct pzip_ctx *ctx, struct input *input,
+		       const char *output_file, bool wide)
+{
+	size_t record_size = zipped_record_size(wide);
+	// Even an empty input gets a (empty) buffer, so NULL always means failure
+	char *zipped_chars = malloc(input->size * record_size + 1);
+	int zipped_chars_count = 0;
+	int char_frequency[PZIP_ALPHABET] = { 0 };
+
+	if (zipped_chars == NULL) {
+		report(output_file, "Error allocating the output");
+		return -1;
+	}
+
+	pzip_ctx_zip(ctx, input->chars, input->size, zipped_chars, wide,
+		     &zipped_chars_count, char_frequency);
+
+	int fd = open(output_file, O_WRONLY | O_CREAT | O_TRUNC, (mode_t)0600);
+
+	if (fd < 0) {
+		report(output_file, "Error opening the output file");
+		free(zipped_chars);
+		return -1;
+	}
+
+	size_t size = zipped_chars_count * record_size;
+	size_t written = 0;
+
+	while (written < size) {
+		ssize_t n = write(fd, zipped_chars + written, size - written);
+
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0) {
+			report(output_file, "Error writing the output file");
+			close(fd);
+			free(zipped_chars);
+			return -1;
+		}
+		written += n;
+	}
+
+	free(zipped_chars);
+	if (close(fd) < 0) {
+		report(output_file, "Error closing the output file");
+		return -1;
+	}
+
+	return 0;
+}
+
+// Pool worker function: takes files one at a time and zips the small ones alone
+static void batch_worker(void *arg, int worker)
+{
+	struct batch *batch = arg;
+	bool split = pzip_ctx_threads(batch->ctx) > 1;
+	int i;
+
+	while ((i = atomic_fetch_add(&batch->next_file, 1)) < batch->n_files) {
+		struct input input;
+
+		if (map_input(batch->input_files[i], &input) < 0) {
+			atomic_fetch_add(&batch->failures, 1);
+			continue;
+		}
+
+		// Large files are worth splitting across every worker once this pass is over
+		if (split && input.size >= PZIP_BATCH_SPLIT_SIZE)
+			batch->large[i] = true;
+		else if (zip_to_file(NULL, &input, batch->output_files[i], batch->wide) < 0)
+			atomic_fetch_add(&batch->failures, 1);
+
+		unmap_input(&input);
+	}
+}
+
+int pzip_batch(struct pzip_ctx *ctx, int n_files, char *const input_files[],
+	       char *const output_files[], bool wide)
+{
+	struct batch batch = {
+		.ctx = ctx,
+		.n_files = n_files,
+		.input_files = input_files,
+		.output_files = output_files,
+		.wide = wide,
+		.large = calloc(n_files + 1, sizeof(bool)),
+	};
+
+	if (batch.large == NULL) {
+		fprintf(stderr, "Failed to malloc the batch\n");
+		return n_files;
+	}
+
+	atomic_init(&batch.next_file, 0);
+	atomic_init(&batch.failures, 0);
+
+	// First pass: small files, several at a time, one per worker
+	pzip_ctx_run(ctx, batch_worker, &batch);
+
+	// Second pass: large files, one at a time, each on every worker
+	int failures = atomic_load(&batch.failures);
+
+	for (int i = 0; i < n_files; i++) {
+		struct input input;
+
+		if (!batch.large[i])
+			continue;
+
+		if (map_input(input_files[i], &input) < 0) {
+			failures++;
+			continue;
+		}
+		if (zip_to_file(ctx, &input, output_files[i], wide) < 0)
+			failures++;
+		unmap_input(&input);
+	}
+
+	free(batch.large);
+
+	return failures;
+}
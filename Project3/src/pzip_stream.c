@@ -0,0 +1,259 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "pzip.h"
+
+// Records written at a time when a carried run is split into many records
+#define CARRY_RECORDS 4096
+
+// Double buffering: the reader thread fills one window while the other is zipped
+struct reader {
+	int fd;
+	int window_size;
+	char *windows[2];
+	// Characters read into each window, valid while filled[i] is set
+	int sizes[2];
+	bool filled[2];
+	// errno of a failed read, reported with the window that hit it
+	int error[2];
+	// Set by the zipping side to make the reader give up
+	bool stopping;
+
+	pthread_mutex_t lock;
+	// Signalled whenever a window is filled or released
+	pthread_cond_t changed;
+};
+
+// The run at the end of the output so far, which may continue in the next window
+struct carry {
+	char character;
+	uint64_t length;
+};
+
+// Reads until @buf is full or the input ends, returning the number of characters or -1
+static ssize_t read_full(int fd, char *buf, size_t size)
+{
+	size_t done = 0;
+
+	while (done < size) {
+		ssize_t n = read(fd, buf + done, size - done);
+
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			return -1;
+		if (n == 0)
+			break;
+		done += n;
+	}
+
+	return done;
+}
+
+static void *reader_main(void *arg)
+{
+	struct reader *reader = arg;
+
+	for (int i = 0;; i ^= 1) {
+		pthread_mutex_lock(&reader->lock);
+		while (reader->filled[i] && !reader->stopping)
+			pthread_cond_wait(&reader->changed, &reader->lock);
+		bool stopping = reader->stopping;
+		pthread_mutex_unlock(&reader->lock);
+
+		if (stopping)
+			break;
+
+		ssize_t n = read_full(reader->fd, reader->windows[i], reader->window_size);
+
+		pthread_mutex_lock(&reader->lock);
+		reader->sizes[i] = n < 0 ? 0 : n;
+		reader->error[i] = n < 0 ? errno : 0;
+		reader->filled[i] = true;
+		pthread_cond_broadcast(&reader->changed);
+		pthread_mutex_unlock(&reader->lock);
+
+		// A short window is the last one: the input ended or could not be read
+		if (n < reader->window_size)
+			break;
+	}
+
+	return NULL;
+}
+
+static int write_full(int fd, const void *buf, size_t size)
+{
+	size_t done = 0;
+
+	while (done < size) {
+		ssize_t n = write(fd, (const char *)buf + done, size - done);
+
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			return -1;
+		done += n;
+	}
+
+	return 0;
+}
+
+// Writes the carried run, split into records of at most 255 (or UINT32_MAX if wide)
+static int write_carry(int fd, const struct carry *carry, bool wide)
+{
+	uint64_t max = wide ? UINT32_MAX : UINT8_MAX;
+	uint64_t length = carry->length;
+
+	while (length > 0) {
+		union {
+			struct zipped_char narrow[CARRY_RECORDS];
+			struct zipped_char_wide wide[CARRY_RECORDS];
+		} records;
+		size_t n = 0;
+
+		for (; n < CARRY_RECORDS && length > 0; n++) {
+			uint32_t occurence = length > max ? max : length;
+
+			if (wide) {
+				records.wide[n].character = carry->character;
+				records.wide[n].occurence = occurence;
+			} else {
+				records.narrow[n].character = carry->character;
+				records.narrow[n].occurence = occurence;
+			}
+			length -= occurence;
+		}
+
+		if (write_full(fd, &records, n * zipped_record_size(wide)) < 0)
+			return -1;
+	}
+
+	return 0;
+}
+
+// Writes the zipped records of one window. The last run is held back in @carry, since the
+// next window may continue it, and a carried run the window continues is extended first.
+static int write_window(int fd, const void *records, size_t count, bool wide,
+			struct carry *carry)
+{
+	size_t record_size = zipped_record_size(wide);
+	size_t first = 0;
+
+	while (first < count && carry->length > 0 &&
+	       zipped_record_character(records, wide, first) == carry->character)
+		carry->length += zipped_record_occurence(records, wide, first++);
+
+	// The window continues the carried run to its end
+	if (first == count)
+		return 0;
+
+	// Otherwise a new run starts, so the carried run is complete
+	if (write_carry(fd, carry, wide) < 0)
+		return -1;
+
+	char last_character = zipped_record_character(records, wide, count - 1);
+	size_t last = count;
+
+	carry->character = last_character;
+	carry->length = 0;
+	while (last > first && zipped_record_character(records, wide, last - 1) == last_character)
+		carry->length += zipped_record_occurence(records, wide, --last);
+
+	return write_full(fd, (const char *)records + first * record_size,
+			  (last - first) * record_size);
+}
+
+int pzip_stream(struct pzip_ctx *ctx, int input_fd, int output_fd,
+		int window_size, bool wide, int64_t *char_frequency)
+{
+	size_t record_size = zipped_record_size(wide);
+	struct reader reader = {
+		.fd = input_fd,
+		.window_size = window_size,
+		.windows = { malloc(window_size), malloc(window_size) },
+	};
+	void *zipped_chars = malloc((size_t)window_size * record_size);
+	struct carry carry = { 0, 0 };
+	pthread_t reader_thread;
+	int ret = 0;
+
+	if (reader.windows[0] == NULL || reader.windows[1] == NULL || zipped_chars == NULL) {
+		fprintf(stderr, "Failed to malloc the stream windows\n");
+		free(reader.windows[0]);
+		free(reader.windows[1]);
+		free(zipped_chars);
+		return -1;
+	}
+
+	pthread_mutex_init(&reader.lock, NULL);
+	pthread_cond_init(&reader.changed, NULL);
+
+	if (pthread_create(&reader_thread, NULL, reader_main, &reader) != 0) {
+		fprintf(stderr, "Failed to create thread\n");
+		ret = -1;
+		goto out;
+	}
+
+	for (int i = 0;; i ^= 1) {
+		pthread_mutex_lock(&reader.lock);
+		while (!reader.filled[i])
+			pthread_cond_wait(&reader.changed, &reader.lock);
+		int size = reader.sizes[i];
+		int error = reader.error[i];
+		pthread_mutex_unlock(&reader.lock);
+
+		if (error) {
+			fprintf(stderr, "Error reading the input: %s\n", strerror(error));
+			ret = -1;
+			break;
+		}
+
+		// The reader is already filling the other window while this one is zipped
+		int zipped_chars_count = 0;
+		int window_frequency[PZIP_ALPHABET] = { 0 };
+
+		pzip_ctx_zip(ctx, reader.windows[i], size, zipped_chars, wide,
+			     &zipped_chars_count, window_frequency);
+		for (int c = 0; c < PZIP_ALPHABET; c++)
+			char_frequency[c] += window_frequency[c];
+
+		if (write_window(output_fd, zipped_chars, zipped_chars_count, wide, &carry) < 0) {
+			perror("Error writing the output");
+			ret = -1;
+			break;
+		}
+
+		pthread_mutex_lock(&reader.lock);
+		reader.filled[i] = false;
+		pthread_cond_broadcast(&reader.changed);
+		pthread_mutex_unlock(&reader.lock);
+
+		if (size < window_size)
+			break;
+	}
+
+	if (ret == 0 && write_carry(output_fd, &carry, wide) < 0) {
+		perror("Error writing the output");
+		ret = -1;
+	}
+
+	pthread_mutex_lock(&reader.lock);
+	reader.stopping = true;
+	pthread_cond_broadcast(&reader.changed);
+	pthread_mutex_unlock(&reader.lock);
+	pthread_join(reader_thread, NULL);
+
+out:
+	pthread_cond_destroy(&reader.changed);
+	pthread_mutex_destroy(&reader.lock);
+	free(reader.windows[0]);
+	free(reader.windows[1]);
+	free(zipped_chars);
+
+	return ret;
+}
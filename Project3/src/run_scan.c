@@ -0,0 +1,165 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HAVE_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define HAVE_X86_SIMD 0
+#endif
+
+#include "run_scan.h"
+
+// The runs found so far by one call to scan_runs()
+struct scan_state {
+	const char *data;
+	struct run *runs;
+	size_t max_runs;
+	size_t n_runs;
+	// Start of the run that is still open
+	size_t start;
+};
+
+// Closes the open run just before @end, returning false if there is no room left for it
+static inline bool emit_run(struct scan_state *state, size_t end)
+{
+	if (state->n_runs == state->max_runs)
+		return false;
+
+	state->runs[state->n_runs].character = state->data[state->start];
+	state->runs[state->n_runs].length = end - state->start;
+	state->n_runs++;
+	state->start = end;
+	return true;
+}
+
+// Checks one character at a time for boundaries between data[i] and data[i + 1], from @from on
+static inline void scan_tail(struct scan_state *state, size_t from, size_t size)
+{
+	for (size_t i = from; i + 1 < size; i++) {
+		if (state->data[i] != state->data[i + 1] && !emit_run(state, i + 1))
+			return;
+	}
+}
+
+static size_t scan_runs_scalar(const char *data, size_t size, struct run *runs,
+			       size_t max_runs, size_t *n_runs)
+{
+	struct scan_state state = { data, runs, max_runs, 0, 0 };
+
+	scan_tail(&state, 0, size);
+
+	*n_runs = state.n_runs;
+	return state.start;
+}
+
+#if HAVE_X86_SIMD
+// Bit k of a block's mask is set when data[i + k] != data[i + k + 1], i.e. a run ends at i + k + 1.
+// Every set bit is a run, so blocks of short runs are emitted in one go, and blocks inside a
+// long run (mask 0) cost one compare.
+
+__attribute__((target("avx2")))
+static size_t scan_runs_avx2(const char *data, size_t size, struct run *runs,
+			     size_t max_runs, size_t *n_runs)
+{
+	struct scan_state state = { data, runs, max_runs, 0, 0 };
+	size_t i = 0;
+
+	// Each block also reads the character after it
+	for (; i + 33 <= size; i += 32) {
+		__m256i block = _mm256_loadu_si256((const __m256i *)(data + i));
+		__m256i next = _mm256_loadu_si256((const __m256i *)(data + i + 1));
+		uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, next));
+
+		while (mask) {
+			if (!emit_run(&state, i + __builtin_ctz(mask) + 1))
+				goto done;
+			mask &= mask - 1;
+		}
+	}
+	scan_tail(&state, i, size);
+
+done:
+	*n_runs = state.n_runs;
+	return state.start;
+}
+
+__attribute__((target("sse4.2")))
+static size_t scan_runs_sse42(const char *data, size_t size, struct run *runs,
+			      size_t max_runs, size_t *n_runs)
+{
+	struct scan_state state = { data, runs, max_runs, 0, 0 };
+	size_t i = 0;
+
+	for (; i + 17 <= size; i += 16) {
+		__m128i block = _mm_loadu_si128((const __m128i *)(data + i));
+		__m128i next = _mm_loadu_si128((const __m128i *)(data + i + 1));
+		uint32_t mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(block, next)) & 0xffff;
+
+		while (mask) {
+			if (!emit_run(&state, i + __builtin_ctz(mask) + 1))
+				goto done;
+			mask &= mask - 1;
+		}
+	}
+	scan_tail(&state, i, size);
+
+done:
+	*n_runs = state.n_runs;
+	return state.start;
+}
+#endif
+
+typedef size_t (*scan_fn)(const char *data, size_t size, struct run *runs,
+			  size_t max_runs, size_t *n_runs);
+
+struct kernel {
+	const char *name;
+	scan_fn scan;
+	bool supported;
+};
+
+static scan_fn selected_scan = scan_runs_scalar;
+static const char *selected_name = "scalar";
+
+// Picks the kernel once at startup, before any worker thread can call scan_runs()
+__attribute__((constructor))
+static void select_kernel(void)
+{
+	// Fastest first
+	struct kernel kernels[] = {
+#if HAVE_X86_SIMD
+		{ "avx2", scan_runs_avx2, __builtin_cpu_supports("avx2") },
+		{ "sse4.2", scan_runs_sse42, __builtin_cpu_supports("sse4.2") },
+#endif
+		{ "scalar", scan_runs_scalar, true },
+	};
+	size_t n_kernels = sizeof(kernels) / sizeof(kernels[0]);
+	const char *forced = getenv("PZIP_SIMD");
+	size_t choice = n_kernels;
+
+	for (size_t i = 0; i < n_kernels && forced; i++) {
+		if (!strcmp(forced, kernels[i].name) && kernels[i].supported)
+			choice = i;
+	}
+
+	for (size_t i = 0; i < n_kernels && choice == n_kernels; i++) {
+		if (kernels[i].supported)
+			choice = i;
+	}
+
+	selected_scan = kernels[choice].scan;
+	selected_name = kernels[choice].name;
+}
+
+size_t scan_runs(const char *data, size_t size, struct run *runs,
+		 size_t max_runs, size_t *n_runs)
+{
+	return selected_scan(data, size, runs, max_runs, n_runs);
+}
+
+const char *scan_runs_kernel(void)
+{
+	return selected_name;
+}
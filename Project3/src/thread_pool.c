@@ -0,0 +1,145 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "thread_pool.h"
+
+struct thread_pool {
+	int n_workers;
+	pthread_t *threads;
+
+	pthread_mutex_t lock;
+	// Signalled when new work is posted or the pool is stopping
+	pthread_cond_t work_posted;
+	// Signalled when the last worker finishes the current work
+	pthread_cond_t work_done;
+
+	// Bumped for every call to thread_pool_run(), so workers can tell new work from old
+	unsigned long generation;
+	// Workers still running the current work
+	int running;
+	bool stopping;
+
+	thread_pool_fn fn;
+	void *arg;
+};
+
+struct worker_start {
+	struct thread_pool *pool;
+	int worker;
+};
+
+static void *worker_main(void *arg)
+{
+	struct worker_start *start = arg;
+	struct thread_pool *pool = start->pool;
+	int worker = start->worker;
+	unsigned long seen = 0;
+
+	free(start);
+
+	pthread_mutex_lock(&pool->lock);
+	for (;;) {
+		while (pool->generation == seen && !pool->stopping)
+			pthread_cond_wait(&pool->work_posted, &pool->lock);
+		if (pool->stopping)
+			break;
+
+		seen = pool->generation;
+		thread_pool_fn fn = pool->fn;
+		void *fn_arg = pool->arg;
+
+		pthread_mutex_unlock(&pool->lock);
+		fn(fn_arg, worker);
+		pthread_mutex_lock(&pool->lock);
+
+		if (--pool->running == 0)
+			pthread_cond_signal(&pool->work_done);
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	return NULL;
+}
+
+// Stops and joins the first @n_started workers
+static void stop_workers(struct thread_pool *pool, int n_started)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->stopping = true;
+	pthread_cond_broadcast(&pool->work_posted);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (int i = 0; i < n_started; i++)
+		pthread_join(pool->threads[i], NULL);
+}
+
+struct thread_pool *thread_pool_create(int n_workers)
+{
+	struct thread_pool *pool = calloc(1, sizeof(*pool));
+
+	if (pool == NULL)
+		return NULL;
+
+	pool->threads = malloc(n_workers * sizeof(pthread_t));
+	if (pool->threads == NULL) {
+		free(pool);
+		return NULL;
+	}
+
+	pool->n_workers = n_workers;
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->work_posted, NULL);
+	pthread_cond_init(&pool->work_done, NULL);
+
+	for (int i = 0; i < n_workers; i++) {
+		struct worker_start *start = malloc(sizeof(*start));
+
+		if (start != NULL) {
+			start->pool = pool;
+			start->worker = i;
+		}
+
+		if (start == NULL || pthread_create(&pool->threads[i], NULL, worker_main, start) != 0) {
+			free(start);
+			stop_workers(pool, i);
+			pool->n_workers = 0;
+			thread_pool_destroy(pool);
+			return NULL;
+		}
+	}
+
+	return pool;
+}
+
+void thread_pool_run(struct thread_pool *pool, thread_pool_fn fn, void *arg)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->fn = fn;
+	pool->arg = arg;
+	pool->running = pool->n_workers;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->work_posted);
+
+	while (pool->running > 0)
+		pthread_cond_wait(&pool->work_done, &pool->lock);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+int thread_pool_size(const struct thread_pool *pool)
+{
+	return pool->n_workers;
+}
+
+void thread_pool_destroy(struct thread_pool *pool)
+{
+	if (pool == NULL)
+		return;
+
+	stop_workers(pool, pool->n_workers);
+
+	pthread_cond_destroy(&pool->work_done);
+	pthread_cond_destroy(&pool->work_posted);
+	pthread_mutex_destroy(&pool->lock);
+	free(pool->threads);
+	free(pool);
+}
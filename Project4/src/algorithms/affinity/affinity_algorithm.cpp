@@ -0,0 +1,78 @@
+#include "algorithms/affinity/affinity_algorithm.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where you should define the logic for the process affinity algorithm.
+*/
+
+AFFINITYScheduler::AFFINITYScheduler(int slice, int window) : window(window) {
+    if (slice != -1) {
+        throw("AFFINITY must have a timeslice of -1");
+    }
+}
+
+std::shared_ptr<SchedulingDecision> AFFINITYScheduler::get_next_thread() {
+    auto decision = std::make_shared<SchedulingDecision>();
+
+    if (thread_count == 0) {
+        decision->thread = nullptr;
+        decision->explanation = "No threads available for scheduling.";
+        return decision;
+    }
+
+    size_t ready_threads = thread_count;
+    int oldest_process = oldest_threads.begin()->second;
+    auto loaded = process_queues.find(loaded_process);
+    bool loaded_ready = loaded != process_queues.end() && !loaded->second.empty();
+
+    // Staying on the loaded process only counts against the window if it skips an older thread
+    int next_process = oldest_process;
+    if (loaded_ready && loaded_process != oldest_process && bypass_count < window) {
+        next_process = loaded_process;
+        bypass_count++;
+    } else {
+        bypass_count = 0;
+    }
+
+    decision->thread = pop_thread(next_process);
+    decision->explanation = fmt::format("Selected from {} threads ({} process {}). Will run to completion of burst.",
+        ready_threads, next_process == loaded_process ? "stayed on" : "switched to", next_process);
+    decision->time_slice = -1;
+
+    loaded_process = next_process;
+    return decision;
+}
+
+void AFFINITYScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+    auto& queue = process_queues[thread->process_id];
+
+    if (queue.empty()) {
+        oldest_threads.insert({next_order, thread->process_id});
+    }
+    queue.push({next_order++, thread});
+    thread_count++;
+}
+
+size_t AFFINITYScheduler::size() const {
+    return thread_count;
+}
+
+std::shared_ptr<Thread> AFFINITYScheduler::pop_thread(int process_id) {
+    auto& queue = process_queues[process_id];
+    auto thread = queue.front().second;
+
+    // Re-key the process by its next oldest thread, if it has one
+    oldest_threads.erase({queue.front().first, process_id});
+    queue.pop();
+    if (!queue.empty()) {
+        oldest_threads.insert({queue.front().first, process_id});
+    }
+
+    thread_count--;
+    return thread;
+}
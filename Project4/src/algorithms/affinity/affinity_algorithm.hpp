@@ -0,0 +1,76 @@
+#ifndef AFFINITY_ALGORITHM_HPP
+#define AFFINITY_ALGORITHM_HPP
+
+#include <memory>
+#include <queue>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    AFFINITYScheduler:
+        A first-come, first-served scheduler that avoids process switches.
+
+        If a thread of the process that is currently loaded on the CPU is ready, it is
+        picked ahead of older threads from other processes, since dispatching it only costs
+        a thread switch. To keep this fair, at most `window` threads in a row may jump
+        ahead of an older thread this way; after that, the oldest ready thread runs.
+
+        Ready threads are kept in one FIFO sublist per process, so finding the threads
+        of a given process is O(1) and picking the oldest thread overall is O(log P).
+*/
+
+class AFFINITYScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    // The default number of consecutive picks that may bypass an older thread
+    static constexpr int DEFAULT_WINDOW = 4;
+
+    // Ready threads of each process, tagged with the order they became ready in
+    std::unordered_map<int, std::queue<std::pair<unsigned long, std::shared_ptr<Thread>>>> process_queues;
+
+    // (Order of the process's oldest ready thread, process ID) for every process with ready threads
+    std::set<std::pair<unsigned long, int>> oldest_threads;
+
+    // Number of threads in all the sublists
+    size_t thread_count = 0;
+
+    // Counter used to tag threads as they become ready
+    unsigned long next_order = 0;
+
+    // The process whose thread was dispatched last, i.e., the one loaded on the CPU
+    int loaded_process = -1;
+
+    // How many picks in a row have bypassed an older thread of another process
+    int bypass_count = 0;
+
+    // The maximum value of bypass_count
+    int window;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    AFFINITYScheduler(int slice = -1, int window = DEFAULT_WINDOW);
+
+    std::shared_ptr<SchedulingDecision> get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+private:
+
+    /*
+        pop_thread(process_id):
+            Removes and returns the oldest ready thread of the given process.
+    */
+    std::shared_ptr<Thread> pop_thread(int process_id);
+};
+
+#endif
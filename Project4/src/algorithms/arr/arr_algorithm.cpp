@@ -0,0 +1,92 @@
+#include "algorithms/arr/arr_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <vector>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where you should define the logic for the adaptive round robin algorithm.
+*/
+
+ARRScheduler::ARRScheduler(int slice) {
+    if (slice <= 0) {
+        this->time_slice = 3;
+    } else {
+        this->time_slice = slice;
+    }
+}
+
+std::shared_ptr<SchedulingDecision> ARRScheduler::get_next_thread() {
+    auto decision = std::make_shared<SchedulingDecision>();
+
+    if (readyQueue.empty()) {
+        decision->thread = nullptr;
+        decision->explanation = "No threads available for scheduling.";
+        return decision;
+    }
+
+    int ready_threads = readyQueue.size();
+    SimTime median = median_burst();
+    int quantum = std::max(this->time_slice, static_cast<int>(std::min<SimTime>(median, TARGET_LATENCY / ready_threads)));
+
+    decision->thread = readyQueue.front();
+    readyQueue.pop();
+
+    decision->explanation = fmt::format("Selected from {} threads (median burst = {}). Will run for at most {} ticks.",
+        ready_threads, median, quantum);
+    decision->time_slice = quantum;
+    return decision;
+}
+
+void ARRScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+    auto& info = burst_info[thread.get()];
+
+    info.burst_time += thread->service_time - info.last_service_time;
+    info.last_service_time = thread->service_time;
+
+    // A thread coming back from I/O finished a whole CPU burst before it blocked
+    if (thread->previous_state == BLOCKED) {
+        record_burst(info.burst_time);
+        info.burst_time = 0;
+    }
+
+    readyQueue.push(thread);
+}
+
+void ARRScheduler::thread_exited(std::shared_ptr<Thread> thread) {
+    auto info = burst_info.find(thread.get());
+    SimTime last_service_time = info == burst_info.end() ? 0 : info->second.last_service_time;
+    SimTime burst_time = info == burst_info.end() ? 0 : info->second.burst_time;
+
+    // The last burst ends with the thread rather than with a wait for I/O
+    record_burst(burst_time + thread->service_time - last_service_time);
+    if (info != burst_info.end()) {
+        burst_info.erase(info);
+    }
+}
+
+size_t ARRScheduler::size() const {
+    return readyQueue.size();
+}
+
+SimTime ARRScheduler::median_burst() const {
+    if (recent_bursts.empty()) {
+        return TARGET_LATENCY;
+    }
+
+    std::vector<SimTime> bursts(recent_bursts.begin(), recent_bursts.end());
+    auto middle = bursts.begin() + bursts.size() / 2;
+    std::nth_element(bursts.begin(), middle, bursts.end());
+    return *middle;
+}
+
+void ARRScheduler::record_burst(SimTime burst_time) {
+    recent_bursts.push_back(burst_time);
+    if (recent_bursts.size() > BURST_HISTORY) {
+        recent_bursts.pop_front();
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef ARR_ALGORITHM_HPP
+#define ARR_ALGORITHM_HPP
+
+#include <deque>
+#include <memory>
+#include <queue>
+#include <unordered_map>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    ARRScheduler:
+        A round robin scheduling algorithm whose quantum adapts to the workload.
+
+        Threads are served in the order they became ready, like RR, but the quantum is
+        recomputed for every dispatch as
+
+            quantum = max(time_slice, min(median recent burst, TARGET_LATENCY / ready threads))
+
+        The median of the last BURST_HISTORY CPU bursts lets most bursts finish within one
+        quantum, while dividing TARGET_LATENCY between the ready threads bounds how long a
+        thread waits for its turn when the queue is long. time_slice is the minimum quantum,
+        so dispatch overhead cannot dominate.
+
+        Burst lengths are observed rather than read ahead: the service time a thread gets
+        between two waits for I/O, or between its last wait and its exit, is one burst.
+*/
+
+class ARRScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    // Time within which every ready thread should get a turn
+    static constexpr int TARGET_LATENCY = 24;
+
+    // Number of recent CPU bursts the median is taken over
+    static constexpr size_t BURST_HISTORY = 16;
+
+    // Queue to hold threads in order of arrival
+    std::queue<std::shared_ptr<Thread>> readyQueue;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    ARRScheduler(int slice = 3);
+
+    std::shared_ptr<SchedulingDecision> get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    void thread_exited(std::shared_ptr<Thread> thread);
+
+private:
+
+    /*
+        BurstInfo:
+            The service time a thread has got in its current CPU burst, and its service time
+            the last time it was added to the ready queue.
+    */
+    struct BurstInfo {
+        SimTime burst_time = 0;
+        SimTime last_service_time = 0;
+    };
+
+    std::unordered_map<const Thread*, BurstInfo> burst_info;
+
+    // Lengths of the most recent CPU bursts, oldest first
+    std::deque<SimTime> recent_bursts;
+
+    /*
+        median_burst():
+            The median of the recent CPU bursts, or TARGET_LATENCY if none have finished yet.
+    */
+    SimTime median_burst() const;
+
+    /*
+        record_burst(burst_time):
+            Adds a finished CPU burst to the recent bursts, dropping the oldest one if needed.
+    */
+    void record_burst(SimTime burst_time);
+};
+
+#endif
@@ -0,0 +1,58 @@
+#include "algorithms/edf/edf_algorithm.hpp"
+
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where you should define the logic for the EDF algorithm.
+*/
+
+EDFScheduler::EDFScheduler(int slice) {
+    if (slice != -1) {
+        throw("EDF must have a timeslice of -1");
+    }
+}
+
+std::shared_ptr<SchedulingDecision> EDFScheduler::get_next_thread() {
+    auto decision = std::make_shared<SchedulingDecision>();
+
+    if (readyQueue.empty()) {
+        decision->thread = nullptr;
+        decision->explanation = "No threads available for scheduling.";
+        return decision;
+    }
+
+    size_t ready_threads = readyQueue.size();
+    decision->thread = readyQueue.top();
+    readyQueue.pop();
+
+    if (decision->thread->deadline >= 0) {
+        decision->explanation = fmt::format("Selected from {} threads (deadline = {}). Will run to completion of burst or until preempted.",
+            ready_threads, decision->thread->deadline);
+    } else {
+        decision->explanation = fmt::format("Selected from {} threads (no deadline). Will run to completion of burst or until preempted.",
+            ready_threads);
+    }
+    decision->time_slice = -1;
+    return decision;
+}
+
+void EDFScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+    readyQueue.push(deadline_key(thread), thread);
+}
+
+size_t EDFScheduler::size() const {
+    return readyQueue.size();
+}
+
+bool EDFScheduler::should_preempt(std::shared_ptr<Thread> running) {
+    return !readyQueue.empty() && deadline_key(readyQueue.top()) < deadline_key(running);
+}
+
+SimTime EDFScheduler::deadline_key(const std::shared_ptr<Thread>& thread) {
+    return thread->deadline >= 0 ? thread->deadline : std::numeric_limits<SimTime>::max();
+}
@@ -0,0 +1,51 @@
+#ifndef EDF_ALGORITHM_HPP
+#define EDF_ALGORITHM_HPP
+
+#include <memory>
+#include "algorithms/scheduling_algorithm.hpp"
+#include "utilities/stable_priority_queue/stable_priority_queue.hpp"
+
+/*
+    EDFScheduler:
+        A preemptive earliest-deadline-first scheduling algorithm.
+
+        Ready threads are ordered by their absolute deadline, with ties broken in the order
+        they became ready. Threads without a deadline run only when no thread with a deadline
+        is ready, in first-come, first-served order. A thread that becomes ready with an earlier
+        deadline than the running thread preempts it.
+*/
+
+class EDFScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    // Queue to hold threads ordered by deadline
+    Stable_Priority_Queue<std::shared_ptr<Thread>, SimTime> readyQueue;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    EDFScheduler(int slice = -1);
+
+    std::shared_ptr<SchedulingDecision> get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    bool should_preempt(std::shared_ptr<Thread> running);
+
+private:
+
+    /*
+        deadline_key(thread):
+            The thread's deadline, or the latest possible time if it has none.
+    */
+    static SimTime deadline_key(const std::shared_ptr<Thread>& thread);
+};
+
+#endif
@@ -0,0 +1,102 @@
+#include "algorithms/fair/fair_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where you should define the logic for the fair-share algorithm.
+*/
+
+FAIRScheduler::FAIRScheduler(int slice) {
+    if (slice <= 0) {
+        this->time_slice = 3;
+    } else {
+        this->time_slice = slice;
+    }
+}
+
+std::shared_ptr<SchedulingDecision> FAIRScheduler::get_next_thread() {
+    auto decision = std::make_shared<SchedulingDecision>();
+
+    // The last selected thread has left the CPU, so it can be charged now
+    if (last_selected) {
+        charge(last_selected);
+        last_selected = nullptr;
+    }
+
+    if (ready_groups.empty()) {
+        decision->thread = nullptr;
+        decision->explanation = "No threads available for scheduling.";
+        return decision;
+    }
+
+    size_t ready_threads = num_ready;
+    size_t ready_processes = ready_groups.size();
+
+    Group& group = groups[std::get<2>(*ready_groups.begin())];
+    min_vruntime = group.vruntime;
+
+    auto first = group.ready_threads.begin();
+    decision->thread = std::get<2>(*first);
+    group.min_vruntime = std::get<0>(*first);
+    group.ready_threads.erase(first);
+    num_ready--;
+
+    if (group.ready_threads.empty()) {
+        ready_groups.erase(group.entry);
+    }
+    last_selected = decision->thread;
+
+    decision->explanation = fmt::format("Selected from {} threads in {} processes (process vruntime = {}, thread vruntime = {}). Will run for at most {} ticks.",
+        ready_threads, ready_processes, group.vruntime, group.min_vruntime, this->time_slice);
+    decision->time_slice = this->time_slice;
+    return decision;
+}
+
+void FAIRScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+    charge(thread);
+
+    Group& group = groups[thread->process_id];
+    ThreadInfo& info = thread_info[thread.get()];
+
+    if (thread->previous_state != RUNNING) {
+        info.vruntime = std::max(info.vruntime, group.min_vruntime);
+    }
+
+    if (group.ready_threads.empty()) {
+        group.vruntime = std::max(group.vruntime, min_vruntime);
+        group.entry = GroupEntry(group.vruntime, next_order++, thread->process_id);
+        ready_groups.insert(group.entry);
+    }
+
+    group.ready_threads.insert(ThreadEntry(info.vruntime, next_order++, thread));
+    num_ready++;
+}
+
+size_t FAIRScheduler::size() const {
+    return num_ready;
+}
+
+void FAIRScheduler::charge(const std::shared_ptr<Thread>& thread) {
+    ThreadInfo& info = thread_info[thread.get()];
+    SimTime delta = thread->service_time - info.last_service_time;
+    if (delta <= 0) {
+        return;
+    }
+    info.vruntime += delta;
+    info.last_service_time = thread->service_time;
+
+    Group& group = groups[thread->process_id];
+    group.vruntime += delta;
+
+    // Move the process to its new position if it is waiting to run
+    if (!group.ready_threads.empty()) {
+        ready_groups.erase(group.entry);
+        std::get<0>(group.entry) = group.vruntime;
+        ready_groups.insert(group.entry);
+    }
+}
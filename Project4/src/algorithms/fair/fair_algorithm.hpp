@@ -0,0 +1,108 @@
+#ifndef FAIR_ALGORITHM_HPP
+#define FAIR_ALGORITHM_HPP
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    FAIRScheduler:
+        A two-level fair-share scheduling algorithm, modeled on the CPU controller of Linux
+        control groups. Every process is a group: the CPU is first shared equally between the
+        processes with ready threads, then equally between the ready threads of that process.
+        A process with many threads gets no more CPU than a process with one.
+
+        Every process and every thread has a virtual runtime, the CPU time it has been charged.
+        The process with the lowest virtual runtime is picked, then its ready thread with the
+        lowest virtual runtime, with ties broken in the order they became ready. Both levels are
+        ordered sets, so selection is O(log n) in the number of processes and threads.
+
+        A thread is charged when it leaves the CPU, by the service time it got since it was last
+        charged. A process or thread that (re)joins after sleeping starts no earlier than the
+        virtual runtime of the last one selected at its level, so it cannot build up credit
+        while it is away.
+*/
+
+class FAIRScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    FAIRScheduler(int slice = 3);
+
+    std::shared_ptr<SchedulingDecision> get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+private:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    // (virtual runtime, order it became ready in, thread)
+    using ThreadEntry = std::tuple<uint64_t, unsigned long, std::shared_ptr<Thread>>;
+
+    // (virtual runtime, order it became ready in, process id)
+    using GroupEntry = std::tuple<uint64_t, unsigned long, int>;
+
+    /*
+        ThreadInfo:
+            The virtual runtime of a thread, and its service time the last time it was charged.
+    */
+    struct ThreadInfo {
+        uint64_t vruntime = 0;
+        SimTime last_service_time = 0;
+    };
+
+    /*
+        Group:
+            The scheduling state of a process: its virtual runtime, its ready threads, and the
+            virtual runtime of its last selected thread. While the process has ready threads,
+            entry is its position in ready_groups.
+    */
+    struct Group {
+        uint64_t vruntime = 0;
+        uint64_t min_vruntime = 0;
+        std::set<ThreadEntry> ready_threads;
+        GroupEntry entry;
+    };
+
+    std::unordered_map<int, Group> groups;
+
+    std::unordered_map<const Thread*, ThreadInfo> thread_info;
+
+    // The processes with ready threads
+    std::set<GroupEntry> ready_groups;
+
+    // The virtual runtime of the last process selected
+    uint64_t min_vruntime = 0;
+
+    // The last thread selected, which has not been charged yet
+    std::shared_ptr<Thread> last_selected;
+
+    // Counter used to break ties between equal virtual runtimes
+    unsigned long next_order = 0;
+
+    size_t num_ready = 0;
+
+    //==================================================
+    //  Helper functions
+    //==================================================
+
+    /*
+        charge(thread):
+            Adds the service time the thread got since it was last charged to its own
+            and its process's virtual runtime.
+    */
+    void charge(const std::shared_ptr<Thread>& thread);
+};
+
+#endif
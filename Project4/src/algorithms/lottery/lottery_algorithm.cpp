@@ -0,0 +1,115 @@
+#include "algorithms/lottery/lottery_algorithm.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+#include "algorithms/shares.hpp"
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where you should define the logic for the lottery algorithm.
+*/
+
+LOTTERYScheduler::LOTTERYScheduler(int slice, unsigned int seed) : rng(seed) {
+    if (slice <= 0) {
+        this->time_slice = 3;
+    } else {
+        this->time_slice = slice;
+    }
+}
+
+std::shared_ptr<SchedulingDecision> LOTTERYScheduler::get_next_thread() {
+    auto decision = std::make_shared<SchedulingDecision>();
+
+    if (thread_count == 0) {
+        decision->thread = nullptr;
+        decision->explanation = "No threads available for scheduling.";
+        return decision;
+    }
+
+    size_t ready_threads = thread_count;
+    int64_t ticket = std::uniform_int_distribution<int64_t>(0, total_tickets - 1)(rng);
+    size_t slot = find(ticket);
+
+    decision->thread = slots[slot];
+    slots[slot] = nullptr;
+    free_slots.push_back(slot);
+    update(slot, -tickets(decision->thread));
+    thread_count--;
+
+    decision->explanation = fmt::format("Selected from {} threads (ticket {} of {}). Will run for at most {} ticks.",
+        ready_threads, ticket, total_tickets + tickets(decision->thread), this->time_slice);
+    decision->time_slice = this->time_slice;
+    return decision;
+}
+
+void LOTTERYScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+    if (free_slots.empty()) {
+        grow();
+    }
+
+    size_t slot = free_slots.back();
+    free_slots.pop_back();
+
+    slots[slot] = thread;
+    update(slot, tickets(thread));
+    thread_count++;
+}
+
+size_t LOTTERYScheduler::size() const {
+    return thread_count;
+}
+
+int LOTTERYScheduler::tickets(std::shared_ptr<Thread> thread) const {
+    return TICKETS_PER_PRIORITY[thread->priority];
+}
+
+void LOTTERYScheduler::update(size_t slot, int64_t delta) {
+    total_tickets += delta;
+    for (size_t i = slot + 1; i < tree.size(); i += i & (~i + 1)) {
+        tree[i] += delta;
+    }
+}
+
+size_t LOTTERYScheduler::find(int64_t ticket) const {
+    // Walk down the tree, skipping over every subtree whose tickets all come before this one
+    size_t position = 0;
+    size_t step = 1;
+    while (step * 2 < tree.size()) {
+        step *= 2;
+    }
+
+    for (; step > 0; step /= 2) {
+        if (position + step < tree.size() && tree[position + step] <= ticket) {
+            position += step;
+            ticket -= tree[position];
+        }
+    }
+
+    // position is the number of slots before the one holding the ticket
+    return position;
+}
+
+void LOTTERYScheduler::grow() {
+    size_t old_size = slots.size();
+    size_t new_size = old_size == 0 ? 16 : old_size * 2;
+
+    slots.resize(new_size);
+    for (size_t slot = new_size; slot > old_size; --slot) {
+        free_slots.push_back(slot - 1);
+    }
+
+    // Rebuild the tree in O(n) from the tickets in each slot
+    tree.assign(new_size + 1, 0);
+    for (size_t i = 1; i <= new_size; ++i) {
+        if (slots[i - 1]) {
+            tree[i] += tickets(slots[i - 1]);
+        }
+        size_t parent = i + (i & (~i + 1));
+        if (parent <= new_size) {
+            tree[parent] += tree[i];
+        }
+    }
+}
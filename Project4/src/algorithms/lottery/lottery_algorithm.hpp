@@ -0,0 +1,87 @@
+#ifndef LOTTERY_ALGORITHM_HPP
+#define LOTTERY_ALGORITHM_HPP
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    LOTTERYScheduler:
+        A lottery scheduling algorithm, which divides the CPU between threads in proportion
+        to their tickets (see algorithms/shares.hpp), on average.
+
+        Every time a thread is needed, a ticket is drawn at random from all the tickets held by
+        ready threads, and the thread holding it runs for one time slice. The random number
+        generator is seeded with the --seed flag, so runs are reproducible.
+
+        Each ready thread occupies a slot in a Fenwick (binary indexed) tree of ticket counts, so
+        that both adding a thread and finding the holder of a ticket take O(log n). Slots are
+        reused once their thread is selected.
+*/
+
+class LOTTERYScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    LOTTERYScheduler(int slice = 3, unsigned int seed = 1);
+
+    std::shared_ptr<SchedulingDecision> get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    int tickets(std::shared_ptr<Thread> thread) const;
+
+private:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    // The thread in each slot, or nullptr if the slot is free
+    std::vector<std::shared_ptr<Thread>> slots;
+
+    // Fenwick tree over the tickets in each slot, 1-indexed (tree[0] is unused)
+    std::vector<int64_t> tree;
+
+    // Slots that are not holding a thread
+    std::vector<size_t> free_slots;
+
+    // Total tickets held by ready threads
+    int64_t total_tickets = 0;
+
+    size_t thread_count = 0;
+
+    std::mt19937_64 rng;
+
+    //==================================================
+    //  Helper functions
+    //==================================================
+
+    /*
+        update(slot, delta):
+            Adds delta to the tickets in the given slot.
+    */
+    void update(size_t slot, int64_t delta);
+
+    /*
+        find(ticket):
+            Returns the slot holding the given ticket, where tickets are numbered from 0
+            through the slots in order.
+    */
+    size_t find(int64_t ticket) const;
+
+    /*
+        grow():
+            Doubles the number of slots, rebuilding the Fenwick tree.
+    */
+    void grow();
+};
+
+#endif
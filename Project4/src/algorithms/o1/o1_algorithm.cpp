@@ -0,0 +1,111 @@
+#include "algorithms/o1/o1_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where you should define the logic for the O(1) algorithm.
+*/
+
+O1Scheduler::O1Scheduler(int slice) {
+    if (slice <= 0) {
+        this->time_slice = 3;
+    } else {
+        this->time_slice = slice;
+    }
+}
+
+std::shared_ptr<SchedulingDecision> O1Scheduler::get_next_thread() {
+    auto decision = std::make_shared<SchedulingDecision>();
+
+    if (size() == 0) {
+        decision->thread = nullptr;
+        decision->explanation = "No threads available for scheduling.";
+        return decision;
+    }
+
+    // Every active thread has used up its slice, so start a new round with the expired ones
+    if (active->count == 0) {
+        std::swap(active, expired);
+        expired_since = -1;
+    }
+
+    size_t ready_threads = size();
+    int level = top_level(*active);
+    auto& queue = active->queues[level];
+
+    decision->thread = queue.front();
+    queue.pop();
+    active->count--;
+    if (queue.empty()) {
+        active->bitmap &= ~(uint64_t(1) << level);
+    }
+
+    decision->explanation = fmt::format("Selected from {} threads (level = {}, bonus = {}, expired = {}). Will run for at most {} ticks.",
+        ready_threads, level, bonus(decision->thread), expired->count, this->time_slice);
+    decision->time_slice = this->time_slice;
+    return decision;
+}
+
+void O1Scheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+    auto& info = thread_info[thread.get()];
+
+    // Time spent on the CPU since the last time the thread was ready counts against its bonus
+    SimTime ran = thread->service_time - info.last_service_time;
+    info.sleep_avg = static_cast<int>(std::max<SimTime>(0, info.sleep_avg - ran));
+    info.last_service_time = thread->service_time;
+
+    int level = dynamic_priority(thread);
+    SimTime now = thread->state_change_time;
+
+    // Only a thread that was preempted after running for its whole slice has expired
+    bool slice_expired = thread->previous_state == RUNNING && ran >= this->time_slice;
+    bool starving = expired->count > 0 && now - expired_since >= STARVATION_LIMIT;
+
+    if (slice_expired && (bonus(thread) < INTERACTIVE_BONUS || starving)) {
+        if (expired->count == 0) {
+            expired_since = now;
+        }
+        enqueue(*expired, level, thread);
+    } else {
+        enqueue(*active, level, thread);
+    }
+}
+
+size_t O1Scheduler::size() const {
+    return active->count + expired->count;
+}
+
+bool O1Scheduler::should_preempt(std::shared_ptr<Thread> running) {
+    return active->count > 0 && top_level(*active) < dynamic_priority(running);
+}
+
+void O1Scheduler::thread_woke(std::shared_ptr<Thread> thread, SimTime sleep_time) {
+    auto& info = thread_info[thread.get()];
+    info.sleep_avg = static_cast<int>(std::min<SimTime>(MAX_SLEEP_AVG, info.sleep_avg + sleep_time));
+}
+
+int O1Scheduler::bonus(const std::shared_ptr<Thread>& thread) {
+    // Maps sleep_avg from [0, MAX_SLEEP_AVG] onto [-MAX_BONUS, MAX_BONUS]
+    return thread_info[thread.get()].sleep_avg * 2 * MAX_BONUS / MAX_SLEEP_AVG - MAX_BONUS;
+}
+
+int O1Scheduler::dynamic_priority(const std::shared_ptr<Thread>& thread) {
+    int static_priority = thread->priority * LEVELS_PER_CLASS + LEVELS_PER_CLASS / 2;
+    return std::clamp(static_priority - bonus(thread), 0, LEVELS - 1);
+}
+
+int O1Scheduler::top_level(const PriorityArray& array) {
+    return __builtin_ctzll(array.bitmap);
+}
+
+void O1Scheduler::enqueue(PriorityArray& array, int level, std::shared_ptr<Thread> thread) {
+    array.queues[level].push(thread);
+    array.bitmap |= uint64_t(1) << level;
+    array.count++;
+}
@@ -0,0 +1,119 @@
+#ifndef O1_ALGORITHM_HPP
+#define O1_ALGORITHM_HPP
+
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <unordered_map>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    O1Scheduler:
+        A scheduler modeled on the classic Linux O(1) scheduler.
+
+        Each process priority class covers 10 of the 40 priority levels (SYSTEM is 0-9,
+        INTERACTIVE is 10-19, and so on), and a thread's static priority is the middle of its
+        class. Its dynamic priority is the static priority minus an interactivity bonus between
+        -5 and +5, which grows with the time the thread spends sleeping on IO and shrinks with
+        the time it spends on the CPU.
+
+        There are two priority arrays, each with a FIFO queue per level and a bitmap of which
+        levels are non-empty, so the highest priority thread is found in O(1). Threads run from
+        the active array. A thread that uses up its time slice moves to the expired array, unless
+        it is interactive (in which case it goes back into the active array, as long as the expired
+        threads are not starving). When the active array runs out, the two arrays are swapped.
+
+        A thread that wakes up with a higher dynamic priority than the running thread preempts it.
+*/
+
+class O1Scheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    // Number of priority levels, and levels per process priority class
+    static constexpr int LEVELS = 40;
+    static constexpr int LEVELS_PER_CLASS = 10;
+
+    // The bonus ranges from -MAX_BONUS to +MAX_BONUS
+    static constexpr int MAX_BONUS = 5;
+
+    // sleep_avg is capped at this many ticks
+    static constexpr int MAX_SLEEP_AVG = 100;
+
+    // A thread with at least this bonus is interactive
+    static constexpr int INTERACTIVE_BONUS = 3;
+
+    // Once the oldest expired thread has waited this long, interactive threads expire too
+    static constexpr int STARVATION_LIMIT = 100;
+
+    /*
+        PriorityArray:
+            A FIFO queue for each priority level, and a bitmap with bit i set if queue i is non-empty.
+    */
+    struct PriorityArray {
+        uint64_t bitmap = 0;
+        std::queue<std::shared_ptr<Thread>> queues[LEVELS];
+        size_t count = 0;
+    };
+
+    PriorityArray arrays[2];
+
+    PriorityArray* active = &arrays[0];
+
+    PriorityArray* expired = &arrays[1];
+
+    // When the first thread went into the (currently) expired array, if it is non-empty
+    SimTime expired_since = -1;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    O1Scheduler(int slice = 3);
+
+    std::shared_ptr<SchedulingDecision> get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    bool should_preempt(std::shared_ptr<Thread> running);
+
+    void thread_woke(std::shared_ptr<Thread> thread, SimTime sleep_time);
+
+private:
+
+    /*
+        ThreadInfo:
+            The interactivity estimate of a thread, and the service time it had the
+            last time it was added to the ready queue. New threads start out neutral.
+    */
+    struct ThreadInfo {
+        int sleep_avg = MAX_SLEEP_AVG / 2;
+        SimTime last_service_time = 0;
+    };
+
+    std::unordered_map<const Thread*, ThreadInfo> thread_info;
+
+    /*
+        bonus(thread), dynamic_priority(thread):
+            The thread's current interactivity bonus, and the level it is queued at.
+    */
+    int bonus(const std::shared_ptr<Thread>& thread);
+
+    int dynamic_priority(const std::shared_ptr<Thread>& thread);
+
+    /*
+        top_level(array):
+            Returns the highest priority (lowest numbered) non-empty level of the array.
+            The array must not be empty.
+    */
+    static int top_level(const PriorityArray& array);
+
+    static void enqueue(PriorityArray& array, int level, std::shared_ptr<Thread> thread);
+};
+
+#endif
@@ -11,10 +11,14 @@
     Here is where you should define the logic for the priority algorithm.
 */
 
-PRIORITYScheduler::PRIORITYScheduler(int slice) {
+PRIORITYScheduler::PRIORITYScheduler(int slice, bool preemptive, int aging_interval)
+    : preemptive(preemptive), aging_interval(aging_interval) {
     if (slice != -1) {
         throw("PRIORITY must have a timeslice of -1");
     }
+    if (aging_interval < 0) {
+        throw("PRIORITY must have a non-negative aging interval");
+    }
 }
 
 std::shared_ptr<SchedulingDecision> PRIORITYScheduler::get_next_thread() {
@@ -29,11 +33,13 @@ std::shared_ptr<SchedulingDecision> PRIORITYScheduler::get_next_thread() {
     auto decision = std::make_shared<SchedulingDecision>();
     auto next_thread = this->readyQueue.top();
     int priority = next_thread->priority;
+    running_key = key(next_thread);
     readyQueue.pop();
 
     decision->explanation = "[S: " + std::to_string(threadCounts[0]) + " I: " + std::to_string(threadCounts[1]) + " N: " + std::to_string(threadCounts[2]) + " B: " + std::to_string(threadCounts[3]) + "] -> ";
     threadCounts[priority] -= 1;
-    decision->explanation += "[S: " + std::to_string(threadCounts[0]) + " I: " + std::to_string(threadCounts[1]) + " N: " + std::to_string(threadCounts[2]) + " B: " + std::to_string(threadCounts[3]) + "]. Will run to completion of burst.";
+    decision->explanation += "[S: " + std::to_string(threadCounts[0]) + " I: " + std::to_string(threadCounts[1]) + " N: " + std::to_string(threadCounts[2]) + " B: " + std::to_string(threadCounts[3]) + "].";
+    decision->explanation += preemptive ? " Will run to completion of burst or until preempted." : " Will run to completion of burst.";
     
     decision->thread = next_thread;
 
@@ -41,11 +47,24 @@ std::shared_ptr<SchedulingDecision> PRIORITYScheduler::get_next_thread() {
 }
 
 void PRIORITYScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
-    this->readyQueue.push(thread->priority,thread);
+    this->readyQueue.push(key(thread), thread);
 
     threadCounts[thread->priority] += 1;
 }
 
 size_t PRIORITYScheduler::size() const {
     return this->readyQueue.size();
-}
\ No newline at end of file
+}
+
+bool PRIORITYScheduler::should_preempt(std::shared_ptr<Thread> running) {
+    // The running thread keeps the key it was selected with, so only a thread that would
+    // have been selected ahead of it can take the CPU
+    return preemptive && !readyQueue.empty() && key(readyQueue.top()) < running_key;
+}
+
+SimTime PRIORITYScheduler::key(const std::shared_ptr<Thread>& thread) const {
+    if (aging_interval == 0) {
+        return thread->priority;
+    }
+    return static_cast<SimTime>(thread->priority) * aging_interval + thread->state_change_time;
+}
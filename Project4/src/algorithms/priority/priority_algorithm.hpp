@@ -13,6 +13,15 @@
     PRIORITYScheduler:
         A representation of a priority scheduling algorithm.
 
+        In preemptive mode (PRIORITY-P), a thread that becomes ready with a higher priority
+        than the running thread kicks the running thread off the CPU.
+
+        With aging, a thread is raised by one priority class for every aging_interval ticks
+        it waits, so low priority threads cannot starve. Rather than rescanning the queue,
+        threads are ordered by the key priority * aging_interval + time they became ready:
+        a thread's effective priority at time t is (key - t) / aging_interval, and since every
+        waiting thread ages at the same rate, the order of the keys never changes.
+
         This is a derived class from the base scheduling algorithm class.
 
         You are free to add any member functions or member variables that you
@@ -20,15 +29,30 @@
 */
 
 // "typedef" this type
-using PriorityQueue = Stable_Priority_Queue<std::shared_ptr<Thread>>; 
+using PriorityQueue = Stable_Priority_Queue<std::shared_ptr<Thread>, SimTime>; 
 
 class PRIORITYScheduler : public Scheduler {
 private:
         //==================================================
         //  Member variables
         //==================================================
-        Stable_Priority_Queue<std::shared_ptr<Thread>> readyQueue;
-        int threadCounts[4];
+        PriorityQueue readyQueue;
+        int threadCounts[4] = {0, 0, 0, 0};
+
+        // Whether a higher priority arrival preempts the running thread
+        bool preemptive = false;
+
+        // Ticks of waiting that raise a thread by one priority class, 0 for no aging
+        int aging_interval = 0;
+
+        // The key the last selected thread had in the ready queue
+        SimTime running_key = 0;
+
+        /*
+            key(thread):
+                The thread's position in the ready queue; lower runs first.
+        */
+        SimTime key(const std::shared_ptr<Thread>& thread) const;
         
 public:
 
@@ -36,7 +60,7 @@ public:
         //  Member functions
         //==================================================
 
-        PRIORITYScheduler(int slice = -1);
+        PRIORITYScheduler(int slice = -1, bool preemptive = false, int aging_interval = 0);
 
         std::shared_ptr<SchedulingDecision> get_next_thread();
 
@@ -44,6 +68,8 @@ public:
 
         size_t size() const;
 
+        bool should_preempt(std::shared_ptr<Thread> running);
+
 };
 
 #endif
@@ -65,6 +65,36 @@ public:
     */
     virtual size_t size() const = 0;
 
+    /*
+        should_preempt(running):
+            Called whenever a thread becomes ready while another thread is on the CPU. Preemptive
+            algorithms override this to return true if the running thread should be kicked off the
+            CPU in favor of a thread in the ready queue. By default, nothing is ever preempted.
+    */
+    virtual bool should_preempt(std::shared_ptr<Thread> running) { return false; }
+
+    /*
+        thread_woke(thread, sleep_time):
+            Called when a thread finishes an IO burst, right before it is added back to the ready
+            queue. sleep_time is how long it was blocked. Algorithms that reward threads for
+            sleeping (e.g., to detect interactive threads) can override this.
+    */
+    virtual void thread_woke(std::shared_ptr<Thread> thread, SimTime sleep_time) {}
+
+    /*
+        thread_exited(thread):
+            Called when a thread finishes its last CPU burst, after its service time has been
+            updated. Algorithms that keep per-thread state or learn from bursts can override this.
+    */
+    virtual void thread_exited(std::shared_ptr<Thread> thread) {}
+
+    /*
+        tickets(thread):
+            For proportional-share algorithms, the number of tickets the thread holds, which
+            determines its target share of the CPU. 0 for all other algorithms.
+    */
+    virtual int tickets(std::shared_ptr<Thread> thread) const { return 0; }
+
     /*
         empty():
             This function returns a true boolean value if the scheduler has no more threads in
@@ -0,0 +1,19 @@
+#ifndef SHARES_HPP
+#define SHARES_HPP
+
+#include "types/enums.hpp"
+
+/*
+    The number of tickets each thread holds in the proportional-share algorithms (stride and
+    lottery), based on its process priority. When every thread is competing for the CPU, a
+    thread's share of the CPU is its tickets divided by the total number of tickets, so e.g. a
+    SYSTEM thread gets twice the CPU time of an INTERACTIVE thread.
+*/
+inline const int TICKETS_PER_PRIORITY[4] = {
+    800,    // SYSTEM
+    400,    // INTERACTIVE
+    200,    // NORMAL
+    100     // BATCH
+};
+
+#endif
@@ -23,7 +23,7 @@ public:
     //==================================================
 
     // Queue to hold threads in order of arrival
-    Stable_Priority_Queue<std::shared_ptr<Thread>> readyQueue;
+    Stable_Priority_Queue<std::shared_ptr<Thread>, SimTime> readyQueue;
 
     //==================================================
     //  Member functions
@@ -0,0 +1,66 @@
+#include "algorithms/stride/stride_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#include "algorithms/shares.hpp"
+
+#define FMT_HEADER_ONLY
+#include "utilities/fmt/format.h"
+
+/*
+    Here is where you should define the logic for the stride algorithm.
+*/
+
+STRIDEScheduler::STRIDEScheduler(int slice) {
+    if (slice <= 0) {
+        this->time_slice = 3;
+    } else {
+        this->time_slice = slice;
+    }
+}
+
+std::shared_ptr<SchedulingDecision> STRIDEScheduler::get_next_thread() {
+    auto decision = std::make_shared<SchedulingDecision>();
+
+    if (readyQueue.empty()) {
+        decision->thread = nullptr;
+        decision->explanation = "No threads available for scheduling.";
+        return decision;
+    }
+
+    size_t ready_threads = readyQueue.size();
+    uint64_t pass = std::get<0>(readyQueue.top());
+    decision->thread = std::get<2>(readyQueue.top());
+    readyQueue.pop();
+    global_pass = pass;
+
+    decision->explanation = fmt::format("Selected from {} threads (pass = {}, tickets = {}). Will run for at most {} ticks.",
+        ready_threads, pass, tickets(decision->thread), this->time_slice);
+    decision->time_slice = this->time_slice;
+    return decision;
+}
+
+void STRIDEScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+    auto& info = thread_info[thread.get()];
+
+    // Charge the thread for the time it spent on the CPU since it was last ready
+    uint64_t stride = STRIDE1 / tickets(thread);
+    info.pass += stride * (thread->service_time - info.last_service_time);
+    info.last_service_time = thread->service_time;
+
+    if (thread->previous_state != RUNNING) {
+        info.pass = std::max(info.pass, global_pass);
+    }
+
+    readyQueue.push(Entry(info.pass, next_order++, thread));
+}
+
+size_t STRIDEScheduler::size() const {
+    return readyQueue.size();
+}
+
+int STRIDEScheduler::tickets(std::shared_ptr<Thread> thread) const {
+    return TICKETS_PER_PRIORITY[thread->priority];
+}
@@ -0,0 +1,76 @@
+#ifndef STRIDE_ALGORITHM_HPP
+#define STRIDE_ALGORITHM_HPP
+
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    STRIDEScheduler:
+        A stride scheduling algorithm, which divides the CPU between threads in proportion
+        to their tickets (see algorithms/shares.hpp).
+
+        Every thread has a stride, inversely proportional to its tickets, and a pass value.
+        The thread with the lowest pass runs next, and for every tick it runs its pass grows
+        by its stride. Ready threads are kept in a min-heap on pass, with ties broken in the
+        order they became ready.
+
+        A thread that (re)joins the ready queue after arriving or sleeping starts no earlier than
+        the pass of the last thread selected, so it cannot build up credit while it is away.
+*/
+
+class STRIDEScheduler : public Scheduler {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    // Stride of a thread with one ticket
+    static constexpr uint64_t STRIDE1 = 1 << 20;
+
+    // (pass, order the thread became ready in, thread)
+    using Entry = std::tuple<uint64_t, unsigned long, std::shared_ptr<Thread>>;
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> readyQueue;
+
+    // The pass of the last thread that was selected
+    uint64_t global_pass = 0;
+
+    // Counter used to break ties between equal pass values
+    unsigned long next_order = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    STRIDEScheduler(int slice = 3);
+
+    std::shared_ptr<SchedulingDecision> get_next_thread();
+
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    size_t size() const;
+
+    int tickets(std::shared_ptr<Thread> thread) const;
+
+private:
+
+    /*
+        ThreadInfo:
+            The pass value of a thread, and its service time the last time it was
+            added to the ready queue.
+    */
+    struct ThreadInfo {
+        uint64_t pass = 0;
+        SimTime last_service_time = 0;
+    };
+
+    std::unordered_map<const Thread*, ThreadInfo> thread_info;
+};
+
+#endif
@@ -0,0 +1,45 @@
+#include "cpusim/cpusim.hpp"
+
+#include "simulation/simulation.hpp"
+
+SimulationResult run_simulation(const Workload& workload, const FlagOptions& options) {
+    FlagOptions flags = options;
+    if (flags.scheduler.empty()) {
+        flags.scheduler = "FCFS";
+    }
+
+    // Output is decided by the caller, so the logger stays quiet
+    flags.verbose = false;
+    flags.per_thread = false;
+    flags.metrics = false;
+    flags.extended_metrics = false;
+
+    Simulation simulation(flags);
+    simulation.load(workload);
+
+    SimulationResult result;
+    result.stats = simulation.simulate();
+
+    for (const auto& entry : simulation.processes) {
+        for (const auto& thread : entry.second->threads) {
+            ThreadResult thread_result;
+
+            thread_result.process_id = thread->process_id;
+            thread_result.thread_id = thread->thread_id;
+            thread_result.priority = thread->priority;
+            thread_result.arrival_time = thread->arrival_time;
+            thread_result.start_time = thread->start_time;
+            thread_result.end_time = thread->end_time;
+            thread_result.service_time = thread->service_time;
+            thread_result.io_time = thread->io_time;
+            thread_result.response_time = thread->response_time();
+            thread_result.turnaround_time = thread->turnaround_time();
+            thread_result.deadline = thread->deadline;
+            thread_result.max_wait_time = thread->max_wait_time;
+
+            result.threads.push_back(thread_result);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,67 @@
+#ifndef CPUSIM_HPP
+#define CPUSIM_HPP
+
+#include <vector>
+
+#include "types/enums.hpp"
+#include "types/sim_time.hpp"
+#include "types/system_stats/system_stats.hpp"
+#include "types/workload/workload.hpp"
+#include "utilities/flags/flags.hpp"
+
+/*
+    libcpusim:
+        The simulator as a library (make libcpusim.a). A workload is built in memory, run with
+        the scheduler and options chosen in a FlagOptions, and the results come back as structs.
+        Nothing is read from files or printed, so it is cheap to call many times, and separate
+        calls share no state, so they may run on different threads.
+
+        Only the simulation options of FlagOptions are used (scheduler, time_slice, switch_cost,
+        seed and aging); filename and the output flags are ignored. An empty scheduler means
+        FCFS, like on the command line.
+*/
+
+/*
+    ThreadResult:
+        The outcome of a single thread of the workload.
+*/
+
+struct ThreadResult {
+    int process_id;
+    int thread_id;
+    ProcessPriority priority;
+
+    SimTime arrival_time;
+    SimTime start_time;
+    SimTime end_time;
+    SimTime service_time;
+    SimTime io_time;
+    SimTime response_time;
+    SimTime turnaround_time;
+
+    // Absolute deadline, or -1 if the thread had none
+    SimTime deadline;
+
+    SimTime max_wait_time;
+};
+
+/*
+    SimulationResult:
+        The statistics of a run, and the results of its threads in process ID, then
+        thread ID order.
+*/
+
+struct SimulationResult {
+    SystemStats stats;
+    std::vector<ThreadResult> threads;
+};
+
+/*
+    run_simulation(workload, options):
+        Simulates the workload and returns the results. Throws std::invalid_argument if the
+        options name an unknown scheduler or switch cost model, and std::logic_error if the
+        workload is malformed.
+*/
+SimulationResult run_simulation(const Workload& workload, const FlagOptions& options);
+
+#endif
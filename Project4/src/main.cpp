@@ -1,7 +1,11 @@
+#include <fstream>
 #include <iostream>
 #include <string>
 
 #include "utilities/flags/flags.hpp"
+#include "utilities/logger/logger.hpp"
+#include "utilities/perf_import/perf_import.hpp"
+#include "monte_carlo/monte_carlo.hpp"
 #include "simulation/simulation.hpp"
 
 int main(int argc, char** argv) {
@@ -15,6 +19,26 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    // Only convert the trace to a simulation file
+    if (flags.perf_import && !flags.output.empty()) {
+        std::ifstream input(flags.filename);
+        std::ofstream output(flags.output);
+        if (!input || !output) {
+            std::cerr << "Unable to open " << (input ? flags.output : flags.filename) << std::endl;
+            return 1;
+        }
+
+        convert_perf_sched(input, output);
+        return 0;
+    }
+
+    // Summarize randomized replicas of a workload model
+    if (flags.replicas > 0) {
+        auto result = run_monte_carlo(read_workload_model(flags.filename), flags);
+        Logger().print_monte_carlo(result);
+        return 0;
+    }
+
     Simulation simulation(flags);
     simulation.run();
 
@@ -0,0 +1,361 @@
+#include "monte_carlo/monte_carlo.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "cpusim/cpusim.hpp"
+
+//==============================================================================
+// Workload models
+//==============================================================================
+
+SimTime Distribution::sample(std::mt19937_64& rng, SimTime min) const {
+    double value;
+
+    switch (kind) {
+        case UNIFORM:
+            value = std::uniform_int_distribution<SimTime>(std::llround(a), std::llround(b))(rng);
+            break;
+        case EXPONENTIAL:
+            value = std::ceil(std::exponential_distribution<double>(1.0 / a)(rng));
+            break;
+        default:
+            value = std::llround(a);
+            break;
+    }
+
+    return std::max(min, static_cast<SimTime>(value));
+}
+
+Workload WorkloadModel::generate(uint64_t seed) const {
+    std::mt19937_64 rng(seed);
+    std::discrete_distribution<int> priority(priority_weights, priority_weights + 4);
+
+    Workload workload;
+    workload.thread_switch_overhead = thread_switch_overhead;
+    workload.process_switch_overhead = process_switch_overhead;
+
+    for (int pid = 0; pid < processes; ++pid) {
+        ProcessSpec process;
+        process.process_id = pid;
+        process.priority = static_cast<ProcessPriority>(priority(rng));
+
+        int num_threads = static_cast<int>(threads.sample(rng, 1));
+        for (int n = 0; n < num_threads; ++n) {
+            ThreadSpec thread;
+            thread.arrival_time = arrival.sample(rng, 0);
+
+            int num_bursts = static_cast<int>(bursts.sample(rng, 1));
+            for (int burst = 0; burst < num_bursts; ++burst) {
+                thread.cpu_bursts.push_back(cpu.sample(rng, 1));
+                if (burst + 1 < num_bursts) {
+                    IOBurstSpec io_burst;
+                    io_burst.length = io.sample(rng, 1);
+                    thread.io_bursts.push_back(io_burst);
+                }
+            }
+
+            if (has_deadline) {
+                thread.relative_deadline = deadline.sample(rng, 0);
+            }
+            process.threads.push_back(std::move(thread));
+        }
+        workload.processes.push_back(std::move(process));
+    }
+
+    return workload;
+}
+
+/*
+    read_distribution(line, name):
+        Reads "fixed v", "uniform a b" or "exp mean" from the rest of a model file line.
+*/
+static Distribution read_distribution(std::istringstream& line, const std::string& name) {
+    Distribution distribution;
+    std::string kind;
+
+    line >> kind;
+    if (kind == "fixed" && line >> distribution.a) {
+        distribution.kind = Distribution::FIXED;
+    } else if (kind == "uniform" && line >> distribution.a >> distribution.b && distribution.a <= distribution.b) {
+        distribution.kind = Distribution::UNIFORM;
+    } else if (kind == "exp" && line >> distribution.a && distribution.a > 0) {
+        distribution.kind = Distribution::EXPONENTIAL;
+    } else {
+        throw(std::logic_error("Bad distribution for " + name + " in workload model."));
+    }
+
+    return distribution;
+}
+
+WorkloadModel read_workload_model(const std::string& filename) {
+    std::ifstream input_file(filename.c_str());
+
+    if (!input_file) {
+        std::cerr << "Unable to open workload model: " << filename << std::endl;
+        throw(std::logic_error("Bad file."));
+    }
+
+    WorkloadModel model;
+    std::string text;
+
+    while (std::getline(input_file, text)) {
+        // Everything after a '#' is a comment
+        std::istringstream line(text.substr(0, text.find('#')));
+        std::string key;
+        if (!(line >> key)) {
+            continue;
+        }
+
+        if (key == "overhead") {
+            line >> model.thread_switch_overhead >> model.process_switch_overhead;
+        } else if (key == "processes") {
+            line >> model.processes;
+        } else if (key == "threads") {
+            model.threads = read_distribution(line, key);
+        } else if (key == "arrival") {
+            model.arrival = read_distribution(line, key);
+        } else if (key == "bursts") {
+            model.bursts = read_distribution(line, key);
+        } else if (key == "cpu") {
+            model.cpu = read_distribution(line, key);
+        } else if (key == "io") {
+            model.io = read_distribution(line, key);
+        } else if (key == "deadline") {
+            model.deadline = read_distribution(line, key);
+            model.has_deadline = true;
+        } else if (key == "priority") {
+            for (double& weight : model.priority_weights) {
+                line >> weight;
+            }
+        } else {
+            throw(std::logic_error("Unknown workload model parameter: " + key));
+        }
+
+        if (line.fail()) {
+            throw(std::logic_error("Bad value for " + key + " in workload model."));
+        }
+    }
+
+    return model;
+}
+
+//==============================================================================
+// Replicated runs
+//==============================================================================
+
+/*
+    MetricValue:
+        One metric of one replica. NaN marks a metric that does not apply to the replica
+        (e.g., a priority class without threads). Metrics that can average out near zero
+        (differences such as lateness and dispatch time saved) do not gate early stopping,
+        since an interval relative to their mean may never get tight enough.
+*/
+struct MetricValue {
+    std::string name;
+    double value;
+    bool gates_stopping;
+};
+
+/*
+    metric_values(stats):
+        The metrics that are summarized, in the order they are printed.
+*/
+static std::vector<MetricValue> metric_values(const SystemStats& stats) {
+    static const char* const CLASS_NAMES[4] = {"SYSTEM", "INTERACTIVE", "NORMAL", "BATCH"};
+    const double none = std::nan("");
+
+    std::vector<MetricValue> values = {
+        {"Total elapsed time:", static_cast<double>(stats.total_time), true},
+        {"Total service time:", static_cast<double>(stats.total_service_time), true},
+        {"Total I/O time:", static_cast<double>(stats.total_io_time), true},
+        {"Total dispatch time:", static_cast<double>(stats.dispatch_time), true},
+        {"Total idle time:", static_cast<double>(stats.total_idle_time), true},
+        {"CPU utilization:", stats.cpu_utilization, true},
+        {"CPU efficiency:", stats.cpu_efficiency, true},
+        {"Thread switches:", static_cast<double>(stats.thread_switches), true},
+        {"Process switches:", static_cast<double>(stats.process_switches), true},
+        {"Dispatch time saved:", static_cast<double>(stats.dispatch_time_saved), false},
+        {"Total I/O wait time:", !stats.device_stats.empty() ? static_cast<double>(stats.total_io_wait_time) : none, true},
+    };
+
+    for (int i = 0; i < 4; ++i) {
+        bool present = stats.thread_counts[i] > 0;
+        std::string name = CLASS_NAMES[i];
+        values.push_back({name + " avg. response time:", present ? stats.avg_thread_response_times[i] : none, true});
+        values.push_back({name + " avg. turnaround time:", present ? stats.avg_thread_turnaround_times[i] : none, true});
+        values.push_back({name + " max. ready wait:", present ? static_cast<double>(stats.max_wait_times[i]) : none, true});
+    }
+
+    // Target shares are only set by proportional-share algorithms
+    bool has_shares = std::any_of(stats.target_shares, stats.target_shares + 4, [](double share) { return share > 0.0; });
+    for (int i = 0; i < 4; ++i) {
+        std::string name = CLASS_NAMES[i];
+        values.push_back({name + " target share:", has_shares ? stats.target_shares[i] : none, true});
+        values.push_back({name + " achieved share:", has_shares ? stats.achieved_shares[i] : none, true});
+    }
+
+    bool has_deadlines = stats.deadline_threads > 0;
+    values.push_back({"Deadline miss rate:", has_deadlines ? stats.deadline_miss_rate : none, true});
+    values.push_back({"Min. lateness:", has_deadlines ? static_cast<double>(stats.min_lateness) : none, false});
+    values.push_back({"Avg. lateness:", has_deadlines ? stats.avg_lateness : none, false});
+    values.push_back({"Median lateness:", has_deadlines ? static_cast<double>(stats.median_lateness) : none, false});
+    values.push_back({"P95 lateness:", has_deadlines ? static_cast<double>(stats.p95_lateness) : none, false});
+    values.push_back({"Max. lateness:", has_deadlines ? static_cast<double>(stats.max_lateness) : none, false});
+    return values;
+}
+
+/*
+    t_quantile(df):
+        The 97.5th percentile of Student's t distribution with df degrees of freedom.
+*/
+static double t_quantile(size_t df) {
+    static const double TABLE[30] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+    };
+
+    if (df == 0) {
+        return INFINITY;
+    } else if (df <= 30) {
+        return TABLE[df - 1];
+    } else if (df <= 40) {
+        return 2.021;
+    } else if (df <= 60) {
+        return 2.000;
+    } else if (df <= 120) {
+        return 1.980;
+    }
+    return 1.960;
+}
+
+/*
+    RunningMetric:
+        Welford's running mean and variance of one metric.
+*/
+struct RunningMetric {
+    size_t samples = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+
+    void add(double value) {
+        samples++;
+        double delta = value - mean;
+        mean += delta / samples;
+        m2 += delta * (value - mean);
+    }
+
+    double half_width() const {
+        if (samples < 2) {
+            return samples == 0 ? 0.0 : INFINITY;
+        }
+        return t_quantile(samples - 1) * std::sqrt(m2 / (samples - 1) / samples);
+    }
+};
+
+MonteCarloResult run_monte_carlo(const WorkloadModel& model, const FlagOptions& flags) {
+    size_t jobs = flags.jobs > 0 ? flags.jobs : std::max(1u, std::thread::hardware_concurrency());
+    size_t batch_size = jobs * 4;
+
+    MonteCarloResult result;
+    std::vector<std::string> names;
+    std::vector<bool> gates_stopping;
+    std::vector<RunningMetric> running;
+
+    while (result.replicas < flags.replicas && !result.converged) {
+        size_t first = result.replicas;
+        size_t count = std::min(batch_size, flags.replicas - first);
+        std::vector<SystemStats> batch(count);
+
+        // Simulate the batch in parallel, each worker taking the next replica
+        std::atomic<size_t> next(0);
+        std::exception_ptr error = nullptr;
+        std::atomic<bool> failed(false);
+
+        auto worker = [&]() {
+            size_t i;
+            while (!failed && (i = next++) < count) {
+                try {
+                    std::seed_seq sequence = {static_cast<uint32_t>(flags.seed), static_cast<uint32_t>(first + i),
+                        static_cast<uint32_t>((first + i) >> 32)};
+                    uint32_t seeds[2];
+                    sequence.generate(seeds, seeds + 2);
+
+                    FlagOptions replica_flags = flags;
+                    replica_flags.seed = seeds[1];
+                    batch[i] = run_simulation(model.generate((static_cast<uint64_t>(seeds[0]) << 32) | seeds[1]), replica_flags).stats;
+                } catch (...) {
+                    if (!failed.exchange(true)) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t n = 1; n < std::min(jobs, count); ++n) {
+            workers.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : workers) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        // Add the replicas in order, so stopping does not depend on the number of jobs
+        for (const auto& stats : batch) {
+            auto values = metric_values(stats);
+            if (running.empty()) {
+                for (const auto& value : values) {
+                    names.push_back(value.name);
+                    gates_stopping.push_back(value.gates_stopping);
+                }
+                running.resize(values.size());
+            }
+
+            for (size_t m = 0; m < values.size(); ++m) {
+                if (!std::isnan(values[m].value)) {
+                    running[m].add(values[m].value);
+                }
+            }
+            result.replicas++;
+
+            if (flags.ci_width > 0 && result.replicas >= MIN_REPLICAS) {
+                // A metric seen in fewer than two replicas has no interval yet, and may never get one
+                // (e.g., a rarely drawn priority class), so it cannot hold the run back
+                result.converged = true;
+                for (size_t m = 0; m < running.size() && result.converged; ++m) {
+                    const RunningMetric& metric = running[m];
+                    double tolerance = std::max(flags.ci_width * std::fabs(metric.mean), MIN_HALF_WIDTH);
+                    result.converged = !gates_stopping[m] || metric.samples < 2 || metric.half_width() <= tolerance;
+                }
+                if (result.converged) {
+                    break;
+                }
+            }
+        }
+    }
+
+    for (size_t m = 0; m < running.size(); ++m) {
+        MetricSummary summary;
+        summary.name = names[m];
+        summary.samples = running[m].samples;
+        summary.mean = running[m].mean;
+        summary.half_width = running[m].half_width();
+        summary.gates_stopping = gates_stopping[m];
+        result.metrics.push_back(summary);
+    }
+
+    return result;
+}
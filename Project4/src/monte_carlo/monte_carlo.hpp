@@ -0,0 +1,124 @@
+#ifndef MONTE_CARLO_HPP
+#define MONTE_CARLO_HPP
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "types/sim_time.hpp"
+#include "types/workload/workload.hpp"
+#include "utilities/flags/flags.hpp"
+
+/*
+    Distribution:
+        A distribution of non-negative integers for one parameter of a WorkloadModel:
+        a fixed value, uniform over [a, b], or exponential with mean a (rounded up).
+*/
+
+struct Distribution {
+    enum Kind { FIXED, UNIFORM, EXPONENTIAL };
+
+    Kind kind = FIXED;
+    double a = 1;
+    double b = 1;
+
+    /*
+        sample(rng, min):
+            Draws a value, which is at least min.
+    */
+    SimTime sample(std::mt19937_64& rng, SimTime min) const;
+};
+
+/*
+    WorkloadModel:
+        A parametric description of a workload, from which randomized workloads are drawn.
+        It is read from a file with one parameter per line (see README.rst), and every
+        parameter has a default.
+*/
+
+struct WorkloadModel {
+    int thread_switch_overhead = 3;
+    int process_switch_overhead = 7;
+    int processes = 10;
+
+    Distribution threads = {Distribution::UNIFORM, 1, 3};
+    Distribution arrival = {Distribution::UNIFORM, 0, 100};
+    Distribution bursts = {Distribution::UNIFORM, 1, 5};
+    Distribution cpu = {Distribution::EXPONENTIAL, 10, 0};
+    Distribution io = {Distribution::EXPONENTIAL, 20, 0};
+
+    // Relative deadlines, if has_deadline is set
+    bool has_deadline = false;
+    Distribution deadline;
+
+    // Relative weights of the process priorities
+    double priority_weights[4] = {1, 1, 1, 1};
+
+    /*
+        generate(seed):
+            Draws a workload. The same seed always gives the same workload.
+    */
+    Workload generate(uint64_t seed) const;
+};
+
+/*
+    read_workload_model(filename):
+        Reads a workload model file.
+*/
+WorkloadModel read_workload_model(const std::string& filename);
+
+/*
+    MetricSummary:
+        The mean of one SystemStats metric over the replicas where it applied, and the
+        half-width of its 95% confidence interval (Student's t).
+*/
+
+struct MetricSummary {
+    std::string name;
+    size_t samples = 0;
+    double mean = 0.0;
+    double half_width = 0.0;
+
+    // Whether the metric is part of the early stopping test (see run_monte_carlo)
+    bool gates_stopping = true;
+};
+
+/*
+    MonteCarloResult:
+        The outcome of run_monte_carlo.
+*/
+
+struct MonteCarloResult {
+    // Number of replicas that were simulated and summarized
+    size_t replicas = 0;
+
+    // Whether the run stopped early because every interval was tight enough
+    bool converged = false;
+
+    std::vector<MetricSummary> metrics;
+};
+
+// Fewest replicas a run may stop early after
+constexpr size_t MIN_REPLICAS = 10;
+
+// Interval half-width that is always tight enough to stop, whatever the mean: half a tick, or
+// half a percentage point
+constexpr double MIN_HALF_WIDTH = 0.5;
+
+/*
+    run_monte_carlo(model, flags):
+        Simulates up to flags.replicas workloads drawn from the model, with the scheduler and
+        options in the flags, spread over flags.jobs threads (0 for one per core). Replica i is
+        drawn from a seed derived from flags.seed and i, so the result does not depend on the
+        number of threads.
+
+        If flags.ci_width is above 0, the run stops once at least MIN_REPLICAS replicas are done
+        and the interval half-width of every gating metric seen in at least two replicas is
+        within ci_width of its mean, or within MIN_HALF_WIDTH. Lateness and dispatch time saved
+        do not gate stopping: they can average out near zero, where a relative interval is
+        never tight enough.
+*/
+MonteCarloResult run_monte_carlo(const WorkloadModel& model, const FlagOptions& flags);
+
+#endif
@@ -1,42 +1,163 @@
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 
 #include "algorithms/fcfs/fcfs_algorithm.hpp"
 #include "algorithms/spn/spn_algorithm.hpp"
 #include "algorithms/rr/rr_algorithm.hpp"
 #include "algorithms/priority/priority_algorithm.hpp"
+#include "algorithms/affinity/affinity_algorithm.hpp"
+#include "algorithms/o1/o1_algorithm.hpp"
+#include "algorithms/stride/stride_algorithm.hpp"
+#include "algorithms/lottery/lottery_algorithm.hpp"
+#include "algorithms/edf/edf_algorithm.hpp"
+#include "algorithms/fair/fair_algorithm.hpp"
+#include "algorithms/arr/arr_algorithm.hpp"
 // TODO: Include your other algorithms as you make them
 
 #include "simulation/simulation.hpp"
+#include "switch_cost/flat/flat_cost_model.hpp"
+#include "switch_cost/warmth/warmth_cost_model.hpp"
 #include "types/enums.hpp"
 
 #include "utilities/flags/flags.hpp"
+#include "utilities/perf_import/perf_import.hpp"
 
 Simulation::Simulation(FlagOptions flags) {
     // Hello!
+    this->scheduler = make_scheduler(flags);
+    this->switch_cost = make_switch_cost(flags);
+    this->flags = flags;
+    this->logger = Logger(flags.verbose, flags.per_thread, flags.metrics, flags.extended_metrics);
+}
+
+std::shared_ptr<Scheduler> Simulation::make_scheduler(const FlagOptions& flags) {
     if (flags.scheduler == "FCFS") {
         // Create a FCFS scheduling algorithm
-        this->scheduler = std::make_shared<FCFSScheduler>();
+        return std::make_shared<FCFSScheduler>();
     }
     else if (flags.scheduler == "SPN") {
         // Create a SPN scheduling algorithm
-        this->scheduler = std::make_shared<SPNScheduler>();
+        return std::make_shared<SPNScheduler>();
     } else if (flags.scheduler == "RR") {
         // Create a RR scheduling algorithm
-        this->scheduler = std::make_shared<RRScheduler>(flags.time_slice);
+        return std::make_shared<RRScheduler>(flags.time_slice);
     } else if (flags.scheduler == "PRIORITY") {
         // Create a PRIORITY scheduling algorithm
-        this->scheduler = std::make_shared<PRIORITYScheduler>();
+        return std::make_shared<PRIORITYScheduler>(-1, false, flags.aging);
+    } else if (flags.scheduler == "PRIORITY-P") {
+        // Create a preemptive PRIORITY scheduling algorithm
+        return std::make_shared<PRIORITYScheduler>(-1, true, flags.aging);
+    } else if (flags.scheduler == "AFFINITY") {
+        // Create a process affinity scheduling algorithm
+        return std::make_shared<AFFINITYScheduler>();
+    } else if (flags.scheduler == "O1") {
+        // Create a Linux O(1)-style scheduling algorithm
+        return std::make_shared<O1Scheduler>(flags.time_slice);
+    } else if (flags.scheduler == "STRIDE") {
+        // Create a stride scheduling algorithm
+        return std::make_shared<STRIDEScheduler>(flags.time_slice);
+    } else if (flags.scheduler == "LOTTERY") {
+        // Create a lottery scheduling algorithm
+        return std::make_shared<LOTTERYScheduler>(flags.time_slice, flags.seed);
+    } else if (flags.scheduler == "EDF") {
+        // Create an earliest-deadline-first scheduling algorithm
+        return std::make_shared<EDFScheduler>();
+    } else if (flags.scheduler == "FAIR") {
+        // Create a hierarchical fair-share scheduling algorithm
+        return std::make_shared<FAIRScheduler>(flags.time_slice);
+    } else if (flags.scheduler == "ARR") {
+        // Create an adaptive round robin scheduling algorithm
+        return std::make_shared<ARRScheduler>(flags.time_slice);
     } else {
-        throw("No scheduler found for " + flags.scheduler);        
+        throw(std::invalid_argument("No scheduler found for " + flags.scheduler));
+    }
+}
+
+std::shared_ptr<SwitchCostModel> Simulation::make_switch_cost(const FlagOptions& flags) {
+    if (flags.switch_cost == "FLAT") {
+        return std::make_shared<FlatCostModel>();
+    } else if (flags.switch_cost == "WARMTH") {
+        return std::make_shared<WarmthCostModel>();
+    } else {
+        throw(std::invalid_argument("No switch cost model found for " + flags.switch_cost));
     }
-    this->flags = flags;
-    this->logger = Logger(flags.verbose, flags.per_thread, flags.metrics);
 }
 
 void Simulation::run() {
-    this->read_file(this->flags.filename);
-    
+    if (this->flags.perf_import) {
+        this->load(read_perf_file(this->flags.filename));
+    } else {
+        this->load(read_file(this->flags.filename));
+    }
+
+    auto stats = this->simulate();
+
+    std::cout << "SIMULATION COMPLETED!\n\n";
+
+    for (auto entry: this->processes) {
+        this->logger.print_per_thread_metrics(entry.second);
+    }
+
+    logger.print_simulation_metrics(stats);
+    logger.print_extended_metrics(stats);
+}
+
+void Simulation::load(const Workload& workload) {
+    this->thread_switch_overhead = workload.thread_switch_overhead;
+    this->process_switch_overhead = workload.process_switch_overhead;
+    this->switch_cost->thread_switch_overhead = this->thread_switch_overhead;
+    this->switch_cost->process_switch_overhead = this->process_switch_overhead;
+
+    for (const auto& spec : workload.devices) {
+        this->devices[spec.device_id] = std::make_shared<IODevice>(spec.device_id, spec.discipline, spec.seek_cost, spec.expiry);
+    }
+
+    for (const auto& process_spec : workload.processes) {
+        auto process = std::make_shared<Process>(process_spec.process_id, process_spec.priority);
+
+        for (size_t thread_id = 0; thread_id < process_spec.threads.size(); ++thread_id) {
+            const auto& spec = process_spec.threads[thread_id];
+
+            if (spec.cpu_bursts.empty() || spec.io_bursts.size() + 1 != spec.cpu_bursts.size()) {
+                throw(std::logic_error("Thread must have exactly one more CPU burst than IO bursts."));
+            }
+
+            auto thread = std::make_shared<Thread>(spec.arrival_time, thread_id, process->process_id, process->priority);
+            if (spec.relative_deadline >= 0) {
+                thread->deadline = spec.arrival_time + spec.relative_deadline;
+            }
+
+            for (size_t n = 0; n < spec.cpu_bursts.size(); ++n) {
+                thread->bursts.push(std::make_shared<Burst>(BurstType::CPU, spec.cpu_bursts[n]));
+                if (n < spec.io_bursts.size()) {
+                    const auto& io = spec.io_bursts[n];
+                    if (io.device >= 0 && this->devices.find(io.device) == this->devices.end()) {
+                        throw(std::logic_error("IO burst uses unknown device " + std::to_string(io.device)));
+                    }
+
+                    auto burst = std::make_shared<Burst>(BurstType::IO, io.length);
+                    burst->device = io.device;
+                    burst->track = io.track;
+                    thread->bursts.push(burst);
+                }
+            }
+
+            this->events.push(std::make_shared<Event>(EventType::THREAD_ARRIVED, thread->arrival_time, this->event_num, thread, nullptr));
+            this->event_num++;
+
+            process->threads.push_back(thread);
+        }
+
+        this->processes[process->process_id] = process;
+    }
+}
+
+SystemStats Simulation::simulate() {
     while (!this->events.empty()) {
         auto event = this->events.top();
         this->events.pop();
@@ -85,13 +206,7 @@ void Simulation::run() {
     }
     // We are done!
 
-    std::cout << "SIMULATION COMPLETED!\n\n";
-
-    for (auto entry: this->processes) {
-        this->logger.print_per_thread_metrics(entry.second);
-    }
-
-    logger.print_simulation_metrics(this->calculate_statistics());
+    return this->calculate_statistics();
 }
 
 //==============================================================================
@@ -100,13 +215,13 @@ void Simulation::run() {
 
 void Simulation::handle_thread_arrived(const std::shared_ptr<Event> event) {
     event->thread->set_ready(event->time);
-    scheduler->add_to_ready_queue(event->thread);
+    add_to_ready_queue(event->thread);
 
-    // If no active thread, run the scheduler!
-    if (!active_thread && !running_dispatcher_invoked) {
-        running_dispatcher_invoked = true;
-        auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-        add_event(std::make_shared<Event>(new_event));
+    // If no active thread, run the scheduler! Otherwise, the new thread may preempt it.
+    if (!active_thread) {
+        invoke_dispatcher(event->time);
+    } else {
+        preempt_if_needed(event->time);
     }
 }
 
@@ -116,64 +231,106 @@ void Simulation::handle_dispatch_completed(const std::shared_ptr<Event> event) {
     /* 
     Determine the appropriate next even and generate it as adequate
         - If the next CPU burst is > than the quantum generate a thread Premted event
-        - Otherwise pop the CPU burst from the queue and determine if there is an I/O burst avaliable
+        - Otherwise determine if there is an I/O burst avaliable after the CPU burst
             - If yes next event is an CPU Burst Complete
             - If no next event is a Thread Complete 
+    The CPU burst stays at the front of the thread's queue until it completes, so that a
+    preemption can still record how much of it is left.
     */
     std::shared_ptr<Event> new_event = nullptr;
-    if (scheduler->time_slice == -1 || event->thread->get_next_burst(CPU)->length <= scheduler->time_slice) {
-        int thread_service_time = event->thread->get_next_burst(CPU)->length;
-        event->thread->pop_next_burst(CPU);
-
-        if (event->thread->get_next_burst(IO)) {
-            new_event = std::make_shared<Event>(Event(CPU_BURST_COMPLETED, event->time + thread_service_time, event_num++, active_thread, nullptr));
+    auto burst = event->thread->get_next_burst(CPU);
+    int time_slice = event->scheduling_decision->time_slice;
+
+    if (scheduler->should_preempt(event->thread)) {
+        // A higher priority thread became ready while this one was being dispatched
+        new_event = std::make_shared<Event>(Event(THREAD_PREEMPTED, event->time, event_num++, active_thread, nullptr));
+    } else if (time_slice == -1 || burst->length <= time_slice) {
+        if (event->thread->bursts.size() > 1) {
+            new_event = std::make_shared<Event>(Event(CPU_BURST_COMPLETED, event->time + burst->length, event_num++, active_thread, nullptr));
         } else {
-            new_event = std::make_shared<Event>(Event(THREAD_COMPLETED, event->time + thread_service_time, event_num++, active_thread, nullptr));
+            new_event = std::make_shared<Event>(Event(THREAD_COMPLETED, event->time + burst->length, event_num++, active_thread, nullptr));
         }
     } else {
-        new_event = std::make_shared<Event>(Event(THREAD_PREEMPTED, event->time + scheduler->time_slice, event_num++, active_thread, nullptr));
+        new_event = std::make_shared<Event>(Event(THREAD_PREEMPTED, event->time + time_slice, event_num++, active_thread, nullptr));
     }
 
+    cpu_event = new_event;
     add_event(new_event);
 }
 
 void Simulation::handle_cpu_burst_completed(const std::shared_ptr<Event> event) {
+    cpu_event = nullptr;
+    switch_cost->thread_descheduled(event->thread, event->time);
+    record_cpu_share(event->thread, event->time);
+    event->thread->pop_next_burst(CPU);
     event->thread->set_blocked(event->time);
 
     // Just finished using the CPU, run the scheduler!
-    auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-    add_event(std::make_shared<Event>(new_event));
+    invoke_dispatcher(event->time);
+
+    auto burst = event->thread->get_next_burst(IO);
+    if (burst->device < 0) {
+        auto new_event = Event(IO_BURST_COMPLETED, event->time + burst->length, event_num++, event->thread, nullptr);
+        add_event(std::make_shared<Event>(new_event));
+        return;
+    }
 
-    new_event = Event(IO_BURST_COMPLETED, event->time + event->thread->get_next_burst(IO)->length, event_num++, event->thread, nullptr);
-    add_event(std::make_shared<Event>(new_event));
+    // Shared devices serve one burst at a time, so the burst may have to wait its turn
+    auto device = devices.at(burst->device);
+    device->submit(IORequest{event->thread, burst->length, burst->track, event->time});
+    if (!device->busy) {
+        start_io(device, event->time);
+    }
 }
 
 void Simulation::handle_io_burst_completed(const std::shared_ptr<Event> event) {
     // Run the scheduler if we don't have an active thread.
     if (active_thread == nullptr) {
-        auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-        add_event(std::make_shared<Event>(new_event));
+        invoke_dispatcher(event->time);
     }
 
+    // Let the device move on to the next burst waiting for it
+    int device_id = event->thread->get_next_burst(IO)->device;
+    if (device_id >= 0) {
+        auto device = devices.at(device_id);
+        device->busy = false;
+        if (!device->empty()) {
+            start_io(device, event->time);
+        }
+    }
+
+    scheduler->thread_woke(event->thread, event->time - event->thread->state_change_time);
     event->thread->set_ready(event->time);
     event->thread->pop_next_burst(IO);
-    scheduler->add_to_ready_queue(event->thread);
+    add_to_ready_queue(event->thread);
+
+    if (active_thread != nullptr) {
+        preempt_if_needed(event->time);
+    }
 }
 
 void Simulation::handle_thread_completed(const std::shared_ptr<Event> event) {
+    cpu_event = nullptr;
+    switch_cost->thread_descheduled(event->thread, event->time);
+    record_cpu_share(event->thread, event->time);
+    event->thread->pop_next_burst(CPU);
     event->thread->set_finished(event->time);
+    scheduler->thread_exited(event->thread);
         
     // Just finished using the CPU, run the scheduler!
-    auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-    add_event(std::make_shared<Event>(new_event));
+    invoke_dispatcher(event->time);
 }
 
 void Simulation::handle_thread_preempted(const std::shared_ptr<Event> event) {
+    cpu_event = nullptr;
+    switch_cost->thread_descheduled(event->thread, event->time);
+    record_cpu_share(event->thread, event->time);
+
+    // Record the work that is left, i.e., the burst minus the time spent running it
+    event->thread->get_next_burst(CPU)->update_time(event->time - event->thread->state_change_time);
     event->thread->set_ready(event->time);
-    event->thread->get_next_burst(CPU)->update_time(scheduler->time_slice);
-    scheduler->add_to_ready_queue(event->thread);
-    auto new_event = Event(DISPATCHER_INVOKED, event->time, event_num++, nullptr, nullptr);
-    add_event(std::make_shared<Event>(new_event));
+    add_to_ready_queue(event->thread);
+    invoke_dispatcher(event->time);
 }
 
 void Simulation::handle_dispatcher_invoked(const std::shared_ptr<Event> event) {
@@ -189,13 +346,21 @@ void Simulation::handle_dispatcher_invoked(const std::shared_ptr<Event> event) {
     if (event->scheduling_decision->thread) {
         std::shared_ptr<Event> new_event = nullptr;
         active_thread = event->scheduling_decision->thread;
+        ready_tickets[active_thread->priority] -= scheduler->tickets(active_thread);
+
+        // The switch cost model decides how much the dispatch costs, but whether it is a
+        // process switch only depends on the previous thread
+        int process_overhead = switch_cost->process_switch_cost(active_thread, event->time);
+        int overhead = switch_cost->dispatch_cost(active_thread, prev_thread, event->time);
+        system_stats.dispatch_time += overhead;
 
         if (!prev_thread || active_thread->process_id != prev_thread->process_id) {
-            system_stats.dispatch_time += process_switch_overhead;
-            new_event = std::make_shared<Event>(Event(PROCESS_DISPATCH_COMPLETED, event->time + process_switch_overhead, event_num++, active_thread, event->scheduling_decision));
+            system_stats.process_switches++;
+            new_event = std::make_shared<Event>(Event(PROCESS_DISPATCH_COMPLETED, event->time + overhead, event_num++, active_thread, event->scheduling_decision));
         } else {
-            system_stats.dispatch_time += thread_switch_overhead;
-            new_event = std::make_shared<Event>(Event(THREAD_DISPATCH_COMPLETED, event->time + thread_switch_overhead, event_num++, active_thread, event->scheduling_decision));
+            system_stats.thread_switches++;
+            system_stats.dispatch_time_saved += process_overhead - overhead;
+            new_event = std::make_shared<Event>(Event(THREAD_DISPATCH_COMPLETED, event->time + overhead, event_num++, active_thread, event->scheduling_decision));
         }
 
         // Regardless of whether this is PROCESS_DISPATCH_COMPLETED or THREAD_DISPATCH_COMPLETED,
@@ -215,18 +380,77 @@ void Simulation::handle_dispatcher_invoked(const std::shared_ptr<Event> event) {
 // Utility methods
 //==============================================================================
 
+void Simulation::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+    ready_tickets[thread->priority] += scheduler->tickets(thread);
+    scheduler->add_to_ready_queue(thread);
+}
+
+void Simulation::record_cpu_share(std::shared_ptr<Thread> thread, SimTime time) {
+    int tickets = scheduler->tickets(thread);
+    if (tickets == 0) {
+        return;
+    }
+
+    double ran = time - thread->state_change_time;
+    double competing_tickets = tickets;
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        competing_tickets += ready_tickets[i];
+    }
+
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        double priority_tickets = ready_tickets[i] + (thread->priority == i ? tickets : 0);
+        entitled_time[i] += ran * priority_tickets / competing_tickets;
+    }
+}
+
+void Simulation::start_io(std::shared_ptr<IODevice> device, SimTime time) {
+    SimTime service_time = 0;
+    auto request = device->start_next(time, service_time);
+
+    add_event(std::make_shared<Event>(Event(IO_BURST_COMPLETED, time + service_time, event_num++, request.thread, nullptr)));
+}
+
+void Simulation::invoke_dispatcher(SimTime time) {
+    // Otherwise, we could run DISPATCHER_INVOKED multiple times if threads become ready at the same time.
+    if (running_dispatcher_invoked) {
+        return;
+    }
+
+    running_dispatcher_invoked = true;
+    add_event(std::make_shared<Event>(Event(DISPATCHER_INVOKED, time, event_num++, nullptr, nullptr)));
+}
+
+void Simulation::preempt_if_needed(SimTime time) {
+    // Only a thread that is actually running (not still being dispatched) has a CPU event to cancel
+    if (!cpu_event || !scheduler->should_preempt(active_thread)) {
+        return;
+    }
+
+    // A thread whose burst or slice ends at this very tick has no work left to take away;
+    // arrivals at the same tick are handled first only because of their lower event_num
+    if (cpu_event->time <= time) {
+        return;
+    }
+
+    events.cancel(cpu_event);
+    cpu_event = nullptr;
+    add_event(std::make_shared<Event>(Event(THREAD_PREEMPTED, time, event_num++, active_thread, nullptr)));
+}
+
 SystemStats Simulation::calculate_statistics() {
     // Initialize counters and accumulators
-    auto total_service_time = 0;
-    auto total_io_time = 0;
-    auto total_idle_time = 0;
-    auto total_dispatch_time = 0;
+    SimTime total_service_time = 0;
+    SimTime total_io_time = 0;
+    SimTime total_idle_time = 0;
+    SimTime total_dispatch_time = 0;
     auto total_simulation_time = this->system_stats.total_time;
 
     // Initialize arrays to store statistics for different priorities
     int thread_counts[4] = {0};
     double total_turnaround_time_per_priority[4] = {0.0};
     double total_response_time_per_priority[4] = {0.0};
+    double service_time_per_priority[4] = {0.0};
+    SimTime max_wait_time_per_priority[4] = {0};
 
     // Iterate over all processes
     for (const auto& entry : processes) {
@@ -243,14 +467,72 @@ SystemStats Simulation::calculate_statistics() {
             total_service_time += thread->service_time;
             total_io_time += thread->io_time;
 
+            // Update service time per priority, for proportional-share algorithms
+            service_time_per_priority[static_cast<int>(priority)] += thread->service_time;
+
             // Update total turnaround time per priority
             total_turnaround_time_per_priority[static_cast<int>(priority)] += thread->turnaround_time();
 
             // Update total response time per priority
             total_response_time_per_priority[static_cast<int>(priority)] += thread->response_time();
+
+            // Update the longest wait in the ready queue per priority
+            max_wait_time_per_priority[static_cast<int>(priority)] = std::max(max_wait_time_per_priority[static_cast<int>(priority)], thread->max_wait_time);
+        }
+    }
+
+    // Gather how late the threads with a deadline finished
+    std::vector<SimTime> lateness;
+    for (const auto& entry : processes) {
+        for (const auto& thread : entry.second->threads) {
+            if (thread->deadline >= 0) {
+                lateness.push_back(thread->lateness());
+            }
         }
     }
 
+    this->system_stats.deadline_threads = lateness.size();
+    this->system_stats.deadline_misses = std::count_if(lateness.begin(), lateness.end(), [](SimTime late) { return late > 0; });
+    if (!lateness.empty()) {
+        std::sort(lateness.begin(), lateness.end());
+        auto nearest_rank = [&lateness](double percentile) {
+            size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * lateness.size()));
+            return lateness[rank > 0 ? rank - 1 : 0];
+        };
+
+        double total_lateness = 0.0;
+        for (SimTime late : lateness) {
+            total_lateness += late;
+        }
+
+        this->system_stats.deadline_miss_rate = this->system_stats.deadline_misses / static_cast<double>(lateness.size()) * 100.0;
+        this->system_stats.min_lateness = lateness.front();
+        this->system_stats.avg_lateness = total_lateness / lateness.size();
+        this->system_stats.median_lateness = nearest_rank(50.0);
+        this->system_stats.p95_lateness = nearest_rank(95.0);
+        this->system_stats.max_lateness = lateness.back();
+    }
+
+    // Gather the statistics of the shared I/O devices
+    this->system_stats.total_io_wait_time = 0;
+    this->system_stats.device_stats.clear();
+    for (const auto& entry : devices) {
+        const auto& device = entry.second;
+        DeviceStats stats;
+
+        stats.device_id = device->device_id;
+        stats.discipline = device->discipline;
+        stats.requests = device->requests_served;
+        stats.busy_time = device->busy_time;
+        stats.wait_time = device->wait_time;
+        if (total_simulation_time > 0) {
+            stats.utilization = device->busy_time / static_cast<double>(total_simulation_time) * 100.0;
+        }
+
+        this->system_stats.total_io_wait_time += device->wait_time;
+        this->system_stats.device_stats.push_back(stats);
+    }
+
     // Calculate total dispatch time
     total_dispatch_time = this->system_stats.dispatch_time;
 
@@ -288,6 +570,9 @@ SystemStats Simulation::calculate_statistics() {
         this->system_stats.thread_counts[i] = thread_counts[i];
         this->system_stats.avg_thread_response_times[i] = thread_counts[i] > 0 ? total_response_time_per_priority[i] / thread_counts[i] : 0.0;
         this->system_stats.avg_thread_turnaround_times[i] = thread_counts[i] > 0 ? total_turnaround_time_per_priority[i] / thread_counts[i] : 0.0;
+        this->system_stats.max_wait_times[i] = max_wait_time_per_priority[i];
+        this->system_stats.target_shares[i] = total_service_time > 0 ? entitled_time[i] / total_service_time * 100.0 : 0.0;
+        this->system_stats.achieved_shares[i] = total_service_time > 0 ? service_time_per_priority[i] / total_service_time * 100.0 : 0.0;
     }
 
     return this->system_stats;
@@ -300,7 +585,21 @@ void Simulation::add_event(std::shared_ptr<Event> event) {
     }
 }
 
-void Simulation::read_file(const std::string filename) {
+/*
+    next_line(input):
+        Returns the next line of the simulation file that is not blank.
+*/
+static std::string next_line(std::istream& input) {
+    std::string line;
+    while (std::getline(input, line)) {
+        if (line.find_first_not_of(" \t\r") != std::string::npos) {
+            return line;
+        }
+    }
+    return "";
+}
+
+Workload Simulation::read_file(const std::string filename) {
     std::ifstream input_file(filename.c_str());
 
     if (!input_file) {
@@ -308,52 +607,132 @@ void Simulation::read_file(const std::string filename) {
         throw(std::logic_error("Bad file."));
     }
 
+    Workload workload;
     int num_processes;
+    int num_devices = 0;
 
-    input_file >> num_processes >> this->thread_switch_overhead >> this->process_switch_overhead;
+    // The number of shared I/O devices is optional, so the first line is read on its own
+    std::istringstream header(next_line(input_file));
+    header >> num_processes >> workload.thread_switch_overhead >> workload.process_switch_overhead;
+    if (!(header >> num_devices)) {
+        num_devices = 0;
+    }
+
+    for (int dev = 0; dev < num_devices; ++dev) {
+        workload.devices.push_back(read_device(input_file));
+    }
 
     for (int proc = 0; proc < num_processes; ++proc) {
-        auto process = read_process(input_file);
+        workload.processes.push_back(read_process(input_file));
+    }
 
-        this->processes[process->process_id] = process;
+    return workload;
+}
+
+Workload Simulation::read_perf_file(const std::string filename) {
+    std::ifstream input_file(filename.c_str());
+
+    if (!input_file) {
+        std::cerr << "Unable to open perf sched trace: " << filename << std::endl;
+        throw(std::logic_error("Bad file."));
     }
+
+    return import_perf_sched(input_file);
 }
 
-std::shared_ptr<Process> Simulation::read_process(std::istream& input) {
-    int process_id, priority;
-    int num_threads;
+DeviceSpec Simulation::read_device(std::istream& input) {
+    // device_id discipline [seek_cost [expiry]]
+    std::istringstream line(next_line(input));
+    DeviceSpec device;
+    std::string discipline_name;
+    int seek_cost;
+    SimTime expiry;
+
+    line >> device.device_id >> discipline_name;
+    if (line >> seek_cost) {
+        device.seek_cost = seek_cost;
+    }
+    if (line >> expiry) {
+        device.expiry = expiry;
+    }
+
+    std::transform(discipline_name.begin(), discipline_name.end(), discipline_name.begin(), ::toupper);
+
+    if (discipline_name == "FIFO") {
+        device.discipline = IO_FIFO;
+    } else if (discipline_name == "SCAN") {
+        device.discipline = IO_SCAN;
+    } else if (discipline_name == "DEADLINE") {
+        device.discipline = IO_DEADLINE;
+    } else {
+        throw(std::logic_error("Unknown I/O discipline: " + discipline_name));
+    }
 
-    input >> process_id >> priority >> num_threads;
+    return device;
+}
+
+ProcessSpec Simulation::read_process(std::istream& input) {
+    ProcessSpec process;
+    int priority;
+    int num_threads;
 
-    auto process = std::make_shared<Process>(process_id, (ProcessPriority) priority);
+    input >> process.process_id >> priority >> num_threads;
+    process.priority = (ProcessPriority) priority;
 
     // iterate over the threads
     for (int thread_id = 0; thread_id < num_threads; ++thread_id) {
-        process->threads.emplace_back(read_thread(input, thread_id, process_id, (ProcessPriority) priority));
+        process.threads.push_back(read_thread(input));
     }
 
     return process;
 }
 
-std::shared_ptr<Thread> Simulation::read_thread(std::istream& input, int thread_id, int process_id, ProcessPriority priority) {
+ThreadSpec Simulation::read_thread(std::istream& input) {
     // Stuff
-    int arrival_time;
+    ThreadSpec thread;
     int num_cpu_bursts;
+    SimTime relative_deadline;
 
-    input >> arrival_time >> num_cpu_bursts;
+    // arrival_time num_cpu_bursts [relative_deadline]
+    std::istringstream header(next_line(input));
+    header >> thread.arrival_time >> num_cpu_bursts;
 
-    auto thread = std::make_shared<Thread>(arrival_time, thread_id, process_id, priority);
+    if (header >> relative_deadline) {
+        if (relative_deadline < 0) {
+            throw(std::logic_error("Thread has a negative deadline."));
+        }
+        thread.relative_deadline = relative_deadline;
+    }
 
-    for (int n = 0, burst_length; n < num_cpu_bursts * 2 - 1; ++n) {
-        input >> burst_length;
+    for (int n = 0; n < num_cpu_bursts * 2 - 1; ++n) {
+        if (n % 2 == 0) {
+            SimTime burst_length;
+            input >> burst_length;
+            thread.cpu_bursts.push_back(burst_length);
+        } else {
+            thread.io_bursts.push_back(read_io_burst(input));
+        }
+    }
 
-        BurstType burst_type = (n % 2 == 0) ? BurstType::CPU : BurstType::IO;
+    return thread;
+}
 
-        thread->bursts.push(std::make_shared<Burst>(burst_type, burst_length));
-    }
+IOBurstSpec Simulation::read_io_burst(std::istream& input) {
+    std::string token;
+    input >> token;
 
-    this->events.push(std::make_shared<Event>(EventType::THREAD_ARRIVED, thread->arrival_time, this->event_num, thread, nullptr));
-    this->event_num++;
+    // length[@device[:track]]
+    size_t at = token.find('@');
+    IOBurstSpec burst;
+    burst.length = std::stoll(token.substr(0, at));
 
-    return thread;
+    if (at != std::string::npos) {
+        size_t colon = token.find(':', at);
+        burst.device = std::stoi(token.substr(at + 1, colon - at - 1));
+        if (colon != std::string::npos) {
+            burst.track = std::stoi(token.substr(colon + 1));
+        }
+    }
+
+    return burst;
 }
@@ -9,16 +9,18 @@
 #include <string>
 
 #include "algorithms/scheduling_algorithm.hpp"
+#include "switch_cost/switch_cost_model.hpp"
+#include "types/io_device/io_device.hpp"
 #include "types/process/process.hpp"
 #include "types/thread/thread.hpp"
 #include "types/system_stats/system_stats.hpp"
 #include "types/event/event.hpp"
+#include "types/workload/workload.hpp"
 
+#include "utilities/event_queue/event_queue.hpp"
 #include "utilities/flags/flags.hpp"
 #include "utilities/logger/logger.hpp"
 
-using EventQueue = std::priority_queue<std::shared_ptr<Event>, std::vector<std::shared_ptr<Event>>, EventComparator>;
-
 /*
     Simulation:
         A class that encapsulates the entire simulation logic. Contains all the member variables
@@ -38,6 +40,13 @@ public:
     */
     std::map<int, std::shared_ptr<Process>> processes;
 
+    /*
+        devices:
+            A map of device IDs to the shared I/O devices specified in the simulation file.
+            IO bursts that do not name a device do not wait for one.
+    */
+    std::map<int, std::shared_ptr<IODevice>> devices;
+
     /*
         scheduler:
             A pointer to a scheduler object. Since the Scheduler class is a base class,
@@ -47,6 +56,13 @@ public:
     */
     std::shared_ptr<Scheduler> scheduler;
 
+    /*
+        switch_cost:
+            The model used to compute the overhead of each dispatch, selected with
+            the -c, --switch_cost flag.
+    */
+    std::shared_ptr<SwitchCostModel> switch_cost;
+
     /*
         active_thread:
             The thread that is currently on the CPU. If no thread is on the
@@ -69,6 +85,28 @@ public:
      */
     bool running_dispatcher_invoked = false; 
 
+    /*
+        cpu_event:
+            The pending CPU_BURST_COMPLETED, THREAD_COMPLETED or THREAD_PREEMPTED event of the
+            thread that is currently running, or nullptr if no thread is running. Kept so that a
+            preemptive scheduler can cancel it when a higher priority thread becomes ready.
+    */
+    std::shared_ptr<Event> cpu_event = nullptr;
+
+    /*
+        ready_tickets[4]:
+            For proportional-share algorithms, the total tickets held by the ready threads
+            of each priority.
+    */
+    double ready_tickets[4] = {0.0, 0.0, 0.0, 0.0};
+
+    /*
+        entitled_time[4]:
+            For proportional-share algorithms, the CPU time that threads of each priority were
+            entitled to, given their tickets and the tickets of the threads they competed with.
+    */
+    double entitled_time[4] = {0.0, 0.0, 0.0, 0.0};
+
     /*
         thread_switch_overhead:
             An integer for the thread switch overhead, as specified in the simulation file.
@@ -86,12 +124,13 @@ public:
             An integer representing how many events that the simulation has created. This is
             used in the Event class so that we can break ties in the event queue.
     */
-    unsigned int event_num = 0;
+    uint64_t event_num = 0;
 
     /*
         events:
             Our priority queue of events. This is what we add new events to,
-            and take events from to progress through the simulation.
+            and take events from to progress through the simulation. Events that
+            are still queued can be cancelled or rescheduled.
     */
     EventQueue events;
 
@@ -132,14 +171,37 @@ public:
     */
     Simulation(FlagOptions flags);
 
+    /*
+        make_scheduler(flags) / make_switch_cost(flags):
+            Create the scheduling algorithm and dispatch cost model selected by the flags. Throw
+            std::invalid_argument if the flags name one that does not exist.
+    */
+    static std::shared_ptr<Scheduler> make_scheduler(const FlagOptions& flags);
+
+    static std::shared_ptr<SwitchCostModel> make_switch_cost(const FlagOptions& flags);
+
     /*
         run():
-            The main loop of the simulation. This function reads in the
-            specified simulation file, populates all the required data structure,
-            and then begins the next-event simulation for the CPU scheduler.
+            Reads in the specified simulation file, runs the simulation, and then prints
+            the results selected by the flags.
     */
     void run();
 
+    /*
+        load(workload):
+            Populates all the required data structures from the workload, and adds the
+            THREAD_ARRIVED event of every thread.
+    */
+    void load(const Workload& workload);
+
+    /*
+        simulate():
+            The main loop of the simulation. Runs the next-event simulation for the CPU
+            scheduler until no events are left, and returns the statistics. Prints nothing
+            unless the logger is verbose.
+    */
+    SystemStats simulate();
+
     /*
         handle_*:
             These functions are handler functions that are called for each
@@ -168,26 +230,83 @@ public:
 
     void handle_dispatcher_invoked(const std::shared_ptr<Event> event);
 
+    /*
+        invoke_dispatcher(time):
+            Adds a DISPATCHER_INVOKED event at the given time, unless one is already pending.
+    */
+    void invoke_dispatcher(SimTime time);
+
+    /*
+        preempt_if_needed(time):
+            Asks the scheduler whether the running thread should give up the CPU to a thread
+            in the ready queue. If so, its pending CPU event is cancelled and replaced with a
+            THREAD_PREEMPTED event at the given time.
+    */
+    void preempt_if_needed(SimTime time);
+
+    /*
+        start_io(device, time):
+            Starts serving the next request waiting for the given device, and adds the
+            IO_BURST_COMPLETED event for when it is done.
+    */
+    void start_io(std::shared_ptr<IODevice> device, SimTime time);
+
+    /*
+        add_to_ready_queue(thread):
+            Adds a thread to the scheduler's ready queue, keeping track of the tickets
+            held by ready threads.
+    */
+    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+
+    /*
+        record_cpu_share(thread, time):
+            Called when a thread leaves the CPU. Splits the time it just ran between the
+            priorities of all the threads that were competing for it, in proportion to their
+            tickets, and adds that to entitled_time.
+    */
+    void record_cpu_share(std::shared_ptr<Thread> thread, SimTime time);
+
     /*
         read_file(filename):
-            This function reads in the simulation file, as specified by filename. If filename is
-            blank, then it reads in from stdin.
+            This function reads in the simulation file, as specified by filename, and
+            returns the workload it describes.
+    */
+    static Workload read_file(const std::string filename);
+
+    /*
+        read_perf_file(filename):
+            Reads in the output of `perf sched script`, as specified by filename, and
+            returns the workload it describes (see PerfSchedImporter).
     */
-    void read_file(const std::string filename);
+    static Workload read_perf_file(const std::string filename);
 
     /*
         read_process(input):
             Reads in a process from the simulation file. Called by read_file
             for each process that is provided in the simulation file.
     */
-    std::shared_ptr<Process> read_process(std::istream& input);
+    static ProcessSpec read_process(std::istream& input);
 
     /*
-        read_thread(input, thread_id, process_id, priority):
+        read_device(input):
+            Reads in an I/O device from the simulation file. Called by read_file
+            for each device that is listed after the first line.
+    */
+    static DeviceSpec read_device(std::istream& input);
+
+    /*
+        read_thread(input):
             Reads in a thread from the simulation file. Called by read_process
             for each thread in a process, as provided by the simulation file.
     */
-    std::shared_ptr<Thread> read_thread(std::istream& input, int thread_id, int process_id, ProcessPriority priority);
+    static ThreadSpec read_thread(std::istream& input);
+
+    /*
+        read_io_burst(input):
+            Reads in an IO burst from the simulation file, which is either just its length, or
+            length@device or length@device:track to have it served by a shared I/O device.
+    */
+    static IOBurstSpec read_io_burst(std::istream& input);
 
     /*
         calculate_statistics():
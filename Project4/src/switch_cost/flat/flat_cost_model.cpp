@@ -0,0 +1,12 @@
+#include "switch_cost/flat/flat_cost_model.hpp"
+
+int FlatCostModel::dispatch_cost(std::shared_ptr<Thread> next, std::shared_ptr<Thread> prev, SimTime time) {
+    if (!prev || next->process_id != prev->process_id) {
+        return process_switch_overhead;
+    }
+    return thread_switch_overhead;
+}
+
+int FlatCostModel::process_switch_cost(std::shared_ptr<Thread> next, SimTime time) const {
+    return process_switch_overhead;
+}
@@ -0,0 +1,25 @@
+#ifndef FLAT_COST_MODEL_HPP
+#define FLAT_COST_MODEL_HPP
+
+#include <memory>
+#include "switch_cost/switch_cost_model.hpp"
+
+/*
+    FlatCostModel:
+        The default model. Every dispatch costs a full process switch if the previous thread
+        belonged to a different process (or there was none), and a thread switch otherwise.
+*/
+
+class FlatCostModel : public SwitchCostModel {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    int dispatch_cost(std::shared_ptr<Thread> next, std::shared_ptr<Thread> prev, SimTime time);
+
+    int process_switch_cost(std::shared_ptr<Thread> next, SimTime time) const;
+};
+
+#endif
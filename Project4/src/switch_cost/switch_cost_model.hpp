@@ -0,0 +1,68 @@
+#ifndef SWITCH_COST_MODEL_HPP
+#define SWITCH_COST_MODEL_HPP
+
+#include <memory>
+#include "types/thread/thread.hpp"
+
+/*
+    SwitchCostModel:
+        Base class for the models of how much overhead a dispatch costs.
+
+        The simulation asks the model for the cost of every dispatch, and tells it whenever
+        a thread leaves the CPU, so that models can take the recent history of the CPU into
+        account. The overheads from the first line of the simulation file are stored here
+        before the simulation starts.
+*/
+
+class SwitchCostModel {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        thread_switch_overhead:
+            The thread switch overhead, as specified in the simulation file.
+    */
+    int thread_switch_overhead = 0;
+
+    /*
+        process_switch_overhead:
+            The process switch overhead, as specified in the simulation file.
+    */
+    int process_switch_overhead = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        dispatch_cost(next, prev, time):
+            Returns the overhead of dispatching `next` at the given time, where `prev` is the
+            thread that was on the CPU before it (or nullptr if there was none).
+    */
+    virtual int dispatch_cost(std::shared_ptr<Thread> next, std::shared_ptr<Thread> prev, SimTime time) = 0;
+
+    /*
+        process_switch_cost(next, time):
+            Returns what dispatching `next` at the given time would have cost had a thread of
+            another process been on the CPU before it. Unlike dispatch_cost(), it does not
+            change the model's state.
+    */
+    virtual int process_switch_cost(std::shared_ptr<Thread> next, SimTime time) const = 0;
+
+    /*
+        thread_descheduled(thread, time):
+            Called whenever a thread leaves the CPU, whether it blocks, finishes or is preempted.
+    */
+    virtual void thread_descheduled(std::shared_ptr<Thread> thread, SimTime time) {}
+
+    /*
+        ~SwitchCostModel():
+            Virtual destructor, since models are used through base class pointers.
+    */
+    virtual ~SwitchCostModel() {}
+};
+
+#endif
@@ -0,0 +1,51 @@
+#include "switch_cost/warmth/warmth_cost_model.hpp"
+
+#include <cmath>
+
+int WarmthCostModel::dispatch_cost(std::shared_ptr<Thread> next, std::shared_ptr<Thread> prev, SimTime time) {
+    double refill = process_switch_overhead - thread_switch_overhead;
+    double cost = thread_switch_overhead;
+
+    cost += refill * (1.0 - thread_warmth(next.get(), time, 0));
+
+    if (!prev || next->process_id != prev->process_id) {
+        cost += refill * (1.0 - process_warmth(next->process_id, time, 0));
+        process_switches++;
+    }
+
+    return static_cast<int>(std::lround(cost));
+}
+
+int WarmthCostModel::process_switch_cost(std::shared_ptr<Thread> next, SimTime time) const {
+    double refill = process_switch_overhead - thread_switch_overhead;
+    double cost = thread_switch_overhead;
+
+    cost += refill * (1.0 - thread_warmth(next.get(), time, 1));
+    cost += refill * (1.0 - process_warmth(next->process_id, time, 1));
+
+    return static_cast<int>(std::lround(cost));
+}
+
+void WarmthCostModel::thread_descheduled(std::shared_ptr<Thread> thread, SimTime time) {
+    LastRun last_run = {time, process_switches};
+
+    thread_runs[thread.get()] = last_run;
+    process_runs[thread->process_id] = last_run;
+}
+
+double WarmthCostModel::warmth(const LastRun& last_run, SimTime time, unsigned long extra_switches) const {
+    double age = time - last_run.time;
+    double switches = process_switches - last_run.process_switches + extra_switches;
+
+    return std::exp2(-age / half_life) * std::pow(retention, switches);
+}
+
+double WarmthCostModel::thread_warmth(const Thread* thread, SimTime time, unsigned long extra_switches) const {
+    auto thread_run = thread_runs.find(thread);
+    return thread_run == thread_runs.end() ? 0.0 : warmth(thread_run->second, time, extra_switches);
+}
+
+double WarmthCostModel::process_warmth(int process_id, SimTime time, unsigned long extra_switches) const {
+    auto process_run = process_runs.find(process_id);
+    return process_run == process_runs.end() ? 0.0 : warmth(process_run->second, time, extra_switches);
+}
@@ -0,0 +1,96 @@
+#ifndef WARMTH_COST_MODEL_HPP
+#define WARMTH_COST_MODEL_HPP
+
+#include <memory>
+#include <unordered_map>
+#include "switch_cost/switch_cost_model.hpp"
+
+/*
+    WarmthCostModel:
+        A model that approximates how much of a thread's cache and TLB working set is still
+        around when it is dispatched.
+
+        A working set is "warm" right after it leaves the CPU and decays over time: its warmth
+        halves every `half_life` ticks, and is multiplied by `retention` for every process
+        switch that happened since (each other process that runs evicts some of it). Warmth is
+        tracked for every thread (its cache footprint) and every process (its address space
+        and TLB entries). Something that has never run has a warmth of 0.
+
+        Every dispatch pays the thread switch overhead to save and restore registers. On top
+        of that, with d = process_switch_overhead - thread_switch_overhead:
+            - a process switch pays d * (1 - process warmth) to refill the TLB
+            - every dispatch pays d * (1 - thread warmth) to refill the caches
+
+        So a fully warm dispatch costs a thread switch, and a completely cold process switch
+        costs a process switch plus a cache refill. A thread switch would have been a process
+        switch had another process run in between, so its process switch cost is priced with
+        one more process switch's worth of eviction.
+*/
+
+class WarmthCostModel : public SwitchCostModel {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    static constexpr double DEFAULT_HALF_LIFE = 50.0;
+
+    static constexpr double DEFAULT_RETENTION = 0.75;
+
+    // Number of ticks after which an idle working set has lost half its warmth
+    double half_life;
+
+    // Fraction of a working set that survives one process switch
+    double retention;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    WarmthCostModel(double half_life = DEFAULT_HALF_LIFE, double retention = DEFAULT_RETENTION) :
+        half_life(half_life), retention(retention) {}
+
+    int dispatch_cost(std::shared_ptr<Thread> next, std::shared_ptr<Thread> prev, SimTime time);
+
+    int process_switch_cost(std::shared_ptr<Thread> next, SimTime time) const;
+
+    void thread_descheduled(std::shared_ptr<Thread> thread, SimTime time);
+
+private:
+
+    /*
+        LastRun:
+            When a thread or process last left the CPU, and how many process switches had
+            happened by then.
+    */
+    struct LastRun {
+        SimTime time;
+        unsigned long process_switches;
+    };
+
+    std::unordered_map<const Thread*, LastRun> thread_runs;
+
+    std::unordered_map<int, LastRun> process_runs;
+
+    // Number of process switches so far
+    unsigned long process_switches = 0;
+
+    /*
+        warmth(last_run, time, extra_switches):
+            Returns how much of a working set that left the CPU at last_run is left at time,
+            between 0 (cold) and 1 (warm), after extra_switches more process switches than
+            actually happened.
+    */
+    double warmth(const LastRun& last_run, SimTime time, unsigned long extra_switches = 0) const;
+
+    /*
+        thread_warmth(thread, time, extra_switches), process_warmth(process_id, time, extra_switches):
+            warmth() of a thread's or process's last run, or 0 if it has never run.
+    */
+    double thread_warmth(const Thread* thread, SimTime time, unsigned long extra_switches) const;
+
+    double process_warmth(int process_id, SimTime time, unsigned long extra_switches) const;
+};
+
+#endif
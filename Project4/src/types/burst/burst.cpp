@@ -3,7 +3,7 @@
 #include <cassert>
 #include <stdexcept>
 
-Burst::Burst(BurstType type, int length)
+Burst::Burst(BurstType type, SimTime length)
 {
     this->burst_type = type;
     if (length > 0 ) {
@@ -14,7 +14,7 @@ Burst::Burst(BurstType type, int length)
     
 }
 
-void Burst::update_time(int delta_t)
+void Burst::update_time(SimTime delta_t)
 {
     this->length = (this->length - delta_t >= 0) ? (this->length - delta_t) : 0;
 }
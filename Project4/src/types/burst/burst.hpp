@@ -2,6 +2,7 @@
 #define BURST_HPP
 
 #include "types/enums.hpp"
+#include "types/sim_time.hpp"
 
 /*
     Burst:
@@ -24,9 +25,23 @@ public:
 
     /*
         length:
-            The length of the burst. Should be a positive integer.
+            The length of the burst, in ticks. Should be positive.
     */
-    int length;
+    SimTime length;
+
+    /*
+        device:
+            For IO bursts, the ID of the I/O device that serves the burst. -1 if the burst
+            does not use a shared device (i.e., it can always start right away).
+    */
+    int device = -1;
+
+    /*
+        track:
+            For IO bursts on a device, the position on the device that the burst accesses.
+            Used by the SCAN and DEADLINE disciplines, and to compute seek time.
+    */
+    int track = 0;
 
     //==================================================
     //  Member functions
@@ -35,9 +50,9 @@ public:
     /*
         Burst(type, length):
             The constructor for a burst. Takes in a BurstType that denotes the type of burst
-            this will be, and an integer for the length.
+            this will be, and a positive length.
     */
-    Burst(BurstType type, int length);
+    Burst(BurstType type, SimTime length);
 
     
     /*
@@ -45,7 +60,7 @@ public:
             Update the burst time. This is useful when you have a preemptive algorithm so that
             the you can update a burst's remaining length after it has been preempted.
     */
-    void update_time(int delta_t);
+    void update_time(SimTime delta_t);
 };
 
 #endif
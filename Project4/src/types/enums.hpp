@@ -30,6 +30,12 @@ enum EventType {
     DISPATCHER_INVOKED
 };
 
+enum IODiscipline {
+    IO_FIFO,
+    IO_SCAN,
+    IO_DEADLINE
+};
+
 enum ThreadState {
     NEW,
     READY,
@@ -74,4 +80,10 @@ inline const char* PROCESS_PRIORITY_MAP[4] = {
     "BATCH"
 };
 
+inline const char* IO_DISCIPLINE_MAP[3] = {
+    "FIFO",
+    "SCAN",
+    "DEADLINE"
+};
+
 #endif
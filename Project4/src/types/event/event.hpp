@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "types/scheduling_decision/scheduling_decision.hpp"
+#include "types/sim_time.hpp"
 #include "types/thread/thread.hpp"
 #include "types/enums.hpp"
 
@@ -31,9 +32,9 @@ public:
 
     /*
         time:
-            The scheduled time that the event will occur. Should be an unsigned integer.
+            The scheduled time that the event will occur. Should not be negative.
     */
-    unsigned int time;
+    SimTime time;
 
     /*
         event_num:
@@ -41,7 +42,7 @@ public:
             event should have a number of 1, and so on. This value is used in the case of
             tie breaks for the event queue (see below).
     */
-    unsigned int event_num;
+    uint64_t event_num;
 
     /*
         thread:
@@ -57,6 +58,13 @@ public:
     */
     std::shared_ptr<SchedulingDecision> scheduling_decision;
 
+    /*
+        queue_index:
+            The event's position in the EventQueue, or -1 if it is not in one. This is maintained
+            by the EventQueue so that it can cancel or reschedule the event in O(log n).
+    */
+    int queue_index = -1;
+
     //==================================================
     //  Member functions
     //==================================================
@@ -68,7 +76,7 @@ public:
             a Thread if one is associated with this event (or nullptr if one is not), and a SchedulingDecision if
             one is associated with this event (or nullptr if one is not).
     */
-    Event(EventType type, unsigned int time, unsigned int event_num, std::shared_ptr<Thread> thread, std::shared_ptr<SchedulingDecision> sd):
+    Event(EventType type, SimTime time, uint64_t event_num, std::shared_ptr<Thread> thread, std::shared_ptr<SchedulingDecision> sd):
         type(type), time(time), event_num(event_num), thread(thread), scheduling_decision(sd) {}
 
     /*
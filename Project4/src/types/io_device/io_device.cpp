@@ -0,0 +1,66 @@
+#include "types/io_device/io_device.hpp"
+
+#include <cstdlib>
+#include <iterator>
+
+void IODevice::submit(IORequest request) {
+    auto entry = by_track.emplace(request.track, QueuedRequest{next_order, request});
+    by_order.emplace(next_order++, entry);
+}
+
+IORequest IODevice::start_next(SimTime time, SimTime& service_time) {
+    auto entry = pick(time);
+    IORequest request = entry->second.request;
+
+    by_order.erase(entry->second.order);
+    by_track.erase(entry);
+
+    service_time = request.length + static_cast<SimTime>(seek_cost) * std::abs(request.track - head);
+    head = request.track;
+    busy = true;
+
+    requests_served++;
+    busy_time += service_time;
+    wait_time += time - request.submit_time;
+
+    return request;
+}
+
+IODevice::TrackMap::iterator IODevice::pick(SimTime time) {
+    switch (discipline) {
+        case IO_FIFO:
+            return by_order.begin()->second;
+
+        case IO_SCAN: {
+            if (moving_up) {
+                auto ahead = by_track.lower_bound(head);
+                if (ahead != by_track.end()) {
+                    return ahead;
+                }
+                moving_up = false;
+            }
+
+            // Nearest request at or below the head (the first one submitted on that track)
+            auto behind = by_track.upper_bound(head);
+            if (behind != by_track.begin()) {
+                auto track = std::prev(behind)->first;
+                return by_track.lower_bound(track);
+            }
+            moving_up = true;
+            return by_track.lower_bound(head);
+        }
+
+        case IO_DEADLINE: {
+            auto oldest = by_order.begin()->second;
+            if (time - oldest->second.request.submit_time >= expiry) {
+                return oldest;
+            }
+
+            // Sweep upwards, wrapping around to the lowest track
+            auto ahead = by_track.lower_bound(head);
+            return ahead != by_track.end() ? ahead : by_track.begin();
+        }
+    }
+
+    return by_order.begin()->second;
+}
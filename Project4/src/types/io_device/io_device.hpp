@@ -0,0 +1,158 @@
+#ifndef IO_DEVICE_HPP
+#define IO_DEVICE_HPP
+
+#include <cstddef>
+#include <map>
+#include <memory>
+
+#include "types/enums.hpp"
+#include "types/sim_time.hpp"
+#include "types/thread/thread.hpp"
+
+/*
+    IORequest:
+        A single IO burst waiting for (or being served by) an I/O device.
+*/
+
+struct IORequest {
+    std::shared_ptr<Thread> thread;
+
+    // The length of the IO burst, not counting seek time
+    SimTime length;
+
+    // The position on the device that the burst accesses
+    int track;
+
+    // When the request was submitted to the device
+    SimTime submit_time;
+};
+
+/*
+    IODevice:
+        A shared I/O device that serves one IO burst at a time. Bursts that are submitted while
+        the device is busy wait in its queue, and the device's discipline decides which one is
+        served next:
+
+            FIFO:      in the order they were submitted.
+            SCAN:      elevator order; the head keeps moving in one direction, serving the nearest
+                       request ahead of it, and reverses when there are none left in that direction.
+            DEADLINE:  like SCAN, but only sweeping upwards, unless the oldest request has waited
+                       `expiry` ticks, in which case it is served first.
+
+        Serving a request takes its length plus `seek_cost` ticks per track the head has to move.
+*/
+
+class IODevice {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    /*
+        device_id:
+            The device's ID, as given in the simulation file.
+    */
+    int device_id;
+
+    /*
+        discipline:
+            How the device picks the next request to serve.
+    */
+    IODiscipline discipline;
+
+    /*
+        seek_cost:
+            The number of ticks it takes the head to move one track.
+    */
+    int seek_cost = 0;
+
+    /*
+        expiry:
+            For the DEADLINE discipline, how long a request may wait before it is served out of order.
+    */
+    SimTime expiry = 100;
+
+    /*
+        head:
+            The track the device's head is currently on.
+    */
+    int head = 0;
+
+    /*
+        busy:
+            Whether the device is currently serving a request.
+    */
+    bool busy = false;
+
+    /*
+        requests_served, busy_time, wait_time:
+            Statistics: the number of requests served, the total time spent serving them, and the
+            total time requests spent waiting in the queue before being served.
+    */
+    size_t requests_served = 0;
+
+    SimTime busy_time = 0;
+
+    SimTime wait_time = 0;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        IODevice(device_id, discipline, seek_cost, expiry):
+            Constructs an idle device with its head on track 0.
+    */
+    IODevice(int device_id, IODiscipline discipline, int seek_cost = 0, SimTime expiry = 100) :
+        device_id(device_id), discipline(discipline), seek_cost(seek_cost), expiry(expiry) {}
+
+    /*
+        submit(request):
+            Adds a request to the device's queue.
+    */
+    void submit(IORequest request);
+
+    /*
+        empty():
+            Returns true if no requests are waiting in the queue.
+    */
+    bool empty() const { return by_order.empty(); }
+
+    /*
+        start_next(time):
+            Removes the next request from the queue according to the discipline, moves the head to
+            it and marks the device busy. Returns the request and sets service_time to how long it
+            will take. The queue must not be empty.
+    */
+    IORequest start_next(SimTime time, SimTime& service_time);
+
+private:
+
+    struct QueuedRequest {
+        unsigned long order;
+        IORequest request;
+    };
+
+    using TrackMap = std::multimap<int, QueuedRequest>;
+
+    // Waiting requests, sorted by track (ties in submission order)
+    TrackMap by_track;
+
+    // Waiting requests, in submission order
+    std::map<unsigned long, TrackMap::iterator> by_order;
+
+    // Counter used to order submissions
+    unsigned long next_order = 0;
+
+    // For SCAN, whether the head is currently moving towards higher tracks
+    bool moving_up = true;
+
+    /*
+        pick(time):
+            Returns the waiting request to serve next.
+    */
+    TrackMap::iterator pick(SimTime time);
+};
+
+#endif
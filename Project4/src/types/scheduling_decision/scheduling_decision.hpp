@@ -34,7 +34,8 @@ public:
     /*
         time_slice:
             The time slice for preemptive algorithms. -1 if the thread
-            should not be preempted.
+            should not be preempted. The simulation uses this rather than the
+            scheduler's time_slice, so it may differ between decisions.
     */
     int time_slice = -1;
     
@@ -0,0 +1,14 @@
+#ifndef SIM_TIME_HPP
+#define SIM_TIME_HPP
+
+#include <cstdint>
+
+/*
+    SimTime:
+        A point in, or span of, simulated time in ticks. It is 64 bits wide so that long traces
+        do not wrap around, and signed so that -1 can mean "not yet" (e.g., a thread's start_time).
+*/
+
+using SimTime = int64_t;
+
+#endif
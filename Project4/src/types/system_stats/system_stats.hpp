@@ -1,6 +1,34 @@
 #ifndef SYSTEM_STATS_HPP
 #define SYSTEM_STATS_HPP
 
+#include <cstddef>
+#include <vector>
+
+#include "types/enums.hpp"
+#include "types/sim_time.hpp"
+
+/*
+    DeviceStats:
+        Statistics for a single shared I/O device.
+*/
+
+struct DeviceStats {
+    int device_id;
+    IODiscipline discipline;
+
+    // Number of IO bursts the device served
+    size_t requests = 0;
+
+    // Time spent serving IO bursts, including seek time
+    SimTime busy_time = 0;
+
+    // Time IO bursts spent waiting in the device's queue
+    SimTime wait_time = 0;
+
+    // Percentage of the simulation the device was busy
+    double utilization = 0.0;
+};
+
 /*
     SystemStats:
         A simple class for encapsulating the statistics that
@@ -18,31 +46,64 @@ public:
         total_time:
             The total amount of time that has elapsed in the simulation.
     */
-    size_t total_time = 0;
+    SimTime total_time = 0;
 
     /*
         dispatch_time:
             The amount of time that the processor has spent dispatching (overhead).
     */
-    size_t dispatch_time = 0;
+    SimTime dispatch_time = 0;
+
+    /*
+        thread_switches:
+            The number of dispatches that only needed a thread switch.
+    */
+    size_t thread_switches = 0;
+
+    /*
+        process_switches:
+            The number of dispatches that needed a full process switch.
+    */
+    size_t process_switches = 0;
+
+    /*
+        dispatch_time_saved:
+            The dispatch time avoided by doing thread switches instead of process switches,
+            i.e., how much larger dispatch_time would be if every dispatch was a process switch,
+            as priced by the switch cost model.
+    */
+    SimTime dispatch_time_saved = 0;
 
     /*
         total_idle_time:
             The amount of time that the processor has been idle.
     */
-    size_t total_idle_time = 0;
+    SimTime total_idle_time = 0;
 
     /*
         total_service_time:
             The amount of time that the processor has spent executing threads.
     */
-    size_t total_service_time = 0;
+    SimTime total_service_time = 0;
 
     /*
         io_time:
             The cumulative amount of time that all threads have spent doing IO.
     */
-    size_t total_io_time = 0;
+    SimTime total_io_time = 0;
+
+    /*
+        total_io_wait_time:
+            The cumulative amount of time that IO bursts spent waiting for a shared I/O
+            device before being served. Included in total_io_time.
+    */
+    SimTime total_io_wait_time = 0;
+
+    /*
+        device_stats:
+            Statistics for every I/O device specified in the simulation file.
+    */
+    std::vector<DeviceStats> device_stats;
 
     /*
         cpu_utilization:
@@ -73,6 +134,56 @@ public:
             The average turnaround time for threads of different priorities.
     */
     double avg_thread_turnaround_times[4] = {0.0, 0.0, 0.0, 0.0};
+
+    /*
+        max_wait_times[4]:
+            The longest time a thread of each priority spent ready before being dispatched.
+    */
+    SimTime max_wait_times[4] = {0, 0, 0, 0};
+
+    /*
+        target_shares[4]:
+            For proportional-share algorithms, the percentage of the service time that threads
+            of each priority should have gotten. Whenever a thread runs, the time is split between
+            the priorities of the threads competing for the CPU (the running and ready threads),
+            in proportion to their tickets. All 0 for other algorithms.
+    */
+    double target_shares[4] = {0.0, 0.0, 0.0, 0.0};
+
+    /*
+        achieved_shares[4]:
+            The percentage of the total service time that went to threads of each priority.
+    */
+    double achieved_shares[4] = {0.0, 0.0, 0.0, 0.0};
+
+    /*
+        deadline_threads:
+            The number of threads that were given a deadline in the simulation file.
+    */
+    size_t deadline_threads = 0;
+
+    /*
+        deadline_misses:
+            The number of threads that finished after their deadline.
+    */
+    size_t deadline_misses = 0;
+
+    /*
+        deadline_miss_rate:
+            The percentage of threads with a deadline that missed it.
+    */
+    double deadline_miss_rate = 0.0;
+
+    /*
+        lateness distribution:
+            How long after their deadlines the threads with a deadline finished (negative if
+            they finished early). The percentiles use the nearest-rank method.
+    */
+    SimTime min_lateness = 0;
+    double avg_lateness = 0.0;
+    SimTime median_lateness = 0;
+    SimTime p95_lateness = 0;
+    SimTime max_lateness = 0;
 };
 
 #endif
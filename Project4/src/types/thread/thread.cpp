@@ -3,7 +3,7 @@
 #include <stdexcept>
 #include "types/thread/thread.hpp"
 
-void Thread::set_ready(int time) {
+void Thread::set_ready(SimTime time) {
     switch (this->current_state)
     {
         case NEW:
@@ -24,11 +24,14 @@ void Thread::set_ready(int time) {
     this->current_state = READY;
 }
 
-void Thread::set_running(int time) {
+void Thread::set_running(SimTime time) {
     if (current_state == READY) {
         if (previous_state == NEW)
                 this->start_time = time;
 
+        if (time - this->state_change_time > this->max_wait_time)
+                this->max_wait_time = time - this->state_change_time;
+
         this->previous_state = this->current_state;
         this->current_state = RUNNING;
         this->state_change_time = time;
@@ -37,7 +40,7 @@ void Thread::set_running(int time) {
     }  
 }
 
-void Thread::set_blocked(int time) {
+void Thread::set_blocked(SimTime time) {
     if (current_state == RUNNING) {
         this->service_time += time - this->state_change_time;
         previous_state = current_state;
@@ -48,7 +51,7 @@ void Thread::set_blocked(int time) {
     } 
 }
 
-void Thread::set_finished(int time) {
+void Thread::set_finished(SimTime time) {
     switch (this->current_state) {
         case RUNNING:
             this->service_time += time - this->state_change_time;
@@ -63,15 +66,19 @@ void Thread::set_finished(int time) {
     } 
 }
 
-int Thread::response_time() const {
+SimTime Thread::response_time() const {
     return start_time - arrival_time;
 }
 
-int Thread::turnaround_time() const {
+SimTime Thread::turnaround_time() const {
     return end_time - arrival_time;
 }
 
-void Thread::set_state(ThreadState state, int time) {
+SimTime Thread::lateness() const {
+    return end_time - deadline;
+}
+
+void Thread::set_state(ThreadState state, SimTime time) {
     switch (state)
     {
     case READY:
@@ -8,6 +8,7 @@
 
 #include "types/burst/burst.hpp"
 #include "types/enums.hpp"
+#include "types/sim_time.hpp"
 
 /*
     Thread:
@@ -24,7 +25,7 @@ public:
             A constuctor for a thread object. We give it an arrival time, thread ID,
             process ID, and priority, and a thread with those variables is constructed.
     */
-    Thread(int arrival, int thread_id, int process_id, ProcessPriority priority):
+    Thread(SimTime arrival, int thread_id, int process_id, ProcessPriority priority):
         thread_id(thread_id), process_id(process_id), arrival_time(arrival), priority(priority) {}
 
     //==================================================
@@ -47,39 +48,52 @@ public:
         arrival_time:
             When the thread arrived into the simulation. Taken from the input file.
     */
-    int arrival_time = -1;
+    SimTime arrival_time = -1;
 
     /*
         start_time:
             The time the CPU was first able to execute this thread. Should be set when
             the thread transitions from NEW to RUNNING.
     */
-    int start_time = -1;
+    SimTime start_time = -1;
 
     /*
         end_time:
             The time that all of this thread's CPU and IO bursts were completed.
             Set when the thread transitions from RUNNING to EXIT.
     */
-    int end_time = -1;
+    SimTime end_time = -1;
 
     /*
         service_time:
             The service time for the thread. The total time it was spent on the CPU.
     */
-    int service_time = 0;
+    SimTime service_time = 0;
 
     /*
         io_time:
             The IO time for the thread. The total time it spent in IO.
     */
-    int io_time = 0;
+    SimTime io_time = 0;
 
     /*
         state_change_time:
             The time of the last state change.
     */
-    int state_change_time = -1;
+    SimTime state_change_time = -1;
+
+    /*
+        deadline:
+            The absolute time by which the thread should finish, i.e., its arrival time plus
+            the relative deadline from the simulation file. -1 if the thread has no deadline.
+    */
+    SimTime deadline = -1;
+
+    /*
+        max_wait_time:
+            The longest time the thread spent in the READY state before being dispatched.
+    */
+    SimTime max_wait_time = 0;
 
 
     /*
@@ -122,27 +136,34 @@ public:
             to make sure that the transition is valid, e.g., is NEW->BLOCKED a valid transition?
             Throwing an exception for an invalid transition may be a good idea.
     */
-    void set_ready(int time);
+    void set_ready(SimTime time);
 
-    void set_running(int time);
+    void set_running(SimTime time);
 
-    void set_blocked(int time);
+    void set_blocked(SimTime time);
 
-    void set_finished(int time);
+    void set_finished(SimTime time);
 
-    void set_state(ThreadState state, int time);
+    void set_state(ThreadState state, SimTime time);
 
     /*
         response_time():
             Calculate the response time for this particular thread.
     */
-    int response_time() const;
+    SimTime response_time() const;
 
     /*
         turnaround_time():
             Calculate the turnaround time for this particular thread.
     */
-    int turnaround_time() const;
+    SimTime turnaround_time() const;
+
+    /*
+        lateness():
+            How long after its deadline the thread finished (negative if it finished early).
+            Only meaningful for finished threads with a deadline.
+    */
+    SimTime lateness() const;
 
     /*
         get_next_burst(type):
@@ -0,0 +1,72 @@
+#ifndef WORKLOAD_HPP
+#define WORKLOAD_HPP
+
+#include <vector>
+
+#include "types/enums.hpp"
+#include "types/sim_time.hpp"
+
+/*
+    IOBurstSpec:
+        An IO burst of a thread in a workload. If device is -1, the burst does not wait
+        for a shared I/O device.
+*/
+
+struct IOBurstSpec {
+    SimTime length = 0;
+    int device = -1;
+    int track = 0;
+};
+
+/*
+    ThreadSpec:
+        A thread in a workload. A thread alternates CPU and IO bursts, starting and ending
+        with a CPU burst, so it has one more CPU burst than IO bursts.
+*/
+
+struct ThreadSpec {
+    SimTime arrival_time = 0;
+    std::vector<SimTime> cpu_bursts;
+    std::vector<IOBurstSpec> io_bursts;
+
+    // Deadline relative to arrival_time, or -1 if the thread has none
+    SimTime relative_deadline = -1;
+};
+
+/*
+    ProcessSpec:
+        A process in a workload and its threads, whose IDs are their indices.
+*/
+
+struct ProcessSpec {
+    int process_id = 0;
+    ProcessPriority priority = NORMAL;
+    std::vector<ThreadSpec> threads;
+};
+
+/*
+    DeviceSpec:
+        A shared I/O device in a workload (see IODevice).
+*/
+
+struct DeviceSpec {
+    int device_id = 0;
+    IODiscipline discipline = IO_FIFO;
+    int seek_cost = 0;
+    SimTime expiry = 100;
+};
+
+/*
+    Workload:
+        Everything a simulation file describes, held in memory. Simulation::read_file parses
+        a simulation file into a Workload, and Simulation::load sets the simulation up from one.
+*/
+
+struct Workload {
+    int thread_switch_overhead = 0;
+    int process_switch_overhead = 0;
+    std::vector<DeviceSpec> devices;
+    std::vector<ProcessSpec> processes;
+};
+
+#endif
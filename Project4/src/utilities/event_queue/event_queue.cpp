@@ -0,0 +1,118 @@
+#include "utilities/event_queue/event_queue.hpp"
+
+#include <utility>
+
+void EventQueue::push(std::shared_ptr<Event> event) {
+    Key event_key = key(*event);
+    heap.push_back(Slot{event_key, std::move(event)});
+    sift_up(heap.size() - 1);
+}
+
+void EventQueue::pop() {
+    remove_at(0);
+}
+
+bool EventQueue::contains(const std::shared_ptr<Event>& event) const {
+    return event && event->queue_index >= 0 && static_cast<size_t>(event->queue_index) < heap.size() &&
+        heap[event->queue_index].event == event;
+}
+
+bool EventQueue::cancel(const std::shared_ptr<Event>& event) {
+    if (!contains(event)) {
+        return false;
+    }
+
+    remove_at(event->queue_index);
+    return true;
+}
+
+bool EventQueue::reschedule(const std::shared_ptr<Event>& event, SimTime time, uint64_t event_num) {
+    if (!contains(event)) {
+        return false;
+    }
+
+    size_t index = event->queue_index;
+    Key old_key = heap[index].key;
+
+    event->time = time;
+    event->event_num = event_num;
+    heap[index].key = key(*event);
+
+    if (heap[index].key < old_key) {
+        sift_up(index);
+    } else {
+        sift_down(index);
+    }
+    return true;
+}
+
+void EventQueue::place(size_t index, Slot slot) {
+    slot.event->queue_index = static_cast<int>(index);
+    heap[index] = std::move(slot);
+}
+
+void EventQueue::sift_up(size_t index) {
+    Slot slot = std::move(heap[index]);
+
+    while (index > 0) {
+        size_t parent = (index - 1) / ARITY;
+        if (heap[parent].key <= slot.key) {
+            break;
+        }
+        place(index, std::move(heap[parent]));
+        index = parent;
+    }
+
+    place(index, std::move(slot));
+}
+
+void EventQueue::sift_down(size_t index) {
+    Slot slot = std::move(heap[index]);
+    size_t count = heap.size();
+
+    while (true) {
+        size_t first_child = index * ARITY + 1;
+        if (first_child >= count) {
+            break;
+        }
+
+        // Find the smallest of up to ARITY children
+        size_t last_child = first_child + ARITY < count ? first_child + ARITY : count;
+        size_t smallest = first_child;
+        for (size_t child = first_child + 1; child < last_child; ++child) {
+            if (heap[child].key < heap[smallest].key) {
+                smallest = child;
+            }
+        }
+
+        if (slot.key <= heap[smallest].key) {
+            break;
+        }
+        place(index, std::move(heap[smallest]));
+        index = smallest;
+    }
+
+    place(index, std::move(slot));
+}
+
+void EventQueue::remove_at(size_t index) {
+    heap[index].event->queue_index = -1;
+
+    Slot last = std::move(heap.back());
+    heap.pop_back();
+
+    // The removed event was the last slot, so nothing needs to move
+    if (index == heap.size()) {
+        return;
+    }
+
+    Key removed_key = heap[index].key;
+    heap[index] = std::move(last);
+    heap[index].event->queue_index = static_cast<int>(index);
+
+    if (heap[index].key < removed_key) {
+        sift_up(index);
+    } else {
+        sift_down(index);
+    }
+}
@@ -0,0 +1,135 @@
+#ifndef EVENT_QUEUE_HPP
+#define EVENT_QUEUE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types/event/event.hpp"
+
+/*
+    EventQueue:
+        The simulation's queue of future events. Events come out ordered by time, with ties
+        broken by event_num, exactly like a std::priority_queue using EventComparator.
+
+        Unlike std::priority_queue, an event that is still in the queue can be withdrawn with
+        cancel() or moved to a new time with reschedule(), both in O(log n). The shared_ptr to
+        the event is its handle: the queue keeps the event's position in the heap up to date in
+        Event::queue_index.
+
+        Internally this is a 4-ary heap. Each slot caches the event's ordering key, its 64-bit time
+        and 64-bit event_num, so sifting never has to dereference the events themselves.
+*/
+
+class EventQueue {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        empty():
+            Returns true if there are no events in the queue.
+    */
+    bool empty() const { return heap.empty(); }
+
+    /*
+        size():
+            Returns the number of events in the queue.
+    */
+    size_t size() const { return heap.size(); }
+
+    /*
+        top():
+            Returns the next event to happen. The queue must not be empty.
+    */
+    const std::shared_ptr<Event>& top() const { return heap.front().event; }
+
+    /*
+        push(event):
+            Adds an event to the queue. The event must not already be in a queue.
+    */
+    void push(std::shared_ptr<Event> event);
+
+    /*
+        pop():
+            Removes the next event to happen. The queue must not be empty.
+    */
+    void pop();
+
+    /*
+        contains(event):
+            Returns true if the event is currently waiting in this queue.
+    */
+    bool contains(const std::shared_ptr<Event>& event) const;
+
+    /*
+        cancel(event):
+            Removes the event from the queue so it never happens. Returns false if the event
+            was not in the queue (e.g., it already happened).
+    */
+    bool cancel(const std::shared_ptr<Event>& event);
+
+    /*
+        reschedule(event, time, event_num):
+            Moves an event that is still in the queue to a new time. The caller gives it a new
+            event_num, so ties are broken as if the event had just been created. Returns false if
+            the event was not in the queue.
+    */
+    bool reschedule(const std::shared_ptr<Event>& event, SimTime time, uint64_t event_num);
+
+private:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    // Number of children per heap node
+    static constexpr size_t ARITY = 4;
+
+    /*
+        Key:
+            An event's (time, event_num), which sorts the same way as EventComparator. Both
+            are 64-bit, so they are compared in turn rather than packed into one integer.
+    */
+    struct Key {
+        SimTime time;
+        uint64_t event_num;
+
+        bool operator<(const Key& other) const {
+            return time != other.time ? time < other.time : event_num < other.event_num;
+        }
+
+        bool operator<=(const Key& other) const { return !(other < *this); }
+    };
+
+    struct Slot {
+        Key key;
+        std::shared_ptr<Event> event;
+    };
+
+    std::vector<Slot> heap;
+
+    //==================================================
+    //  Helper functions
+    //==================================================
+
+    /*
+        key(event):
+            Returns the event's ordering key.
+    */
+    static Key key(const Event& event) {
+        return Key{event.time, event.event_num};
+    }
+
+    void place(size_t index, Slot slot);
+
+    void sift_up(size_t index);
+
+    void sift_down(size_t index);
+
+    void remove_at(size_t index);
+};
+
+#endif
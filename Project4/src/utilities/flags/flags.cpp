@@ -11,8 +11,11 @@ void print_usage() {
         "   -m, --metrics:\n"
         "       If set, outputs general metrics for the simulation.\n"
         "\n"
+        "   -x, --extended_metrics:\n"
+        "       If set, outputs extended metrics for the simulation.\n"
+        "\n"
         "   -s, --time_slice <value>:\n"
-        "       Set the default time slice for a pre-emptive algorithms (this is min_granularity for CFS). Must be greater than zero.\n"
+        "       Set the default time slice for a pre-emptive algorithms (this is min_granularity for CFS and the minimum quantum for ARR). Must be greater than zero.\n"
         "\n"
         "   -t, --per_thread:\n"
         "       If set, outputs per-thread metrics at the end of the simulation.\n"
@@ -25,9 +28,48 @@ void print_usage() {
         "           FCFS: first-come, first-served (default)\n"
         "           SPN: shortest process next\n"
         "           RR: round-robin scheduling\n"
+        "           ARR: round-robin scheduling with an adaptive quantum\n"
         "           PRIORITY: priority scheduling\n"
+        "           PRIORITY-P: preemptive priority scheduling\n"
+        "           AFFINITY: first-come, first-served preferring the loaded process\n"
+        "           O1: Linux O(1)-style active/expired priority arrays\n"
+        "           STRIDE: stride scheduling with tickets per process priority\n"
+        "           LOTTERY: lottery scheduling with tickets per process priority\n"
+        "           EDF: preemptive earliest-deadline-first scheduling\n"
+        "           FAIR: fair share between processes, then between their threads\n"
         "           MLFQ: multilevel feedback queue\n"
-        "           CFS: completely-fair scheduling\n";
+        "           CFS: completely-fair scheduling\n"
+        "\n"
+        "   -c, --switch_cost <model>:\n"
+        "       The model used to compute the overhead of a dispatch. Valid values are:\n"
+        "           FLAT: process or thread switch overhead from the simulation file (default)\n"
+        "           WARMTH: overhead grows as the cache and TLB working set goes cold\n"
+        "\n"
+        "   -r, --seed <value>:\n"
+        "       The seed for randomized algorithms (default 1).\n"
+        "\n"
+        "   -g, --aging <ticks>:\n"
+        "       For PRIORITY and PRIORITY-P, raise a waiting thread by one priority class every\n"
+        "       <ticks> ticks it spends ready (default 0, no aging).\n"
+        "\n"
+        "   -i, --perf_import:\n"
+        "       The input file is the output of `perf sched script`. Every traced thread becomes a\n"
+        "       process, with one tick per microsecond.\n"
+        "\n"
+        "   -o, --output <file>:\n"
+        "       With --perf_import, write the imported workload to <file> as a simulation file\n"
+        "       instead of simulating it.\n"
+        "\n"
+        "   -n, --replicas <N>:\n"
+        "       The input file is a workload model. Simulate up to N randomized workloads drawn\n"
+        "       from it, and print the mean and 95% confidence interval of every metric.\n"
+        "\n"
+        "   -e, --ci_width <fraction>:\n"
+        "       With --replicas, stop early once every confidence interval half-width is within\n"
+        "       <fraction> of its mean (e.g., 0.05).\n"
+        "\n"
+        "   -j, --jobs <N>:\n"
+        "       With --replicas, the number of threads to use (default one per core).\n";
 }
 
 
@@ -40,9 +82,18 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
     static struct option flag_options[] = {
         {"per_thread",  no_argument,        0, 't'},
         {"metrics",     no_argument,        0, 'm'},
+        {"extended_metrics", no_argument,   0, 'x'},
         {"verbose",     no_argument,        0, 'v'},
         {"algorithm",   required_argument,  0, 'a'},
         {"time_slice",  required_argument,  0, 's'},
+        {"switch_cost", required_argument,  0, 'c'},
+        {"seed",        required_argument,  0, 'r'},
+        {"aging",       required_argument,  0, 'g'},
+        {"perf_import", no_argument,        0, 'i'},
+        {"output",      required_argument,  0, 'o'},
+        {"replicas",    required_argument,  0, 'n'},
+        {"ci_width",    required_argument,  0, 'e'},
+        {"jobs",        required_argument,  0, 'j'},
         {"help",        no_argument,        0, 'h'},
         {0, 0, 0, 0}
     };
@@ -52,7 +103,7 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
 
     // Parse flags entered by the user.
     while (true) {
-        flag_char = getopt_long(argc, argv, "-s:tvhma:", flag_options, &option_index);
+        flag_char = getopt_long(argc, argv, "-s:tvhmxa:c:r:g:io:n:e:j:", flag_options, &option_index);
 
         // Detect the end of the options.
         if (flag_char == -1) {
@@ -72,10 +123,69 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
                 flags.metrics = true;
                 break;
 
+            case 'x':
+                flags.extended_metrics = true;
+                break;
+
             case 'a':
                 flags.scheduler = get_scheduler();
                 break;
 
+            case 'c':
+                flags.switch_cost = get_switch_cost();
+                break;
+
+            case 'r':
+                try {
+                    flags.seed = std::stoul(optarg);
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'g':
+                try {
+                    flags.aging = std::stoi(optarg);
+                    if (flags.aging < 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'i':
+                flags.perf_import = true;
+                break;
+
+            case 'o':
+                flags.output = optarg;
+                break;
+
+            case 'n':
+                try {
+                    if (std::stol(optarg) <= 0) { return 1; }
+                    flags.replicas = std::stoul(optarg);
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'e':
+                try {
+                    flags.ci_width = std::stod(optarg);
+                    if (flags.ci_width < 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'j':
+                try {
+                    flags.jobs = std::stoul(optarg);
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
             case 'h':
                 return 1;
                 break;
@@ -105,7 +215,7 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
         flags.scheduler = "FCFS";
     }
 
-    if (flags.scheduler == "ERROR") {
+    if (flags.scheduler == "ERROR" || flags.switch_cost == "ERROR") {
         return 1;
     }
 
@@ -117,7 +227,7 @@ std::string get_scheduler() {
     std::string input(optarg);
     std::string input_algorithm = input;
     std::transform(input_algorithm.begin(), input_algorithm.end(), input_algorithm.begin(), ::toupper);
-    std::string valid_algorithms[] = {"FCFS", "SPN", "RR", "PRIORITY", "MLFQ", "CFS"};
+    std::string valid_algorithms[] = {"FCFS", "SPN", "RR", "ARR", "PRIORITY", "PRIORITY-P", "AFFINITY", "O1", "STRIDE", "LOTTERY", "EDF", "FAIR", "MLFQ", "CFS"};
 
     bool valid = std::find(std::begin(valid_algorithms), std::end(valid_algorithms), input_algorithm) != std::end(valid_algorithms);
 
@@ -128,3 +238,14 @@ std::string get_scheduler() {
     }
     return "";
 }
+
+
+std::string get_switch_cost() {
+    std::string input_model(optarg);
+    std::transform(input_model.begin(), input_model.end(), input_model.begin(), ::toupper);
+    std::string valid_models[] = {"FLAT", "WARMTH"};
+
+    bool valid = std::find(std::begin(valid_models), std::end(valid_models), input_model) != std::end(valid_models);
+
+    return valid ? input_model : "ERROR";
+}
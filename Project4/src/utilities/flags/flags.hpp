@@ -55,6 +55,15 @@ public:
     */
     bool metrics = false;
 
+    /*
+        extended_metrics:
+            Whether or not the simulation should print extended metrics (dispatch
+            breakdown, etc.) at the end of the simulation.
+
+            Set to true with the -x, --extended_metrics flag.
+    */
+    bool extended_metrics = false;
+
     /*
         time_slice:
             The time slice for preemptive algorithms. Should be positive.
@@ -71,6 +80,75 @@ public:
             Set with the -a, --algorithm flag.
     */
     std::string scheduler = "";
+
+    /*
+        switch_cost:
+            A string representing the model used to compute dispatch overhead.
+
+            Set with the -c, --switch_cost flag.
+    */
+    std::string switch_cost = "FLAT";
+
+    /*
+        seed:
+            The seed for randomized algorithms (e.g., lottery scheduling).
+
+            Set with the -r, --seed flag.
+    */
+    unsigned int seed = 1;
+
+    /*
+        aging:
+            For PRIORITY and PRIORITY-P, the number of ticks a thread has to wait in the
+            ready queue to be raised by one priority class. 0 disables aging.
+
+            Set with the -g, --aging flag.
+    */
+    int aging = 0;
+
+    /*
+        perf_import:
+            Whether the input file is the text output of `perf sched script` rather than
+            a simulation file.
+
+            Set to true with the -i, --perf_import flag.
+    */
+    bool perf_import = false;
+
+    /*
+        output:
+            With perf_import, the simulation file to write the imported workload to instead
+            of simulating it. Empty to simulate.
+
+            Set with the -o, --output flag.
+    */
+    std::string output = "";
+
+    /*
+        replicas:
+            If above 0, the input file is a workload model, and up to this many randomized
+            workloads are drawn from it and simulated (see run_monte_carlo).
+
+            Set with the -n, --replicas flag.
+    */
+    size_t replicas = 0;
+
+    /*
+        ci_width:
+            With replicas, stop once every metric's 95% confidence interval half-width is
+            within this fraction of its mean. 0 to always simulate every replica.
+
+            Set with the -e, --ci_width flag.
+    */
+    double ci_width = 0.0;
+
+    /*
+        jobs:
+            With replicas, the number of threads to simulate on. 0 for one per core.
+
+            Set with the -j, --jobs flag.
+    */
+    unsigned int jobs = 0;
 };
 
 /*
@@ -93,4 +171,10 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags);
 */
 std::string get_scheduler();
 
+/*
+    get_switch_cost();
+        Return a string denoting the switch cost model to use.
+*/
+std::string get_switch_cost();
+
 #endif
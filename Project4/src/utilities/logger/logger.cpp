@@ -9,6 +9,7 @@
 #include "types/event/event.hpp"
 #include "types/process/process.hpp"
 #include "types/system_stats/system_stats.hpp"
+#include "monte_carlo/monte_carlo.hpp"
 
 #include "utilities/fmt/format.h"
 
@@ -23,6 +24,10 @@ void Logger::print_state_transition(const std::shared_ptr<Event> event, ThreadSt
         Transitioned from NEW to READY
     */
 
+    if (!this->verbose) {
+        return;
+    }
+
     std::string message = fmt::format("Transitioned from {} to {}", STATE_MAP[before_state], STATE_MAP[after_state]);
 
     print_verbose(event, event->thread, message);
@@ -140,3 +145,113 @@ void Logger::print_simulation_metrics(SystemStats stats) const {
 
     std::cout << summary_message << std::endl;
 }
+
+
+void Logger::print_extended_metrics(SystemStats stats) const {
+    /*
+    This prints something like this:
+
+        DISPATCH OVERHEAD:
+            Thread switches:              9
+            Process switches:            14
+            Dispatch time saved:         36
+
+        MAX READY WAIT:
+            SYSTEM:                      12
+            ...
+
+        I/O DEVICES:
+            Total I/O wait time:         41
+            Device 0 [SCAN]:      served 12   busy 96     wait 30     util 38.10%
+
+        CPU SHARES:
+            SYSTEM:               target  53.33%   achieved  50.94%
+            ...
+
+        DEADLINES:
+            Threads with deadline:        5
+            Deadlines missed:             2
+            Miss rate:               40.00%
+            Lateness min/avg/max:  -12 / 1.40 / 9
+            Lateness p50/p95:      -1 / 9
+    */
+
+    if (!this->extended) {
+        return;
+    }
+
+    std::string message;
+
+    message = "DISPATCH OVERHEAD:\n";
+    message += fmt::format("    {:<22} {:>8}\n", "Thread switches:", stats.thread_switches);
+    message += fmt::format("    {:<22} {:>8}\n", "Process switches:", stats.process_switches);
+    message += fmt::format("    {:<22} {:>8}\n", "Dispatch time saved:", stats.dispatch_time_saved);
+
+    message += "\nMAX READY WAIT:\n";
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        message += fmt::format("    {:<22} {:>8}\n", std::string(PROCESS_PRIORITY_MAP[i]) + ":", stats.max_wait_times[i]);
+    }
+
+    if (!stats.device_stats.empty()) {
+        message += "\nI/O DEVICES:\n";
+        message += fmt::format("    {:<22} {:>8}\n", "Total I/O wait time:", stats.total_io_wait_time);
+
+        for (const auto& device : stats.device_stats) {
+            std::string name = fmt::format("Device {} [{}]:", device.device_id, IO_DISCIPLINE_MAP[device.discipline]);
+            message += fmt::format("    {:<22}served {:<6}busy {:<6} wait {:<6} util {:.2f}%\n",
+                name, device.requests, device.busy_time, device.wait_time, device.utilization);
+        }
+    }
+
+    // Target shares are only set by proportional-share algorithms
+    bool has_shares = false;
+    for (int i = SYSTEM; i <= BATCH; ++i) {
+        has_shares = has_shares || stats.target_shares[i] > 0.0;
+    }
+
+    if (has_shares) {
+        message += "\nCPU SHARES:\n";
+        for (int i = SYSTEM; i <= BATCH; ++i) {
+            message += fmt::format("    {:<22}target {:>7.2f}%   achieved {:>7.2f}%\n",
+                std::string(PROCESS_PRIORITY_MAP[i]) + ":", stats.target_shares[i], stats.achieved_shares[i]);
+        }
+    }
+
+    if (stats.deadline_threads > 0) {
+        message += "\nDEADLINES:\n";
+        message += fmt::format("    {:<22} {:>8}\n", "Threads with deadline:", stats.deadline_threads);
+        message += fmt::format("    {:<22} {:>8}\n", "Deadlines missed:", stats.deadline_misses);
+        message += fmt::format("    {:<22} {:>7.2f}%\n", "Miss rate:", stats.deadline_miss_rate);
+        message += fmt::format("    {:<22} {} / {:.2f} / {}\n", "Lateness min/avg/max:",
+            stats.min_lateness, stats.avg_lateness, stats.max_lateness);
+        message += fmt::format("    {:<22} {} / {}\n", "Lateness p50/p95:", stats.median_lateness, stats.p95_lateness);
+    }
+
+    std::cout << message << std::endl;
+}
+
+void Logger::print_monte_carlo(const MonteCarloResult& result) const {
+    /*
+    This prints something like this:
+
+        MONTE CARLO SUMMARY:
+            Replicas:                              40 (converged)
+
+            Total elapsed time:               1234.50 ± 12.34
+            ...
+            BATCH avg. response time:          n/a
+    */
+
+    std::string message = "MONTE CARLO SUMMARY:\n";
+    message += fmt::format("    {:<34} {:>10}{}\n\n", "Replicas:", result.replicas, result.converged ? " (converged)" : "");
+
+    for (const auto& metric : result.metrics) {
+        if (metric.samples == 0) {
+            message += fmt::format("    {:<34} {:>10}\n", metric.name, "n/a");
+        } else {
+            message += fmt::format("    {:<34} {:>10.2f} ± {:.2f}\n", metric.name, metric.mean, metric.half_width);
+        }
+    }
+
+    std::cout << message << std::endl;
+}
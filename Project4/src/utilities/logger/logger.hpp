@@ -8,6 +8,9 @@
 #include "types/thread/thread.hpp"
 #include "types/system_stats/system_stats.hpp"
 
+// Defined in monte_carlo/monte_carlo.hpp; the logger only prints it
+struct MonteCarloResult;
+
 /*
     Logger:
         A class that provides logger functionality for the simulation.
@@ -45,6 +48,14 @@ public:
     */
     bool metrics;
 
+    /*
+        extended:
+            Whether to display extended simulation metrics.
+
+            Set with the -x, --extended_metrics flag in the command line.
+    */
+    bool extended = false;
+
     //==================================================
     //  Member functions
     //==================================================
@@ -59,7 +70,8 @@ public:
         Logger(verbose, per_thread, metrics):
             Constructs a new logger object with the input parameters.
     */
-    Logger(bool verbose, bool per_thread, bool metrics) : verbose(verbose), per_thread(per_thread), metrics(metrics) {}
+    Logger(bool verbose, bool per_thread, bool metrics, bool extended = false) :
+        verbose(verbose), per_thread(per_thread), metrics(metrics), extended(extended) {}
 
     /*
         print_state_transition(event, before_state, after_state):
@@ -89,6 +101,19 @@ public:
             contained in a SystemStats object.
     */
     void print_simulation_metrics(SystemStats stats) const;
+
+    /*
+        print_extended_metrics(stats):
+            If extended is set to true, outputs the extended simulation metrics
+            contained in a SystemStats object.
+    */
+    void print_extended_metrics(SystemStats stats) const;
+
+    /*
+        print_monte_carlo(result):
+            Outputs the summary of a replicated Monte Carlo run.
+    */
+    void print_monte_carlo(const MonteCarloResult& result) const;
 };
 
 #endif
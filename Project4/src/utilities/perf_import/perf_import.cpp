@@ -0,0 +1,462 @@
+#include "utilities/perf_import/perf_import.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+//==============================================================================
+// Line parsing
+//==============================================================================
+
+/*
+    trim(text):
+        Returns the text without leading and trailing whitespace.
+*/
+static std::string_view trim(std::string_view text) {
+    size_t begin = text.find_first_not_of(" \t\r\n");
+    if (begin == std::string_view::npos) {
+        return std::string_view();
+    }
+    size_t end = text.find_last_not_of(" \t\r\n");
+    return text.substr(begin, end - begin + 1);
+}
+
+/*
+    parse_int(text, value):
+        Parses the integer at the start of the text. Returns false if there is none.
+*/
+static bool parse_int(std::string_view text, int& value) {
+    text = trim(text);
+    bool negative = !text.empty() && text[0] == '-';
+    size_t i = negative ? 1 : 0;
+    if (i >= text.size() || text[i] < '0' || text[i] > '9') {
+        return false;
+    }
+
+    long result = 0;
+    for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i) {
+        result = result * 10 + (text[i] - '0');
+    }
+    value = static_cast<int>(negative ? -result : result);
+    return true;
+}
+
+/*
+    field(text, key, value):
+        Parses the integer that follows "key" (e.g., "prev_pid=") in the text.
+*/
+static bool field(std::string_view text, std::string_view key, int& value) {
+    size_t pos = text.find(key);
+    return pos != std::string_view::npos && parse_int(text.substr(pos + key.size()), value);
+}
+
+/*
+    parse_task(text, pid, prio):
+        Parses a task in the compact "comm:pid [prio]" format. The command name may
+        contain spaces and colons, so the pid is taken from the last colon before " [".
+*/
+static bool parse_task(std::string_view text, int& pid, int& prio) {
+    size_t bracket = text.find(" [");
+    if (bracket == std::string_view::npos) {
+        return false;
+    }
+    size_t colon = text.rfind(':', bracket);
+    return colon != std::string_view::npos && parse_int(text.substr(colon + 1, bracket - colon - 1), pid) &&
+        parse_int(text.substr(bracket + 2), prio);
+}
+
+/*
+    parse_timestamp(text, time_us):
+        Parses a "seconds.fraction" timestamp into microseconds.
+*/
+static bool parse_timestamp(std::string_view text, int64_t& time_us) {
+    int64_t seconds = 0;
+    int64_t micros = 0;
+    size_t i = 0;
+
+    for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i) {
+        seconds = seconds * 10 + (text[i] - '0');
+    }
+    if (i == 0) {
+        return false;
+    }
+
+    // Only the first six digits of the fraction fit in a microsecond
+    if (i < text.size() && text[i] == '.') {
+        int digits = 0;
+        for (++i; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i) {
+            if (digits < 6) {
+                micros = micros * 10 + (text[i] - '0');
+                digits++;
+            }
+        }
+        for (; digits < 6; ++digits) {
+            micros *= 10;
+        }
+    }
+
+    time_us = seconds * 1000000 + micros;
+    return true;
+}
+
+//==============================================================================
+// PerfSchedImporter
+//==============================================================================
+
+PerfSchedImporter::PerfSchedImporter(const PerfImportOptions& options, std::function<void(const ProcessSpec&)> sink)
+    : options(options), sink(std::move(sink)) {
+    if (options.tick_us <= 0) {
+        throw(std::logic_error("The tick length must be positive."));
+    }
+    if (options.max_bursts == 0) {
+        throw(std::logic_error("Threads must be allowed at least one burst."));
+    }
+}
+
+void PerfSchedImporter::parse_line(std::string_view line) {
+    enum Kind { SWITCH, WAKEUP, EXIT };
+    static const std::pair<std::string_view, Kind> EVENTS[] = {
+        {"sched_switch:", SWITCH},
+        {"sched_wakeup:", WAKEUP},
+        {"sched_wakeup_new:", WAKEUP},
+        {"sched_process_exit:", EXIT},
+    };
+
+    size_t name_pos = std::string_view::npos;
+    Kind kind = SWITCH;
+    std::string_view args;
+    for (const auto& event : EVENTS) {
+        name_pos = line.find(event.first);
+        if (name_pos != std::string_view::npos) {
+            kind = event.second;
+            args = line.substr(name_pos + event.first.size());
+            break;
+        }
+    }
+    if (name_pos == std::string_view::npos) {
+        return;
+    }
+
+    // "comm pid [cpu] seconds.fraction: [sched:]event_name: args"
+    std::string_view before = trim(line.substr(0, name_pos));
+    if (before.size() >= 6 && before.substr(before.size() - 6) == "sched:") {
+        before = trim(before.substr(0, before.size() - 6));
+    }
+    size_t space = before.rfind(' ');
+    int64_t time_us;
+    if (!parse_timestamp(space == std::string_view::npos ? before : before.substr(space + 1), time_us)) {
+        return;
+    }
+    SimTime time = to_ticks(time_us);
+
+    int pid;
+    int prio = 120;
+
+    if (kind == SWITCH) {
+        int next_pid;
+        int next_prio = 120;
+        char state;
+
+        if (args.find("prev_pid=") != std::string_view::npos) {
+            // prev_comm=... prev_pid=1 prev_prio=120 prev_state=S ==> next_comm=... next_pid=2 next_prio=120
+            size_t state_pos = args.find("prev_state=");
+            if (!field(args, "prev_pid=", pid) || !field(args, "next_pid=", next_pid) || state_pos == std::string_view::npos) {
+                return;
+            }
+            field(args, "prev_prio=", prio);
+            field(args, "next_prio=", next_prio);
+            state = args[state_pos + 11];
+        } else {
+            // comm:1 [120] S ==> comm:2 [120]
+            size_t arrow = args.find("==>");
+            if (arrow == std::string_view::npos) {
+                return;
+            }
+            std::string_view prev = trim(args.substr(0, arrow));
+            size_t state_pos = prev.rfind(' ');
+            if (state_pos == std::string_view::npos || !parse_task(prev.substr(0, state_pos), pid, prio) ||
+                !parse_task(trim(args.substr(arrow + 3)), next_pid, next_prio)) {
+                return;
+            }
+            state = prev[state_pos + 1];
+        }
+
+        // pid 0 is the idle task
+        if (pid != 0) {
+            switch_out(pid, prio, state, time);
+        }
+        if (next_pid != 0) {
+            switch_in(next_pid, next_prio, time);
+        }
+    } else {
+        bool parsed = args.find(" pid=") != std::string_view::npos ?
+            field(args, " pid=", pid) : parse_task(trim(args), pid, prio);
+        if (!parsed || pid == 0) {
+            return;
+        }
+        field(args, " prio=", prio);
+
+        if (kind == WAKEUP) {
+            wake_up(pid, prio, time);
+        } else {
+            auto it = threads.find(pid);
+            if (it != threads.end()) {
+                emit(it->second, time);
+                threads.erase(it);
+            }
+        }
+    }
+
+    events_used++;
+}
+
+void PerfSchedImporter::finish() {
+    // Hand the remaining threads over in tid order, so the output does not depend on hashing
+    std::vector<int> tids;
+    tids.reserve(threads.size());
+    for (const auto& entry : threads) {
+        tids.push_back(entry.first);
+    }
+    std::sort(tids.begin(), tids.end());
+
+    for (int tid : tids) {
+        emit(threads[tid], last_time);
+    }
+    threads.clear();
+}
+
+PerfSchedImporter::LiveThread& PerfSchedImporter::get_thread(int tid, SimTime time) {
+    auto result = threads.try_emplace(tid);
+    LiveThread& thread = result.first->second;
+    if (result.second) {
+        thread.arrival_time = time;
+        thread.state = TRACE_READY;
+        thread.state_change_time = time;
+    }
+    return thread;
+}
+
+void PerfSchedImporter::switch_out(int tid, int prio, char state, SimTime time) {
+    bool known = threads.find(tid) != threads.end();
+
+    // A dead task's last switch comes after its exit event
+    if (state == 'X' || state == 'Z') {
+        if (known) {
+            emit(threads[tid], time);
+            threads.erase(tid);
+        }
+        return;
+    }
+
+    LiveThread& thread = get_thread(tid, time);
+    if (!known) {
+        // It was already running when the trace started
+        thread.arrival_time = 0;
+        thread.state = TRACE_RUNNING;
+        thread.state_change_time = 0;
+    }
+
+    if (thread.state == TRACE_RUNNING) {
+        thread.cpu_time += time - thread.state_change_time;
+    }
+    thread.prio = prio;
+    thread.state_change_time = time;
+
+    if (state == 'R') {
+        // Preempted, so the CPU burst goes on
+        thread.state = TRACE_READY;
+        return;
+    }
+
+    thread.cpu_bursts.push_back(std::max<SimTime>(thread.cpu_time, 1));
+    thread.cpu_time = 0;
+    thread.state = TRACE_SLEEPING;
+
+    // Cut long-lived threads, so their bursts do not pile up in memory
+    if (thread.cpu_bursts.size() >= options.max_bursts) {
+        emit(thread, time);
+        thread.arrival_time = -1;
+    }
+}
+
+void PerfSchedImporter::switch_in(int tid, int prio, SimTime time) {
+    LiveThread& thread = get_thread(tid, time);
+
+    // The wakeup may be missing from the trace
+    if (thread.state == TRACE_SLEEPING) {
+        wake_up(tid, prio, time);
+    }
+
+    thread.prio = prio;
+    thread.state = TRACE_RUNNING;
+    thread.state_change_time = time;
+}
+
+void PerfSchedImporter::wake_up(int tid, int prio, SimTime time) {
+    LiveThread& thread = get_thread(tid, time);
+    if (thread.state != TRACE_SLEEPING) {
+        return;
+    }
+
+    if (thread.arrival_time < 0) {
+        // The first wakeup after a cut starts the next part of the thread
+        thread.arrival_time = time;
+    } else {
+        thread.io_bursts.push_back(std::max<SimTime>(time - thread.state_change_time, 1));
+    }
+
+    thread.prio = prio;
+    thread.state = TRACE_READY;
+    thread.state_change_time = time;
+}
+
+void PerfSchedImporter::emit(LiveThread& thread, SimTime time) {
+    if (thread.arrival_time < 0) {
+        return;
+    }
+
+    if (thread.state == TRACE_RUNNING) {
+        thread.cpu_time += time - thread.state_change_time;
+        thread.state_change_time = time;
+    }
+
+    // A thread has to end with a CPU burst
+    if (thread.cpu_bursts.size() == thread.io_bursts.size()) {
+        if (thread.cpu_time > 0) {
+            thread.cpu_bursts.push_back(thread.cpu_time);
+        } else if (!thread.io_bursts.empty()) {
+            thread.io_bursts.pop_back();
+        }
+    }
+    thread.cpu_time = 0;
+
+    // Threads that never ran are left out
+    if (!thread.cpu_bursts.empty()) {
+        ProcessSpec process;
+        process.process_id = next_process_id++;
+        if (thread.prio < 100) {
+            process.priority = SYSTEM;
+        } else if (thread.prio < 120) {
+            process.priority = INTERACTIVE;
+        } else if (thread.prio == 120) {
+            process.priority = NORMAL;
+        } else {
+            process.priority = BATCH;
+        }
+
+        ThreadSpec spec;
+        spec.arrival_time = thread.arrival_time;
+        spec.cpu_bursts = std::move(thread.cpu_bursts);
+        spec.io_bursts.reserve(thread.io_bursts.size());
+        for (SimTime length : thread.io_bursts) {
+            IOBurstSpec burst;
+            burst.length = length;
+            spec.io_bursts.push_back(burst);
+        }
+        process.threads.push_back(std::move(spec));
+
+        sink(process);
+    }
+
+    thread.cpu_bursts.clear();
+    thread.io_bursts.clear();
+}
+
+SimTime PerfSchedImporter::to_ticks(int64_t time_us) {
+    if (first_time_us < 0) {
+        first_time_us = time_us;
+    }
+
+    // Events of different CPUs may be slightly out of order
+    last_time = std::max(last_time, (time_us - first_time_us) / options.tick_us);
+    return std::max<SimTime>((time_us - first_time_us) / options.tick_us, 0);
+}
+
+//==============================================================================
+// Importing and converting
+//==============================================================================
+
+Workload import_perf_sched(std::istream& input, const PerfImportOptions& options) {
+    Workload workload;
+    workload.thread_switch_overhead = options.thread_switch_overhead;
+    workload.process_switch_overhead = options.process_switch_overhead;
+
+    PerfSchedImporter importer(options, [&workload](const ProcessSpec& process) {
+        workload.processes.push_back(process);
+    });
+
+    std::string line;
+    while (std::getline(input, line)) {
+        importer.parse_line(line);
+    }
+    importer.finish();
+
+    return workload;
+}
+
+size_t convert_perf_sched(std::istream& input, std::ostream& output, const PerfImportOptions& options) {
+    // The number of processes goes first, but is only known at the end
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> spill(std::tmpfile(), &std::fclose);
+    if (!spill) {
+        throw(std::runtime_error("Unable to create a temporary file."));
+    }
+
+    size_t num_processes = 0;
+    std::ostringstream buffer;
+    PerfSchedImporter importer(options, [&](const ProcessSpec& process) {
+        buffer.str("");
+        write_process(buffer, process);
+        std::string text = buffer.str();
+        if (std::fwrite(text.data(), 1, text.size(), spill.get()) != text.size()) {
+            throw(std::runtime_error("Unable to write to the temporary file."));
+        }
+        num_processes++;
+    });
+
+    std::string line;
+    while (std::getline(input, line)) {
+        importer.parse_line(line);
+    }
+    importer.finish();
+
+    output << num_processes << ' ' << options.thread_switch_overhead << ' ' << options.process_switch_overhead << "\n\n";
+
+    std::rewind(spill.get());
+    char chunk[1 << 16];
+    size_t count;
+    while ((count = std::fread(chunk, 1, sizeof(chunk), spill.get())) > 0) {
+        output.write(chunk, count);
+    }
+
+    return num_processes;
+}
+
+void write_process(std::ostream& output, const ProcessSpec& process) {
+    output << process.process_id << ' ' << static_cast<int>(process.priority) << ' ' << process.threads.size() << '\n';
+
+    for (const auto& thread : process.threads) {
+        output << thread.arrival_time << ' ' << thread.cpu_bursts.size();
+        if (thread.relative_deadline >= 0) {
+            output << ' ' << thread.relative_deadline;
+        }
+        output << '\n';
+
+        for (size_t n = 0; n < thread.cpu_bursts.size(); ++n) {
+            output << thread.cpu_bursts[n];
+            if (n < thread.io_bursts.size()) {
+                const auto& io = thread.io_bursts[n];
+                output << ' ' << io.length;
+                if (io.device >= 0) {
+                    output << '@' << io.device;
+                    if (io.track != 0) {
+                        output << ':' << io.track;
+                    }
+                }
+            }
+            output << '\n';
+        }
+    }
+    output << '\n';
+}
@@ -0,0 +1,156 @@
+#ifndef PERF_IMPORT_HPP
+#define PERF_IMPORT_HPP
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "types/workload/workload.hpp"
+
+/*
+    PerfImportOptions:
+        Settings for turning a perf sched trace into a workload.
+*/
+
+struct PerfImportOptions {
+    // Length of one simulation tick, in microseconds of trace time
+    int tick_us = 1;
+
+    // A thread with this many CPU bursts is cut into a new thread at its next sleep,
+    // which bounds the memory used per traced thread
+    size_t max_bursts = 1 << 16;
+
+    // Dispatch overheads of the workload. The trace already includes the real ones.
+    int thread_switch_overhead = 0;
+    int process_switch_overhead = 0;
+};
+
+/*
+    PerfSchedImporter:
+        Reconstructs per-thread burst sequences from the text output of `perf sched script`
+        (sched_switch, sched_wakeup, sched_wakeup_new and sched_process_exit events; other
+        lines are skipped). Both the key=value and the compact "comm:pid [prio] state" formats
+        of sched_switch and sched_wakeup are understood.
+
+        Lines are fed one at a time, and only the threads that are alive in the trace are kept
+        in memory. A CPU burst is the time a thread spends running between going to sleep (being
+        switched out in any state other than R), across preemptions. An IO burst is the time it
+        sleeps until it is woken up. The arrival time is when the thread is first seen.
+
+        Every traced thread becomes a process with a single thread, since sched events only
+        name threads. Its priority follows the kernel priority: real-time (below 100) is SYSTEM,
+        negative nice is INTERACTIVE, nice 0 is NORMAL, and positive nice is BATCH. As soon as a
+        thread exits (or reaches max_bursts) it is handed to the sink, and finish() hands over
+        the threads still alive at the end of the trace. Times are relative to the first event.
+*/
+
+class PerfSchedImporter {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    PerfSchedImporter(const PerfImportOptions& options, std::function<void(const ProcessSpec&)> sink);
+
+    /*
+        parse_line(line):
+            Processes one line of the trace.
+    */
+    void parse_line(std::string_view line);
+
+    /*
+        finish():
+            Ends the trace, handing every thread that is still alive to the sink.
+    */
+    void finish();
+
+    // Number of sched events that were used
+    size_t events_used = 0;
+
+private:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    enum TraceState { TRACE_RUNNING, TRACE_READY, TRACE_SLEEPING };
+
+    /*
+        LiveThread:
+            A thread that has not exited yet, and the bursts recorded for it so far.
+    */
+    struct LiveThread {
+        SimTime arrival_time = -1;
+        TraceState state = TRACE_READY;
+        SimTime state_change_time = 0;
+        SimTime cpu_time = 0;
+        int prio = 120;
+        std::vector<SimTime> cpu_bursts;
+        std::vector<SimTime> io_bursts;
+    };
+
+    PerfImportOptions options;
+
+    std::function<void(const ProcessSpec&)> sink;
+
+    std::unordered_map<int, LiveThread> threads;
+
+    // Trace time of the first event, in microseconds, and of the latest event, in ticks
+    int64_t first_time_us = -1;
+    SimTime last_time = 0;
+
+    int next_process_id = 0;
+
+    //==================================================
+    //  Helper functions
+    //==================================================
+
+    LiveThread& get_thread(int tid, SimTime time);
+
+    void switch_out(int tid, int prio, char state, SimTime time);
+
+    void switch_in(int tid, int prio, SimTime time);
+
+    void wake_up(int tid, int prio, SimTime time);
+
+    /*
+        emit(thread, time):
+            Hands the bursts recorded for the thread up to the given time to the sink,
+            and clears them.
+    */
+    void emit(LiveThread& thread, SimTime time);
+
+    /*
+        to_ticks(time_us):
+            Converts an absolute trace time to simulation ticks since the first event.
+    */
+    SimTime to_ticks(int64_t time_us);
+};
+
+/*
+    import_perf_sched(input, options):
+        Reads a whole perf sched trace into a workload that can be simulated directly.
+*/
+Workload import_perf_sched(std::istream& input, const PerfImportOptions& options = PerfImportOptions());
+
+/*
+    convert_perf_sched(input, output, options):
+        Streams a perf sched trace into a simulation file. Threads are written to a temporary
+        file as they exit, and the header is put in front at the end, so memory only depends
+        on the threads alive at any one time. Returns the number of processes written.
+*/
+size_t convert_perf_sched(std::istream& input, std::ostream& output, const PerfImportOptions& options = PerfImportOptions());
+
+/*
+    write_process(output, process):
+        Writes a process in the simulation file format.
+*/
+void write_process(std::ostream& output, const ProcessSpec& process);
+
+#endif
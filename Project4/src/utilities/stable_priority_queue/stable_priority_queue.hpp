@@ -17,11 +17,12 @@
 
 // Priority Queue that mainains FIFO ordering for elements with the same priority
 // Everything is defined in-line since this is templated.
-template <class T>
+// Priority is the key type; lower keys come out first (e.g., SimTime for time-based keys).
+template <class T, class Priority = int>
 class Stable_Priority_Queue {
  private:
-    std::map<int, std::queue<T>> mQueues;
-    std::priority_queue<int, std::vector<int>, std::greater<int>> mPriorityQueue;
+    std::map<Priority, std::queue<T>> mQueues;
+    std::priority_queue<Priority, std::vector<Priority>, std::greater<Priority>> mPriorityQueue;
 
  public:
     Stable_Priority_Queue() {}
@@ -64,7 +65,7 @@ class Stable_Priority_Queue {
     /**
      * Adds an item into the queue. 
      */
-    void push(int priority, const T& item) {
+    void push(Priority priority, const T& item) {
         mPriorityQueue.push(priority);
         auto theQueue = mQueues.find(priority);
         if (theQueue == mQueues.end()) {
@@ -77,7 +78,7 @@ class Stable_Priority_Queue {
     /**
      * Overload for assignment operator for deep-copying
      */
-    Stable_Priority_Queue<T>& operator=(const Stable_Priority_Queue<T> &other) {
+    Stable_Priority_Queue<T, Priority>& operator=(const Stable_Priority_Queue<T, Priority> &other) {
         // Guard self assignment
         if (this == &other)
             return *this;
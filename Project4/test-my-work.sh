@@ -1,33 +1,62 @@
 #!/bin/bash
+
+# Runs ./cpu-sim -MODE for every mode in $3 with algorithm $1 on tests/input/input-$2, and
+# compares the output with tests/output/output-$1-$2.MODE
+run_tests() {
+	alg=$1
+	inputfilename=tests/input/input-$2
+	outputfilename=tests/output/output-$alg-$2
+
+	alg_param="-a ${alg^^}"
+	alg_param=${alg_param/"RR-S6"/"RR -s 6"}
+	alg_param=${alg_param/"-G20"/" -g 20"}
+	#Uncomment the statement below to enable CFS testing
+	#alg_param=${alg_param/"CFS-S6"/"CFS -s 6"}
+
+	for mode_param in $3
+	do
+		SIM_COMMAND="./cpu-sim -$mode_param $alg_param $inputfilename"
+		echo Executing $SIM_COMMAND
+		$SIM_COMMAND &> my_output
+		DIFF=$(diff -b -B my_output $outputfilename.$mode_param)
+		if [ "$DIFF" != "" ]
+		then
+			diff -b -B my_output $outputfilename.$mode_param > my_output.diff
+			echo "   The output does not match $outputfilename.$mode_param Please check my_output and my_output.diff for details."
+			exit
+		else
+			echo -e "\e[32mTest passed!\e[0m"
+		fi
+	done
+}
+
+# The extended metrics (x) are checked for the algorithms that report them
+for alg in priority-p priority-g20 affinity o1 stride lottery edf fair arr
+do
+	for i in 1 2 3 4 5
+	do
+		run_tests $alg $i "v t m x"
+	done
+done
+
+# Shared I/O devices: FIFO, SCAN over two devices and DEADLINE
+for i in 1 2 3
+do
+	run_tests fcfs io-$i "v t m x"
+done
+
+# Threads with deadlines
+for alg in fcfs edf
+do
+	run_tests $alg dl-1 "v t m x"
+done
+
 #Switch these for loops (commented and uncommented) to enable CFS testing
 #for alg in fcfs spn rr rr-s6 priority mlfq cfs cfs-s6
 for alg in fcfs spn rr rr-s6 priority mlfq
 do
 	for i in 1 2 3 4 5
 	do
-		inputfilename=tests/input/input-$i
-		outputfilename=tests/output/output-$alg-$i
-
-		alg_param="-a ${alg^^}"
-		alg_param=${alg_param/"RR-S6"/"RR -s 6"}
-		#Uncomment the statement below to enable CFS testing
-    #alg_param=${alg_param/"CFS-S6"/"CFS -s 6"}
-
-		for mode_param in v t m
-		do
-			SIM_COMMAND="./cpu-sim -$mode_param $alg_param $inputfilename"
-			echo Executing $SIM_COMMAND 
-			$SIM_COMMAND &> my_output
-			DIFF=$(diff -b -B my_output $outputfilename.$mode_param)
-			if [ "$DIFF" != "" ] 
-			then
-				diff -b -B my_output $outputfilename.$mode_param > my_output.diff
-				echo "   The output does not match $outputfilename.$mode_param Please check my_output and my_output.diff for details."
-				exit
-			else
-				echo -e "\e[32mTest passed!\e[0m"
-			fi
-		done
+		run_tests $alg $i "v t m"
 	done
 done
-
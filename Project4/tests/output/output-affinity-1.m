@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       52.33
+    Avg. turnaround time:    817.33
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      180.50
+    Avg. turnaround time:    536.25
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1181
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:           489
+Total idle time:                64
+
+CPU utilization:            94.58%
+CPU efficiency:             53.18%
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 720    END: 770   
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 1050   END: 1092  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 682    END: 739   
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 1081   END: 1181  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 272    END: 332   
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 534    END: 607   
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 258    END: 308   
+
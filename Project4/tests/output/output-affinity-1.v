@@ -0,0 +1,702 @@
+At time 42:
+    THREAD_ARRIVED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 42:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (switched to process 642). Will run to completion of burst.
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 57:
+    THREAD_ARRIVED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 60:
+    THREAD_ARRIVED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 73:
+    THREAD_ARRIVED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 77:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 100:
+    THREAD_ARRIVED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 107:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 107:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 6 threads (stayed on process 642). Will run to completion of burst.
+
+At time 110:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 116:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 116:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads (stayed on process 642). Will run to completion of burst.
+
+At time 119:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 120:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 133:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 133:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 5 threads (stayed on process 642). Will run to completion of burst.
+
+At time 136:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 139:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 154:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 162:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 162:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 6 threads (stayed on process 642). Will run to completion of burst.
+
+At time 165:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 185:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 187:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 187:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 6 threads (switched to process 740). Will run to completion of burst.
+
+At time 207:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 222:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 243:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 243:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 6 threads (stayed on process 740). Will run to completion of burst.
+
+At time 246:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 250:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 250:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads (stayed on process 740). Will run to completion of burst.
+
+At time 253:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 262:
+    IO_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 265:
+    IO_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 281:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 281:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 6 threads (stayed on process 740). Will run to completion of burst.
+
+At time 284:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 300:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 300:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 5 threads (stayed on process 740). Will run to completion of burst.
+
+At time 303:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 305:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 308:
+    THREAD_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 308:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 5 threads (stayed on process 740). Will run to completion of burst.
+
+At time 311:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 315:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 332:
+    THREAD_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 332:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads (stayed on process 740). Will run to completion of burst.
+
+At time 335:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 349:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 349:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (stayed on process 740). Will run to completion of burst.
+
+At time 352:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 373:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 376:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 376:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads (switched to process 642). Will run to completion of burst.
+
+At time 398:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 411:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 425:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 425:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads (stayed on process 642). Will run to completion of burst.
+
+At time 428:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 451:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 458:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 458:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (stayed on process 642). Will run to completion of burst.
+
+At time 461:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 475:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 475:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads (stayed on process 642). Will run to completion of burst.
+
+At time 478:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 483:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 484:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 507:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 507:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (stayed on process 642). Will run to completion of burst.
+
+At time 510:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 520:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 521:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 521:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads (stayed on process 642). Will run to completion of burst.
+
+At time 524:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 540:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 540:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads (stayed on process 642). Will run to completion of burst.
+
+At time 543:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 548:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 562:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 566:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 566:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 4 threads (switched to process 740). Will run to completion of burst.
+
+At time 588:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 607:
+    THREAD_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 607:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (stayed on process 740). Will run to completion of burst.
+
+At time 610:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 639:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 639:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads (switched to process 642). Will run to completion of burst.
+
+At time 647:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 674:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 697:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 697:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads (stayed on process 642). Will run to completion of burst.
+
+At time 700:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 705:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 717:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 717:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads (stayed on process 642). Will run to completion of burst.
+
+At time 720:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 739:
+    THREAD_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 739:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 2 threads (stayed on process 642). Will run to completion of burst.
+
+At time 742:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 742:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 770:
+    THREAD_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 770:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 2 threads (stayed on process 642). Will run to completion of burst.
+
+At time 773:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 802:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 802:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (switched to process 740). Will run to completion of burst.
+
+At time 818:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 837:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 855:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 855:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (switched to process 642). Will run to completion of burst.
+
+At time 862:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 890:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 899:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 899:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (switched to process 740). Will run to completion of burst.
+
+At time 919:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 934:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 943:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 943:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (switched to process 642). Will run to completion of burst.
+
+At time 964:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 999:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 999:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (switched to process 740). Will run to completion of burst.
+
+At time 1002:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1034:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1035:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1035:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (switched to process 642). Will run to completion of burst.
+
+At time 1059:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1070:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1092:
+    THREAD_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 1092:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (switched to process 740). Will run to completion of burst.
+
+At time 1127:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1148:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1170:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1170:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (stayed on process 740). Will run to completion of burst.
+
+At time 1173:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1181:
+    THREAD_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
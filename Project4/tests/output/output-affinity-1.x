@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             23
+    Process switches:            12
+    Dispatch time saved:        736
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                257
+    NORMAL:                     228
+    BATCH:                        0
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  2
+    Avg. response time:      123.50
+    Avg. turnaround time:    489.00
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       47.00
+    Avg. turnaround time:    500.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:            618
+Total service time:            223
+Total I/O time:                191
+Total dispatch time:           362
+Total idle time:                33
+
+CPU utilization:            94.66%
+CPU efficiency:             36.08%
+
@@ -0,0 +1,9 @@
+SIMULATION COMPLETED!
+
+Process 59 [SYSTEM]:
+    Thread  0:    ARR: 33     CPU: 54     I/O: 60     TRT: 389    END: 422   
+    Thread  1:    ARR: 29     CPU: 123    I/O: 97     TRT: 589    END: 618   
+
+Process 189 [NORMAL]:
+    Thread  0:    ARR: 19     CPU: 46     I/O: 34     TRT: 500    END: 519   
+
@@ -0,0 +1,282 @@
+At time 19:
+    THREAD_ARRIVED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 19:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (switched to process 189). Will run to completion of burst.
+
+At time 29:
+    THREAD_ARRIVED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 66:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 91:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 91:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (switched to process 59). Will run to completion of burst.
+
+At time 105:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 161:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 161:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (stayed on process 59). Will run to completion of burst.
+
+At time 169:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 171:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 179:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 179:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (stayed on process 59). Will run to completion of burst.
+
+At time 186:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 189:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 196:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 196:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (stayed on process 59). Will run to completion of burst.
+
+At time 198:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 206:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 212:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 212:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (stayed on process 59). Will run to completion of burst.
+
+At time 222:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 235:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 236:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 236:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (stayed on process 59). Will run to completion of burst.
+
+At time 246:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 262:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 269:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 269:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (switched to process 189). Will run to completion of burst.
+
+At time 299:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 316:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 321:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 321:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (switched to process 59). Will run to completion of burst.
+
+At time 341:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 368:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 395:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 395:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (stayed on process 59). Will run to completion of burst.
+
+At time 405:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 420:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 422:
+    THREAD_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 422:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (stayed on process 59). Will run to completion of burst.
+
+At time 432:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 456:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 456:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (switched to process 189). Will run to completion of burst.
+
+At time 478:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 503:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 519:
+    THREAD_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 519:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (switched to process 59). Will run to completion of burst.
+
+At time 566:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 567:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 581:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 581:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (stayed on process 59). Will run to completion of burst.
+
+At time 591:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 618:
+    THREAD_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      848.00
+    Avg. turnaround time:   3244.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      512.75
+    Avg. turnaround time:   1895.25
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:       98.25
+    Avg. turnaround time:   1944.25
+
+Total elapsed time:           3395
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:          2268
+Total idle time:                 0
+
+CPU utilization:           100.00%
+CPU efficiency:             33.20%
+
@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 3347   END: 3395  
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 1947   END: 1957  
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 3244   END: 3326  
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 357    END: 415   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 3041   END: 3069  
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 1318   END: 1351  
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 3000   END: 3000  
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 1793   END: 1846  
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 1037   END: 1095  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 2139   END: 2209  
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 2243   END: 2290  
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 555    END: 594   
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 2162   END: 2249  
+
@@ -0,0 +1,1382 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (switched to process 404). Will run to completion of burst.
+
+At time 10:
+    THREAD_ARRIVED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from NEW to READY
+
+At time 28:
+    THREAD_ARRIVED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    THREAD_ARRIVED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 53:
+    THREAD_ARRIVED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 67:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 67:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads (stayed on process 404). Will run to completion of burst.
+
+At time 70:
+    THREAD_ARRIVED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 82:
+    THREAD_ARRIVED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 86:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 87:
+    THREAD_ARRIVED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 89:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 97:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 97:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads (stayed on process 404). Will run to completion of burst.
+
+At time 110:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 116:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 128:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 128:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads (stayed on process 404). Will run to completion of burst.
+
+At time 141:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 147:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 175:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 175:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads (stayed on process 404). Will run to completion of burst.
+
+At time 194:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 195:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 216:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 216:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads (switched to process 297). Will run to completion of burst.
+
+At time 229:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 264:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 291:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 291:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads (switched to process 395). Will run to completion of burst.
+
+At time 307:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 339:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 345:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 345:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads (stayed on process 395). Will run to completion of burst.
+
+At time 364:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 368:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 394:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 394:
+    DISPATCHER_INVOKED
+    Thread 0 in process 395 [NORMAL]
+    Selected from 12 threads (stayed on process 395). Will run to completion of burst.
+
+At time 413:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 414:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 415:
+    THREAD_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 415:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads (stayed on process 395). Will run to completion of burst.
+
+At time 434:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 443:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 443:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (stayed on process 395). Will run to completion of burst.
+
+At time 460:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 462:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 488:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 488:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (stayed on process 395). Will run to completion of burst.
+
+At time 496:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 507:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 532:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 532:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 11 threads (switched to process 613). Will run to completion of burst.
+
+At time 548:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 580:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 594:
+    THREAD_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 594:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (stayed on process 613). Will run to completion of burst.
+
+At time 613:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 641:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 641:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (stayed on process 613). Will run to completion of burst.
+
+At time 659:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 660:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 671:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 671:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (stayed on process 613). Will run to completion of burst.
+
+At time 679:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 690:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 720:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 720:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (stayed on process 613). Will run to completion of burst.
+
+At time 723:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 739:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 758:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 758:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (stayed on process 613). Will run to completion of burst.
+
+At time 766:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 777:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 805:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 805:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (switched to process 203). Will run to completion of burst.
+
+At time 826:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 853:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 882:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 882:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (switched to process 341). Will run to completion of burst.
+
+At time 912:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 930:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 951:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 951:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 10 threads (switched to process 404). Will run to completion of burst.
+
+At time 954:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 999:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1003:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1003:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (stayed on process 404). Will run to completion of burst.
+
+At time 1022:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1029:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1042:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1042:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (stayed on process 404). Will run to completion of burst.
+
+At time 1055:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1061:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1066:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1066:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 10 threads (stayed on process 404). Will run to completion of burst.
+
+At time 1085:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1088:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1095:
+    THREAD_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 1095:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (stayed on process 404). Will run to completion of burst.
+
+At time 1114:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1123:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1123:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads (stayed on process 404). Will run to completion of burst.
+
+At time 1131:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1142:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1172:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1172:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads (stayed on process 404). Will run to completion of burst.
+
+At time 1191:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1202:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1213:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1213:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 9 threads (switched to process 297). Will run to completion of burst.
+
+At time 1237:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1261:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1289:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1289:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads (switched to process 395). Will run to completion of burst.
+
+At time 1317:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1337:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1351:
+    THREAD_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1351:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads (stayed on process 395). Will run to completion of burst.
+
+At time 1370:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1371:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1371:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (switched to process 613). Will run to completion of burst.
+
+At time 1395:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1419:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1444:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1444:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (stayed on process 613). Will run to completion of burst.
+
+At time 1463:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1472:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1478:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1478:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads (stayed on process 613). Will run to completion of burst.
+
+At time 1493:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1497:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1498:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1498:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (stayed on process 613). Will run to completion of burst.
+
+At time 1508:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1517:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1525:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1525:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (stayed on process 613). Will run to completion of burst.
+
+At time 1544:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1550:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1550:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 7 threads (stayed on process 613). Will run to completion of burst.
+
+At time 1551:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1559:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1569:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1583:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1583:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (stayed on process 613). Will run to completion of burst.
+
+At time 1602:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1607:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1611:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1611:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (switched to process 203). Will run to completion of burst.
+
+At time 1620:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1659:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1663:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1663:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 8 threads (switched to process 341). Will run to completion of burst.
+
+At time 1692:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1711:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1724:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1724:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 8 threads (switched to process 404). Will run to completion of burst.
+
+At time 1731:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1772:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1786:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1786:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads (stayed on process 404). Will run to completion of burst.
+
+At time 1789:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1805:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1813:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1813:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 8 threads (stayed on process 404). Will run to completion of burst.
+
+At time 1820:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1832:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1846:
+    THREAD_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 1846:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads (stayed on process 404). Will run to completion of burst.
+
+At time 1865:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1893:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1893:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 7 threads (switched to process 297). Will run to completion of burst.
+
+At time 1917:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1941:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1957:
+    THREAD_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 1957:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 7 threads (switched to process 395). Will run to completion of burst.
+
+At time 2005:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2017:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2017:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 6 threads (switched to process 613). Will run to completion of burst.
+
+At time 2046:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2065:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2068:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2068:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 6 threads (stayed on process 613). Will run to completion of burst.
+
+At time 2087:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2092:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2101:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2101:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 6 threads (stayed on process 613). Will run to completion of burst.
+
+At time 2120:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2122:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2139:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2139:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 6 threads (stayed on process 613). Will run to completion of burst.
+
+At time 2141:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2158:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2184:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2184:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 6 threads (stayed on process 613). Will run to completion of burst.
+
+At time 2203:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2209:
+    THREAD_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2209:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads (stayed on process 613). Will run to completion of burst.
+
+At time 2212:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2228:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2249:
+    THREAD_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2249:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads (stayed on process 613). Will run to completion of burst.
+
+At time 2268:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2290:
+    THREAD_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2290:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 4 threads (switched to process 203). Will run to completion of burst.
+
+At time 2338:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2362:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2362:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 3 threads (switched to process 341). Will run to completion of burst.
+
+At time 2363:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2410:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2437:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2437:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (switched to process 404). Will run to completion of burst.
+
+At time 2440:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2485:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2502:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2502:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 3 threads (switched to process 395). Will run to completion of burst.
+
+At time 2512:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2550:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2551:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2551:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 3 threads (switched to process 203). Will run to completion of burst.
+
+At time 2557:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2599:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2613:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2613:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 3 threads (switched to process 341). Will run to completion of burst.
+
+At time 2642:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2661:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2663:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2663:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (switched to process 404). Will run to completion of burst.
+
+At time 2687:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2711:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2741:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2741:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 3 threads (switched to process 395). Will run to completion of burst.
+
+At time 2766:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2789:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2819:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2819:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 3 threads (switched to process 203). Will run to completion of burst.
+
+At time 2823:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2867:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2873:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2873:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 3 threads (switched to process 341). Will run to completion of burst.
+
+At time 2874:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2921:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2951:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2951:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (switched to process 404). Will run to completion of burst.
+
+At time 2957:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2999:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3000:
+    THREAD_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 3000:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 3 threads (switched to process 395). Will run to completion of burst.
+
+At time 3048:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3069:
+    THREAD_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3069:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 2 threads (switched to process 203). Will run to completion of burst.
+
+At time 3117:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3127:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3127:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 1 threads (switched to process 341). Will run to completion of burst.
+
+At time 3133:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3175:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3178:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3178:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 1 threads (switched to process 203). Will run to completion of burst.
+
+At time 3193:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3226:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3253:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3253:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 1 threads (switched to process 341). Will run to completion of burst.
+
+At time 3272:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3301:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3326:
+    THREAD_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 3326:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 1 threads (switched to process 203). Will run to completion of burst.
+
+At time 3374:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3395:
+    THREAD_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             36
+    Process switches:            33
+    Dispatch time saved:       1044
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                848
+    NORMAL:                     841
+    BATCH:                      954
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      758.00
+    Avg. turnaround time:   4168.31
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:      545.30
+    Avg. turnaround time:   4523.30
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           6383
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:          4239
+Total idle time:                10
+
+CPU utilization:            99.84%
+CPU efficiency:             33.43%
+
@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 6324   END: 6383  
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 4234   END: 4313  
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 6264   END: 6314  
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 2524   END: 2546  
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 5245   END: 5295  
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 4865   END: 4924  
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 5741   END: 5812  
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 4973   END: 5012  
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 4478   END: 4501  
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 5318   END: 5410  
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 2752   END: 2823  
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 4687   END: 4712  
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 5361   END: 5456  
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 6080   END: 6124  
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 3540   END: 3607  
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 3450   END: 3497  
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 3932   END: 3977  
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 1836   END: 1895  
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 5108   END: 5184  
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 6230   END: 6240  
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 365    END: 382   
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 3978   END: 4027  
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 2136   END: 2191  
+
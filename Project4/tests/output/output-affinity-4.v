@@ -0,0 +1,2782 @@
+At time 10:
+    THREAD_ARRIVED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 1 threads (switched to process 687). Will run to completion of burst.
+
+At time 17:
+    THREAD_ARRIVED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 22:
+    THREAD_ARRIVED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 23:
+    THREAD_ARRIVED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 25:
+    THREAD_ARRIVED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 44:
+    THREAD_ARRIVED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 45:
+    THREAD_ARRIVED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 49:
+    THREAD_ARRIVED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    THREAD_ARRIVED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 67:
+    THREAD_ARRIVED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 69:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 69:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 16 threads (stayed on process 687). Will run to completion of burst.
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 76:
+    THREAD_ARRIVED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 79:
+    THREAD_ARRIVED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 81:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 92:
+    THREAD_ARRIVED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 93:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 95:
+    THREAD_ARRIVED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 101:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 101:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (stayed on process 687). Will run to completion of burst.
+
+At time 125:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 125:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 134:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 134:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (stayed on process 687). Will run to completion of burst.
+
+At time 158:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 159:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 166:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 166:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (stayed on process 687). Will run to completion of burst.
+
+At time 186:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 190:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 194:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 194:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (switched to process 729). Will run to completion of burst.
+
+At time 209:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 239:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 252:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 252:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (stayed on process 729). Will run to completion of burst.
+
+At time 262:
+    IO_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 276:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 288:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 288:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (stayed on process 729). Will run to completion of burst.
+
+At time 312:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 317:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 334:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 334:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (stayed on process 729). Will run to completion of burst.
+
+At time 358:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 364:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 382:
+    THREAD_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 382:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (stayed on process 729). Will run to completion of burst.
+
+At time 406:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 432:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 432:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (switched to process 104). Will run to completion of burst.
+
+At time 433:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 477:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 489:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 489:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (stayed on process 104). Will run to completion of burst.
+
+At time 492:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 513:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 541:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 541:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (stayed on process 104). Will run to completion of burst.
+
+At time 546:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 565:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 573:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 573:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (stayed on process 104). Will run to completion of burst.
+
+At time 593:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 597:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 601:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 601:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (stayed on process 104). Will run to completion of burst.
+
+At time 622:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 625:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 643:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 643:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads (switched to process 320). Will run to completion of burst.
+
+At time 645:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 688:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 690:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 690:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (stayed on process 320). Will run to completion of burst.
+
+At time 705:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 714:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 734:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 734:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 21 threads (stayed on process 320). Will run to completion of burst.
+
+At time 746:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 758:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 776:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 776:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads (stayed on process 320). Will run to completion of burst.
+
+At time 800:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 802:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 815:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 815:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (stayed on process 320). Will run to completion of burst.
+
+At time 823:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 839:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 856:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 856:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (switched to process 428). Will run to completion of burst.
+
+At time 871:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 901:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 903:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 903:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (stayed on process 428). Will run to completion of burst.
+
+At time 920:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 927:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 950:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 950:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (stayed on process 428). Will run to completion of burst.
+
+At time 953:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 974:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 976:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 976:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (stayed on process 428). Will run to completion of burst.
+
+At time 983:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1000:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1013:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1013:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (stayed on process 428). Will run to completion of burst.
+
+At time 1027:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1037:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1054:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1054:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (switched to process 242). Will run to completion of burst.
+
+At time 1079:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1099:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1103:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1103:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 21 threads (stayed on process 242). Will run to completion of burst.
+
+At time 1122:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1127:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1157:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1157:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (stayed on process 242). Will run to completion of burst.
+
+At time 1172:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1181:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1199:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1199:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (stayed on process 242). Will run to completion of burst.
+
+At time 1204:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1223:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1242:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1242:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 21 threads (stayed on process 242). Will run to completion of burst.
+
+At time 1266:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1266:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1288:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1288:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (switched to process 461). Will run to completion of burst.
+
+At time 1304:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1333:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1356:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1356:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 21 threads (stayed on process 461). Will run to completion of burst.
+
+At time 1363:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1380:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1384:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1384:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (stayed on process 461). Will run to completion of burst.
+
+At time 1408:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1408:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1434:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1434:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (stayed on process 461). Will run to completion of burst.
+
+At time 1458:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1460:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1468:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1468:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 21 threads (stayed on process 461). Will run to completion of burst.
+
+At time 1475:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1492:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1504:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1504:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (stayed on process 461). Will run to completion of burst.
+
+At time 1528:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1534:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1540:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1540:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 21 threads (switched to process 71). Will run to completion of burst.
+
+At time 1569:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1585:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1603:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1603:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads (switched to process 687). Will run to completion of burst.
+
+At time 1610:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1648:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1677:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1677:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads (stayed on process 687). Will run to completion of burst.
+
+At time 1700:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1701:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1723:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1723:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (stayed on process 687). Will run to completion of burst.
+
+At time 1747:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1751:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1771:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1771:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 21 threads (stayed on process 687). Will run to completion of burst.
+
+At time 1795:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1799:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1814:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1814:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads (stayed on process 687). Will run to completion of burst.
+
+At time 1819:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1838:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1845:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1845:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads (stayed on process 687). Will run to completion of burst.
+
+At time 1858:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1869:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1895:
+    THREAD_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1895:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (stayed on process 687). Will run to completion of burst.
+
+At time 1919:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1920:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1920:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 20 threads (stayed on process 687). Will run to completion of burst.
+
+At time 1940:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1944:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1961:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1961:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (switched to process 729). Will run to completion of burst.
+
+At time 1962:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2006:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2010:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2010:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (stayed on process 729). Will run to completion of burst.
+
+At time 2034:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2037:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2046:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2046:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (stayed on process 729). Will run to completion of burst.
+
+At time 2053:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2070:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2096:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2096:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (stayed on process 729). Will run to completion of burst.
+
+At time 2101:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2120:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2143:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2143:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (stayed on process 729). Will run to completion of burst.
+
+At time 2145:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2167:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2191:
+    THREAD_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 2191:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (stayed on process 729). Will run to completion of burst.
+
+At time 2215:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2224:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2224:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads (switched to process 104). Will run to completion of burst.
+
+At time 2230:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2269:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2291:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2291:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads (stayed on process 104). Will run to completion of burst.
+
+At time 2312:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2315:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2321:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2321:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 19 threads (stayed on process 104). Will run to completion of burst.
+
+At time 2332:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2345:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2353:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2353:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads (stayed on process 104). Will run to completion of burst.
+
+At time 2357:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2377:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2398:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2398:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads (stayed on process 104). Will run to completion of burst.
+
+At time 2405:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2422:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2436:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2436:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads (stayed on process 104). Will run to completion of burst.
+
+At time 2449:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2460:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2482:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2482:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 19 threads (stayed on process 104). Will run to completion of burst.
+
+At time 2506:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2509:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2509:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 18 threads (stayed on process 104). Will run to completion of burst.
+
+At time 2512:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2533:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2536:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2546:
+    THREAD_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 2546:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads (switched to process 320). Will run to completion of burst.
+
+At time 2591:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2618:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2618:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 18 threads (stayed on process 320). Will run to completion of burst.
+
+At time 2632:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2642:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2661:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2661:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads (stayed on process 320). Will run to completion of burst.
+
+At time 2666:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2685:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2714:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2714:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 18 threads (stayed on process 320). Will run to completion of burst.
+
+At time 2727:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2738:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2751:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2751:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 18 threads (stayed on process 320). Will run to completion of burst.
+
+At time 2752:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2775:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2786:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2786:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads (stayed on process 320). Will run to completion of burst.
+
+At time 2806:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2810:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2823:
+    THREAD_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2823:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 18 threads (stayed on process 320). Will run to completion of burst.
+
+At time 2847:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2868:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2868:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads (switched to process 428). Will run to completion of burst.
+
+At time 2875:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2913:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2927:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2927:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 17 threads (stayed on process 428). Will run to completion of burst.
+
+At time 2933:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2951:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2957:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2957:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads (stayed on process 428). Will run to completion of burst.
+
+At time 2970:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2981:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3009:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3009:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 17 threads (stayed on process 428). Will run to completion of burst.
+
+At time 3022:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3033:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3041:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3041:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads (stayed on process 428). Will run to completion of burst.
+
+At time 3065:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3071:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3083:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3083:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 17 threads (stayed on process 428). Will run to completion of burst.
+
+At time 3107:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3113:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3119:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3119:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 17 threads (switched to process 242). Will run to completion of burst.
+
+At time 3122:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3164:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3173:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3173:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 17 threads (stayed on process 242). Will run to completion of burst.
+
+At time 3187:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3197:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3213:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3213:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 17 threads (stayed on process 242). Will run to completion of burst.
+
+At time 3223:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3237:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3239:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3239:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 17 threads (stayed on process 242). Will run to completion of burst.
+
+At time 3258:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3263:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3270:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3270:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 17 threads (stayed on process 242). Will run to completion of burst.
+
+At time 3293:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3294:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3303:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3303:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 17 threads (stayed on process 242). Will run to completion of burst.
+
+At time 3313:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3327:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3333:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3333:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 17 threads (stayed on process 242). Will run to completion of burst.
+
+At time 3355:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3357:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3382:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3382:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 17 threads (switched to process 461). Will run to completion of burst.
+
+At time 3411:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3427:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3446:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3446:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 17 threads (stayed on process 461). Will run to completion of burst.
+
+At time 3455:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3470:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3497:
+    THREAD_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 3497:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 17 threads (stayed on process 461). Will run to completion of burst.
+
+At time 3521:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3542:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3542:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (stayed on process 461). Will run to completion of burst.
+
+At time 3566:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3568:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3579:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3579:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 16 threads (stayed on process 461). Will run to completion of burst.
+
+At time 3603:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3603:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3607:
+    THREAD_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 3607:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (stayed on process 461). Will run to completion of burst.
+
+At time 3631:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3637:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3637:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (switched to process 71). Will run to completion of burst.
+
+At time 3665:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3682:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3695:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3695:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads (switched to process 687). Will run to completion of burst.
+
+At time 3722:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3740:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3743:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3743:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 15 threads (stayed on process 687). Will run to completion of burst.
+
+At time 3755:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3767:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3790:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3790:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 15 threads (stayed on process 687). Will run to completion of burst.
+
+At time 3797:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3814:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3828:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3828:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads (stayed on process 687). Will run to completion of burst.
+
+At time 3852:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3853:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3860:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3860:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 15 threads (stayed on process 687). Will run to completion of burst.
+
+At time 3864:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3884:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3891:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3891:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 15 threads (stayed on process 687). Will run to completion of burst.
+
+At time 3915:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3916:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3928:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3928:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads (stayed on process 687). Will run to completion of burst.
+
+At time 3943:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3952:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3977:
+    THREAD_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3977:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 15 threads (switched to process 729). Will run to completion of burst.
+
+At time 4022:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4027:
+    THREAD_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4027:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 14 threads (switched to process 104). Will run to completion of burst.
+
+At time 4072:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4091:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4091:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 13 threads (stayed on process 104). Will run to completion of burst.
+
+At time 4094:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4115:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4132:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4132:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 13 threads (stayed on process 104). Will run to completion of burst.
+
+At time 4143:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4156:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4185:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4185:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 13 threads (stayed on process 104). Will run to completion of burst.
+
+At time 4207:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4209:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4235:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4235:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 13 threads (stayed on process 104). Will run to completion of burst.
+
+At time 4252:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4259:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4276:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4276:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 13 threads (stayed on process 104). Will run to completion of burst.
+
+At time 4300:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4301:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4313:
+    THREAD_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4313:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 13 threads (stayed on process 104). Will run to completion of burst.
+
+At time 4337:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4363:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4363:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 12 threads (switched to process 320). Will run to completion of burst.
+
+At time 4391:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4408:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4427:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4427:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 12 threads (stayed on process 320). Will run to completion of burst.
+
+At time 4435:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4451:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4470:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4470:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 12 threads (stayed on process 320). Will run to completion of burst.
+
+At time 4494:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4497:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4501:
+    THREAD_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 4501:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 12 threads (stayed on process 320). Will run to completion of burst.
+
+At time 4525:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4527:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4527:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 11 threads (switched to process 428). Will run to completion of burst.
+
+At time 4543:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4572:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4602:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4602:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 11 threads (stayed on process 428). Will run to completion of burst.
+
+At time 4612:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4626:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4641:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4641:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 11 threads (stayed on process 428). Will run to completion of burst.
+
+At time 4665:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4666:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4687:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4687:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 11 threads (stayed on process 428). Will run to completion of burst.
+
+At time 4711:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4712:
+    THREAD_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4712:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads (switched to process 242). Will run to completion of burst.
+
+At time 4715:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4757:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4762:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4762:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 10 threads (stayed on process 242). Will run to completion of burst.
+
+At time 4764:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4786:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4796:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4796:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 10 threads (stayed on process 242). Will run to completion of burst.
+
+At time 4808:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4820:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4841:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4841:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads (stayed on process 242). Will run to completion of burst.
+
+At time 4855:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4865:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4881:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4881:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 10 threads (stayed on process 242). Will run to completion of burst.
+
+At time 4904:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4905:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4924:
+    THREAD_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 4924:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 10 threads (stayed on process 242). Will run to completion of burst.
+
+At time 4948:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4970:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4970:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 9 threads (stayed on process 242). Will run to completion of burst.
+
+At time 4983:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4994:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5012:
+    THREAD_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 5012:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 9 threads (switched to process 461). Will run to completion of burst.
+
+At time 5057:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5080:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5080:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 8 threads (switched to process 71). Will run to completion of burst.
+
+At time 5088:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5125:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5128:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5128:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 8 threads (switched to process 687). Will run to completion of burst.
+
+At time 5143:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5173:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5184:
+    THREAD_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 5184:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 8 threads (stayed on process 687). Will run to completion of burst.
+
+At time 5208:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5231:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5231:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 7 threads (switched to process 104). Will run to completion of burst.
+
+At time 5256:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5276:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5295:
+    THREAD_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 5295:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 7 threads (stayed on process 104). Will run to completion of burst.
+
+At time 5319:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5341:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5341:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (switched to process 320). Will run to completion of burst.
+
+At time 5369:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5386:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5410:
+    THREAD_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 5410:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (switched to process 428). Will run to completion of burst.
+
+At time 5455:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5456:
+    THREAD_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 5456:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (switched to process 242). Will run to completion of burst.
+
+At time 5501:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5528:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5528:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 4 threads (switched to process 461). Will run to completion of burst.
+
+At time 5556:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5573:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5590:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5590:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 4 threads (switched to process 71). Will run to completion of burst.
+
+At time 5609:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5635:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5641:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5641:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 4 threads (switched to process 687). Will run to completion of burst.
+
+At time 5654:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5686:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5694:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5694:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 4 threads (switched to process 104). Will run to completion of burst.
+
+At time 5695:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5739:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5764:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5764:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 4 threads (switched to process 242). Will run to completion of burst.
+
+At time 5787:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5809:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5812:
+    THREAD_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 5812:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 4 threads (switched to process 461). Will run to completion of burst.
+
+At time 5857:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5869:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5869:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 3 threads (switched to process 71). Will run to completion of burst.
+
+At time 5886:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5914:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5943:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5943:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 3 threads (switched to process 687). Will run to completion of burst.
+
+At time 5961:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5988:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6003:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6003:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 3 threads (switched to process 104). Will run to completion of burst.
+
+At time 6016:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6048:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6076:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6076:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 3 threads (switched to process 461). Will run to completion of burst.
+
+At time 6080:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6121:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6124:
+    THREAD_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 6124:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 3 threads (switched to process 71). Will run to completion of burst.
+
+At time 6169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6175:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6175:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads (switched to process 687). Will run to completion of burst.
+
+At time 6184:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6220:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6240:
+    THREAD_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6240:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads (switched to process 104). Will run to completion of burst.
+
+At time 6285:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6314:
+    THREAD_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 6314:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 1 threads (switched to process 71). Will run to completion of burst.
+
+At time 6359:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6383:
+    THREAD_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
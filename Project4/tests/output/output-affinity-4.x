@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             96
+    Process switches:            43
+    Dispatch time saved:       2016
+
+MAX READY WAIT:
+    SYSTEM:                    2072
+    INTERACTIVE:                  0
+    NORMAL:                    1960
+    BATCH:                        0
+
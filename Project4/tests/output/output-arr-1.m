@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       94.00
+    Avg. turnaround time:   3019.00
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      131.25
+    Avg. turnaround time:   2040.75
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           3344
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:          2671
+Total idle time:                45
+
+CPU utilization:            98.65%
+CPU efficiency:             18.78%
+
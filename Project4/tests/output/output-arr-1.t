@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 2876   END: 2926  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 3302   END: 3344  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 2879   END: 2936  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 3157   END: 3257  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 1528   END: 1588  
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 2026   END: 2099  
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 1452   END: 1502  
+
@@ -0,0 +1,2172 @@
+At time 42:
+    THREAD_ARRIVED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 42:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (median burst = 24). Will run for at most 24 ticks.
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 57:
+    THREAD_ARRIVED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 60:
+    THREAD_ARRIVED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 73:
+    THREAD_ARRIVED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 77:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 100:
+    THREAD_ARRIVED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 101:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 101:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 136:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 139:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 139:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 174:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 177:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 177:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 180:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 183:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 183:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 218:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 221:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 221:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 224:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 227:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 227:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 230:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 233:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 233:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 268:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 271:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 271:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 306:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 309:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 309:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 344:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 347:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 347:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 6 threads (median burst = 24). Will run for at most 4 ticks.
+
+At time 350:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 354:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 354:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 6 threads (median burst = 24). Will run for at most 4 ticks.
+
+At time 370:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 389:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 390:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 390:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 6 threads (median burst = 6). Will run for at most 4 ticks.
+
+At time 393:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 397:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 397:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 6 threads (median burst = 6). Will run for at most 4 ticks.
+
+At time 400:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 404:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 404:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 6 threads (median burst = 6). Will run for at most 4 ticks.
+
+At time 405:
+    IO_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 439:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 442:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 442:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 6 threads (median burst = 6). Will run for at most 4 ticks.
+
+At time 455:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 477:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 481:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 481:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 516:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 519:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 519:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 522:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 525:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 525:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 560:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 563:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 563:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 566:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 569:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 569:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 572:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 575:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 575:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 610:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 613:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 613:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 648:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 651:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 651:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 686:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 689:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 689:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 692:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 695:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 695:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 730:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 733:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 733:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 736:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 739:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 739:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 742:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 745:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 745:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 780:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 783:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 783:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 818:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 821:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 821:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 856:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 857:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 857:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 6 threads (median burst = 6). Will run for at most 4 ticks.
+
+At time 860:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 864:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 864:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 6 threads (median burst = 6). Will run for at most 4 ticks.
+
+At time 878:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 899:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 903:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 903:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 906:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 909:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 909:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 912:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 916:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 916:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 924:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 951:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 955:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 955:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 990:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 993:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 993:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 1028:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1031:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1031:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 1034:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1037:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1037:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 1072:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1075:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1075:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 1078:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1081:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1081:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 1084:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1087:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1087:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 1122:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1125:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1125:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 1160:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1162:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1162:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 1181:
+    IO_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1197:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1201:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1201:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1204:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1207:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1207:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1242:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1245:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1245:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1248:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1251:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1251:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1254:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1257:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1257:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1295:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1295:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1330:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1333:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1333:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1368:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1371:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1371:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1374:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1377:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1377:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1412:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1415:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1415:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1418:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1421:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1421:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1424:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1427:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1427:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1462:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1465:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1465:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 1500:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1502:
+    THREAD_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1502:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 1537:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1539:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1539:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 1542:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1546:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1546:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 1559:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1581:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1583:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1583:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 1586:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1588:
+    THREAD_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1588:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 16). Will run for at most 6 ticks.
+
+At time 1591:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1597:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1597:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 16). Will run for at most 6 ticks.
+
+At time 1607:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1632:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1638:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1638:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads (median burst = 21). Will run for at most 4 ticks.
+
+At time 1641:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1642:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1642:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 1645:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1651:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1651:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 1668:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1686:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1692:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1692:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 1695:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1699:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1699:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 1734:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1735:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1735:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 16). Will run for at most 6 ticks.
+
+At time 1738:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1744:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1744:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 16). Will run for at most 6 ticks.
+
+At time 1747:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1753:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1753:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 16). Will run for at most 6 ticks.
+
+At time 1758:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1788:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1791:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1791:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 1794:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1800:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1800:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 1813:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1835:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1837:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1837:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 1840:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1845:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1846:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1846:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 5 threads (median burst = 21). Will run for at most 4 ticks.
+
+At time 1849:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1853:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1853:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads (median burst = 21). Will run for at most 4 ticks.
+
+At time 1888:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1892:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1892:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 1895:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1901:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1901:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 1916:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1936:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1942:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1942:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 1945:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1949:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1949:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 1952:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1956:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1956:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 1991:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1995:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1995:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 1998:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2002:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2002:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 2037:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2041:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2041:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 2044:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2048:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2048:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 2051:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2055:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2055:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 2090:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2094:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2094:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads (median burst = 16). Will run for at most 4 ticks.
+
+At time 2097:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2099:
+    THREAD_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2099:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 16). Will run for at most 6 ticks.
+
+At time 2134:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2135:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2135:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 16). Will run for at most 8 ticks.
+
+At time 2138:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2146:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2146:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 16). Will run for at most 8 ticks.
+
+At time 2149:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2157:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2157:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 3 threads (median burst = 16). Will run for at most 8 ticks.
+
+At time 2162:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2192:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2200:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2200:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 16). Will run for at most 6 ticks.
+
+At time 2235:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2236:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2236:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 16). Will run for at most 8 ticks.
+
+At time 2239:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2247:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2247:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 16). Will run for at most 8 ticks.
+
+At time 2249:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2250:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2258:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2258:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 2293:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2299:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2299:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 2334:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2336:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2336:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 21). Will run for at most 8 ticks.
+
+At time 2339:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2347:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2347:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 21). Will run for at most 8 ticks.
+
+At time 2350:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2358:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2358:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 3 threads (median burst = 21). Will run for at most 8 ticks.
+
+At time 2362:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2393:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2394:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2394:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 21). Will run for at most 8 ticks.
+
+At time 2402:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2429:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2437:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2437:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 2440:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2446:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2446:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 2449:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2455:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2455:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 2490:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2496:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2496:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 2531:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2537:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2537:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 21). Will run for at most 6 ticks.
+
+At time 2540:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2541:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2541:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 21). Will run for at most 8 ticks.
+
+At time 2544:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2549:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2552:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2552:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 22). Will run for at most 6 ticks.
+
+At time 2587:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2593:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2593:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 22). Will run for at most 6 ticks.
+
+At time 2628:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2629:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2629:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 22). Will run for at most 8 ticks.
+
+At time 2632:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2640:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2640:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 22). Will run for at most 8 ticks.
+
+At time 2643:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2645:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2645:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 2 threads (median burst = 22). Will run for at most 12 ticks.
+
+At time 2651:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2667:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2680:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2686:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2686:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 23). Will run for at most 8 ticks.
+
+At time 2693:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2721:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2729:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2729:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 23). Will run for at most 6 ticks.
+
+At time 2732:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2738:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2738:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 23). Will run for at most 6 ticks.
+
+At time 2741:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2747:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2747:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 23). Will run for at most 6 ticks.
+
+At time 2782:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2788:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2788:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 23). Will run for at most 6 ticks.
+
+At time 2823:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2829:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2829:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 23). Will run for at most 6 ticks.
+
+At time 2832:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2838:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2838:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads (median burst = 23). Will run for at most 6 ticks.
+
+At time 2841:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2847:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2847:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (median burst = 23). Will run for at most 6 ticks.
+
+At time 2882:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2885:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2885:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 23). Will run for at most 8 ticks.
+
+At time 2906:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2920:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2926:
+    THREAD_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 2926:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads (median burst = 23). Will run for at most 8 ticks.
+
+At time 2929:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2936:
+    THREAD_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 2936:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 2 threads (median burst = 23). Will run for at most 12 ticks.
+
+At time 2939:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2944:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2944:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (median burst = 23). Will run for at most 23 ticks.
+
+At time 2969:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2979:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2980:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2980:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (median burst = 19). Will run for at most 19 ticks.
+
+At time 3004:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3015:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3034:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3034:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 2 threads (median burst = 18). Will run for at most 12 ticks.
+
+At time 3069:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3081:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3081:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 2 threads (median burst = 18). Will run for at most 12 ticks.
+
+At time 3116:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3126:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3126:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (median burst = 18). Will run for at most 18 ticks.
+
+At time 3142:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3161:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3170:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3170:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (median burst = 19). Will run for at most 19 ticks.
+
+At time 3192:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3205:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3214:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3214:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (median burst = 21). Will run for at most 21 ticks.
+
+At time 3234:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3249:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3257:
+    THREAD_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3257:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (median burst = 21). Will run for at most 21 ticks.
+
+At time 3292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3313:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3316:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3316:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (median burst = 21). Will run for at most 21 ticks.
+
+At time 3319:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3340:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3340:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (median burst = 21). Will run for at most 21 ticks.
+
+At time 3343:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3344:
+    THREAD_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             62
+    Process switches:            71
+    Dispatch time saved:       1984
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                168
+    NORMAL:                     169
+    BATCH:                        0
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  2
+    Avg. response time:      115.00
+    Avg. turnaround time:    812.00
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       47.00
+    Avg. turnaround time:    569.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:            937
+Total service time:            223
+Total I/O time:                191
+Total dispatch time:           620
+Total idle time:                94
+
+CPU utilization:            89.97%
+CPU efficiency:             23.80%
+
@@ -0,0 +1,9 @@
+SIMULATION COMPLETED!
+
+Process 59 [SYSTEM]:
+    Thread  0:    ARR: 33     CPU: 54     I/O: 60     TRT: 716    END: 749   
+    Thread  1:    ARR: 29     CPU: 123    I/O: 97     TRT: 908    END: 937   
+
+Process 189 [NORMAL]:
+    Thread  0:    ARR: 19     CPU: 46     I/O: 34     TRT: 569    END: 588   
+
@@ -0,0 +1,447 @@
+At time 19:
+    THREAD_ARRIVED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 19:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (median burst = 24). Will run for at most 24 ticks.
+
+At time 29:
+    THREAD_ARRIVED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 66:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 90:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 90:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (median burst = 24). Will run for at most 8 ticks.
+
+At time 137:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 145:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 145:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (median burst = 24). Will run for at most 8 ticks.
+
+At time 155:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 163:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 163:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (median burst = 24). Will run for at most 12 ticks.
+
+At time 170:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 210:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 211:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 211:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 225:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 258:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 266:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 266:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (median burst = 25). Will run for at most 8 ticks.
+
+At time 276:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 282:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 282:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (median burst = 25). Will run for at most 12 ticks.
+
+At time 305:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 329:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 334:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 334:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 354:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 381:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 388:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 388:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 396:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 398:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 406:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 406:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 453:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 461:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 461:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 508:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 515:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 515:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 517:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 525:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 533:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 533:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 580:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 588:
+    THREAD_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 588:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 635:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 643:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 643:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 653:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 660:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 660:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (median burst = 8). Will run for at most 8 ticks.
+
+At time 670:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 676:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 690:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 690:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 1 threads (median burst = 16). Will run for at most 16 ticks.
+
+At time 700:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 702:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 716:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 716:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (median burst = 14). Will run for at most 12 ticks.
+
+At time 726:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 738:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 738:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (median burst = 14). Will run for at most 12 ticks.
+
+At time 748:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 749:
+    THREAD_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 749:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (median burst = 16). Will run for at most 16 ticks.
+
+At time 759:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 774:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 799:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 799:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (median burst = 16). Will run for at most 16 ticks.
+
+At time 809:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 825:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 825:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (median burst = 16). Will run for at most 16 ticks.
+
+At time 835:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 843:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 865:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 865:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (median burst = 17). Will run for at most 17 ticks.
+
+At time 875:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 876:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 890:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 890:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (median burst = 16). Will run for at most 16 ticks.
+
+At time 900:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 916:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 916:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (median burst = 16). Will run for at most 16 ticks.
+
+At time 926:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 937:
+    THREAD_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             15
+    Process switches:            10
+    Dispatch time saved:        555
+
+MAX READY WAIT:
+    SYSTEM:                     122
+    INTERACTIVE:                  0
+    NORMAL:                     120
+    BATCH:                        0
+
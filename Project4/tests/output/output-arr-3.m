@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      484.00
+    Avg. turnaround time:  16962.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      287.75
+    Avg. turnaround time:  11785.25
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      217.25
+    Avg. turnaround time:  12496.25
+
+Total elapsed time:          17416
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         16264
+Total idle time:                25
+
+CPU utilization:            99.86%
+CPU efficiency:              6.47%
+
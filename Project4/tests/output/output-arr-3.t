@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 17226  END: 17274 
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 12018  END: 12028 
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 16962  END: 17044 
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 358    END: 416   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 16082  END: 16110 
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 11567  END: 11600 
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 17416  END: 17416 
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 15537  END: 15590 
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 5014   END: 5072  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 13027  END: 13097 
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 16895  END: 16942 
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 2379   END: 2418  
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 16748  END: 16835 
+
@@ -0,0 +1,5792 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (median burst = 24). Will run for at most 24 ticks.
+
+At time 10:
+    THREAD_ARRIVED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from NEW to READY
+
+At time 28:
+    THREAD_ARRIVED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    THREAD_ARRIVED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 53:
+    THREAD_ARRIVED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 67:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 67:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 9 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 70:
+    THREAD_ARRIVED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 82:
+    THREAD_ARRIVED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 87:
+    THREAD_ARRIVED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 89:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 115:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 118:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 118:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 13 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 166:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 169:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 169:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 13 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 188:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 191:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 191:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 13 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 239:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 242:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 242:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 13 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 261:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 264:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 264:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 13 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 312:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 315:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 315:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 13 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 363:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 366:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 366:
+    DISPATCHER_INVOKED
+    Thread 0 in process 395 [NORMAL]
+    Selected from 13 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 414:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 416:
+    THREAD_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 416:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 464:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 467:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 467:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 515:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 518:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 518:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 566:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 569:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 569:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 617:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 620:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 620:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 668:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 671:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 671:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 719:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 722:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 722:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 770:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 773:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 773:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 792:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 795:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 795:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 796:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 843:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 846:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 846:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 865:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 868:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 868:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 919:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 919:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 967:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 970:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 970:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 989:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 992:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 992:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1040:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1043:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1043:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1091:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1094:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1094:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1142:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1145:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1145:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1193:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1196:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1196:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1244:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1247:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1247:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1295:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1298:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1298:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1317:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1320:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1320:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1368:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1371:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1371:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1390:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1393:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1393:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1441:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1444:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1444:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1492:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1495:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1495:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1514:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1517:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1517:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1565:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1568:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1568:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1616:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1619:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1619:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1667:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1670:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1670:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1718:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1721:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1721:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1769:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1772:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1772:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1820:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1823:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1823:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1842:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1845:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1845:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1893:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1896:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1896:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1915:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1918:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1918:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 1966:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1969:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1969:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 2017:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2019:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2019:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 6). Will run for at most 3 ticks.
+
+At time 2032:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2038:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2041:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2041:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2054:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2089:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2091:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2091:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2099:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2139:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2142:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2142:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 12 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2190:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2193:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2193:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2241:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2244:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2244:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2295:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2295:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2343:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2346:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2346:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2365:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2368:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2368:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2385:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2416:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2418:
+    THREAD_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2418:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2437:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2440:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2440:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2488:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2491:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2491:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2539:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2542:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2542:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2561:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2564:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2564:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2612:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2615:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2615:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2663:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2666:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2666:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2714:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2717:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2717:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2765:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2768:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2768:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2816:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2819:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2819:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2867:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2870:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2870:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2889:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2892:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2892:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2940:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2943:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2943:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 2991:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2994:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2994:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3042:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3045:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3045:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3064:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3065:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3065:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3091:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3113:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3116:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3116:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3164:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3167:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3167:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3215:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3218:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3218:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3266:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3269:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3269:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3317:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3320:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3320:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3368:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3371:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3371:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3390:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3393:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3393:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3441:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3444:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3444:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3492:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3495:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3495:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3543:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3546:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3546:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3565:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3568:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3568:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3616:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3619:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3619:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3667:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3670:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3670:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3673:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3718:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3721:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3721:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3769:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3772:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3772:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3820:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3823:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3823:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3871:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3874:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3874:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3893:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3896:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3896:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3944:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3947:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3947:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 3995:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3998:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3998:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4046:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4049:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4049:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4068:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4071:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4071:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4119:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4122:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4122:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4170:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4173:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4173:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4221:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4224:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4224:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4272:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4275:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4275:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4323:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4326:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4326:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4342:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 4374:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4377:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4377:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4396:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4399:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4399:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4447:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4450:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4450:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4498:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4501:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4501:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4549:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4552:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4552:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4571:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4574:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4574:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4622:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4625:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4625:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4673:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4676:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4676:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4724:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4727:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4727:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4775:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4778:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4778:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4826:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4829:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4829:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4877:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4880:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4880:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 11). Will run for at most 3 ticks.
+
+At time 4899:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4900:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4902:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4902:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 4950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4951:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4951:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 4969:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4999:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5001:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5001:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 5031:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5049:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5052:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5052:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5071:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5072:
+    THREAD_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 5072:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 5120:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5123:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5123:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 5171:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5174:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5174:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 5222:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5225:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5225:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 5228:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5273:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5274:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5274:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 9 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5294:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 5322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5325:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5325:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5373:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5376:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5376:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5395:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5398:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5398:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5446:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5449:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5449:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5497:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5500:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5500:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5548:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5551:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5551:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5599:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5602:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5602:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5653:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5653:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5701:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5704:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5704:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5752:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5755:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5755:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5803:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5806:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5806:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5854:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5857:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5857:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5876:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5879:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5879:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5927:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5930:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5930:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 5978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5979:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5979:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 6008:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6027:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6028:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6028:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 6041:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 6076:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6079:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6079:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6127:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6128:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6128:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6135:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 6176:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6179:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6179:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6227:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6230:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6230:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6278:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6281:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6281:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6329:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6332:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6332:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6351:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6354:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6354:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6402:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6405:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6405:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6453:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6456:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6456:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6504:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6507:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6507:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6555:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6558:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6558:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6606:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6609:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6609:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6657:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6660:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6660:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6708:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6711:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6711:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6759:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6762:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6762:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6810:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6813:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6813:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6832:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6833:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6833:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 21). Will run for at most 3 ticks.
+
+At time 6849:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6881:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6884:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6884:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 6932:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6935:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6935:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 6983:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6985:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6985:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 7007:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 7033:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7034:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7034:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 7055:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7082:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7085:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 7085:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7133:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7136:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7136:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7184:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7187:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7187:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7235:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7238:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7238:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7286:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7289:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7289:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7308:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7309:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7309:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7333:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7357:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7360:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7360:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7408:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7411:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7411:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7459:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7462:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7462:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7510:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7511:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7511:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7521:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7559:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7562:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 7562:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7610:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7613:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7613:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7661:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7664:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7664:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7712:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7715:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7715:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7763:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7766:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7766:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7785:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7788:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7788:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7836:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7839:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7839:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7887:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7890:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7890:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7938:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7941:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7941:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 7989:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7992:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7992:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8040:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8043:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8043:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8091:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8094:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8094:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8142:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8145:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8145:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8193:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8196:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8196:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8244:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8247:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8247:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8266:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8269:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8269:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8317:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8318:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8318:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8326:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 8366:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8369:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8369:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8417:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8420:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8420:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8468:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8471:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8471:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8519:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8522:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8522:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8570:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8573:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8573:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8621:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8623:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8623:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 9 threads (median burst = 25). Will run for at most 3 ticks.
+
+At time 8636:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 8671:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8674:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8674:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 8722:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8725:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8725:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 8744:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8747:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8747:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 8795:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8798:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8798:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 8846:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8849:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8849:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 8897:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8900:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8900:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 8948:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8951:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8951:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 8999:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9002:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 9002:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9050:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9053:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9053:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9101:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9104:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9104:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9152:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9153:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9153:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9181:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 9201:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9203:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9203:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9211:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9222:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9225:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9225:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9254:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9273:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9276:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9276:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9324:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9327:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9327:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9375:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9378:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9378:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9426:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9429:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9429:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9477:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9480:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 9480:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9528:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9529:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9529:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9557:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9577:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9580:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9580:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9628:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9631:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9631:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9679:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9682:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9682:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9701:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9702:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9702:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 9708:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9750:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9753:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9753:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9801:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9804:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9804:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9805:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9852:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9855:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9855:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9903:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9905:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9905:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 9929:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9953:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9956:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 9956:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 10004:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10007:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10007:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 10055:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10058:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10058:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 9 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 10066:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 10106:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10109:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10109:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10157:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10160:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10160:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10179:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10182:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10182:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10230:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10233:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10233:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10281:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10284:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10284:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10332:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10335:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10335:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10383:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10386:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10386:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10434:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 10437:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10437:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10440:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 10485:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10488:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10488:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 10536:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10539:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10539:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 10587:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10590:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10590:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 10638:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10641:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10641:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 10660:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10663:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10663:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 10711:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10714:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10714:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 10729:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10762:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10765:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10765:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10813:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10816:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10816:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10864:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10867:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10867:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10915:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 10917:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10917:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10941:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 10965:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10967:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10967:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10993:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11015:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11018:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11018:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11066:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11069:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11069:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11117:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11120:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11120:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11139:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11142:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11142:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11190:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11193:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11193:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11241:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11244:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11244:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11295:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11295:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11343:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11346:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11346:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11394:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 11397:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 11397:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11445:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11448:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11448:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11496:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11499:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11499:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11547:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11550:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11550:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11598:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11600:
+    THREAD_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 11600:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11619:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11622:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11622:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11670:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11673:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11673:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11682:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11721:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11724:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11724:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11772:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11775:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11775:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11805:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 11823:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11826:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11826:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11874:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 11877:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 11877:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11925:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11928:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11928:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 11976:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11979:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11979:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 9 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 12027:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12028:
+    THREAD_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 12028:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 12076:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12079:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12079:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 12127:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12130:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12130:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 12154:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 12178:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12180:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12180:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12209:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 12228:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12231:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12231:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12279:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12281:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12281:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12302:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 12329:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 12332:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 12332:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12380:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12383:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12383:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12392:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 12431:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12434:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12434:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12482:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12485:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12485:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12533:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12536:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12536:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12584:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12587:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12587:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12635:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12638:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12638:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12686:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12689:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12689:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12737:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 12740:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 12740:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12788:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12791:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12791:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12839:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12842:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12842:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12890:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12893:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12893:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12941:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12944:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12944:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12992:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12995:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12995:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 12996:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13043:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13046:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13046:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13094:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13097:
+    THREAD_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 13097:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13145:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 13148:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 13148:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13196:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13199:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13199:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13247:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13250:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13250:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13298:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13301:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13301:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13349:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13352:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13352:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13400:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13403:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13403:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13451:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13454:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13454:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13502:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 13505:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 13505:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13553:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13556:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13556:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13604:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13605:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13605:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 13629:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 13653:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13657:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13657:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13705:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13708:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13708:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13756:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13759:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13759:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13807:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13809:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13809:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 13812:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 13857:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 13861:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 13861:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13909:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13912:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13912:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 13960:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13963:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13963:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14011:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14013:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14013:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 14017:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14061:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14065:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14065:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14113:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14116:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14116:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14164:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14167:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14167:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14215:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 14218:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 14218:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14266:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14269:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14269:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14317:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14320:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14320:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14368:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14371:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14371:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14419:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14422:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14422:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14470:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14471:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14471:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 14477:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14519:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14523:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14523:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14571:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 14574:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 14574:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14622:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14625:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14625:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14673:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14675:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14675:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 14682:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 14723:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14727:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14727:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14775:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14778:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14778:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14826:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14829:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14829:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14877:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14880:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14880:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 14928:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 14930:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14930:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 14936:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 14978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14979:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14979:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 14981:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 15027:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15031:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15031:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 15079:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15082:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15082:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 15130:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15133:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15133:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 15181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15184:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15184:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 15232:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15235:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15235:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 15283:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 15286:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15286:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 15301:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 15334:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15338:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15338:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 15386:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15389:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15389:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 15437:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15440:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15440:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 15488:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15489:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15489:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 15517:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 15537:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15541:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15541:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 7 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 15589:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15590:
+    THREAD_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 15590:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 15638:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 15642:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 15642:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 15690:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15694:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15694:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 15742:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15746:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15746:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 15794:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15798:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15798:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 15846:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15850:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15850:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 15898:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15902:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15902:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 15950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 15954:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 15954:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16002:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16006:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16006:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16054:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16058:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16058:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16106:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16110:
+    THREAD_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 16110:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16158:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16162:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16162:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16210:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16214:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16214:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16262:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 16266:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 16266:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16314:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16318:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16318:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16366:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16370:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16370:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16418:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16422:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16422:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16470:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16474:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16474:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16522:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 16526:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 16526:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16574:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16578:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16578:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16626:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16630:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16630:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16682:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16682:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16730:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16734:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16734:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16782:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 16786:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 16786:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads (median burst = 14). Will run for at most 4 ticks.
+
+At time 16834:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16835:
+    THREAD_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 16835:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads (median burst = 14). Will run for at most 6 ticks.
+
+At time 16883:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16888:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16888:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads (median burst = 14). Will run for at most 8 ticks.
+
+At time 16912:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 16936:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16942:
+    THREAD_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 16942:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 3 threads (median burst = 21). Will run for at most 8 ticks.
+
+At time 16990:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16991:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16991:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 2 threads (median burst = 21). Will run for at most 12 ticks.
+
+At time 17010:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 17039:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 17044:
+    THREAD_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 17044:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads (median burst = 22). Will run for at most 12 ticks.
+
+At time 17092:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17104:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17104:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 2 threads (median burst = 22). Will run for at most 12 ticks.
+
+At time 17152:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17164:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17164:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads (median burst = 22). Will run for at most 12 ticks.
+
+At time 17212:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17217:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17217:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 1 threads (median burst = 22). Will run for at most 22 ticks.
+
+At time 17227:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 17265:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17274:
+    THREAD_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 17274:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (median burst = 21). Will run for at most 21 ticks.
+
+At time 17322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17343:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17343:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (median burst = 21). Will run for at most 21 ticks.
+
+At time 17362:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17371:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17396:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 17396:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (median burst = 21). Will run for at most 21 ticks.
+
+At time 17415:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17416:
+    THREAD_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
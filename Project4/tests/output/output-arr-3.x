@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             40
+    Process switches:           323
+    Dispatch time saved:       1160
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                522
+    NORMAL:                     601
+    BATCH:                      601
+
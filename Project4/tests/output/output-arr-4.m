@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      509.85
+    Avg. turnaround time:  25167.23
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:      562.60
+    Avg. turnaround time:  27998.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:          32820
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:         30621
+Total idle time:                65
+
+CPU utilization:            99.80%
+CPU efficiency:              6.50%
+
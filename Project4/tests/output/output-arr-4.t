@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 29526  END: 29585 
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 21789  END: 21868 
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 32770  END: 32820 
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 22036  END: 22058 
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 28768  END: 28818 
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 28805  END: 28864 
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 32100  END: 32171 
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 28658  END: 28697 
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 25834  END: 25857 
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 31392  END: 31484 
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 26872  END: 26943 
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 22947  END: 22972 
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 32397  END: 32492 
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 32028  END: 32072 
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 22544  END: 22611 
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 15418  END: 15465 
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 27230  END: 27275 
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 20542  END: 20601 
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 26335  END: 26411 
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 32212  END: 32222 
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 13054  END: 13071 
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 27780  END: 27829 
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 26117  END: 26172 
+
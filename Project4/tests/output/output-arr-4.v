@@ -0,0 +1,11212 @@
+At time 10:
+    THREAD_ARRIVED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 1 threads (median burst = 24). Will run for at most 24 ticks.
+
+At time 17:
+    THREAD_ARRIVED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 22:
+    THREAD_ARRIVED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 23:
+    THREAD_ARRIVED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 25:
+    THREAD_ARRIVED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 44:
+    THREAD_ARRIVED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 45:
+    THREAD_ARRIVED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 49:
+    THREAD_ARRIVED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    THREAD_ARRIVED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 67:
+    THREAD_ARRIVED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 69:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 69:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 16 threads (median burst = 24). Will run for at most 3 ticks.
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 76:
+    THREAD_ARRIVED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 79:
+    THREAD_ARRIVED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 81:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 92:
+    THREAD_ARRIVED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 95:
+    THREAD_ARRIVED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 114:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 117:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 117:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 162:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 165:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 165:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 210:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 212:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 212:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 227:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 257:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 259:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 259:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 276:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 304:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 307:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 307:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 352:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 355:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 355:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 400:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 403:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 403:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 448:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 451:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 451:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 496:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 499:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 499:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 544:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 547:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 547:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 571:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 574:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 574:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 619:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 622:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 622:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 667:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 670:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 670:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 715:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 718:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 718:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 763:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 766:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 766:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 811:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 814:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 814:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 859:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 862:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 862:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 907:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 910:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 910:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 955:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 958:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 958:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1003:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1006:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1006:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1051:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1054:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1054:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1099:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1102:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1102:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1147:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1150:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1150:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1195:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1198:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1198:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1243:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1246:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1246:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1291:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1294:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1294:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1339:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1341:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1341:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1348:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1386:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1387:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1387:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1406:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1432:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1435:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1435:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1480:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1483:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1483:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1528:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1529:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1529:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (median burst = 2). Will run for at most 3 ticks.
+
+At time 1553:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1574:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1577:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1577:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 1622:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1625:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1625:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 1649:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1652:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1652:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 1697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1700:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1700:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 1745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1748:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1748:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 1793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1796:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1796:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 1841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1844:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1844:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 1889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1892:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1892:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 1937:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1940:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1940:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 1985:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1988:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1988:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2033:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2036:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2036:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2081:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2082:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2082:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2103:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2127:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2128:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2128:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2143:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2173:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2176:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2176:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2221:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2224:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2224:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2269:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2272:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2272:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2317:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2320:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2320:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2365:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2368:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2368:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2413:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2416:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2416:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2461:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2464:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2464:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2509:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2512:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2512:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2557:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2559:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2559:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2583:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2604:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2607:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2607:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2652:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2655:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2655:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2700:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2703:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2703:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2727:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2729:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2729:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2749:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2774:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2777:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2777:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2825:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2825:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2850:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2870:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2873:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2873:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2918:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2921:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2921:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 2966:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2969:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2969:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3014:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3017:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3017:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3062:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3065:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3065:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3110:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3112:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3112:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3132:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3157:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3160:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3160:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3205:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3208:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3208:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3253:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3256:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3256:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3301:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3304:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3304:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3349:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3352:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3352:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3397:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3400:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3400:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3403:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3445:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3448:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3448:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3493:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3496:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3496:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3541:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3544:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3544:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3589:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3592:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3592:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3637:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3640:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3640:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3685:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3688:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3688:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3733:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3736:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3736:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 4). Will run for at most 3 ticks.
+
+At time 3765:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3781:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3784:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3784:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 3808:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3811:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3811:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 3856:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3859:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3859:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 3904:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3907:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3907:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 3952:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3955:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3955:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4000:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4003:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4003:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4048:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4051:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4051:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4096:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4099:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4099:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4144:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4147:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4147:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4192:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4195:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4195:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4240:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4243:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4243:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4288:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4291:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4291:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4336:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4339:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4339:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4384:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4387:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4387:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4432:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4433:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4433:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4443:
+    IO_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4478:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4481:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4481:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4526:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4529:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4529:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4574:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4577:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4577:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4622:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4625:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4625:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4670:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4673:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4673:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4718:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4721:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4721:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4766:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4769:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4769:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4814:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4817:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4817:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4862:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4865:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4865:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4889:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4892:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4892:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4903:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4937:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4940:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4940:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 4985:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4988:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4988:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5033:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5036:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5036:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5081:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5084:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5084:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5129:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5132:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5132:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5177:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5180:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5180:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5225:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5228:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5228:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5273:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5276:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5276:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5321:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5323:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5323:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5327:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5368:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5371:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5371:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5416:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5419:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5419:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5464:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5467:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5467:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5512:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5515:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5515:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5560:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5563:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5563:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5608:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5611:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5611:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5619:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5656:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5659:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5659:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5704:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5707:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5707:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5752:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5755:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5755:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5800:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5803:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5803:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5848:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5851:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5851:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5881:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5896:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5899:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5899:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5944:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5947:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5947:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 5971:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5974:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5974:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 6019:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6022:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6022:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 6067:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6070:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6070:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 6115:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6118:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6118:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 6163:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6166:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6166:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 6173:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6211:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6214:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6214:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 6259:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6262:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6262:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 6307:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6310:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6310:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 8). Will run for at most 3 ticks.
+
+At time 6315:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6355:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6358:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6358:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 9). Will run for at most 3 ticks.
+
+At time 6403:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6406:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6406:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 9). Will run for at most 3 ticks.
+
+At time 6433:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6451:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6454:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6454:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 9). Will run for at most 3 ticks.
+
+At time 6499:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6502:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6502:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (median burst = 9). Will run for at most 3 ticks.
+
+At time 6528:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6547:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6550:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6550:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 6595:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6598:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6598:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 6643:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6646:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6646:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 6691:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6694:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6694:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 6739:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6742:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6742:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 6787:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6790:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6790:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 6835:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6838:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6838:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 6883:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6886:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6886:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 6931:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6934:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6934:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 6979:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6982:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6982:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7027:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7030:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7030:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7054:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7057:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7057:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7102:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7105:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7105:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7150:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7153:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7153:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7198:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7201:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7201:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7246:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7249:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7249:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7294:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7297:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7297:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7344:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7344:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7356:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7389:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7392:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7392:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7437:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7440:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7440:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7485:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7488:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7488:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7533:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7536:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7536:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7581:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7584:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7584:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7629:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7632:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7632:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7677:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7680:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7680:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7725:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7728:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7728:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7773:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7776:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7776:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7821:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7823:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7823:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7848:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7868:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7871:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7871:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7918:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7918:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 12). Will run for at most 3 ticks.
+
+At time 7925:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7963:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7966:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7966:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 8011:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8014:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8014:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 8059:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8062:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8062:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 8107:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8110:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8110:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 8134:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8137:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8137:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 8182:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8183:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8183:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 8213:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 8228:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8231:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8231:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8276:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8279:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8279:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8324:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8327:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8327:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8372:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8375:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8375:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8420:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8423:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8423:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8468:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8471:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8471:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8516:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8519:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8519:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8564:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8567:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8567:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8612:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8615:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8615:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8660:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8663:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8663:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8708:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8710:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8710:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 8713:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 8755:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8758:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8758:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 8803:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8806:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8806:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 8851:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8854:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8854:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 8899:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8902:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8902:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 8947:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8948:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8948:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 8972:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 8993:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8996:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8996:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9041:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9044:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9044:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9089:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9092:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9092:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9137:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9140:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9140:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9185:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9188:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9188:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9212:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9215:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9215:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9260:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9263:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9263:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9308:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9311:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9311:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9356:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9359:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9359:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9404:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9407:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9407:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9452:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9454:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9454:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9480:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9499:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9502:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9502:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9547:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9550:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9550:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9564:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9595:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9598:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9598:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9643:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9646:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9646:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9691:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9692:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9692:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9697:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9737:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9740:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9740:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9785:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9788:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9788:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9833:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9836:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9836:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9881:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9884:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9884:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9886:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9929:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9932:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9932:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9977:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9980:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9980:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 9993:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10025:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10028:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10028:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 10073:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10076:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10076:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 10121:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10124:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10124:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 10169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10172:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10172:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 10217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10220:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10220:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 10265:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10266:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10266:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 10271:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10290:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10293:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10293:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10338:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10339:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10339:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10366:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10384:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10387:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10387:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10432:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10435:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10435:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10450:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10480:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10483:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10483:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10528:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10531:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10531:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10576:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10579:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10579:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10624:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10627:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10627:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10672:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10675:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10675:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10720:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10723:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10723:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10768:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10771:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10771:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10816:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10819:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10819:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10864:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10867:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10867:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10912:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10915:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10915:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 10960:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10963:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10963:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11008:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11011:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11011:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11056:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11059:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11059:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11104:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11107:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11107:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11152:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11155:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11155:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11200:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11203:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11203:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11248:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11251:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11251:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11296:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11299:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11299:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11344:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11347:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11347:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11371:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11374:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11374:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11419:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11422:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11422:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11467:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11468:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11468:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 11496:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11513:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11516:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11516:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 11561:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11562:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11562:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 11589:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 11607:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11610:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11610:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 11655:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11658:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11658:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 11703:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11706:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11706:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 11751:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11754:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11754:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 20). Will run for at most 3 ticks.
+
+At time 11782:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11799:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11802:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11802:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 11847:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11850:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11850:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 11895:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11898:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11898:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 11943:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11946:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11946:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 11991:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11994:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11994:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12039:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12042:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12042:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12087:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12090:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12090:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12135:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12138:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12138:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12183:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12186:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12186:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12231:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12232:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12232:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12239:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 12277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12280:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12280:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12325:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12328:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12328:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12373:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12376:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12376:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12421:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12424:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12424:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12448:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12451:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12451:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12496:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12499:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12499:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12544:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12547:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12547:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12592:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12595:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12595:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12640:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12643:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12643:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 12658:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 12688:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12691:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12691:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 12736:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12739:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12739:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 12784:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12785:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12785:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 12808:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 12830:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12831:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12831:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 12851:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 12876:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12879:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12879:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 12924:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12927:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12927:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 12972:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12975:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12975:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13020:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13023:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13023:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13068:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13071:
+    THREAD_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 13071:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13116:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13119:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13119:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13164:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13165:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13165:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13170:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13210:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13212:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13212:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13242:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13257:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13260:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13260:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13305:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13308:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13308:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13353:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13355:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13355:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13378:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13400:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13403:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13403:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13448:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13450:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13450:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 13451:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13495:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13498:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13498:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 13522:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13523:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13523:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 13553:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13568:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13571:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13571:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 13616:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13619:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13619:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 13664:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13667:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13667:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 13712:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13715:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13715:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 13760:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13763:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13763:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 22). Will run for at most 3 ticks.
+
+At time 13792:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13808:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13810:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13810:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 13825:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13855:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13858:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13858:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 13903:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13906:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13906:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 13951:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13954:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13954:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 13999:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14002:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14002:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 14047:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14050:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14050:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 14095:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14096:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14096:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 14110:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 14141:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14144:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14144:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14189:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14192:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14192:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14237:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14240:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14240:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14285:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14288:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14288:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14333:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14336:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14336:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14381:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14384:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14384:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14429:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14432:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14432:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14477:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14480:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14480:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14525:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14528:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14528:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14552:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14555:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14555:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14600:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14603:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14603:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14648:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14651:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14651:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14696:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14699:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14699:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14744:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14747:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14747:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 14760:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 14792:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14795:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14795:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 14840:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14843:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14843:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 14888:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14891:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14891:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 14936:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14939:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14939:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 14984:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14987:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14987:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 15032:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15035:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15035:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 15080:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15083:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15083:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 15128:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15131:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15131:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 15176:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15179:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15179:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 15224:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15227:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15227:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 15272:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15275:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15275:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 15320:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15321:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15321:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 15331:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 15366:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15369:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15369:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15414:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15417:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15417:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15462:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15465:
+    THREAD_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 15465:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15510:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15513:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15513:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15558:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15561:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15561:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15585:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15588:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15588:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15633:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15636:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15636:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15681:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15684:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15684:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15729:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15732:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15732:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15777:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15780:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15780:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15825:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15828:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15828:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15873:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15876:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15876:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15921:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15924:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15924:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 15969:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15972:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15972:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 16017:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16020:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16020:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 16065:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16067:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16067:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 20 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 16068:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16112:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16115:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16115:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16129:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16160:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16163:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16163:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16208:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16211:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16211:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16259:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16259:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16304:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16307:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16307:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16352:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16355:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16355:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16400:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16403:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16403:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16448:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16449:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16449:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16462:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16494:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16497:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16497:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16542:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16545:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16545:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16569:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16572:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16572:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16617:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16620:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16620:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16665:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16668:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16668:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16713:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16716:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16716:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16761:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16764:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16764:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16809:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16812:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16812:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16857:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16860:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16860:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16905:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16908:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16908:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 16953:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16956:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16956:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 17001:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17003:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17003:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 17025:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 17048:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17051:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17051:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 17096:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17099:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17099:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 17144:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17147:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17147:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 17192:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17195:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17195:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 20 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 17202:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 17240:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17242:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17242:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 20 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 17262:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 17287:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17290:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17290:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 17293:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 17335:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17338:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17338:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 17383:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17386:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17386:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 17431:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17434:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17434:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 17446:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 17479:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17482:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17482:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 17489:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 17527:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17530:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17530:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17554:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17557:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17557:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17602:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17605:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17605:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17653:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17653:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17698:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17701:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17701:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17746:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17749:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17749:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17794:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17797:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17797:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17842:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17845:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17845:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17890:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17893:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17893:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17938:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17941:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17941:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 17986:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17989:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17989:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18034:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18037:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18037:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18082:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18085:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18085:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18130:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18133:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18133:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18178:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18181:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18181:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18226:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18229:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18229:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18274:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18277:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18277:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18325:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18325:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18335:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18370:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18373:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18373:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 18418:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18421:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18421:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 18466:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18469:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18469:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 18514:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18515:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18515:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 20 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 18536:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 18539:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18542:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18542:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18587:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18590:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18590:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18635:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18638:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18638:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18683:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18684:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18684:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 20 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18700:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18729:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18732:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18732:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18777:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18780:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18780:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18825:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18828:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18828:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18873:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18876:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18876:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18921:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18924:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18924:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 18969:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18972:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18972:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 19017:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19020:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19020:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 19065:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19068:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19068:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 19113:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19115:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19115:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 20 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 19121:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 19160:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19163:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19163:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 19208:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19211:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19211:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 19256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19259:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19259:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 19304:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19307:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19307:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 19352:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19353:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19353:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 20 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 19362:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 19398:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19401:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19401:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19446:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19449:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19449:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19494:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19497:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19497:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19521:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19523:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19523:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19534:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 19568:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19570:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19570:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19575:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 19615:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19618:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19618:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19663:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19665:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19665:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19684:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 19710:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19713:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19713:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19758:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19761:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19761:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19806:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19809:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19809:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19854:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19857:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19857:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19902:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19905:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19905:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19953:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19953:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 19998:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20001:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20001:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 20046:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20049:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20049:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 20094:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20097:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20097:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 20142:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20145:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20145:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 20190:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20193:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20193:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 20238:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20241:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20241:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 20286:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20288:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20288:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 20290:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 20333:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20336:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20336:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20381:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20383:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20383:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20387:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 20428:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20431:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20431:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20476:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20479:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20479:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20503:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20506:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20506:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20551:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20554:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20554:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20599:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20601:
+    THREAD_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 20601:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20646:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20649:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20649:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 20 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20694:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20697:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20697:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 20 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20742:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20745:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20745:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 19 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20771:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 20790:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20793:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20793:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 20 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20838:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20841:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20841:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 20 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20886:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20888:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20888:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 19 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 20895:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 20933:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20936:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20936:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 20981:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20983:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20983:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21008:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 21028:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21029:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21029:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21030:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 21074:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21077:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21077:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21122:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21125:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21125:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21170:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21173:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21173:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21218:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21221:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21221:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21266:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21269:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21269:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21314:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21317:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21317:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21362:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21365:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21365:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21410:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21413:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21413:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21458:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21461:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21461:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21485:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21488:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21488:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21533:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21536:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21536:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21581:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21584:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21584:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 19 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21606:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 21629:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21632:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21632:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21677:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21680:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21680:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21725:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21728:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21728:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 20 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21773:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21774:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21774:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 19 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21803:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 21819:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21822:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21822:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 20 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 21867:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21868:
+    THREAD_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 21868:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21913:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21916:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21916:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 21961:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21964:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21964:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 22009:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22012:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22012:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads (median burst = 17). Will run for at most 3 ticks.
+
+At time 22057:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22058:
+    THREAD_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 22058:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 18 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22103:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22106:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22106:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 18 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22151:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22154:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22154:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 17 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22179:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 22199:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22202:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22202:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 22247:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22250:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22250:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 18 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 22295:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22298:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22298:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 18 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 22343:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22346:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22346:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 18 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 22391:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22394:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22394:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 18 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 22418:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22421:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22421:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 18 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 22466:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22469:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22469:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 18 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 22514:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22517:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22517:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 18 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 22562:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22565:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22565:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 18 threads (median burst = 15). Will run for at most 3 ticks.
+
+At time 22610:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22611:
+    THREAD_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 22611:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 17 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22656:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22659:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22659:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 17 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22704:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22707:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22707:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 17 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22752:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22755:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22755:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 17 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22779:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22782:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22782:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 17 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22827:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22830:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22830:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22875:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22878:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22878:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 17 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22923:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22926:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22926:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 17 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 22971:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22972:
+    THREAD_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 22972:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23017:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23020:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23020:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23065:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23068:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23068:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 16 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23113:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23116:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23116:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 16 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23161:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23164:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23164:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23209:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23211:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23211:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 15 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23224:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 23235:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23238:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23238:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 16 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23283:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23286:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23286:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23331:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23334:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23334:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23379:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23382:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23382:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 16 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23427:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23429:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23429:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 15 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 23442:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23474:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23477:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23477:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23522:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23523:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23523:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23547:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23548:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23550:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23550:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23595:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23598:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23598:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23643:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23646:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23646:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23691:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23692:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23692:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23700:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23737:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23740:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23740:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23785:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23786:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23786:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23810:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 23831:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23834:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23834:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23879:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23882:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23882:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23927:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23930:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23930:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 23954:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23957:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23957:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24002:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24005:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24005:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24050:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24053:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24053:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24098:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24100:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24100:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24118:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 24145:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24148:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24148:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24193:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24196:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24196:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24241:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24244:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24244:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24268:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24271:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24271:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24316:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24319:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24319:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24364:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24367:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24367:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24412:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24415:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24415:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24460:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24463:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24463:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24508:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24511:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24511:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24556:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24559:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24559:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24604:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24606:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24606:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24608:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 24651:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24654:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24654:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24678:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24680:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24680:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24705:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 24725:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24728:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24728:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24773:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24774:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24774:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24786:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 24819:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24822:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24822:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24867:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24870:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24870:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24915:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24918:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24918:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24963:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24966:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24966:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 24990:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24991:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24991:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25006:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 25036:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25039:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25039:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25084:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25087:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25087:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25132:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25135:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25135:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25180:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25181:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25181:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25204:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 25226:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25229:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25229:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25257:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 25274:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25277:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25277:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25325:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25325:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25370:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25373:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25373:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25397:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25400:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25400:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25445:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25448:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25448:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25493:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25496:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25496:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25541:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25544:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25544:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 15 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25553:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 25589:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25592:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25592:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25637:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25640:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25640:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25685:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25688:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25688:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25712:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25715:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25715:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25760:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25763:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25763:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25808:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25811:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25811:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 16 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 25856:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25857:
+    THREAD_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 25857:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 15 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 25902:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25905:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25905:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 25950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25953:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25953:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 25998:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26001:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26001:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 15 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 26046:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26049:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26049:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 15 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 26094:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26097:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26097:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 15 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 26121:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26124:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26124:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 15 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 26169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26172:
+    THREAD_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 26172:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 14 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 26217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26220:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26220:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 14 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 26265:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26268:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26268:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 14 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 26313:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26316:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26316:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 14 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 26361:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26364:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26364:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 14 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 26409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26411:
+    THREAD_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 26411:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 13 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 26435:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26438:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26438:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 13 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 26483:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26486:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26486:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (median burst = 14). Will run for at most 3 ticks.
+
+At time 26493:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 26531:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26534:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26534:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 13 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 26579:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26582:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26582:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 13 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 26627:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26630:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26630:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 13 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 26675:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26678:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26678:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 13 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 26723:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26726:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26726:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 26732:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 26771:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26774:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26774:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 13 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 26798:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26801:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26801:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 13 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 26846:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26849:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26849:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 13 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 26894:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26897:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26897:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 13 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 26942:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26943:
+    THREAD_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 26943:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 12 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 26988:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26991:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26991:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 27005:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 27036:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27039:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27039:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 12 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 27084:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27087:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27087:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 27132:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27133:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27133:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 27146:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 27178:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27181:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27181:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 12 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27226:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27229:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27229:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 12 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27274:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27275:
+    THREAD_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 27275:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27320:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27323:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27323:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27368:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27371:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27371:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27395:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27398:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27398:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27443:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27446:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27446:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27491:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27494:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27494:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27539:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27542:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27542:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27587:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27590:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27590:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27635:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27638:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27638:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27683:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27686:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27686:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27731:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27734:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27734:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27779:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27782:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27782:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 11 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 27827:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27829:
+    THREAD_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 27829:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 27874:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27875:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27875:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 9 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 27878:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 27899:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27902:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27902:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 27947:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27950:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27950:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 27995:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27998:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27998:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28043:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28046:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28046:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28091:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28094:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28094:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28139:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28142:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28142:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28187:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28190:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28190:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28235:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28238:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28238:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28283:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28286:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28286:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28331:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28334:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28334:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28358:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28361:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28361:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28406:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28409:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28409:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28454:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28457:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28457:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28502:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28505:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28505:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28550:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28553:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28553:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28598:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28601:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28601:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28646:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28649:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28649:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads (median burst = 13). Will run for at most 3 ticks.
+
+At time 28694:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28697:
+    THREAD_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 28697:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 9 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 28742:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28745:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28745:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 28790:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28793:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28793:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 9 threads (median burst = 16). Will run for at most 3 ticks.
+
+At time 28817:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28818:
+    THREAD_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 28818:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 8 threads (median burst = 18). Will run for at most 3 ticks.
+
+At time 28863:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28864:
+    THREAD_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 28864:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 28909:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28912:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28912:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 28957:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28960:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28960:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29005:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29008:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29008:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29053:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29056:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29056:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29101:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29104:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29104:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29149:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29152:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29152:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29197:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29200:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29200:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29245:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29248:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29248:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29293:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29296:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29296:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29341:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29343:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29343:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29368:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29388:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29392:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29392:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29419:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29437:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29441:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29441:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29486:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29488:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29488:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29496:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 29533:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29537:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29537:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 7 threads (median burst = 19). Will run for at most 3 ticks.
+
+At time 29582:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29585:
+    THREAD_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 29585:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29634:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29634:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29679:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29683:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29683:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29728:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29730:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29730:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29746:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29775:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29777:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29777:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29807:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 29822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29826:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29826:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29871:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29875:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29875:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29920:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29923:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29923:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29936:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29968:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29972:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29972:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 29973:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 30017:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30021:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30021:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30066:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30070:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30070:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30115:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30119:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30119:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30164:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30168:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30168:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30213:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30217:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30217:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30262:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30266:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30266:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30311:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30315:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30315:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30360:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30364:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30364:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30413:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30413:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30458:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30462:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30462:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30507:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30511:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30511:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30556:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30560:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30560:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30605:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30609:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30609:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30654:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30658:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30658:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30703:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30707:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30707:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30752:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30753:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 30753:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30770:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 30798:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30802:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30802:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30847:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30851:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30851:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30896:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30900:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30900:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30945:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30949:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30949:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 30994:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30995:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 30995:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31014:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 31040:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31044:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31044:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31089:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31093:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31093:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31141:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31141:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31154:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31186:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31190:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31190:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31235:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31239:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31239:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31284:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31288:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31288:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31333:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31337:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31337:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31382:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31386:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31386:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31431:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31435:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31435:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31480:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31484:
+    THREAD_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 31484:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31529:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31533:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31533:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31582:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31582:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31627:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31631:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31631:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31676:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31680:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31680:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31725:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31729:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31729:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31774:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31778:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31778:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31823:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31827:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31827:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 4 threads (median burst = 19). Will run for at most 6 ticks.
+
+At time 31844:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 31872:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31878:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31878:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 31923:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31926:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31926:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 4 threads (median burst = 19). Will run for at most 6 ticks.
+
+At time 31954:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31971:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31977:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31977:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (median burst = 19). Will run for at most 4 ticks.
+
+At time 32022:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32024:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32024:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 4 threads (median burst = 19). Will run for at most 6 ticks.
+
+At time 32034:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 32069:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32072:
+    THREAD_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 32072:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 4 threads (median burst = 22). Will run for at most 6 ticks.
+
+At time 32117:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32123:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32123:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 4 threads (median burst = 22). Will run for at most 6 ticks.
+
+At time 32168:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32171:
+    THREAD_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 32171:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 3 threads (median burst = 19). Will run for at most 8 ticks.
+
+At time 32216:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32222:
+    THREAD_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 32222:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 2 threads (median burst = 20). Will run for at most 12 ticks.
+
+At time 32267:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32279:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32279:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads (median burst = 20). Will run for at most 12 ticks.
+
+At time 32324:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32326:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32326:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 1 threads (median burst = 20). Will run for at most 20 ticks.
+
+At time 32354:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 32371:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32381:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32381:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (median burst = 20). Will run for at most 20 ticks.
+
+At time 32409:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 32426:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32446:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32446:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 2 threads (median burst = 20). Will run for at most 12 ticks.
+
+At time 32491:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32492:
+    THREAD_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 32492:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (median burst = 20). Will run for at most 20 ticks.
+
+At time 32537:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32539:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32567:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 32567:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (median burst = 22). Will run for at most 22 ticks.
+
+At time 32591:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32613:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32613:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (median burst = 22). Will run for at most 22 ticks.
+
+At time 32637:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32640:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32663:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 32663:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (median burst = 22). Will run for at most 22 ticks.
+
+At time 32687:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32709:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32709:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (median burst = 22). Will run for at most 22 ticks.
+
+At time 32733:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32739:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32743:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 32743:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (median burst = 22). Will run for at most 22 ticks.
+
+At time 32767:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32789:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32789:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (median burst = 22). Will run for at most 22 ticks.
+
+At time 32813:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32820:
+    THREAD_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             44
+    Process switches:           657
+    Dispatch time saved:        924
+
+MAX READY WAIT:
+    SYSTEM:                    1080
+    INTERACTIVE:                  0
+    NORMAL:                    1080
+    BATCH:                        0
+
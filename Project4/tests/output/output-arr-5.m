@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:       59.00
+    Avg. turnaround time:   1005.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       36.00
+    Avg. turnaround time:    722.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1085
+Total service time:            170
+Total I/O time:                185
+Total dispatch time:           760
+Total idle time:               155
+
+CPU utilization:            85.71%
+CPU efficiency:             15.67%
+
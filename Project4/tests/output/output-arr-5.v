@@ -0,0 +1,462 @@
+At time 62:
+    THREAD_ARRIVED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 62:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (median burst = 24). Will run for at most 24 ticks.
+
+At time 80:
+    THREAD_ARRIVED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 98:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 103:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 103:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 24). Will run for at most 24 ticks.
+
+At time 110:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 139:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 145:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 145:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (median burst = 5). Will run for at most 5 ticks.
+
+At time 173:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 186:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 186:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 222:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 228:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 228:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 264:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 270:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 270:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 306:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 312:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 312:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 354:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 354:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 390:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 396:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 396:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 432:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 436:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 436:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 452:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 472:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 478:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 478:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 514:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 520:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 520:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 556:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 561:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 561:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (median burst = 6). Will run for at most 6 ticks.
+
+At time 570:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 597:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 603:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 603:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (median burst = 21). Will run for at most 12 ticks.
+
+At time 639:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 646:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 646:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (median burst = 21). Will run for at most 21 ticks.
+
+At time 667:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 682:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 693:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 693:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 7). Will run for at most 7 ticks.
+
+At time 704:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 729:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 736:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 736:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (median burst = 21). Will run for at most 12 ticks.
+
+At time 772:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 784:
+    THREAD_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 784:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 12). Will run for at most 12 ticks.
+
+At time 820:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 831:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 840:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 840:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 18). Will run for at most 18 ticks.
+
+At time 854:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 872:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 872:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 18). Will run for at most 18 ticks.
+
+At time 886:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 887:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 893:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 893:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 18). Will run for at most 18 ticks.
+
+At time 907:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 909:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 917:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 917:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 18). Will run for at most 18 ticks.
+
+At time 931:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 936:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 959:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 959:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 12). Will run for at most 12 ticks.
+
+At time 973:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 975:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 997:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 997:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 12). Will run for at most 12 ticks.
+
+At time 1011:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1023:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1023:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 12). Will run for at most 12 ticks.
+
+At time 1037:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1041:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1066:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1066:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (median burst = 12). Will run for at most 12 ticks.
+
+At time 1080:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1085:
+    THREAD_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:              8
+    Process switches:            18
+    Dispatch time saved:        176
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                 84
+    NORMAL:                      79
+    BATCH:                        0
+
@@ -0,0 +1,702 @@
+At time 42:
+    THREAD_ARRIVED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 42:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 57:
+    THREAD_ARRIVED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 60:
+    THREAD_ARRIVED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 73:
+    THREAD_ARRIVED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 77:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 100:
+    THREAD_ARRIVED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 107:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 107:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 120:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 142:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 163:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 163:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 182:
+    IO_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 198:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 204:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 204:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 207:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 221:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 221:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 5 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 227:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 242:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 260:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 260:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 263:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 275:
+    IO_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 291:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 291:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 294:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 310:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 310:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 5 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 315:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 325:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 345:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 371:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 371:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 394:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 406:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 411:
+    THREAD_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 411:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 446:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 468:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 468:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 471:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 485:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 485:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 488:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 511:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 520:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 541:
+    THREAD_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 541:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 544:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 558:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 558:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 561:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 582:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 585:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 585:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 607:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 620:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 650:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 650:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 653:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 667:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 667:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 670:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 675:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 676:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 699:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 699:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 712:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 734:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 740:
+    THREAD_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 740:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 743:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 772:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 772:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 780:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 807:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 818:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 818:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 821:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 837:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 837:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 840:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 845:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 859:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 863:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 863:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 3 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 885:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 898:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 916:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 916:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 923:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 951:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 974:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 974:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 977:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 982:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 994:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 994:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 997:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1016:
+    THREAD_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 1016:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1019:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1051:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1060:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1060:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1081:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1095:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1123:
+    THREAD_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 1123:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1126:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1155:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1155:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1171:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1190:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1191:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1191:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1215:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1226:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1235:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1235:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1255:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1270:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1291:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1291:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1313:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1326:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1347:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1347:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1350:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1382:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1390:
+    THREAD_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1390:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1425:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1447:
+    THREAD_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
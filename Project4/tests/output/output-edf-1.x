@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             14
+    Process switches:            21
+    Dispatch time saved:        448
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                229
+    NORMAL:                     245
+    BATCH:                        0
+
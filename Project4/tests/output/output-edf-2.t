@@ -0,0 +1,9 @@
+SIMULATION COMPLETED!
+
+Process 59 [SYSTEM]:
+    Thread  0:    ARR: 33     CPU: 54     I/O: 60     TRT: 489    END: 522   
+    Thread  1:    ARR: 29     CPU: 123    I/O: 97     TRT: 611    END: 640   
+
+Process 189 [NORMAL]:
+    Thread  0:    ARR: 19     CPU: 46     I/O: 34     TRT: 345    END: 364   
+
@@ -0,0 +1,282 @@
+At time 19:
+    THREAD_ARRIVED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 19:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 29:
+    THREAD_ARRIVED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 66:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 91:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 91:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 105:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 161:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 161:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 169:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 171:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 179:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 179:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 186:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 226:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 231:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 231:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 251:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 278:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 285:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 285:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 287:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 295:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 301:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 301:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 324:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 364:
+    THREAD_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 364:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 411:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 425:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 425:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 435:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 451:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 458:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 458:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 468:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 488:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 495:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 495:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 505:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 520:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 522:
+    THREAD_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 522:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 532:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 556:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 578:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 578:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 588:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 589:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 603:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 603:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 613:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 640:
+    THREAD_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
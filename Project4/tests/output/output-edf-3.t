@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 4090   END: 4138  
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 1604   END: 1614  
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 3853   END: 3935  
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 482    END: 540   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 4041   END: 4069  
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 1687   END: 1720  
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 4261   END: 4261  
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 3336   END: 3389  
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 1879   END: 1937  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 3373   END: 3443  
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 3740   END: 3787  
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 268    END: 307   
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 3476   END: 3563  
+
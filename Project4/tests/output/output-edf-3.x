@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:              7
+    Process switches:            62
+    Dispatch time saved:        203
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                665
+    NORMAL:                     787
+    BATCH:                      772
+
@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 7324   END: 7383  
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 5940   END: 6019  
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 8160   END: 8210  
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 4127   END: 4149  
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 6626   END: 6676  
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 6681   END: 6740  
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 7773   END: 7844  
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 7146   END: 7185  
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 6233   END: 6256  
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 7485   END: 7577  
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 4796   END: 4867  
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 7644   END: 7669  
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 7855   END: 7950  
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 7954   END: 7998  
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 4742   END: 4809  
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 3180   END: 3227  
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 6467   END: 6512  
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 3472   END: 3531  
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 6838   END: 6914  
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 8126   END: 8136  
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 1451   END: 1468  
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 6513   END: 6562  
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 4603   END: 4658  
+
@@ -0,0 +1,2782 @@
+At time 10:
+    THREAD_ARRIVED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 17:
+    THREAD_ARRIVED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 22:
+    THREAD_ARRIVED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 23:
+    THREAD_ARRIVED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 25:
+    THREAD_ARRIVED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 44:
+    THREAD_ARRIVED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 45:
+    THREAD_ARRIVED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 49:
+    THREAD_ARRIVED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    THREAD_ARRIVED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 67:
+    THREAD_ARRIVED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 69:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 69:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 16 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 76:
+    THREAD_ARRIVED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 79:
+    THREAD_ARRIVED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 81:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 92:
+    THREAD_ARRIVED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 95:
+    THREAD_ARRIVED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 114:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 127:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 127:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 137:
+    IO_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 172:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 184:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 184:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 187:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 231:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 231:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 246:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 276:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 278:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 278:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 295:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 323:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 327:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 327:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 346:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 372:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 395:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 395:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 402:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 440:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 448:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 448:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 472:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 493:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 497:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 497:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 521:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 542:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 554:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 554:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 583:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 599:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 627:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 627:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 632:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 651:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 659:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 659:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 679:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 704:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 726:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 726:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 756:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 771:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 780:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 780:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 805:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 825:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 855:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 855:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 870:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 900:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 918:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 918:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 925:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 963:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 989:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 989:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1015:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1034:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1054:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1054:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1066:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1099:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1117:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1117:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1122:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1162:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1170:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1170:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1190:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1215:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1219:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1219:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1240:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1264:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1268:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1268:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1283:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1313:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1331:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1331:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1357:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1376:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1399:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1399:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1402:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1444:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1468:
+    THREAD_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 1468:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1513:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1531:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1531:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1533:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1576:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1591:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1591:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1599:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1636:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1638:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1638:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1645:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1683:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1702:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1702:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1726:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1747:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1757:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1757:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1764:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1802:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1831:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1831:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1854:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1876:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1888:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1888:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1918:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1933:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1959:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1959:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 1960:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2004:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2026:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2026:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2047:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2050:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2056:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2056:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2067:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2101:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2105:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2105:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2132:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2150:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2172:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2172:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2200:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2239:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2239:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2255:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2284:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2297:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2297:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2324:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2354:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2354:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2383:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2399:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2416:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2416:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2431:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2461:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2470:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2470:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2484:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2515:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2539:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2539:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2567:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2584:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2592:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2592:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2596:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2637:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2656:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2656:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2661:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2701:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2728:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2728:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2742:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2773:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2786:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2786:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2800:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2831:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2852:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2852:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2859:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2897:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2916:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2916:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 2921:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2961:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2978:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2978:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3003:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3023:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3039:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3039:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3049:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3084:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3103:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3103:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3112:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3148:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3155:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3155:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3168:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3200:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3227:
+    THREAD_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 3227:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3272:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3284:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3284:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 20 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3291:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3329:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3343:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3343:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 20 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3356:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3367:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3389:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3389:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3419:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3434:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3460:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3460:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 20 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3465:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3505:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3531:
+    THREAD_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3531:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3576:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3578:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3578:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3597:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3623:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3626:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3626:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3641:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3671:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3692:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3692:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3718:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3737:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3766:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3766:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3779:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3811:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3818:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3818:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3841:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3863:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3864:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3864:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3884:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3909:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3912:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3912:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3939:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3957:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3974:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3974:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 3975:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4019:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4032:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4032:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4033:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4077:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4091:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4091:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4097:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4136:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4149:
+    THREAD_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4149:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 19 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4194:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4205:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4205:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 18 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4225:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4250:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4256:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4256:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 18 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4269:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4301:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4310:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4310:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4320:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4355:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4368:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4368:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 18 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4392:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4413:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4416:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4416:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 18 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4428:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4461:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4484:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4484:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 18 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4486:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4529:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4548:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4548:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 18 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4551:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4572:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4589:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4589:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 18 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4600:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4634:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4658:
+    THREAD_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4658:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 18 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4703:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4709:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4709:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 17 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4731:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4754:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4760:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4760:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 17 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4773:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4805:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4809:
+    THREAD_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4809:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 17 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4854:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4867:
+    THREAD_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 4867:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 16 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4912:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4937:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4937:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 4966:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4982:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5005:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5005:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5012:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5050:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5079:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5079:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5101:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5124:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5138:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5138:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5163:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5183:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5204:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5204:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5211:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5249:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5277:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5277:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5290:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5341:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5341:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5349:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5386:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5394:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5394:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5424:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5439:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5444:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5444:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5446:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5489:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5495:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5495:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5523:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5540:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5548:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5548:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5552:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5593:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5602:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5602:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5608:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5647:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5673:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5673:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5690:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5697:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5714:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5714:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5739:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5759:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5769:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5769:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5781:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5814:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5843:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5843:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5861:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5888:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5909:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5909:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5923:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5954:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5961:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5961:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 5986:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6006:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6019:
+    THREAD_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 6019:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 15 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6064:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6077:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6077:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 14 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6092:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6122:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6141:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6141:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 14 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6168:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6186:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6204:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6204:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 14 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6234:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6249:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6256:
+    THREAD_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6256:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 14 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6301:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6313:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6313:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 13 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6316:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6358:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6374:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6374:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 13 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6397:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6419:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6442:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6442:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 13 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6450:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6487:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6512:
+    THREAD_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6512:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 13 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6557:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6562:
+    THREAD_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 6562:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6607:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6633:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6633:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 11 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6657:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6661:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6676:
+    THREAD_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 6676:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 11 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6721:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6740:
+    THREAD_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6740:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 10 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6785:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6791:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6791:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6800:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6836:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6858:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6858:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 9 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6871:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6903:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6914:
+    THREAD_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6914:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6938:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6961:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6961:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 6986:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7006:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7008:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7008:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 8 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7024:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7053:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7083:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7083:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 8 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7093:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7107:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7122:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7122:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 8 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7147:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7167:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7185:
+    THREAD_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7185:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 8 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7230:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7247:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7247:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 7 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7266:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7314:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7314:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 7 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7342:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7359:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7383:
+    THREAD_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 7383:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 7 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7428:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7455:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7455:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7483:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7500:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7508:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7508:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7509:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7553:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7577:
+    THREAD_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7577:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7622:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7644:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7644:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 5 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7668:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7669:
+    THREAD_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 7669:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7672:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7714:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7726:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7726:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7743:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7771:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7796:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7796:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7819:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7844:
+    THREAD_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7844:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 4 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7904:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7904:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 3 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7917:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7949:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7950:
+    THREAD_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 7950:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 3 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 7995:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7998:
+    THREAD_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 7998:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 8043:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8071:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8071:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 8075:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 8116:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8136:
+    THREAD_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 8136:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 8181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8210:
+    THREAD_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:              9
+    Process switches:           130
+    Dispatch time saved:        189
+
+MAX READY WAIT:
+    SYSTEM:                    1372
+    INTERACTIVE:                  0
+    NORMAL:                    1354
+    BATCH:                        0
+
@@ -0,0 +1,282 @@
+At time 62:
+    THREAD_ARRIVED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 62:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 80:
+    THREAD_ARRIVED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 98:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 103:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 103:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 110:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 139:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 145:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 145:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 173:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 202:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 202:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 218:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 238:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 267:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 267:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 276:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 303:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 326:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 326:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 337:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 362:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 369:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 369:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 390:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 405:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 417:
+    THREAD_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 417:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 453:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 471:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 480:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 480:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 494:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 513:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 519:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 519:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 533:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 535:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 543:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 543:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 557:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 562:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 585:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 585:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 599:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 601:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 623:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 623:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 637:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 653:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 678:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 678:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (no deadline). Will run to completion of burst or until preempted.
+
+At time 692:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 697:
+    THREAD_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:              6
+    Process switches:             8
+    Dispatch time saved:        132
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                 86
+    NORMAL:                      85
+    BATCH:                        0
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:      394.67
+    Avg. turnaround time:   1672.33
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      607.75
+    Avg. turnaround time:   1218.25
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           2359
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:          1541
+Total idle time:               190
+
+CPU utilization:            91.95%
+CPU efficiency:             26.62%
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 1679   END: 1729  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 2317   END: 2359  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 1021   END: 1078  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 648    END: 748   
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 1180   END: 1240  
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 1879   END: 1952  
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 1166   END: 1216  
+
@@ -0,0 +1,20 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             12
+    Process switches:            43
+    Dispatch time saved:        384
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:               1750
+    NORMAL:                    1243
+    BATCH:                        0
+
+DEADLINES:
+    Threads with deadline:        7
+    Deadlines missed:             7
+    Miss rate:              100.00%
+    Lateness min/avg/max:  248 / 484.29 / 717
+    Lateness p50/p95:      521 / 717
+
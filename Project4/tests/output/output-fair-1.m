@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:      107.33
+    Avg. turnaround time:   6065.67
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      105.75
+    Avg. turnaround time:   3554.50
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           6312
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:          5556
+Total idle time:               128
+
+CPU utilization:            97.97%
+CPU efficiency:              9.95%
+
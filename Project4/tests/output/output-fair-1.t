@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 5972   END: 6022  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 6270   END: 6312  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 5955   END: 6012  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 5727   END: 5827  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 2348   END: 2408  
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 3634   END: 3707  
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 2509   END: 2559  
+
@@ -0,0 +1,3477 @@
+At time 42:
+    THREAD_ARRIVED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 42:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 57:
+    THREAD_ARRIVED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 60:
+    THREAD_ARRIVED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 73:
+    THREAD_ARRIVED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 77:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 80:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 80:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 6 threads in 2 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 100:
+    THREAD_ARRIVED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 115:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 118:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 118:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 121:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 124:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 124:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 159:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 162:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 162:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 197:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 200:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 200:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 235:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 238:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 238:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 9, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 273:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 276:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 276:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 9, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 311:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 314:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 314:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 12, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 349:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 352:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 352:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 12, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 387:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 390:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 390:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 6 threads in 2 processes (process vruntime = 15, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 413:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 425:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 426:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 426:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 6 threads in 2 processes (process vruntime = 15, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 441:
+    IO_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 461:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 464:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 464:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 16, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 499:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 502:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 502:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 18, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 537:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 540:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 540:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 19, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 575:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 578:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 578:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 21, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 613:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 616:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 616:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 22, thread vruntime = 4). Will run for at most 3 ticks.
+
+At time 651:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 654:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 654:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 24, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 689:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 692:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 692:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 25, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 727:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 730:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 730:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 27, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 765:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 768:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 768:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 28, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 803:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 806:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 806:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 30, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 844:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 844:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 31, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 879:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 882:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 882:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 33, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 917:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 920:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 920:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 34, thread vruntime = 7). Will run for at most 3 ticks.
+
+At time 955:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 958:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 958:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 36, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 993:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 996:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 996:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 37, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 1031:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1034:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1034:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 39, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 1069:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1072:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1072:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 40, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 1107:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1110:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1110:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 42, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 1145:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1147:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1147:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 6 threads in 2 processes (process vruntime = 43, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 1168:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1182:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1185:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1185:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 44, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 1220:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1223:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1223:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 46, thread vruntime = 10). Will run for at most 3 ticks.
+
+At time 1258:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1261:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1261:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 47, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 1296:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1299:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1299:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 49, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 1334:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1337:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1337:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 50, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 1372:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1375:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1375:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 52, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 1410:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1413:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1413:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 53, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 1448:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1451:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1451:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 55, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 1486:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1489:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1489:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 56, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 1524:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1527:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1527:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 58, thread vruntime = 13). Will run for at most 3 ticks.
+
+At time 1562:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1565:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1565:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 59, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 1600:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1603:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1603:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 61, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 1638:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1641:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1641:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 62, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 1676:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1679:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1679:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 64, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 1714:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1717:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1717:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 65, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 1752:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1755:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1755:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 67, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 1790:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1791:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1791:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 6 threads in 2 processes (process vruntime = 68, thread vruntime = 16). Will run for at most 3 ticks.
+
+At time 1794:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1797:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1797:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 6 threads in 2 processes (process vruntime = 68, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 1806:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1832:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1835:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1835:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 71, thread vruntime = 16). Will run for at most 3 ticks.
+
+At time 1870:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1873:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1873:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 71, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 1908:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1911:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1911:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 74, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 1946:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1949:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1949:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 6 threads in 2 processes (process vruntime = 74, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 1968:
+    IO_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1984:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1987:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1987:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 77, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 2022:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2025:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2025:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 77, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 2060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2063:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2063:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 80, thread vruntime = 19). Will run for at most 3 ticks.
+
+At time 2098:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2101:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2101:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 80, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 2136:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2138:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2138:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 6 threads in 2 processes (process vruntime = 82, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 2141:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2144:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2144:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 83, thread vruntime = 19). Will run for at most 3 ticks.
+
+At time 2157:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2164:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2179:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2182:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2182:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 85, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 2217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2218:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2218:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 6 threads in 2 processes (process vruntime = 86, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 2238:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2253:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2256:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2256:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 86, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 2291:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2294:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2294:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 89, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 2329:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2332:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2332:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 7 threads in 2 processes (process vruntime = 89, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 2367:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2370:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2370:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    Selected from 7 threads in 2 processes (process vruntime = 92, thread vruntime = 22). Will run for at most 3 ticks.
+
+At time 2405:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2408:
+    THREAD_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2408:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 6 threads in 2 processes (process vruntime = 92, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 2443:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2446:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2446:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 6 threads in 2 processes (process vruntime = 95, thread vruntime = 22). Will run for at most 3 ticks.
+
+At time 2481:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2484:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2484:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 6 threads in 2 processes (process vruntime = 95, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 2519:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2522:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2522:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    Selected from 6 threads in 2 processes (process vruntime = 98, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 2557:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2559:
+    THREAD_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2559:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 98, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 2594:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2597:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2597:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 100, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 2632:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2635:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2635:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 101, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 2670:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2673:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2673:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 103, thread vruntime = 25). Will run for at most 3 ticks.
+
+At time 2708:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2711:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2711:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 104, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 2746:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2749:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2749:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 106, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 2784:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2785:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2785:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 107, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 2788:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2791:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2791:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 107, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 2809:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2826:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2829:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2829:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 110, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 2832:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2835:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2835:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 110, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 2870:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2873:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2873:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 113, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 2908:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2911:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2911:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 113, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 2946:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2949:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2949:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 116, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 2984:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2987:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2987:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 116, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 3022:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3025:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3025:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 119, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 3060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3063:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3063:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 119, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 3098:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3101:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3101:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 122, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 3136:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3139:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3139:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 122, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 3174:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3177:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3177:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 125, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 3212:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3214:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3214:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 125, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 3222:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3249:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3252:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3252:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 127, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 3274:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3287:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3290:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3290:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 128, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 3325:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3328:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3328:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 130, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 3363:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3366:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3366:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 131, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 3401:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3404:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3404:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 133, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 3439:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3442:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3442:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 134, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 3477:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3479:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3479:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 136, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 3503:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3514:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3517:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3517:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 136, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 3552:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3555:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3555:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 139, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 3590:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3593:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3593:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 139, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 3628:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3631:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3631:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 5 threads in 2 processes (process vruntime = 142, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 3666:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3669:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3669:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 142, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 3704:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3707:
+    THREAD_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3707:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 145, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 3742:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3745:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3745:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 145, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 3780:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3783:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3783:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 148, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 3818:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3821:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3821:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 148, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 3856:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3859:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3859:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 151, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 3894:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3897:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3897:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 151, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 3932:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3935:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3935:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 154, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 3970:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3973:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3973:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 154, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 4008:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4011:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4011:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 157, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 4046:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4048:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4048:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 157, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 4075:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 4083:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4086:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4086:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 159, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 4121:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4124:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4124:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 160, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 4159:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4162:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4162:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 162, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 4197:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4200:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4200:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 163, thread vruntime = 64). Will run for at most 3 ticks.
+
+At time 4235:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4238:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4238:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 165, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 4273:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4275:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4275:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 166, thread vruntime = 67). Will run for at most 3 ticks.
+
+At time 4298:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 4310:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4312:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4312:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 167, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 4320:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4347:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4349:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4349:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 168, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 4362:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 4384:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4387:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4387:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 169, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 4422:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4425:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4425:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 171, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 4460:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4463:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4463:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 172, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 4498:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4501:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4501:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 174, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 4536:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4539:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4539:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 175, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 4574:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4577:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4577:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 177, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 4612:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4615:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4615:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 178, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 4650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4653:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4653:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 180, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 4688:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4691:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4691:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 181, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 4726:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4729:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4729:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 183, thread vruntime = 84). Will run for at most 3 ticks.
+
+At time 4764:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4767:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4767:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 184, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 4774:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4802:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4805:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4805:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 186, thread vruntime = 87). Will run for at most 3 ticks.
+
+At time 4840:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4843:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4843:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 187, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 4878:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4881:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4881:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 189, thread vruntime = 90). Will run for at most 3 ticks.
+
+At time 4916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4919:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4919:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 190, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 4954:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4957:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4957:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 192, thread vruntime = 93). Will run for at most 3 ticks.
+
+At time 4992:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4995:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4995:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 193, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 5016:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5030:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5033:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5033:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 195, thread vruntime = 96). Will run for at most 3 ticks.
+
+At time 5068:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5069:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5069:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 196, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 5093:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5104:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5107:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5107:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 196, thread vruntime = 97). Will run for at most 3 ticks.
+
+At time 5142:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5145:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5145:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 199, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 5180:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5183:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5183:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 199, thread vruntime = 100). Will run for at most 3 ticks.
+
+At time 5218:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5221:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5221:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 202, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 5256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5259:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5259:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 202, thread vruntime = 103). Will run for at most 3 ticks.
+
+At time 5294:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5297:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5297:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 205, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 5332:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5335:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5335:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 205, thread vruntime = 106). Will run for at most 3 ticks.
+
+At time 5370:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5373:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5373:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 208, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 5408:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5411:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5411:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 208, thread vruntime = 109). Will run for at most 3 ticks.
+
+At time 5446:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5449:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5449:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 211, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 5484:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5487:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5487:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 211, thread vruntime = 112). Will run for at most 3 ticks.
+
+At time 5522:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5525:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5525:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 214, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 5560:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5563:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5563:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 214, thread vruntime = 115). Will run for at most 3 ticks.
+
+At time 5598:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5601:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5601:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 217, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 5623:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5636:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5639:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5639:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 217, thread vruntime = 118). Will run for at most 3 ticks.
+
+At time 5674:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5677:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5677:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 220, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 5712:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5715:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5715:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 220, thread vruntime = 121). Will run for at most 3 ticks.
+
+At time 5750:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5753:
+    THREAD_PREEMPTED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5753:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 4 threads in 2 processes (process vruntime = 223, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 5788:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5790:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5790:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 223, thread vruntime = 124). Will run for at most 3 ticks.
+
+At time 5798:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 5825:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5827:
+    THREAD_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 5827:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 225, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 5862:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5865:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5865:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 228, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 5868:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5871:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5871:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 231, thread vruntime = 76). Will run for at most 3 ticks.
+
+At time 5874:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5877:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5877:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 234, thread vruntime = 77). Will run for at most 3 ticks.
+
+At time 5880:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5883:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5883:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 237, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 5886:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5888:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5888:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 239, thread vruntime = 79). Will run for at most 3 ticks.
+
+At time 5891:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5894:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5894:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 242, thread vruntime = 80). Will run for at most 3 ticks.
+
+At time 5897:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5900:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5900:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 245, thread vruntime = 82). Will run for at most 3 ticks.
+
+At time 5903:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5906:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5906:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 248, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 5909:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5910:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 5912:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5912:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 251, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 5915:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5918:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5918:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 254, thread vruntime = 85). Will run for at most 3 ticks.
+
+At time 5921:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5924:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5924:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 257, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 5927:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5930:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5930:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 260, thread vruntime = 88). Will run for at most 3 ticks.
+
+At time 5933:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5936:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5936:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 263, thread vruntime = 89). Will run for at most 3 ticks.
+
+At time 5938:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 5939:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5942:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5942:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 266, thread vruntime = 89). Will run for at most 3 ticks.
+
+At time 5945:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5948:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5948:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 269, thread vruntime = 91). Will run for at most 3 ticks.
+
+At time 5951:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5954:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5954:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 272, thread vruntime = 92). Will run for at most 3 ticks.
+
+At time 5957:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5960:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5960:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 275, thread vruntime = 92). Will run for at most 3 ticks.
+
+At time 5963:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5966:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5966:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 278, thread vruntime = 94). Will run for at most 3 ticks.
+
+At time 5969:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5972:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5972:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 281, thread vruntime = 95). Will run for at most 3 ticks.
+
+At time 5975:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5978:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5978:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 284, thread vruntime = 95). Will run for at most 3 ticks.
+
+At time 5981:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5984:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5984:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 287, thread vruntime = 97). Will run for at most 3 ticks.
+
+At time 5987:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5990:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5990:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 290, thread vruntime = 98). Will run for at most 3 ticks.
+
+At time 5993:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5996:
+    THREAD_PREEMPTED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5996:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 293, thread vruntime = 98). Will run for at most 3 ticks.
+
+At time 5999:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6002:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6002:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 296, thread vruntime = 100). Will run for at most 3 ticks.
+
+At time 6005:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6008:
+    THREAD_PREEMPTED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6008:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    Selected from 3 threads in 1 processes (process vruntime = 299, thread vruntime = 101). Will run for at most 3 ticks.
+
+At time 6011:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6012:
+    THREAD_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 6012:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 300, thread vruntime = 101). Will run for at most 3 ticks.
+
+At time 6015:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6018:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6018:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    Selected from 2 threads in 1 processes (process vruntime = 303, thread vruntime = 103). Will run for at most 3 ticks.
+
+At time 6021:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6022:
+    THREAD_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 6022:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 304, thread vruntime = 104). Will run for at most 3 ticks.
+
+At time 6025:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6026:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6048:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 6048:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 305, thread vruntime = 105). Will run for at most 3 ticks.
+
+At time 6051:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6054:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6054:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 308, thread vruntime = 108). Will run for at most 3 ticks.
+
+At time 6057:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6060:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6060:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 311, thread vruntime = 111). Will run for at most 3 ticks.
+
+At time 6063:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6066:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6066:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 314, thread vruntime = 114). Will run for at most 3 ticks.
+
+At time 6069:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6072:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6072:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 317, thread vruntime = 117). Will run for at most 3 ticks.
+
+At time 6075:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6078:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6078:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 320, thread vruntime = 120). Will run for at most 3 ticks.
+
+At time 6081:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6083:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6108:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 6108:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 322, thread vruntime = 122). Will run for at most 3 ticks.
+
+At time 6111:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6114:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6114:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 325, thread vruntime = 125). Will run for at most 3 ticks.
+
+At time 6117:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6120:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6120:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 328, thread vruntime = 128). Will run for at most 3 ticks.
+
+At time 6123:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6126:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6126:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 331, thread vruntime = 131). Will run for at most 3 ticks.
+
+At time 6129:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6132:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6132:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 334, thread vruntime = 134). Will run for at most 3 ticks.
+
+At time 6135:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6138:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6138:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 337, thread vruntime = 137). Will run for at most 3 ticks.
+
+At time 6141:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6144:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6144:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 340, thread vruntime = 140). Will run for at most 3 ticks.
+
+At time 6147:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6150:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6150:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 343, thread vruntime = 143). Will run for at most 3 ticks.
+
+At time 6153:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6156:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6156:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 346, thread vruntime = 146). Will run for at most 3 ticks.
+
+At time 6159:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6162:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6162:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 349, thread vruntime = 149). Will run for at most 3 ticks.
+
+At time 6165:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6167:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6183:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 6183:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 351, thread vruntime = 151). Will run for at most 3 ticks.
+
+At time 6186:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6189:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6189:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 354, thread vruntime = 154). Will run for at most 3 ticks.
+
+At time 6192:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6195:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6195:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 357, thread vruntime = 157). Will run for at most 3 ticks.
+
+At time 6198:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6201:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6221:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 6221:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 360, thread vruntime = 160). Will run for at most 3 ticks.
+
+At time 6224:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6227:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6227:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 363, thread vruntime = 163). Will run for at most 3 ticks.
+
+At time 6230:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6233:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6233:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 366, thread vruntime = 166). Will run for at most 3 ticks.
+
+At time 6236:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6239:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6239:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 369, thread vruntime = 169). Will run for at most 3 ticks.
+
+At time 6242:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6245:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6245:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 372, thread vruntime = 172). Will run for at most 3 ticks.
+
+At time 6248:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6251:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6251:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 375, thread vruntime = 175). Will run for at most 3 ticks.
+
+At time 6254:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6257:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6257:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 378, thread vruntime = 178). Will run for at most 3 ticks.
+
+At time 6260:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6263:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6266:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 6266:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 381, thread vruntime = 181). Will run for at most 3 ticks.
+
+At time 6269:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6272:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6272:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 384, thread vruntime = 184). Will run for at most 3 ticks.
+
+At time 6275:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6278:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6278:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 387, thread vruntime = 187). Will run for at most 3 ticks.
+
+At time 6281:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6284:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6284:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 390, thread vruntime = 190). Will run for at most 3 ticks.
+
+At time 6287:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6290:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6290:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 393, thread vruntime = 193). Will run for at most 3 ticks.
+
+At time 6293:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6296:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6296:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 396, thread vruntime = 196). Will run for at most 3 ticks.
+
+At time 6299:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6302:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6302:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 399, thread vruntime = 199). Will run for at most 3 ticks.
+
+At time 6305:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6308:
+    THREAD_PREEMPTED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6308:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 402, thread vruntime = 202). Will run for at most 3 ticks.
+
+At time 6311:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6312:
+    THREAD_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             67
+    Process switches:           153
+    Dispatch time saved:       2144
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                300
+    NORMAL:                     375
+    BATCH:                        0
+
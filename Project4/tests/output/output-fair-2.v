@@ -0,0 +1,1257 @@
+At time 19:
+    THREAD_ARRIVED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 19:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 29:
+    THREAD_ARRIVED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 66:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 69:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 69:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 116:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 119:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 119:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 129:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 132:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 132:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 3, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 179:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 182:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 182:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 6, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 232:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 232:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 6, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 279:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 282:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 282:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 9, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 329:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 332:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 332:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 9, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 379:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 382:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 382:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 12, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 429:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 432:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 432:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 12, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 479:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 482:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 482:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 15, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 529:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 531:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 531:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 15, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 538:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 581:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 581:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 17, thread vruntime = 8). Will run for at most 3 ticks.
+
+At time 628:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 631:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 631:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 18, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 681:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 681:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 20, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 728:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 731:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 731:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 21, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 778:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 781:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 781:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 23, thread vruntime = 11). Will run for at most 3 ticks.
+
+At time 828:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 831:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 831:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 24, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 854:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 878:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 879:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 879:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 26, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 893:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 926:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 929:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 929:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 26, thread vruntime = 25). Will run for at most 3 ticks.
+
+At time 976:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 979:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 979:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 29, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 1026:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1029:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1029:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 29, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 1076:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1078:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1078:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 32, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 1098:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1125:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1128:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1128:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 32, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 1175:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1178:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1178:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 35, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 1225:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1228:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1228:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 35, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 1275:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1278:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1278:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 38, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 1325:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1328:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1328:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 38, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 1375:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1378:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1378:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 41, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 1425:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1428:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1428:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 41, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 1475:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1478:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1478:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 44, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 1525:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1527:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1527:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 44, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 1535:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1574:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1577:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1577:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 46, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 1624:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1627:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1627:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 47, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 1674:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1675:
+    THREAD_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1675:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 49, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 1722:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1725:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1725:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 52, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 1735:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1738:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1738:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 55, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 1748:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1751:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1751:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 58, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 1761:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1764:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1764:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 61, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 1774:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1775:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1775:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 62, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 1777:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1785:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1788:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1788:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 65, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 1798:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1801:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1801:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 68, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 1811:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1813:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1813:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 70, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 1823:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1826:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1826:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 73, thread vruntime = 38). Will run for at most 3 ticks.
+
+At time 1836:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1839:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1839:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 76, thread vruntime = 41). Will run for at most 3 ticks.
+
+At time 1843:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1849:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1852:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1852:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 79, thread vruntime = 41). Will run for at most 3 ticks.
+
+At time 1862:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1865:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1865:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 82, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 1875:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1877:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1877:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 84, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 1887:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1890:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1890:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 87, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 1900:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1903:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1903:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1903:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 90, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 1913:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1916:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1916:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 93, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 1926:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1929:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1929:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 96, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 1939:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1942:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1942:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 99, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 1952:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1955:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1955:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 102, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 1965:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1968:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1968:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads in 1 processes (process vruntime = 105, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 1978:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1980:
+    THREAD_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 1980:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 107, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 1990:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1993:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1993:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 110, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 2003:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2006:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2006:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 113, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 2016:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2019:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2019:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 116, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 2029:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2032:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2032:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 119, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 2042:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2045:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2045:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 122, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 2055:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2058:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2083:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2083:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 125, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 2093:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2096:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2096:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 128, thread vruntime = 77). Will run for at most 3 ticks.
+
+At time 2106:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2109:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2109:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 131, thread vruntime = 80). Will run for at most 3 ticks.
+
+At time 2119:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2122:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2122:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 134, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 2132:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2135:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2135:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 137, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 2145:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2148:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2148:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 140, thread vruntime = 89). Will run for at most 3 ticks.
+
+At time 2158:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2161:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2161:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 143, thread vruntime = 92). Will run for at most 3 ticks.
+
+At time 2171:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2174:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2174:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 146, thread vruntime = 95). Will run for at most 3 ticks.
+
+At time 2184:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2187:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2209:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2209:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 149, thread vruntime = 98). Will run for at most 3 ticks.
+
+At time 2219:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2220:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2234:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2234:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 150, thread vruntime = 99). Will run for at most 3 ticks.
+
+At time 2244:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2247:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2247:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 153, thread vruntime = 102). Will run for at most 3 ticks.
+
+At time 2257:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2260:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2260:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 156, thread vruntime = 105). Will run for at most 3 ticks.
+
+At time 2270:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2273:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2273:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 159, thread vruntime = 108). Will run for at most 3 ticks.
+
+At time 2283:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2286:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2286:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 162, thread vruntime = 111). Will run for at most 3 ticks.
+
+At time 2296:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2299:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2299:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 165, thread vruntime = 114). Will run for at most 3 ticks.
+
+At time 2309:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2312:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2312:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 168, thread vruntime = 117). Will run for at most 3 ticks.
+
+At time 2322:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2325:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2325:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 171, thread vruntime = 120). Will run for at most 3 ticks.
+
+At time 2335:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2338:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2338:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 174, thread vruntime = 123). Will run for at most 3 ticks.
+
+At time 2348:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2351:
+    THREAD_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             45
+    Process switches:            34
+    Dispatch time saved:       1665
+
+MAX READY WAIT:
+    SYSTEM:                     296
+    INTERACTIVE:                  0
+    NORMAL:                     110
+    BATCH:                        0
+
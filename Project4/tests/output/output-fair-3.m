@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      221.00
+    Avg. turnaround time:  11894.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      417.25
+    Avg. turnaround time:  12904.50
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      310.75
+    Avg. turnaround time:  13090.25
+
+Total elapsed time:          19796
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         18669
+Total idle time:                 0
+
+CPU utilization:           100.00%
+CPU efficiency:              5.69%
+
@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 12815  END: 12863 
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 7592   END: 7602  
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 11894  END: 11976 
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 604    END: 662   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 15014  END: 15042 
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 13235  END: 13268 
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 19681  END: 19681 
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 16477  END: 16530 
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 8611   END: 8669  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 16916  END: 16986 
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 19749  END: 19796 
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 5358   END: 5397  
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 19545  END: 19632 
+
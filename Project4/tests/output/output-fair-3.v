@@ -0,0 +1,6317 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads in 1 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 10:
+    THREAD_ARRIVED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from NEW to READY
+
+At time 28:
+    THREAD_ARRIVED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    THREAD_ARRIVED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 51:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 51:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 7 threads in 5 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 53:
+    THREAD_ARRIVED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 70:
+    THREAD_ARRIVED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 82:
+    THREAD_ARRIVED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 87:
+    THREAD_ARRIVED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 99:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 102:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 102:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 13 threads in 6 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 150:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 153:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 153:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 13 threads in 6 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 201:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 204:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 204:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 13 threads in 6 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 255:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 255:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 13 threads in 6 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 303:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 306:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 306:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 13 threads in 6 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 354:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 357:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 357:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 13 threads in 6 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 405:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 408:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 408:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 13 threads in 6 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 456:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 459:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 459:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 13 threads in 6 processes (process vruntime = 3, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 507:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 510:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 510:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 13 threads in 6 processes (process vruntime = 3, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 558:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 561:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 561:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 13 threads in 6 processes (process vruntime = 3, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 609:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 612:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 612:
+    DISPATCHER_INVOKED
+    Thread 0 in process 395 [NORMAL]
+    Selected from 13 threads in 6 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 660:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 662:
+    THREAD_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 662:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 710:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 713:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 713:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 761:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 764:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 764:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 6, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 812:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 815:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 815:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 6, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 863:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 866:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 866:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 6, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 914:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 917:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 917:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 8, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 965:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 968:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 968:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 9, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 991:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1016:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1019:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1019:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 9, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1067:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1070:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1070:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 9, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 1118:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1121:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1121:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 9, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 1169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1172:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1172:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 9, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 1220:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1223:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1223:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 11, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1271:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1274:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1274:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 12, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1325:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1325:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 12, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1373:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1376:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1376:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 12, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 1424:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1427:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1427:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 12, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 1475:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1478:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1478:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 12, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 1526:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1529:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1529:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 14, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 1577:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1580:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1580:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 15, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1628:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1631:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1631:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 15, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1679:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1682:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1682:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 15, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 1730:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1733:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1733:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 15, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 1781:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1784:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1784:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 15, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 1832:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1835:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1835:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 17, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 1883:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1886:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1886:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 18, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1934:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1937:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1937:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 18, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 1985:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1988:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1988:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 18, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 2036:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2039:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2039:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 18, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 2087:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2090:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2090:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 18, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 2138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2141:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2141:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads in 5 processes (process vruntime = 20, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 2144:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2189:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2192:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2192:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 21, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2240:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2243:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2243:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 21, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 2291:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2294:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2294:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 21, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 2342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2345:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2345:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 21, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 2393:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2396:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2396:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 21, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 2444:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2447:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2447:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 23, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 2495:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2498:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2498:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 24, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 2546:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2549:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2549:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 24, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 2597:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2600:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2600:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 24, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 2648:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2651:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2651:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads in 5 processes (process vruntime = 24, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 2667:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2699:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2702:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2702:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 24, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 2750:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2753:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2753:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 26, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 2801:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2804:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2804:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 27, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 2821:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2852:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2855:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2855:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 27, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 2903:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2906:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2906:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 27, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 2954:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2957:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2957:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 27, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 3005:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3007:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3007:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads in 5 processes (process vruntime = 27, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 3037:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3055:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3058:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3058:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 29, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 3106:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3109:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3109:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 29, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 3157:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3160:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3160:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 30, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3208:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3211:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3211:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 30, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 3259:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3261:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3261:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 30, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 3274:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3309:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3312:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3312:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 30, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 3360:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3363:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3363:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 32, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 3411:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3414:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3414:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 32, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 3462:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3465:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3465:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 32, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 3478:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3513:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3514:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3514:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads in 5 processes (process vruntime = 33, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3543:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3562:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3565:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3565:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 33, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 3613:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3616:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3616:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 33, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 3664:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3665:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3665:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads in 5 processes (process vruntime = 33, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 3672:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3713:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3716:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3716:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 34, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 3764:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3767:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3767:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 35, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 3815:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3818:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3818:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 35, thread vruntime = 11). Will run for at most 3 ticks.
+
+At time 3866:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3869:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3869:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 36, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 3917:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3920:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3920:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 36, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 3968:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3971:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3971:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 36, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 4019:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4022:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4022:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 37, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 4070:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4073:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4073:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 38, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 4121:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4124:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4124:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 38, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 4172:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4175:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4175:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 39, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4223:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4226:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4226:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 39, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 4274:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4277:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4277:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 39, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 4325:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4328:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4328:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 40, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 4376:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4379:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4379:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 41, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 4427:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4430:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4430:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 41, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 4478:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4481:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4481:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 42, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4529:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4531:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4531:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 42, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 4539:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4579:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4582:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4582:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 42, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 4630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4633:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4633:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 43, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 4681:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4684:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4684:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 44, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 4732:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4735:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4735:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 44, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4783:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4786:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4786:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 44, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 4834:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4837:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4837:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 45, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 4885:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4888:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4888:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 45, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 4936:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4939:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4939:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 46, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 4987:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4990:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4990:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 47, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 5038:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5041:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5041:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 47, thread vruntime = 11). Will run for at most 3 ticks.
+
+At time 5089:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5092:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5092:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 47, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 5140:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5143:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5143:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads in 6 processes (process vruntime = 48, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 5191:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5194:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5194:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 48, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 5242:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5245:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5245:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads in 6 processes (process vruntime = 49, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 5293:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5296:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5296:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 50, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 5344:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5347:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5347:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads in 6 processes (process vruntime = 50, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5395:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5397:
+    THREAD_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 5397:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 50, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 5445:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5446:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5446:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads in 6 processes (process vruntime = 51, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 5465:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5468:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5468:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads in 6 processes (process vruntime = 51, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 5472:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 5516:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5519:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5519:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 51, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 5567:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5570:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5570:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 52, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5618:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5621:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5621:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads in 6 processes (process vruntime = 52, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 5669:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5672:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5672:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 53, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 5720:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5723:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5723:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 54, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 5771:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5774:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5774:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 54, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 5822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5823:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5823:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 54, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 5851:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 5871:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5874:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5874:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 55, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5875:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5922:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5925:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5925:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads in 6 processes (process vruntime = 55, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 5973:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5976:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5976:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 55, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 6024:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6027:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6027:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 56, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 6075:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6078:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6078:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 57, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 6126:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6127:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6127:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads in 6 processes (process vruntime = 57, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 6149:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 6175:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6178:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6178:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 58, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 6226:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6229:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6229:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 58, thread vruntime = 19). Will run for at most 3 ticks.
+
+At time 6277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6280:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6280:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads in 6 processes (process vruntime = 58, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 6328:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6331:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6331:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads in 5 processes (process vruntime = 58, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 6334:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 6379:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6382:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6382:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 59, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 6430:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6433:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6433:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads in 6 processes (process vruntime = 60, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 6453:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6481:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6484:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6484:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 61, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6532:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6535:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6535:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 61, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 6583:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6586:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6586:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads in 6 processes (process vruntime = 61, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 6634:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6636:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6636:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads in 5 processes (process vruntime = 61, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 6660:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 6684:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6687:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6687:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 62, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 6735:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6738:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6738:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 63, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 6786:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6789:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6789:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads in 6 processes (process vruntime = 63, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 6837:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6840:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6840:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 64, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6888:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6891:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6891:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 64, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 6939:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6942:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6942:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 64, thread vruntime = 64). Will run for at most 3 ticks.
+
+At time 6990:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6993:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6993:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 65, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 7041:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7044:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7044:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 66, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 7092:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7095:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7095:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads in 6 processes (process vruntime = 66, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 7143:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7146:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 7146:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 67, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 7194:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7197:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7197:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 67, thread vruntime = 22). Will run for at most 3 ticks.
+
+At time 7245:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7248:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7248:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 67, thread vruntime = 67). Will run for at most 3 ticks.
+
+At time 7296:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7299:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7299:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 68, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 7347:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7350:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7350:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 69, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 7398:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7400:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7400:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads in 5 processes (process vruntime = 69, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 7429:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7448:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7451:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 7451:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads in 6 processes (process vruntime = 70, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 7499:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7502:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7502:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 70, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 7550:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7553:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7553:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads in 6 processes (process vruntime = 70, thread vruntime = 70). Will run for at most 3 ticks.
+
+At time 7601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7602:
+    THREAD_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 7602:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 71, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 7650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7653:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7653:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 71, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 7701:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7704:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7704:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads in 5 processes (process vruntime = 72, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 7752:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7755:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 7755:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 73, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 7803:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7806:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7806:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 10 threads in 5 processes (process vruntime = 73, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 7854:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 7857:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 7857:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 74, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 7905:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7908:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7908:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 74, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 7956:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7959:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7959:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 4 processes (process vruntime = 75, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 7960:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 8007:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8010:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8010:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 76, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 8058:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8061:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8061:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads in 5 processes (process vruntime = 76, thread vruntime = 25). Will run for at most 3 ticks.
+
+At time 8109:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8112:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8112:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 77, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 8160:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8163:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8163:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 77, thread vruntime = 77). Will run for at most 3 ticks.
+
+At time 8211:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8214:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8214:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads in 5 processes (process vruntime = 78, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 8262:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8265:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8265:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 79, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 8313:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8316:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8316:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads in 5 processes (process vruntime = 79, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 8364:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8367:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8367:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 80, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 8415:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8416:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8416:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 80, thread vruntime = 80). Will run for at most 3 ticks.
+
+At time 8432:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 8464:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8467:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8467:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 81, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 8515:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8518:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8518:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads in 5 processes (process vruntime = 81, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 8566:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8569:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8569:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads in 5 processes (process vruntime = 82, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 8617:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8620:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8620:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 10 threads in 5 processes (process vruntime = 82, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 8668:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8669:
+    THREAD_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 8669:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 83, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 8688:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8691:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8691:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 83, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 8739:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8742:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8742:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 84, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 8790:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8791:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8791:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 8 threads in 5 processes (process vruntime = 84, thread vruntime = 84). Will run for at most 3 ticks.
+
+At time 8815:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 8839:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8842:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8842:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 85, thread vruntime = 41). Will run for at most 3 ticks.
+
+At time 8890:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8893:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8893:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 85, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 8941:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8944:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8944:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 86, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 8992:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8995:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8995:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 86, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 9043:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9044:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9044:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 8 threads in 4 processes (process vruntime = 87, thread vruntime = 87). Will run for at most 3 ticks.
+
+At time 9050:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9092:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9095:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 9095:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 87, thread vruntime = 87). Will run for at most 3 ticks.
+
+At time 9143:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9146:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9146:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 88, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 9194:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9197:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9197:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 88, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 9245:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9248:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9248:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 89, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 9296:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9299:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9299:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 90, thread vruntime = 90). Will run for at most 3 ticks.
+
+At time 9347:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9350:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9350:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 90, thread vruntime = 90). Will run for at most 3 ticks.
+
+At time 9356:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 9398:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9401:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9401:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 91, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 9449:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9452:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9452:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 91, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 9500:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9503:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9503:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 92, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 9551:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9552:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9552:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads in 5 processes (process vruntime = 93, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 9565:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 9571:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9574:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9574:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 93, thread vruntime = 93). Will run for at most 3 ticks.
+
+At time 9622:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9625:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9625:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 93, thread vruntime = 93). Will run for at most 3 ticks.
+
+At time 9640:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 9673:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9676:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9676:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 94, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 9724:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9727:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9727:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 94, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 9775:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9778:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9778:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 96, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 9826:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9829:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9829:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 96, thread vruntime = 96). Will run for at most 3 ticks.
+
+At time 9877:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9880:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 9880:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 96, thread vruntime = 96). Will run for at most 3 ticks.
+
+At time 9928:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9931:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9931:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 97, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 9979:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9982:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9982:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 97, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 10030:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10031:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10031:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads in 5 processes (process vruntime = 98, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 10049:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10050:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10053:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10053:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads in 5 processes (process vruntime = 99, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 10056:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10101:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10104:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10104:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 99, thread vruntime = 99). Will run for at most 3 ticks.
+
+At time 10152:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 10155:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 10155:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 99, thread vruntime = 99). Will run for at most 3 ticks.
+
+At time 10203:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10206:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10206:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 100, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 10254:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10257:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10257:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 101, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 10305:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10308:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10308:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 102, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 10356:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10358:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10358:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 8 threads in 5 processes (process vruntime = 102, thread vruntime = 102). Will run for at most 3 ticks.
+
+At time 10380:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 10406:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 10409:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 10409:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 102, thread vruntime = 102). Will run for at most 3 ticks.
+
+At time 10457:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10460:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10460:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 103, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 10508:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10511:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10511:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads in 5 processes (process vruntime = 104, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 10540:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10559:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10562:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10562:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 104, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 10610:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10613:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10613:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 105, thread vruntime = 105). Will run for at most 3 ticks.
+
+At time 10661:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 10664:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 10664:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 105, thread vruntime = 105). Will run for at most 3 ticks.
+
+At time 10712:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10715:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10715:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 106, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 10763:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10766:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10766:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 107, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 10814:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10817:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10817:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 107, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 10865:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10868:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10868:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 108, thread vruntime = 108). Will run for at most 3 ticks.
+
+At time 10916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 10919:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 10919:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 108, thread vruntime = 108). Will run for at most 3 ticks.
+
+At time 10967:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10970:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10970:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 109, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 11018:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11019:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11019:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 8 threads in 5 processes (process vruntime = 110, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 11025:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11038:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11040:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11040:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads in 5 processes (process vruntime = 110, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 11048:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11088:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11091:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11091:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 110, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 11139:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11142:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11142:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 111, thread vruntime = 111). Will run for at most 3 ticks.
+
+At time 11190:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 11193:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 11193:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 111, thread vruntime = 111). Will run for at most 3 ticks.
+
+At time 11241:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11244:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11244:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 112, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 11263:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11295:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11295:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 113, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 11343:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11346:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11346:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 113, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 11394:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11397:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11397:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 114, thread vruntime = 114). Will run for at most 3 ticks.
+
+At time 11445:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 11448:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 11448:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 114, thread vruntime = 114). Will run for at most 3 ticks.
+
+At time 11496:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11499:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11499:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 115, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 11547:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11550:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11550:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 116, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 11598:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11601:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11601:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 116, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 11649:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11652:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11652:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 117, thread vruntime = 117). Will run for at most 3 ticks.
+
+At time 11700:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 11703:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 11703:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 117, thread vruntime = 117). Will run for at most 3 ticks.
+
+At time 11751:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11754:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11754:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 118, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 11802:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11805:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11805:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads in 5 processes (process vruntime = 119, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 11853:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11856:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11856:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads in 5 processes (process vruntime = 119, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 11904:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11905:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11905:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 8 threads in 5 processes (process vruntime = 120, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 11924:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11925:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 11927:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11927:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads in 5 processes (process vruntime = 120, thread vruntime = 120). Will run for at most 3 ticks.
+
+At time 11975:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 11976:
+    THREAD_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 11976:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 120, thread vruntime = 120). Will run for at most 3 ticks.
+
+At time 12024:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12027:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12027:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 121, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 12075:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12078:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12078:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 122, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 12126:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12129:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12129:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads in 4 processes (process vruntime = 123, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 12177:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12180:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12180:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 123, thread vruntime = 123). Will run for at most 3 ticks.
+
+At time 12228:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12231:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12231:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 124, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 12279:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12282:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12282:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 125, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 12330:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12333:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12333:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 8 threads in 4 processes (process vruntime = 126, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 12381:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12384:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12384:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 126, thread vruntime = 126). Will run for at most 3 ticks.
+
+At time 12432:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12435:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12435:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 127, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 12483:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12486:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12486:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 128, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 12534:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12537:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12537:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads in 4 processes (process vruntime = 129, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 12585:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12588:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12588:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 129, thread vruntime = 129). Will run for at most 3 ticks.
+
+At time 12636:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12639:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12639:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 130, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 12687:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12690:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12690:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 131, thread vruntime = 38). Will run for at most 3 ticks.
+
+At time 12738:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12739:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12739:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 132, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 12758:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12760:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 12761:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12761:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 8 threads in 4 processes (process vruntime = 132, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 12809:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12812:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12812:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 132, thread vruntime = 132). Will run for at most 3 ticks.
+
+At time 12860:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12863:
+    THREAD_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 12863:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 7 threads in 3 processes (process vruntime = 133, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 12911:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12914:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12914:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 7 threads in 3 processes (process vruntime = 135, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 12962:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12963:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12963:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 135, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 12973:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13011:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13014:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13014:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 7 threads in 3 processes (process vruntime = 136, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 13062:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13065:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13065:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 7 threads in 3 processes (process vruntime = 136, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 13113:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13116:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13116:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 7 threads in 3 processes (process vruntime = 138, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 13164:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13167:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13167:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 7 threads in 3 processes (process vruntime = 139, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 13215:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13218:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13218:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 7 threads in 3 processes (process vruntime = 139, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 13266:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13268:
+    THREAD_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 13268:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 141, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 13287:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13290:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13290:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 141, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 13338:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13341:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13341:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 142, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 13389:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13392:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13392:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 144, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 13440:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13443:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13443:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 144, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 13491:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13494:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13494:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 145, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 13542:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13545:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13545:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 147, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 13593:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13596:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13596:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 147, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 13644:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13647:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13647:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 148, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 13695:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13698:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13698:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 150, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 13746:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13749:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13749:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 150, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 13797:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13800:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13800:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 151, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 13848:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13851:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13851:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 153, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 13899:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13902:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13902:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 153, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 13950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13953:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13953:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 154, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 13957:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14001:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14002:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14002:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 155, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 14010:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14021:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14024:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14024:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 156, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 14072:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14075:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14075:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 156, thread vruntime = 84). Will run for at most 3 ticks.
+
+At time 14105:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 14123:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14126:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14126:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 158, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 14174:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14177:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14177:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 159, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 14225:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14227:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14227:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 159, thread vruntime = 87). Will run for at most 3 ticks.
+
+At time 14240:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 14275:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14278:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14278:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 161, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 14326:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14329:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14329:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 161, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 14377:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14380:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14380:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 162, thread vruntime = 90). Will run for at most 3 ticks.
+
+At time 14428:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14431:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14431:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 164, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 14479:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14482:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14482:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 164, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 14530:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14533:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14533:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 165, thread vruntime = 93). Will run for at most 3 ticks.
+
+At time 14581:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14584:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14584:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 167, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 14632:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14635:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14635:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 167, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 14683:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14686:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14686:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 168, thread vruntime = 96). Will run for at most 3 ticks.
+
+At time 14734:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14737:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14737:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 170, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 14785:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14788:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14788:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 6 threads in 3 processes (process vruntime = 170, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 14836:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14839:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14839:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 171, thread vruntime = 99). Will run for at most 3 ticks.
+
+At time 14887:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14890:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14890:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 173, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 14938:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14940:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14940:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 5 threads in 3 processes (process vruntime = 173, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 14964:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14988:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14991:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14991:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 174, thread vruntime = 102). Will run for at most 3 ticks.
+
+At time 14999:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 15039:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15042:
+    THREAD_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 15042:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 175, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 15090:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15093:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15093:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 5 threads in 2 processes (process vruntime = 176, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 15141:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15144:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15144:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 178, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 15192:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15193:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15193:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 179, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 15212:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15215:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15215:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads in 2 processes (process vruntime = 179, thread vruntime = 77). Will run for at most 3 ticks.
+
+At time 15221:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 15263:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15266:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15266:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 182, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 15314:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15317:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15317:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 5 threads in 2 processes (process vruntime = 182, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 15365:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15368:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15368:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 185, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 15416:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15419:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15419:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 5 threads in 2 processes (process vruntime = 185, thread vruntime = 80). Will run for at most 3 ticks.
+
+At time 15467:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15470:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15470:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 188, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 15518:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15521:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15521:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 5 threads in 2 processes (process vruntime = 188, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 15569:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15571:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15571:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads in 2 processes (process vruntime = 190, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 15574:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 15590:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15593:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15593:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 191, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 15641:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15644:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15644:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 5 threads in 2 processes (process vruntime = 193, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 15692:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15695:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15695:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 194, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 15743:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15746:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15746:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads in 2 processes (process vruntime = 196, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 15761:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 15794:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15797:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15797:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 197, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 15845:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15848:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15848:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 5 threads in 2 processes (process vruntime = 199, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 15896:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15899:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15899:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 200, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 15947:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15949:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15949:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 202, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 15968:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15971:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15971:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads in 2 processes (process vruntime = 202, thread vruntime = 89). Will run for at most 3 ticks.
+
+At time 15975:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16019:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16022:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16022:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 205, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 16070:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16073:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16073:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 5 threads in 2 processes (process vruntime = 205, thread vruntime = 89). Will run for at most 3 ticks.
+
+At time 16121:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16124:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16124:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 208, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 16172:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16175:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16175:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 5 threads in 2 processes (process vruntime = 208, thread vruntime = 92). Will run for at most 3 ticks.
+
+At time 16223:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16226:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16226:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 211, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 16274:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16277:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16277:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 4 threads in 2 processes (process vruntime = 211, thread vruntime = 92). Will run for at most 3 ticks.
+
+At time 16286:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16325:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16328:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16328:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 214, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 16376:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16378:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16378:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads in 2 processes (process vruntime = 214, thread vruntime = 95). Will run for at most 3 ticks.
+
+At time 16399:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16426:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16429:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16429:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 5 threads in 2 processes (process vruntime = 216, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 16477:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16480:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16480:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 5 threads in 2 processes (process vruntime = 217, thread vruntime = 95). Will run for at most 3 ticks.
+
+At time 16528:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16530:
+    THREAD_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 16530:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 219, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 16578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16581:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16581:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 219, thread vruntime = 98). Will run for at most 3 ticks.
+
+At time 16605:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16629:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16630:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16630:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 3 threads in 1 processes (process vruntime = 222, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 16654:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 16678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16681:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16681:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads in 2 processes (process vruntime = 222, thread vruntime = 99). Will run for at most 3 ticks.
+
+At time 16729:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16732:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16732:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 225, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 16780:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16783:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16783:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 225, thread vruntime = 102). Will run for at most 3 ticks.
+
+At time 16792:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16831:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16834:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16834:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 228, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 16882:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16885:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16885:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads in 2 processes (process vruntime = 228, thread vruntime = 105). Will run for at most 3 ticks.
+
+At time 16933:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16935:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16935:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 3 threads in 1 processes (process vruntime = 231, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 16942:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 16983:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16986:
+    THREAD_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 16986:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 231, thread vruntime = 107). Will run for at most 3 ticks.
+
+At time 17034:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17037:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17037:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 234, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 17085:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17088:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17088:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 234, thread vruntime = 110). Will run for at most 3 ticks.
+
+At time 17136:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17139:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17139:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 237, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 17187:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17190:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17190:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 237, thread vruntime = 113). Will run for at most 3 ticks.
+
+At time 17238:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17241:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17241:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 240, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 17289:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17292:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17292:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 240, thread vruntime = 116). Will run for at most 3 ticks.
+
+At time 17340:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17343:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17343:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 243, thread vruntime = 77). Will run for at most 3 ticks.
+
+At time 17391:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17394:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17394:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 243, thread vruntime = 119). Will run for at most 3 ticks.
+
+At time 17442:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17445:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17445:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 246, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 17493:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17496:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17496:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 246, thread vruntime = 122). Will run for at most 3 ticks.
+
+At time 17544:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17547:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17547:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 249, thread vruntime = 80). Will run for at most 3 ticks.
+
+At time 17595:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17598:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17598:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 249, thread vruntime = 125). Will run for at most 3 ticks.
+
+At time 17646:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17649:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17649:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 252, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 17697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17700:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17700:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 252, thread vruntime = 128). Will run for at most 3 ticks.
+
+At time 17748:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17751:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17751:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 255, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 17799:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17802:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17802:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 255, thread vruntime = 131). Will run for at most 3 ticks.
+
+At time 17850:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17853:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 17853:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 258, thread vruntime = 84). Will run for at most 3 ticks.
+
+At time 17901:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17904:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17904:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 258, thread vruntime = 134). Will run for at most 3 ticks.
+
+At time 17952:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 17953:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17953:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 2 threads in 1 processes (process vruntime = 261, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 17977:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 18001:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18004:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18004:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 261, thread vruntime = 135). Will run for at most 3 ticks.
+
+At time 18052:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18055:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 18055:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 264, thread vruntime = 87). Will run for at most 3 ticks.
+
+At time 18103:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18106:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18106:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 264, thread vruntime = 138). Will run for at most 3 ticks.
+
+At time 18154:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18157:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 18157:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 267, thread vruntime = 89). Will run for at most 3 ticks.
+
+At time 18205:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18208:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18208:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 267, thread vruntime = 141). Will run for at most 3 ticks.
+
+At time 18256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18259:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 18259:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 270, thread vruntime = 90). Will run for at most 3 ticks.
+
+At time 18307:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18308:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18308:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads in 2 processes (process vruntime = 270, thread vruntime = 144). Will run for at most 3 ticks.
+
+At time 18310:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18356:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18359:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 18359:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 271, thread vruntime = 91). Will run for at most 3 ticks.
+
+At time 18407:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18410:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18410:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 273, thread vruntime = 147). Will run for at most 3 ticks.
+
+At time 18458:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18461:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 18461:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 274, thread vruntime = 92). Will run for at most 3 ticks.
+
+At time 18509:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18512:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18512:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 276, thread vruntime = 150). Will run for at most 3 ticks.
+
+At time 18560:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18562:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18562:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 2 threads in 1 processes (process vruntime = 277, thread vruntime = 94). Will run for at most 3 ticks.
+
+At time 18572:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 18610:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18613:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18613:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 278, thread vruntime = 152). Will run for at most 3 ticks.
+
+At time 18661:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18664:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 18664:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 280, thread vruntime = 95). Will run for at most 3 ticks.
+
+At time 18712:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18714:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18714:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads in 2 processes (process vruntime = 281, thread vruntime = 155). Will run for at most 3 ticks.
+
+At time 18742:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18762:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18765:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 18765:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 282, thread vruntime = 97). Will run for at most 3 ticks.
+
+At time 18813:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18816:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18816:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 284, thread vruntime = 158). Will run for at most 3 ticks.
+
+At time 18864:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18867:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 18867:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 285, thread vruntime = 97). Will run for at most 3 ticks.
+
+At time 18915:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18918:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18918:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 287, thread vruntime = 161). Will run for at most 3 ticks.
+
+At time 18966:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 18969:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 18969:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 288, thread vruntime = 100). Will run for at most 3 ticks.
+
+At time 19017:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19020:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19020:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 290, thread vruntime = 164). Will run for at most 3 ticks.
+
+At time 19068:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 19071:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 19071:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 291, thread vruntime = 100). Will run for at most 3 ticks.
+
+At time 19119:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19122:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19122:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 293, thread vruntime = 167). Will run for at most 3 ticks.
+
+At time 19170:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 19173:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 19173:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 294, thread vruntime = 103). Will run for at most 3 ticks.
+
+At time 19221:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19224:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19224:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 296, thread vruntime = 170). Will run for at most 3 ticks.
+
+At time 19272:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 19275:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 19275:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 297, thread vruntime = 103). Will run for at most 3 ticks.
+
+At time 19323:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19326:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19326:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 299, thread vruntime = 173). Will run for at most 3 ticks.
+
+At time 19374:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 19377:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 19377:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 300, thread vruntime = 106). Will run for at most 3 ticks.
+
+At time 19425:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19428:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19428:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 302, thread vruntime = 176). Will run for at most 3 ticks.
+
+At time 19476:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 19479:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 19479:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads in 2 processes (process vruntime = 303, thread vruntime = 106). Will run for at most 3 ticks.
+
+At time 19527:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19530:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19530:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads in 2 processes (process vruntime = 305, thread vruntime = 179). Will run for at most 3 ticks.
+
+At time 19578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 19581:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19581:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 2 threads in 1 processes (process vruntime = 306, thread vruntime = 109). Will run for at most 3 ticks.
+
+At time 19606:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 19629:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19632:
+    THREAD_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 19632:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads in 2 processes (process vruntime = 308, thread vruntime = 182). Will run for at most 3 ticks.
+
+At time 19680:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 19681:
+    THREAD_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 19681:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 309, thread vruntime = 109). Will run for at most 3 ticks.
+
+At time 19729:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19732:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19732:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 312, thread vruntime = 112). Will run for at most 3 ticks.
+
+At time 19751:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19754:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19754:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 315, thread vruntime = 115). Will run for at most 3 ticks.
+
+At time 19773:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19776:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19776:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 318, thread vruntime = 118). Will run for at most 3 ticks.
+
+At time 19795:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19796:
+    THREAD_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             15
+    Process switches:           383
+    Dispatch time saved:        435
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                373
+    NORMAL:                    1475
+    BATCH:                     1266
+
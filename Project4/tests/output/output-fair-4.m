@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      548.85
+    Avg. turnaround time:  23803.92
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:      622.40
+    Avg. turnaround time:  30512.80
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:          35535
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:         33336
+Total idle time:                65
+
+CPU utilization:            99.82%
+CPU efficiency:              6.01%
+
@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 13020  END: 13079 
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 27698  END: 27777 
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 35485  END: 35535 
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 29434  END: 29456 
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 32418  END: 32468 
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 30425  END: 30484 
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 32829  END: 32900 
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 29894  END: 29933 
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 27325  END: 27348 
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 31112  END: 31204 
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 28184  END: 28255 
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 16330  END: 16355 
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 26539  END: 26634 
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 28165  END: 28209 
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 21739  END: 21806 
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 16214  END: 16261 
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 31995  END: 32040 
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 27576  END: 27635 
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 31223  END: 31299 
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 34565  END: 34575 
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 14065  END: 14082 
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 25061  END: 25110 
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 23283  END: 23338 
+
@@ -0,0 +1,12082 @@
+At time 10:
+    THREAD_ARRIVED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 17:
+    THREAD_ARRIVED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 22:
+    THREAD_ARRIVED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 23:
+    THREAD_ARRIVED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 25:
+    THREAD_ARRIVED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 44:
+    THREAD_ARRIVED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 45:
+    THREAD_ARRIVED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 49:
+    THREAD_ARRIVED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    THREAD_ARRIVED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 58:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 58:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 13 threads in 7 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 67:
+    THREAD_ARRIVED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 76:
+    THREAD_ARRIVED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 79:
+    THREAD_ARRIVED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 92:
+    THREAD_ARRIVED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 95:
+    THREAD_ARRIVED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 103:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 106:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 106:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 151:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 154:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 154:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 199:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 201:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 201:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 216:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 246:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 248:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 248:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 265:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 293:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 296:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 296:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 341:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 344:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 344:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 389:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 392:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 392:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 2, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 437:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 440:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 440:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 2, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 485:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 488:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 488:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 533:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 536:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 536:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 581:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 584:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 584:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 629:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 632:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 632:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 677:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 680:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 680:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 3, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 725:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 728:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 728:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 3, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 773:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 776:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 776:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 5, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 821:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 824:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 824:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 5, thread vruntime = 2). Will run for at most 3 ticks.
+
+At time 869:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 871:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 871:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 878:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 919:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 919:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 964:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 967:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 967:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 1012:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1015:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1015:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 1060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1063:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1063:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 6, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 1108:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1111:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1111:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 6, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 1156:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1159:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1159:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 7, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1204:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1207:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1207:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 8, thread vruntime = 2). Will run for at most 3 ticks.
+
+At time 1252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1255:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1255:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 9, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1300:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1303:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1303:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 9, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 1348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1351:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1351:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 9, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1396:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1397:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1397:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 9, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1416:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1442:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1445:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1445:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 9, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 1490:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1493:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1493:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 9, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 1538:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1541:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1541:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 10, thread vruntime = 4). Will run for at most 3 ticks.
+
+At time 1586:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1589:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1589:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 10, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1634:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1637:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1637:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 11, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1682:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1685:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1685:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 12, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1730:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1733:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1733:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 12, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1778:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1781:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1781:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 12, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1826:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1827:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1827:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 12, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 1851:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1872:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1875:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1875:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 12, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 1920:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1923:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1923:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 13, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 1968:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1971:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1971:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 13, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2016:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2019:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2019:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 13, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2064:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2067:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2067:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 14, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2112:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2115:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2115:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 15, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2160:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2163:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2163:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 15, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2208:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2211:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2211:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 15, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2259:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2259:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 15, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 2304:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2307:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2307:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 16, thread vruntime = 7). Will run for at most 3 ticks.
+
+At time 2314:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2352:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2355:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2355:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 16, thread vruntime = 4). Will run for at most 3 ticks.
+
+At time 2400:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2403:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2403:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 16, thread vruntime = 4). Will run for at most 3 ticks.
+
+At time 2448:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2451:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2451:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 17, thread vruntime = 5). Will run for at most 3 ticks.
+
+At time 2496:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2499:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2499:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 18, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 2544:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2547:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2547:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 18, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2592:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2595:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2595:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 18, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2640:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2643:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2643:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 18, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 2688:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2691:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2691:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 19, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 2736:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2739:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2739:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 19, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 2784:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2787:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2787:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 19, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 2832:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2835:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2835:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 20, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 2880:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2883:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2883:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 21, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 2928:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2931:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2931:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 21, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2976:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2977:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2977:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 21, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 2998:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3022:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3025:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3025:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 21, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 3070:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3073:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3073:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 22, thread vruntime = 4). Will run for at most 3 ticks.
+
+At time 3118:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3121:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3121:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 22, thread vruntime = 10). Will run for at most 3 ticks.
+
+At time 3166:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3169:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3169:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 22, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3214:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3217:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3217:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 22, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3262:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3265:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3265:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 23, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3310:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3313:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3313:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 24, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3358:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3361:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3361:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 24, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3406:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3409:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3409:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 24, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 3454:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3457:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3457:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 25, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3502:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3505:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3505:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 25, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 3550:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3553:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3553:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 25, thread vruntime = 7). Will run for at most 3 ticks.
+
+At time 3598:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3601:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3601:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 25, thread vruntime = 7). Will run for at most 3 ticks.
+
+At time 3646:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3649:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3649:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 26, thread vruntime = 8). Will run for at most 3 ticks.
+
+At time 3694:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3697:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3697:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 27, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 3742:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3745:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3745:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 27, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3790:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3792:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3792:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 27, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 3816:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3837:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3840:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3840:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 28, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 3885:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3888:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3888:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 28, thread vruntime = 13). Will run for at most 3 ticks.
+
+At time 3933:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3936:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3936:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 28, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 3981:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3984:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3984:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 28, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4029:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4032:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4032:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 29, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4077:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4080:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4080:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 29, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 4125:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4128:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4128:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 30, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4153:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4173:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4176:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4176:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 30, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 4205:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4221:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4222:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4222:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 31, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 4249:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4267:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4269:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4269:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 31, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 4289:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4314:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4317:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4317:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 31, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4362:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4365:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4365:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 31, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4410:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4413:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4413:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 31, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 4458:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4461:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4461:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 32, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4476:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4506:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4509:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4509:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 32, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 4554:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4556:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4556:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 33, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 4576:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4604:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4604:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 33, thread vruntime = 7). Will run for at most 3 ticks.
+
+At time 4649:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4652:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4652:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 34, thread vruntime = 16). Will run for at most 3 ticks.
+
+At time 4697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4700:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4700:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 34, thread vruntime = 10). Will run for at most 3 ticks.
+
+At time 4745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4748:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4748:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 34, thread vruntime = 10). Will run for at most 3 ticks.
+
+At time 4793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4796:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4796:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 34, thread vruntime = 8). Will run for at most 3 ticks.
+
+At time 4841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4844:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4844:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 34, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 4889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4892:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4892:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 35, thread vruntime = 11). Will run for at most 3 ticks.
+
+At time 4937:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4940:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4940:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 36, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 4985:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4986:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4986:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 36, thread vruntime = 8). Will run for at most 3 ticks.
+
+At time 4996:
+    IO_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5031:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5034:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5034:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 37, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5079:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5082:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5082:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 37, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 5127:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5130:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5130:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 37, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5175:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5178:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5178:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 37, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5223:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5226:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5226:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 37, thread vruntime = 8). Will run for at most 3 ticks.
+
+At time 5271:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5274:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5274:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 37, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 5319:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5322:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5322:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 38, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5335:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5367:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5370:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5370:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 39, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 5415:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5418:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5418:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 40, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5421:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5463:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5466:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5466:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 40, thread vruntime = 19). Will run for at most 3 ticks.
+
+At time 5511:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5513:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5513:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 40, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5538:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5558:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5561:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5561:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 40, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5606:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5609:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5609:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 40, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 5654:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5657:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5657:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 40, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 5702:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5705:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5705:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 41, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 5750:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5753:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5753:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 42, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 5798:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5801:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5801:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 42, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 5846:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5848:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5848:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 43, thread vruntime = 13). Will run for at most 3 ticks.
+
+At time 5851:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5893:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5896:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5896:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 43, thread vruntime = 13). Will run for at most 3 ticks.
+
+At time 5941:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5944:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5944:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 43, thread vruntime = 13). Will run for at most 3 ticks.
+
+At time 5989:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5992:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5992:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 43, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 6022:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6037:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6040:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6040:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 43, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 6085:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6088:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6088:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 44, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 6133:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6136:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6136:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 44, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 6144:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6184:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6184:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 45, thread vruntime = 10). Will run for at most 3 ticks.
+
+At time 6229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6231:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6231:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 46, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6235:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6276:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6279:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6279:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 46, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6324:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6327:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6327:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 46, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6372:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6375:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6375:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 46, thread vruntime = 11). Will run for at most 3 ticks.
+
+At time 6420:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6423:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6423:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 46, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 6468:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6471:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6471:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 47, thread vruntime = 11). Will run for at most 3 ticks.
+
+At time 6516:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6519:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6519:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 47, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6530:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6564:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6567:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6567:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 47, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 6612:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6615:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6615:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 49, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6660:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6663:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6663:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 49, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6708:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6711:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6711:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 49, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6716:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6756:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6759:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6759:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 49, thread vruntime = 11). Will run for at most 3 ticks.
+
+At time 6804:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6807:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6807:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 49, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 6852:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6855:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6855:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 50, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 6900:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6903:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6903:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 50, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 6948:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6951:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6951:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 50, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 6977:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6996:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6999:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6999:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 52, thread vruntime = 16). Will run for at most 3 ticks.
+
+At time 7012:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7044:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7047:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7047:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 52, thread vruntime = 16). Will run for at most 3 ticks.
+
+At time 7092:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7095:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7095:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 52, thread vruntime = 16). Will run for at most 3 ticks.
+
+At time 7140:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7143:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7143:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 52, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 7188:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7190:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7190:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 52, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 7202:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7235:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7238:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7238:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 53, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 7283:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7286:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7286:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 53, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 7331:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7334:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7334:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 53, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 7379:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7382:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7382:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 54, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 7427:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7430:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7430:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 55, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 7475:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7478:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7478:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 55, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 7523:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7526:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7526:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 55, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 7571:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7574:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7574:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 55, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 7619:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7622:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7622:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 56, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 7667:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7670:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7670:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 56, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 7697:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7715:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7717:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7717:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 56, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 7729:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7762:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7765:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7765:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 57, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 7810:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7813:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7813:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 58, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 7858:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7861:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7861:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 58, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 7906:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7909:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7909:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 58, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 7954:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7957:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7957:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 58, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 8002:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8005:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8005:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 58, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 8050:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8053:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8053:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 59, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 8098:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8101:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8101:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 59, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 8146:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8149:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8149:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 60, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 8194:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8197:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8197:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 61, thread vruntime = 19). Will run for at most 3 ticks.
+
+At time 8242:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8245:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8245:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 61, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 8290:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8293:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8293:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 61, thread vruntime = 19). Will run for at most 3 ticks.
+
+At time 8338:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8341:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8341:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 61, thread vruntime = 19). Will run for at most 3 ticks.
+
+At time 8386:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8389:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8389:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 61, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 8434:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8437:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8437:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 62, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 8482:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8485:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8485:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 62, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 8530:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8533:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8533:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 63, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 8578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8581:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8581:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 64, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 8626:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8629:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8629:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 64, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 8674:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8677:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8677:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 64, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 8722:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8725:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8725:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 64, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 8770:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8772:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8772:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 64, thread vruntime = 64). Will run for at most 3 ticks.
+
+At time 8779:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 8817:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8820:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8820:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 65, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 8865:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8868:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8868:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 65, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 8913:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8916:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8916:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 66, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 8961:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8964:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8964:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 66, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 9009:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9012:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9012:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 67, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 9057:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9058:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9058:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 67, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 9088:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9103:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9106:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9106:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 67, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 9151:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9154:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9154:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 67, thread vruntime = 67). Will run for at most 3 ticks.
+
+At time 9199:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9201:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9201:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 68, thread vruntime = 22). Will run for at most 3 ticks.
+
+At time 9219:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9246:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9249:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9249:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 68, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 9294:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9297:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9297:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 68, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 9342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9344:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9344:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 69, thread vruntime = 22). Will run for at most 3 ticks.
+
+At time 9374:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9389:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9392:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9392:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 69, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 9437:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9440:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9440:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 69, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 9485:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9488:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9488:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 70, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 9533:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9536:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9536:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 70, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 9581:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9582:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9582:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 70, thread vruntime = 22). Will run for at most 3 ticks.
+
+At time 9596:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9627:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9628:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9628:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 71, thread vruntime = 22). Will run for at most 3 ticks.
+
+At time 9652:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9673:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9676:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9676:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 71, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 9721:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9724:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9724:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 71, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 9769:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9772:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9772:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 71, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 9817:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9820:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9820:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 72, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 9865:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9868:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9868:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 72, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 9913:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9916:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9916:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 72, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 9961:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9964:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9964:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 73, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 9973:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10009:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10012:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10012:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 74, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 10057:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10060:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10060:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 74, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 10105:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10108:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10108:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 74, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 10153:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10156:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10156:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 74, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 10201:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10204:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10204:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 75, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 10249:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10251:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10251:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 75, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 10277:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10296:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10297:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10297:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 75, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 10312:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10345:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10345:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 76, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 10390:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10393:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10393:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 76, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 10438:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10441:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10441:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 77, thread vruntime = 25). Will run for at most 3 ticks.
+
+At time 10486:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10489:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10489:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 77, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 10534:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10537:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10537:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 77, thread vruntime = 38). Will run for at most 3 ticks.
+
+At time 10582:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10585:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10585:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 77, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 10630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10633:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10633:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 77, thread vruntime = 25). Will run for at most 3 ticks.
+
+At time 10647:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10681:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10681:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 78, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 10726:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10729:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10729:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 79, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 10774:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10777:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10777:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 79, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 10822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10825:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10825:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 80, thread vruntime = 25). Will run for at most 3 ticks.
+
+At time 10870:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10871:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10871:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 80, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 10898:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10919:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10919:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 80, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 10964:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10967:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10967:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 80, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 11012:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11015:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11015:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 80, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 11060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11063:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11063:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 81, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 11108:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11111:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11111:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 81, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 11156:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11159:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11159:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 82, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 11204:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11207:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11207:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 82, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 11252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11255:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11255:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 83, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 11300:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11303:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11303:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 83, thread vruntime = 41). Will run for at most 3 ticks.
+
+At time 11348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11351:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11351:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 83, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 11396:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11399:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11399:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads in 8 processes (process vruntime = 83, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 11414:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11444:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11447:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11447:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 84, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 11492:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11495:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11495:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 84, thread vruntime = 84). Will run for at most 3 ticks.
+
+At time 11540:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11543:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11543:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 85, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 11588:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11591:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11591:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 85, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 11636:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11639:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11639:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 86, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 11684:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11687:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11687:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 86, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 11732:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11735:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11735:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 86, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 11780:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11783:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11783:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 86, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 11828:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11831:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11831:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 87, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 11876:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11879:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11879:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 87, thread vruntime = 87). Will run for at most 3 ticks.
+
+At time 11924:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11927:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11927:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 88, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 11972:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11975:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11975:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 88, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 12020:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12023:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12023:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 89, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 12068:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12071:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12071:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 89, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 12116:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12119:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12119:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads in 8 processes (process vruntime = 89, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 12122:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 12164:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12167:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12167:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 89, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 12212:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12215:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12215:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 90, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 12260:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12263:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12263:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 90, thread vruntime = 90). Will run for at most 3 ticks.
+
+At time 12308:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12311:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12311:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 91, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 12356:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12359:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12359:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 91, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 12404:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12407:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12407:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 92, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 12452:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12455:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12455:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 92, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 12500:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12503:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12503:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 92, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 12548:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12551:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12551:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 92, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 12596:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12599:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12599:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 93, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 12644:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12647:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12647:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 93, thread vruntime = 93). Will run for at most 3 ticks.
+
+At time 12692:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12695:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12695:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 94, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 12740:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12743:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12743:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 94, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 12788:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12791:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12791:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 95, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 12836:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12839:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12839:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 95, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 12884:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12887:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12887:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads in 8 processes (process vruntime = 95, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 12932:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12935:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12935:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 95, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 12980:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12983:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12983:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 96, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 13028:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13031:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13031:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads in 8 processes (process vruntime = 96, thread vruntime = 96). Will run for at most 3 ticks.
+
+At time 13076:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13079:
+    THREAD_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 13079:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 97, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 13124:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13127:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13127:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 97, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 13172:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13175:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13175:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 98, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 13220:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13223:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13223:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 98, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 13268:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13270:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13270:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 98, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 13276:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13315:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13318:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13318:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 98, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 13363:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13364:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13364:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 99, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 13371:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13412:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13412:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 99, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 13457:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13460:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13460:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 100, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 13505:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13508:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13508:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 100, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 13553:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13556:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13556:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 100, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 13601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13604:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13604:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 101, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 13649:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13652:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13652:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 101, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 13697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13700:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13700:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 102, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 13745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13748:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13748:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 102, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 13793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13796:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13796:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 103, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 13841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13844:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13844:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 103, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 13889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13892:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13892:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 103, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 13937:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13940:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13940:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads in 7 processes (process vruntime = 104, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 13985:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13988:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13988:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads in 7 processes (process vruntime = 104, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 14033:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14034:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14034:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 105, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 14057:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14079:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14082:
+    THREAD_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 14082:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 105, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 14127:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14130:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14130:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 105, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 14175:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14178:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14178:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 106, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 14223:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14224:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14224:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 20 threads in 7 processes (process vruntime = 106, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 14229:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14269:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14272:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14272:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 106, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 14317:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14320:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14320:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 107, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 14365:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14368:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14368:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 107, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 14413:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14415:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14415:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads in 7 processes (process vruntime = 108, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 14430:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14460:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14463:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14463:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 108, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 14508:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14511:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14511:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 108, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 14556:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14559:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14559:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 20 threads in 7 processes (process vruntime = 109, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 14588:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 14604:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14607:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14607:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 109, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 14652:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14655:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14655:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 109, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 14700:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14703:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14703:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 110, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 14748:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14751:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14751:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads in 7 processes (process vruntime = 111, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 14753:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 14796:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14798:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14798:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads in 7 processes (process vruntime = 111, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 14799:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 14843:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14846:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14846:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 111, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 14891:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14894:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14894:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 112, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 14939:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14942:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14942:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 112, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 14987:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14990:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14990:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 112, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 15035:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15038:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15038:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 113, thread vruntime = 38). Will run for at most 3 ticks.
+
+At time 15083:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15086:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15086:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 113, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 15131:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15132:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15132:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 20 threads in 7 processes (process vruntime = 114, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 15137:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 15156:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15159:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15159:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 114, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 15204:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15207:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15207:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 114, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 15252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15255:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15255:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 115, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 15300:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15303:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15303:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 115, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 15348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15351:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15351:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 115, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 15396:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15399:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15399:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 116, thread vruntime = 38). Will run for at most 3 ticks.
+
+At time 15444:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15447:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15447:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 117, thread vruntime = 28). Will run for at most 3 ticks.
+
+At time 15492:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15495:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15495:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 117, thread vruntime = 38). Will run for at most 3 ticks.
+
+At time 15540:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15541:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15541:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 20 threads in 7 processes (process vruntime = 117, thread vruntime = 38). Will run for at most 3 ticks.
+
+At time 15551:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 15586:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15589:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15589:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 118, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 15634:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15637:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15637:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 118, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 15682:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15685:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15685:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads in 7 processes (process vruntime = 118, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 15710:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 15730:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15733:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15733:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 118, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 15778:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15781:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15781:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 119, thread vruntime = 41). Will run for at most 3 ticks.
+
+At time 15826:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15829:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15829:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 120, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 15874:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15877:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15877:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 120, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 15922:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15925:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15925:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 121, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 15970:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15973:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15973:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 121, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 16018:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16021:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16021:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 121, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 16066:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16069:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16069:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads in 7 processes (process vruntime = 121, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 16114:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16117:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16117:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads in 7 processes (process vruntime = 122, thread vruntime = 41). Will run for at most 3 ticks.
+
+At time 16145:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16162:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16165:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16165:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 123, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 16210:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16213:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16213:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 21 threads in 7 processes (process vruntime = 123, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 16258:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16261:
+    THREAD_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 16261:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 20 threads in 7 processes (process vruntime = 124, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 16306:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16309:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16309:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 20 threads in 7 processes (process vruntime = 124, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 16354:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16355:
+    THREAD_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 16355:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 124, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 16400:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16403:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16403:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 124, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 16448:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16449:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16449:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 125, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 16477:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16494:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16497:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16497:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 125, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 16542:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16545:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16545:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 125, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 16590:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16593:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16593:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 126, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 16638:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16641:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16641:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 126, thread vruntime = 41). Will run for at most 3 ticks.
+
+At time 16686:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16689:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16689:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 127, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 16734:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16737:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16737:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 127, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 16751:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16782:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16785:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16785:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 128, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 16830:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16833:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16833:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 128, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 16878:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16881:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16881:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 128, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 16926:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16929:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16929:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 129, thread vruntime = 31). Will run for at most 3 ticks.
+
+At time 16974:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16977:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16977:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 129, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 17022:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17025:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17025:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 130, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 17070:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17073:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17073:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 130, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 17118:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17121:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17121:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 131, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 17166:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17169:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17169:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 131, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 17214:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17217:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17217:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 131, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 17262:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17265:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17265:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 132, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 17310:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17313:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17313:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 132, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 17358:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17361:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17361:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 133, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 17406:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17409:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17409:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 133, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 17454:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17457:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17457:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 134, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 17502:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17505:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17505:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 134, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 17512:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 17550:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17551:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17551:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 134, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 17571:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 17596:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17599:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17599:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 135, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 17644:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17647:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17647:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 135, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 17692:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17695:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17695:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 135, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 17740:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17743:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17743:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 136, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 17788:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17791:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17791:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 136, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 17836:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17839:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17839:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 137, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 17884:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17886:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17886:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 137, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 17891:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 17931:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17934:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17934:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 138, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 17979:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17982:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17982:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 138, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 18027:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18030:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18030:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 138, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 18075:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18078:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18078:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 139, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 18123:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18126:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18126:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 139, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 18171:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18173:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18173:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 139, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 18193:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18218:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18221:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18221:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 140, thread vruntime = 77). Will run for at most 3 ticks.
+
+At time 18231:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18266:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18267:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18267:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 18 threads in 6 processes (process vruntime = 141, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 18280:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 18312:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18315:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18315:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 141, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 18360:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18363:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18363:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 141, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 18408:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18411:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18411:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 141, thread vruntime = 34). Will run for at most 3 ticks.
+
+At time 18456:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18459:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18459:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 141, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 18504:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18507:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18507:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 142, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 18552:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18555:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18555:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 142, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 18600:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18603:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18603:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 144, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 18648:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18649:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18649:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 144, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 18679:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 18694:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18697:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18697:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 144, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 18742:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18745:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18745:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 144, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 18790:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18792:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18792:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 144, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 18815:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18837:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18840:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18840:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 145, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 18885:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18888:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18888:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 145, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 18933:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18936:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18936:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 145, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 18981:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18984:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18984:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 146, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 19029:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19030:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19030:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 147, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 19035:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 19075:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19078:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19078:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 147, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 19123:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19124:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19124:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 147, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 19133:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 19169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19172:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19172:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 147, thread vruntime = 84). Will run for at most 3 ticks.
+
+At time 19217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19220:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19220:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 148, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 19265:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19268:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19268:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 148, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 19313:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19316:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19316:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 148, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 19361:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19364:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19364:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 148, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 19409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19412:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19412:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 150, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 19457:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19460:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19460:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 150, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 19505:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19508:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19508:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 150, thread vruntime = 87). Will run for at most 3 ticks.
+
+At time 19553:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19556:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19556:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 151, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 19601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19604:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19604:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 151, thread vruntime = 36). Will run for at most 3 ticks.
+
+At time 19649:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19652:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19652:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 151, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 19697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19700:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19700:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 151, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 19745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19748:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19748:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 153, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 19793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19796:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19796:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 153, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 19841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19844:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19844:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 153, thread vruntime = 90). Will run for at most 3 ticks.
+
+At time 19889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19892:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19892:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 154, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 19937:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19940:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19940:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 154, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 19985:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19988:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19988:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 154, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 20033:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20034:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20034:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 154, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 20050:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 20079:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20082:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20082:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 155, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 20127:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20129:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20129:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 156, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 20131:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 20174:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20177:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20177:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 156, thread vruntime = 37). Will run for at most 3 ticks.
+
+At time 20222:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20225:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20225:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 156, thread vruntime = 93). Will run for at most 3 ticks.
+
+At time 20270:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20273:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20273:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 18 threads in 6 processes (process vruntime = 157, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 20303:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 20318:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20321:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20321:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 157, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 20366:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20369:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20369:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 157, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 20414:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20417:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20417:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 157, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 20462:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20465:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20465:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 159, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 20491:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 20510:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20513:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20513:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 159, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 20558:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20561:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20561:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 159, thread vruntime = 96). Will run for at most 3 ticks.
+
+At time 20606:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20609:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20609:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 160, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 20654:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20657:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20657:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 160, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 20702:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20705:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20705:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 160, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 20750:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20752:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20752:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 160, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 20771:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 20797:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20800:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20800:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 162, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 20845:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20848:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20848:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 162, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 20893:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20896:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20896:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 162, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 20941:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20944:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20944:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 162, thread vruntime = 99). Will run for at most 3 ticks.
+
+At time 20989:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20992:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20992:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 163, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 21037:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21040:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21040:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 163, thread vruntime = 39). Will run for at most 3 ticks.
+
+At time 21085:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21088:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21088:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 163, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 21133:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21136:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21136:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 165, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 21181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21184:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21184:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 165, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 21229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21232:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21232:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 165, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 21277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21280:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21280:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 165, thread vruntime = 102). Will run for at most 3 ticks.
+
+At time 21325:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21328:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21328:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 166, thread vruntime = 64). Will run for at most 3 ticks.
+
+At time 21373:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21376:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21376:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 166, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 21421:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21424:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21424:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 166, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 21469:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21472:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21472:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 168, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 21517:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21520:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21520:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 168, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 21565:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21568:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21568:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads in 7 processes (process vruntime = 168, thread vruntime = 40). Will run for at most 3 ticks.
+
+At time 21613:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21616:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21616:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 168, thread vruntime = 105). Will run for at most 3 ticks.
+
+At time 21661:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21664:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21664:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 169, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 21709:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21712:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21712:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 169, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 21757:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21760:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21760:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads in 7 processes (process vruntime = 169, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 21805:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21806:
+    THREAD_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 21806:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 170, thread vruntime = 64). Will run for at most 3 ticks.
+
+At time 21830:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21831:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21831:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 17 threads in 6 processes (process vruntime = 171, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 21855:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 21876:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21879:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21879:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 171, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 21924:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21927:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21927:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 171, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 21972:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21975:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21975:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 171, thread vruntime = 108). Will run for at most 3 ticks.
+
+At time 22020:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22023:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22023:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 171, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 22068:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22071:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22071:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 172, thread vruntime = 67). Will run for at most 3 ticks.
+
+At time 22116:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22119:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22119:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 172, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 22164:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22166:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22166:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 174, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 22188:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 22190:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22193:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22193:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 174, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 22238:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22239:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22239:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 174, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 22240:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 22284:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22287:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22287:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 174, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 22309:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 22332:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22335:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22335:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 174, thread vruntime = 111). Will run for at most 3 ticks.
+
+At time 22380:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22383:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22383:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 174, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 22428:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22431:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22431:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 17 threads in 6 processes (process vruntime = 175, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 22459:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 22476:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22479:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22479:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 175, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 22524:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22527:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22527:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 177, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 22572:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22575:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22575:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 177, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 22620:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22621:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22621:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 177, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 22650:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 22666:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22667:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22667:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 177, thread vruntime = 114). Will run for at most 3 ticks.
+
+At time 22680:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 22712:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22715:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22715:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 177, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 22760:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22763:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22763:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 178, thread vruntime = 70). Will run for at most 3 ticks.
+
+At time 22808:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22811:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22811:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 178, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 22856:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22859:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22859:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 178, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 22904:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22907:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22907:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 178, thread vruntime = 43). Will run for at most 3 ticks.
+
+At time 22952:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22955:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22955:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 180, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 23000:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23003:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23003:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 180, thread vruntime = 117). Will run for at most 3 ticks.
+
+At time 23048:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23051:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23051:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 180, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 23096:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23099:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23099:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 18 threads in 7 processes (process vruntime = 181, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 23144:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23146:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23146:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 181, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 23148:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 23191:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23194:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23194:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 181, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 23239:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23242:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23242:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 18 threads in 7 processes (process vruntime = 181, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 23287:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23290:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23290:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 183, thread vruntime = 73). Will run for at most 3 ticks.
+
+At time 23302:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23335:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23338:
+    THREAD_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 23338:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 183, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 23383:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23386:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23386:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 183, thread vruntime = 120). Will run for at most 3 ticks.
+
+At time 23431:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23434:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23434:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 183, thread vruntime = 77). Will run for at most 3 ticks.
+
+At time 23479:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23482:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23482:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 184, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 23527:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23530:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23530:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 184, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 23575:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23578:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23578:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 184, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 23623:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23626:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23626:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 186, thread vruntime = 73). Will run for at most 3 ticks.
+
+At time 23671:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23674:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23674:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 186, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 23719:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23722:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23722:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 186, thread vruntime = 123). Will run for at most 3 ticks.
+
+At time 23767:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23770:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23770:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 186, thread vruntime = 80). Will run for at most 3 ticks.
+
+At time 23780:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 23815:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23818:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23818:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 187, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 23863:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23866:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23866:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 187, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 23911:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23914:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23914:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 187, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 23959:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23962:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23962:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 189, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 24007:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24010:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24010:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 189, thread vruntime = 76). Will run for at most 3 ticks.
+
+At time 24055:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24058:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24058:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 189, thread vruntime = 126). Will run for at most 3 ticks.
+
+At time 24103:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24106:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24106:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 189, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 24151:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24154:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24154:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 190, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 24199:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24202:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24202:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 190, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 24247:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24250:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24250:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 190, thread vruntime = 46). Will run for at most 3 ticks.
+
+At time 24295:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24298:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24298:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 192, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 24343:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24346:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24346:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 192, thread vruntime = 79). Will run for at most 3 ticks.
+
+At time 24391:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24394:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24394:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 192, thread vruntime = 129). Will run for at most 3 ticks.
+
+At time 24400:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 24439:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24442:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24442:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 192, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 24487:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24490:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24490:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 193, thread vruntime = 64). Will run for at most 3 ticks.
+
+At time 24535:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24537:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24537:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads in 7 processes (process vruntime = 193, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 24550:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 24582:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24585:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24585:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 193, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 24630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24633:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24633:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 195, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 24678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24681:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24681:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 16 threads in 7 processes (process vruntime = 195, thread vruntime = 64). Will run for at most 3 ticks.
+
+At time 24688:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 24726:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24729:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24729:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 195, thread vruntime = 82). Will run for at most 3 ticks.
+
+At time 24774:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24777:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24777:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 195, thread vruntime = 132). Will run for at most 3 ticks.
+
+At time 24822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24825:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24825:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 195, thread vruntime = 89). Will run for at most 3 ticks.
+
+At time 24870:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24873:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24873:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 196, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 24918:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24921:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24921:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 196, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 24966:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24969:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24969:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 17 threads in 7 processes (process vruntime = 198, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 25014:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25017:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25017:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 17 threads in 7 processes (process vruntime = 198, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 25062:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25063:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25063:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 16 threads in 7 processes (process vruntime = 198, thread vruntime = 85). Will run for at most 3 ticks.
+
+At time 25071:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 25108:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25110:
+    THREAD_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 25110:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 198, thread vruntime = 135). Will run for at most 3 ticks.
+
+At time 25155:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25158:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25158:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 198, thread vruntime = 92). Will run for at most 3 ticks.
+
+At time 25203:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25205:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25205:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 15 threads in 5 processes (process vruntime = 199, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 25213:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 25250:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25253:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25253:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 199, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 25298:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25301:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25301:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 199, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 25346:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25349:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25349:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 200, thread vruntime = 94). Will run for at most 3 ticks.
+
+At time 25394:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25397:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25397:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 201, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 25442:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25443:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25443:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 15 threads in 6 processes (process vruntime = 201, thread vruntime = 138). Will run for at most 3 ticks.
+
+At time 25464:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 25488:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25491:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25491:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 202, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 25536:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25539:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25539:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 202, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 25584:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25587:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25587:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 202, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 25632:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25635:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25635:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 202, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 25680:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25683:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25683:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 203, thread vruntime = 97). Will run for at most 3 ticks.
+
+At time 25728:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25731:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25731:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 204, thread vruntime = 141). Will run for at most 3 ticks.
+
+At time 25776:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25779:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25779:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 205, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 25824:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25827:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25827:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 205, thread vruntime = 67). Will run for at most 3 ticks.
+
+At time 25872:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25875:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25875:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 205, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 25920:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25921:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25921:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads in 6 processes (process vruntime = 205, thread vruntime = 50). Will run for at most 3 ticks.
+
+At time 25944:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 25966:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25969:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25969:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 206, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 26014:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26017:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26017:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 206, thread vruntime = 100). Will run for at most 3 ticks.
+
+At time 26062:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26065:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26065:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 207, thread vruntime = 144). Will run for at most 3 ticks.
+
+At time 26110:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26113:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26113:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 208, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 26158:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26161:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26161:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 208, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 26206:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26209:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26209:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 208, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 26254:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26257:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26257:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 209, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 26302:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26303:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26303:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads in 6 processes (process vruntime = 209, thread vruntime = 103). Will run for at most 3 ticks.
+
+At time 26315:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 26348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26351:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26351:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 210, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 26396:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26399:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26399:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 210, thread vruntime = 147). Will run for at most 3 ticks.
+
+At time 26444:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26445:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26445:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 15 threads in 5 processes (process vruntime = 211, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 26473:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 26490:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26492:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26492:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 15 threads in 6 processes (process vruntime = 211, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 26503:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 26537:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26540:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26540:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 16 threads in 6 processes (process vruntime = 211, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 26585:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26588:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26588:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads in 6 processes (process vruntime = 211, thread vruntime = 148). Will run for at most 3 ticks.
+
+At time 26633:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26634:
+    THREAD_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 26634:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads in 5 processes (process vruntime = 212, thread vruntime = 106). Will run for at most 3 ticks.
+
+At time 26679:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26682:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26682:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 15 threads in 5 processes (process vruntime = 213, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 26727:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26730:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26730:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 15 threads in 5 processes (process vruntime = 213, thread vruntime = 70). Will run for at most 3 ticks.
+
+At time 26775:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26778:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26778:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 15 threads in 5 processes (process vruntime = 214, thread vruntime = 70). Will run for at most 3 ticks.
+
+At time 26823:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26826:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26826:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 15 threads in 5 processes (process vruntime = 214, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 26871:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26873:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26873:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 14 threads in 5 processes (process vruntime = 215, thread vruntime = 109). Will run for at most 3 ticks.
+
+At time 26874:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 26918:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26920:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26920:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 14 threads in 4 processes (process vruntime = 216, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 26939:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 26965:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26968:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26968:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 15 threads in 5 processes (process vruntime = 216, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 27013:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27016:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27016:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads in 5 processes (process vruntime = 216, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 27061:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27063:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27063:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 14 threads in 5 processes (process vruntime = 217, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 27067:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 27108:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27111:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27111:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads in 5 processes (process vruntime = 217, thread vruntime = 111). Will run for at most 3 ticks.
+
+At time 27156:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27159:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27159:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 15 threads in 5 processes (process vruntime = 218, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 27204:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27206:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27206:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 14 threads in 5 processes (process vruntime = 219, thread vruntime = 53). Will run for at most 3 ticks.
+
+At time 27213:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 27251:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27254:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27254:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 15 threads in 5 processes (process vruntime = 219, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 27299:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27302:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27302:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 15 threads in 5 processes (process vruntime = 220, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 27347:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27348:
+    THREAD_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 27348:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 14 threads in 5 processes (process vruntime = 220, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 27393:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27396:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27396:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 14 threads in 5 processes (process vruntime = 220, thread vruntime = 114). Will run for at most 3 ticks.
+
+At time 27441:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27444:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27444:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 14 threads in 5 processes (process vruntime = 221, thread vruntime = 73). Will run for at most 3 ticks.
+
+At time 27489:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27492:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27492:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 14 threads in 5 processes (process vruntime = 222, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 27537:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27540:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27540:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 14 threads in 5 processes (process vruntime = 222, thread vruntime = 73). Will run for at most 3 ticks.
+
+At time 27585:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27588:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27588:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 14 threads in 5 processes (process vruntime = 223, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 27633:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27635:
+    THREAD_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 27635:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 13 threads in 5 processes (process vruntime = 223, thread vruntime = 117). Will run for at most 3 ticks.
+
+At time 27680:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27683:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27683:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 13 threads in 5 processes (process vruntime = 224, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 27728:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27731:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27731:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 13 threads in 5 processes (process vruntime = 225, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 27776:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27777:
+    THREAD_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 27777:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 12 threads in 5 processes (process vruntime = 225, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 27822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27825:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27825:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 12 threads in 5 processes (process vruntime = 225, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 27870:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27873:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27873:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads in 5 processes (process vruntime = 226, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 27918:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27921:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27921:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 12 threads in 5 processes (process vruntime = 226, thread vruntime = 120). Will run for at most 3 ticks.
+
+At time 27966:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27969:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27969:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 11 threads in 4 processes (process vruntime = 227, thread vruntime = 76). Will run for at most 3 ticks.
+
+At time 27986:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 28014:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28017:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28017:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads in 5 processes (process vruntime = 228, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 28024:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 28062:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28065:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28065:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 12 threads in 5 processes (process vruntime = 228, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 28110:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28113:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28113:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 12 threads in 5 processes (process vruntime = 229, thread vruntime = 56). Will run for at most 3 ticks.
+
+At time 28158:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28161:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28161:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 12 threads in 5 processes (process vruntime = 229, thread vruntime = 123). Will run for at most 3 ticks.
+
+At time 28206:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28209:
+    THREAD_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 28209:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads in 4 processes (process vruntime = 230, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 28254:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28255:
+    THREAD_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 28255:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 231, thread vruntime = 79). Will run for at most 3 ticks.
+
+At time 28279:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28282:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28282:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 231, thread vruntime = 76). Will run for at most 3 ticks.
+
+At time 28327:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28330:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28330:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 231, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 28375:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28378:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28378:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 10 threads in 4 processes (process vruntime = 232, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 28423:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28426:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28426:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 234, thread vruntime = 77). Will run for at most 3 ticks.
+
+At time 28471:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28474:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28474:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 9 threads in 4 processes (process vruntime = 234, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 28488:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 28519:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28522:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28522:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 234, thread vruntime = 82). Will run for at most 3 ticks.
+
+At time 28567:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28570:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28570:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 10 threads in 4 processes (process vruntime = 235, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 28615:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28618:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28618:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 237, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 28663:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28666:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28666:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 237, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 28711:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28714:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28714:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 237, thread vruntime = 85). Will run for at most 3 ticks.
+
+At time 28759:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28762:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28762:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 10 threads in 4 processes (process vruntime = 238, thread vruntime = 59). Will run for at most 3 ticks.
+
+At time 28807:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28810:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28810:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 240, thread vruntime = 79). Will run for at most 3 ticks.
+
+At time 28855:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28858:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28858:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 240, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 28903:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28906:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28906:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 240, thread vruntime = 88). Will run for at most 3 ticks.
+
+At time 28951:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28954:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28954:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 10 threads in 4 processes (process vruntime = 241, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 28999:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29002:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29002:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 243, thread vruntime = 80). Will run for at most 3 ticks.
+
+At time 29047:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29050:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29050:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 243, thread vruntime = 61). Will run for at most 3 ticks.
+
+At time 29095:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29098:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29098:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 243, thread vruntime = 91). Will run for at most 3 ticks.
+
+At time 29143:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29146:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29146:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 10 threads in 4 processes (process vruntime = 244, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 29191:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29193:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29193:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 9 threads in 4 processes (process vruntime = 246, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 29206:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 29217:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29220:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29220:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 246, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 29265:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29268:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29268:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 246, thread vruntime = 62). Will run for at most 3 ticks.
+
+At time 29313:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29314:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29314:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads in 4 processes (process vruntime = 246, thread vruntime = 94). Will run for at most 3 ticks.
+
+At time 29339:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29359:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29362:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29362:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 10 threads in 4 processes (process vruntime = 247, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 29407:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29410:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29410:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 10 threads in 4 processes (process vruntime = 249, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 29455:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29456:
+    THREAD_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 29456:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 9 threads in 4 processes (process vruntime = 249, thread vruntime = 82). Will run for at most 3 ticks.
+
+At time 29501:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29504:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29504:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads in 4 processes (process vruntime = 249, thread vruntime = 97). Will run for at most 3 ticks.
+
+At time 29549:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29550:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29550:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 8 threads in 3 processes (process vruntime = 250, thread vruntime = 64). Will run for at most 3 ticks.
+
+At time 29577:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29595:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29598:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29598:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 9 threads in 4 processes (process vruntime = 250, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 29643:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29646:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29646:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads in 4 processes (process vruntime = 250, thread vruntime = 98). Will run for at most 3 ticks.
+
+At time 29691:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29693:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29693:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 8 threads in 3 processes (process vruntime = 252, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 29709:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29738:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29741:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29741:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads in 4 processes (process vruntime = 252, thread vruntime = 100). Will run for at most 3 ticks.
+
+At time 29786:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29789:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29789:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 9 threads in 4 processes (process vruntime = 253, thread vruntime = 65). Will run for at most 3 ticks.
+
+At time 29834:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29837:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29837:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 9 threads in 4 processes (process vruntime = 253, thread vruntime = 64). Will run for at most 3 ticks.
+
+At time 29882:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29885:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29885:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 9 threads in 4 processes (process vruntime = 255, thread vruntime = 84). Will run for at most 3 ticks.
+
+At time 29930:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29933:
+    THREAD_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 29933:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 255, thread vruntime = 103). Will run for at most 3 ticks.
+
+At time 29978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29981:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29981:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 8 threads in 4 processes (process vruntime = 256, thread vruntime = 67). Will run for at most 3 ticks.
+
+At time 30026:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30029:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30029:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 256, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 30074:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30076:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 30076:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 258, thread vruntime = 85). Will run for at most 3 ticks.
+
+At time 30101:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 30121:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30124:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30124:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 258, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 30169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30172:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30172:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 258, thread vruntime = 106). Will run for at most 3 ticks.
+
+At time 30217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30220:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30220:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 8 threads in 4 processes (process vruntime = 259, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 30265:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30267:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 30267:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 7 threads in 4 processes (process vruntime = 261, thread vruntime = 70). Will run for at most 3 ticks.
+
+At time 30291:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30292:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 30294:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30294:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 261, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 30339:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30342:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30342:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 261, thread vruntime = 67). Will run for at most 3 ticks.
+
+At time 30387:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30390:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30390:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 261, thread vruntime = 109). Will run for at most 3 ticks.
+
+At time 30435:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30438:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30438:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 8 threads in 4 processes (process vruntime = 264, thread vruntime = 88). Will run for at most 3 ticks.
+
+At time 30483:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30484:
+    THREAD_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 30484:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 264, thread vruntime = 68). Will run for at most 3 ticks.
+
+At time 30529:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30532:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30532:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 7 threads in 4 processes (process vruntime = 264, thread vruntime = 70). Will run for at most 3 ticks.
+
+At time 30577:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30580:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30580:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 264, thread vruntime = 112). Will run for at most 3 ticks.
+
+At time 30625:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30628:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30628:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 265, thread vruntime = 89). Will run for at most 3 ticks.
+
+At time 30673:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30676:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30676:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 267, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 30721:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30724:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30724:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 7 threads in 4 processes (process vruntime = 267, thread vruntime = 73). Will run for at most 3 ticks.
+
+At time 30769:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30772:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30772:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 267, thread vruntime = 115). Will run for at most 3 ticks.
+
+At time 30817:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30820:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30820:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 268, thread vruntime = 92). Will run for at most 3 ticks.
+
+At time 30865:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30868:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30868:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 270, thread vruntime = 70). Will run for at most 3 ticks.
+
+At time 30913:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30916:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30916:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 7 threads in 4 processes (process vruntime = 270, thread vruntime = 73). Will run for at most 3 ticks.
+
+At time 30961:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30964:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30964:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 270, thread vruntime = 118). Will run for at most 3 ticks.
+
+At time 31009:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31012:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31012:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 271, thread vruntime = 95). Will run for at most 3 ticks.
+
+At time 31057:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31060:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31060:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 273, thread vruntime = 71). Will run for at most 3 ticks.
+
+At time 31105:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31108:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31108:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 7 threads in 4 processes (process vruntime = 273, thread vruntime = 76). Will run for at most 3 ticks.
+
+At time 31153:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31156:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31156:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 7 threads in 4 processes (process vruntime = 273, thread vruntime = 121). Will run for at most 3 ticks.
+
+At time 31201:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31204:
+    THREAD_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 31204:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 274, thread vruntime = 98). Will run for at most 3 ticks.
+
+At time 31249:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31252:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31252:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 6 threads in 3 processes (process vruntime = 276, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 31297:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31299:
+    THREAD_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 31299:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 5 threads in 3 processes (process vruntime = 276, thread vruntime = 76). Will run for at most 3 ticks.
+
+At time 31344:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31347:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31347:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 277, thread vruntime = 101). Will run for at most 3 ticks.
+
+At time 31392:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31393:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31393:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 4 threads in 2 processes (process vruntime = 278, thread vruntime = 73). Will run for at most 3 ticks.
+
+At time 31406:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31438:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31441:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31441:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 278, thread vruntime = 102). Will run for at most 3 ticks.
+
+At time 31486:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31489:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31489:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 5 threads in 3 processes (process vruntime = 279, thread vruntime = 79). Will run for at most 3 ticks.
+
+At time 31534:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31537:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31537:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 281, thread vruntime = 74). Will run for at most 3 ticks.
+
+At time 31582:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31585:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31585:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 281, thread vruntime = 105). Will run for at most 3 ticks.
+
+At time 31630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31633:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31633:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 5 threads in 3 processes (process vruntime = 282, thread vruntime = 79). Will run for at most 3 ticks.
+
+At time 31678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31681:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31681:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 284, thread vruntime = 76). Will run for at most 3 ticks.
+
+At time 31726:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31729:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31729:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 284, thread vruntime = 108). Will run for at most 3 ticks.
+
+At time 31774:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31777:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31777:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 5 threads in 3 processes (process vruntime = 285, thread vruntime = 82). Will run for at most 3 ticks.
+
+At time 31822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31823:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31823:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 4 threads in 3 processes (process vruntime = 286, thread vruntime = 82). Will run for at most 3 ticks.
+
+At time 31826:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 31847:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31850:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31850:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 287, thread vruntime = 77). Will run for at most 3 ticks.
+
+At time 31895:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31898:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31898:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 287, thread vruntime = 111). Will run for at most 3 ticks.
+
+At time 31943:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31946:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31946:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 5 threads in 3 processes (process vruntime = 289, thread vruntime = 83). Will run for at most 3 ticks.
+
+At time 31991:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31994:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31994:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 5 threads in 3 processes (process vruntime = 290, thread vruntime = 79). Will run for at most 3 ticks.
+
+At time 32039:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32040:
+    THREAD_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 32040:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 4 threads in 3 processes (process vruntime = 290, thread vruntime = 114). Will run for at most 3 ticks.
+
+At time 32085:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32088:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32088:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 4 threads in 3 processes (process vruntime = 291, thread vruntime = 80). Will run for at most 3 ticks.
+
+At time 32133:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32134:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32134:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 3 threads in 2 processes (process vruntime = 292, thread vruntime = 85). Will run for at most 3 ticks.
+
+At time 32149:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 32179:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32182:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32182:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 4 threads in 3 processes (process vruntime = 292, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 32227:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32230:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32230:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 4 threads in 3 processes (process vruntime = 293, thread vruntime = 117). Will run for at most 3 ticks.
+
+At time 32275:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32278:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32278:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 4 threads in 3 processes (process vruntime = 295, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 32323:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32326:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32326:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 4 threads in 3 processes (process vruntime = 295, thread vruntime = 84). Will run for at most 3 ticks.
+
+At time 32371:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32374:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32374:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 4 threads in 3 processes (process vruntime = 296, thread vruntime = 120). Will run for at most 3 ticks.
+
+At time 32419:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32422:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32422:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 4 threads in 3 processes (process vruntime = 298, thread vruntime = 88). Will run for at most 3 ticks.
+
+At time 32467:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32468:
+    THREAD_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 32468:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 3 threads in 3 processes (process vruntime = 298, thread vruntime = 87). Will run for at most 3 ticks.
+
+At time 32513:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32516:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32516:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 3 threads in 3 processes (process vruntime = 299, thread vruntime = 89). Will run for at most 3 ticks.
+
+At time 32561:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32564:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32564:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 3 threads in 3 processes (process vruntime = 299, thread vruntime = 123). Will run for at most 3 ticks.
+
+At time 32609:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32612:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32612:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 3 threads in 3 processes (process vruntime = 301, thread vruntime = 90). Will run for at most 3 ticks.
+
+At time 32657:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32660:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32660:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 3 threads in 3 processes (process vruntime = 302, thread vruntime = 92). Will run for at most 3 ticks.
+
+At time 32705:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32708:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32708:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 3 threads in 3 processes (process vruntime = 302, thread vruntime = 126). Will run for at most 3 ticks.
+
+At time 32753:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32756:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32756:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 304, thread vruntime = 93). Will run for at most 3 ticks.
+
+At time 32784:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 32801:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32804:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32804:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 3 threads in 3 processes (process vruntime = 305, thread vruntime = 95). Will run for at most 3 ticks.
+
+At time 32849:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32852:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32852:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 3 threads in 3 processes (process vruntime = 305, thread vruntime = 129). Will run for at most 3 ticks.
+
+At time 32897:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32900:
+    THREAD_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 32900:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 307, thread vruntime = 96). Will run for at most 3 ticks.
+
+At time 32945:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32948:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32948:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 308, thread vruntime = 98). Will run for at most 3 ticks.
+
+At time 32993:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32996:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32996:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 310, thread vruntime = 99). Will run for at most 3 ticks.
+
+At time 33041:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33044:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33044:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 311, thread vruntime = 101). Will run for at most 3 ticks.
+
+At time 33089:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33092:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33092:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 313, thread vruntime = 102). Will run for at most 3 ticks.
+
+At time 33137:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33139:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 33139:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 314, thread vruntime = 104). Will run for at most 3 ticks.
+
+At time 33164:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 33184:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33187:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33187:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 315, thread vruntime = 104). Will run for at most 3 ticks.
+
+At time 33232:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33235:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33235:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 317, thread vruntime = 107). Will run for at most 3 ticks.
+
+At time 33280:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33282:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 33282:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 318, thread vruntime = 107). Will run for at most 3 ticks.
+
+At time 33299:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 33327:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33330:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33330:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 319, thread vruntime = 109). Will run for at most 3 ticks.
+
+At time 33375:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33378:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33378:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 321, thread vruntime = 110). Will run for at most 3 ticks.
+
+At time 33423:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33425:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 33425:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 322, thread vruntime = 112). Will run for at most 3 ticks.
+
+At time 33426:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 33470:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33473:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33473:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 323, thread vruntime = 112). Will run for at most 3 ticks.
+
+At time 33518:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33521:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33521:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 325, thread vruntime = 115). Will run for at most 3 ticks.
+
+At time 33566:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33569:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33569:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 326, thread vruntime = 115). Will run for at most 3 ticks.
+
+At time 33614:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33617:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33617:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 328, thread vruntime = 118). Will run for at most 3 ticks.
+
+At time 33662:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33665:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33665:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 329, thread vruntime = 118). Will run for at most 3 ticks.
+
+At time 33710:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33713:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33713:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 331, thread vruntime = 121). Will run for at most 3 ticks.
+
+At time 33758:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33761:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33761:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 332, thread vruntime = 121). Will run for at most 3 ticks.
+
+At time 33806:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33809:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33809:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 334, thread vruntime = 124). Will run for at most 3 ticks.
+
+At time 33854:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33857:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33857:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 335, thread vruntime = 124). Will run for at most 3 ticks.
+
+At time 33902:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33905:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 33905:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 337, thread vruntime = 127). Will run for at most 3 ticks.
+
+At time 33918:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 33950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33953:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33953:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 338, thread vruntime = 127). Will run for at most 3 ticks.
+
+At time 33998:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34001:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34001:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 340, thread vruntime = 130). Will run for at most 3 ticks.
+
+At time 34046:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34049:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34049:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 341, thread vruntime = 130). Will run for at most 3 ticks.
+
+At time 34094:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34097:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34097:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 343, thread vruntime = 133). Will run for at most 3 ticks.
+
+At time 34142:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34144:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 34144:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 344, thread vruntime = 133). Will run for at most 3 ticks.
+
+At time 34172:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 34189:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34192:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34192:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 345, thread vruntime = 135). Will run for at most 3 ticks.
+
+At time 34237:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34240:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34240:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 347, thread vruntime = 136). Will run for at most 3 ticks.
+
+At time 34285:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34288:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34288:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 348, thread vruntime = 138). Will run for at most 3 ticks.
+
+At time 34333:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34336:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34336:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 350, thread vruntime = 139). Will run for at most 3 ticks.
+
+At time 34381:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34384:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34384:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 351, thread vruntime = 141). Will run for at most 3 ticks.
+
+At time 34429:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34432:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34432:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 353, thread vruntime = 142). Will run for at most 3 ticks.
+
+At time 34477:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34480:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34480:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads in 2 processes (process vruntime = 354, thread vruntime = 144). Will run for at most 3 ticks.
+
+At time 34525:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34528:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34528:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 356, thread vruntime = 145). Will run for at most 3 ticks.
+
+At time 34573:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34575:
+    THREAD_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 34575:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 357, thread vruntime = 147). Will run for at most 3 ticks.
+
+At time 34620:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34623:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34623:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 360, thread vruntime = 150). Will run for at most 3 ticks.
+
+At time 34647:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34650:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34650:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 363, thread vruntime = 153). Will run for at most 3 ticks.
+
+At time 34674:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34677:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34677:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 366, thread vruntime = 156). Will run for at most 3 ticks.
+
+At time 34701:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34702:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 34730:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 34730:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 367, thread vruntime = 157). Will run for at most 3 ticks.
+
+At time 34754:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34757:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34757:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 370, thread vruntime = 160). Will run for at most 3 ticks.
+
+At time 34781:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34784:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34784:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 373, thread vruntime = 163). Will run for at most 3 ticks.
+
+At time 34808:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34811:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34811:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 376, thread vruntime = 166). Will run for at most 3 ticks.
+
+At time 34835:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34838:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34838:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 379, thread vruntime = 169). Will run for at most 3 ticks.
+
+At time 34862:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34865:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34865:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 382, thread vruntime = 172). Will run for at most 3 ticks.
+
+At time 34889:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34892:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34892:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 385, thread vruntime = 175). Will run for at most 3 ticks.
+
+At time 34916:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34919:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34919:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 388, thread vruntime = 178). Will run for at most 3 ticks.
+
+At time 34943:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34946:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34946:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 391, thread vruntime = 181). Will run for at most 3 ticks.
+
+At time 34970:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34971:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 34994:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 34994:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 392, thread vruntime = 182). Will run for at most 3 ticks.
+
+At time 35018:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35021:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35021:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 395, thread vruntime = 185). Will run for at most 3 ticks.
+
+At time 35045:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35048:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35048:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 398, thread vruntime = 188). Will run for at most 3 ticks.
+
+At time 35072:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35075:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35075:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 401, thread vruntime = 191). Will run for at most 3 ticks.
+
+At time 35099:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35102:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35102:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 404, thread vruntime = 194). Will run for at most 3 ticks.
+
+At time 35126:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35129:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35129:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 407, thread vruntime = 197). Will run for at most 3 ticks.
+
+At time 35153:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35156:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35156:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 410, thread vruntime = 200). Will run for at most 3 ticks.
+
+At time 35180:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35183:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35183:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 413, thread vruntime = 203). Will run for at most 3 ticks.
+
+At time 35207:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35210:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35210:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 416, thread vruntime = 206). Will run for at most 3 ticks.
+
+At time 35234:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35237:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35237:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 419, thread vruntime = 209). Will run for at most 3 ticks.
+
+At time 35261:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35262:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 35266:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 35266:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 420, thread vruntime = 210). Will run for at most 3 ticks.
+
+At time 35290:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35293:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35293:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 423, thread vruntime = 213). Will run for at most 3 ticks.
+
+At time 35317:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35320:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35320:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 426, thread vruntime = 216). Will run for at most 3 ticks.
+
+At time 35344:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35347:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35347:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 429, thread vruntime = 219). Will run for at most 3 ticks.
+
+At time 35371:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35374:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35374:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 432, thread vruntime = 222). Will run for at most 3 ticks.
+
+At time 35398:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35401:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35401:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 435, thread vruntime = 225). Will run for at most 3 ticks.
+
+At time 35425:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35428:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35428:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 438, thread vruntime = 228). Will run for at most 3 ticks.
+
+At time 35452:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35455:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35455:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 441, thread vruntime = 231). Will run for at most 3 ticks.
+
+At time 35479:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35482:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35482:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 444, thread vruntime = 234). Will run for at most 3 ticks.
+
+At time 35506:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35509:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35509:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads in 1 processes (process vruntime = 447, thread vruntime = 237). Will run for at most 3 ticks.
+
+At time 35533:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35535:
+    THREAD_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             39
+    Process switches:           720
+    Dispatch time saved:        819
+
+MAX READY WAIT:
+    SYSTEM:                    1910
+    INTERACTIVE:                  0
+    NORMAL:                    2245
+    BATCH:                        0
+
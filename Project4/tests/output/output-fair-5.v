@@ -0,0 +1,987 @@
+At time 62:
+    THREAD_ARRIVED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 62:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 80:
+    THREAD_ARRIVED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 98:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 101:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 101:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 0, thread vruntime = 0). Will run for at most 3 ticks.
+
+At time 137:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 140:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 140:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 3, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 176:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 178:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 178:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 3, thread vruntime = 3). Will run for at most 3 ticks.
+
+At time 185:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 214:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 217:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 217:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 5, thread vruntime = 5). Will run for at most 3 ticks.
+
+At time 245:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 253:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 256:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 256:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 6, thread vruntime = 6). Will run for at most 3 ticks.
+
+At time 292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 295:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 295:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 8, thread vruntime = 8). Will run for at most 3 ticks.
+
+At time 331:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 334:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 334:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 9, thread vruntime = 9). Will run for at most 3 ticks.
+
+At time 370:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 373:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 373:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 11, thread vruntime = 11). Will run for at most 3 ticks.
+
+At time 409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 412:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 412:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 12, thread vruntime = 12). Will run for at most 3 ticks.
+
+At time 448:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 451:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 451:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 14, thread vruntime = 14). Will run for at most 3 ticks.
+
+At time 487:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 490:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 490:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 15, thread vruntime = 15). Will run for at most 3 ticks.
+
+At time 526:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 529:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 529:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 17, thread vruntime = 17). Will run for at most 3 ticks.
+
+At time 565:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 568:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 568:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 18, thread vruntime = 18). Will run for at most 3 ticks.
+
+At time 604:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 607:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 607:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 20, thread vruntime = 20). Will run for at most 3 ticks.
+
+At time 643:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 646:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 646:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 21, thread vruntime = 21). Will run for at most 3 ticks.
+
+At time 682:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 685:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 685:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 23, thread vruntime = 23). Will run for at most 3 ticks.
+
+At time 721:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 724:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 724:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 24, thread vruntime = 24). Will run for at most 3 ticks.
+
+At time 740:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 760:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 763:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 763:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 26, thread vruntime = 26). Will run for at most 3 ticks.
+
+At time 799:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 802:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 802:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 27, thread vruntime = 27). Will run for at most 3 ticks.
+
+At time 838:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 841:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 841:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 29, thread vruntime = 29). Will run for at most 3 ticks.
+
+At time 877:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 880:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 880:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 30, thread vruntime = 30). Will run for at most 3 ticks.
+
+At time 916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 919:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 919:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 32, thread vruntime = 32). Will run for at most 3 ticks.
+
+At time 955:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 958:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 958:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 33, thread vruntime = 33). Will run for at most 3 ticks.
+
+At time 994:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 996:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 996:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 35, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 1005:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1032:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1035:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1035:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 35, thread vruntime = 35). Will run for at most 3 ticks.
+
+At time 1071:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1074:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1074:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 38, thread vruntime = 38). Will run for at most 3 ticks.
+
+At time 1110:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1113:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1113:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 38, thread vruntime = 38). Will run for at most 3 ticks.
+
+At time 1149:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1152:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1152:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 41, thread vruntime = 41). Will run for at most 3 ticks.
+
+At time 1188:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1191:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1191:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 41, thread vruntime = 41). Will run for at most 3 ticks.
+
+At time 1227:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1228:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1228:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads in 1 processes (process vruntime = 44, thread vruntime = 44). Will run for at most 3 ticks.
+
+At time 1249:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1264:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1267:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1267:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 44, thread vruntime = 42). Will run for at most 3 ticks.
+
+At time 1303:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1306:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1306:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 47, thread vruntime = 47). Will run for at most 3 ticks.
+
+At time 1342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1344:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1344:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 47, thread vruntime = 45). Will run for at most 3 ticks.
+
+At time 1355:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1380:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1383:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1383:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 49, thread vruntime = 49). Will run for at most 3 ticks.
+
+At time 1419:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1422:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1422:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 50, thread vruntime = 48). Will run for at most 3 ticks.
+
+At time 1458:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1461:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1461:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 52, thread vruntime = 52). Will run for at most 3 ticks.
+
+At time 1497:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1500:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1500:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 53, thread vruntime = 51). Will run for at most 3 ticks.
+
+At time 1536:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1539:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1539:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 55, thread vruntime = 55). Will run for at most 3 ticks.
+
+At time 1575:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1578:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1578:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads in 2 processes (process vruntime = 56, thread vruntime = 54). Will run for at most 3 ticks.
+
+At time 1614:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1617:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1617:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads in 2 processes (process vruntime = 58, thread vruntime = 58). Will run for at most 3 ticks.
+
+At time 1653:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1656:
+    THREAD_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1656:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 59, thread vruntime = 57). Will run for at most 3 ticks.
+
+At time 1692:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1695:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1704:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1704:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 62, thread vruntime = 60). Will run for at most 3 ticks.
+
+At time 1718:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1721:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1721:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 65, thread vruntime = 63). Will run for at most 3 ticks.
+
+At time 1735:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1738:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1738:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 68, thread vruntime = 66). Will run for at most 3 ticks.
+
+At time 1752:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1755:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1755:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 71, thread vruntime = 69). Will run for at most 3 ticks.
+
+At time 1769:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1772:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1772:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 74, thread vruntime = 72). Will run for at most 3 ticks.
+
+At time 1786:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1789:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1789:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 77, thread vruntime = 75). Will run for at most 3 ticks.
+
+At time 1803:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1806:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1806:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 80, thread vruntime = 78). Will run for at most 3 ticks.
+
+At time 1820:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1821:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1827:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1827:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 81, thread vruntime = 79). Will run for at most 3 ticks.
+
+At time 1841:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1843:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1851:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1851:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 83, thread vruntime = 81). Will run for at most 3 ticks.
+
+At time 1865:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1868:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1868:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 86, thread vruntime = 84). Will run for at most 3 ticks.
+
+At time 1882:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1884:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1907:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1907:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 88, thread vruntime = 86). Will run for at most 3 ticks.
+
+At time 1921:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1923:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1945:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1945:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 90, thread vruntime = 88). Will run for at most 3 ticks.
+
+At time 1959:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1962:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1962:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 93, thread vruntime = 91). Will run for at most 3 ticks.
+
+At time 1976:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1979:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1979:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 96, thread vruntime = 94). Will run for at most 3 ticks.
+
+At time 1993:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1996:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1996:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 99, thread vruntime = 97). Will run for at most 3 ticks.
+
+At time 2010:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2013:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2013:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 102, thread vruntime = 100). Will run for at most 3 ticks.
+
+At time 2027:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2030:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2030:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 105, thread vruntime = 103). Will run for at most 3 ticks.
+
+At time 2044:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2045:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2070:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2070:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 106, thread vruntime = 104). Will run for at most 3 ticks.
+
+At time 2084:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2087:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2087:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads in 1 processes (process vruntime = 109, thread vruntime = 107). Will run for at most 3 ticks.
+
+At time 2101:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2103:
+    THREAD_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
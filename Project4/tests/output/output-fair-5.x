@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             19
+    Process switches:            42
+    Dispatch time saved:        418
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                 75
+    NORMAL:                      75
+    BATCH:                        0
+
@@ -0,0 +1,20 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             14
+    Process switches:            21
+    Dispatch time saved:        448
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                229
+    NORMAL:                     245
+    BATCH:                        0
+
+DEADLINES:
+    Threads with deadline:        7
+    Deadlines missed:             2
+    Miss rate:               28.57%
+    Lateness min/avg/max:  -633 / -37.71 / 890
+    Lateness p50/p95:      -195 / 890
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 103    TRT: 1105   END: 1155  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 1405   END: 1447  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 100    TRT: 959    END: 1016  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 124    TRT: 1290   END: 1390  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 481    END: 541   
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 667    END: 740   
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 361    END: 411   
+
@@ -0,0 +1,17 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             14
+    Process switches:            21
+    Dispatch time saved:        448
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                226
+    NORMAL:                     245
+    BATCH:                        0
+
+I/O DEVICES:
+    Total I/O wait time:         40
+    Device 0 [FIFO]:      served 28    busy 517    wait 40     util 35.73%
+
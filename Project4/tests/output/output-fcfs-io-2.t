@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 167    TRT: 1073   END: 1123  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 378    TRT: 1407   END: 1449  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 186    TRT: 959    END: 1016  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 288    TRT: 1292   END: 1392  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 17     TRT: 481    END: 541   
+    Thread  2:    ARR: 73     CPU: 48     I/O: 64     TRT: 667    END: 740   
+    Thread  3:    ARR: 50     CPU: 26     I/O: 41     TRT: 361    END: 411   
+
@@ -0,0 +1,18 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             14
+    Process switches:            21
+    Dispatch time saved:        448
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                212
+    NORMAL:                     243
+    BATCH:                        0
+
+I/O DEVICES:
+    Total I/O wait time:         89
+    Device 0 [SCAN]:      served 14    busy 576    wait 35     util 39.75%
+    Device 1 [SCAN]:      served 14    busy 476    wait 54     util 32.85%
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 304    TRT: 1105   END: 1155  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 463    TRT: 1418   END: 1460  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 285    TRT: 959    END: 1016  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 396    TRT: 1303   END: 1403  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 116    TRT: 498    END: 558   
+    Thread  2:    ARR: 73     CPU: 48     I/O: 79     TRT: 667    END: 740   
+    Thread  3:    ARR: 50     CPU: 26     I/O: 41     TRT: 361    END: 411   
+
@@ -0,0 +1,17 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             14
+    Process switches:            21
+    Dispatch time saved:        448
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                206
+    NORMAL:                     202
+    BATCH:                        0
+
+I/O DEVICES:
+    Total I/O wait time:        572
+    Device 0 [DEADLINE]:  served 28    busy 1112   wait 572    util 76.16%
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       33.33
+    Avg. turnaround time:   3739.33
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      174.75
+    Avg. turnaround time:   2915.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           4914
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:          4244
+Total idle time:                42
+
+CPU utilization:            99.15%
+CPU efficiency:             12.78%
+
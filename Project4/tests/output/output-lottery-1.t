@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 3288   END: 3338  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 4835   END: 4877  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 3095   END: 3152  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 4814   END: 4914  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 1307   END: 1367  
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 3570   END: 3643  
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 1969   END: 2019  
+
@@ -0,0 +1,19 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:            108
+    Process switches:           112
+    Dispatch time saved:       3456
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                567
+    NORMAL:                     809
+    BATCH:                        0
+
+CPU SHARES:
+    SYSTEM:               target    0.00%   achieved    0.00%
+    INTERACTIVE:          target   65.39%   achieved   64.17%
+    NORMAL:               target   34.61%   achieved   35.83%
+    BATCH:                target    0.00%   achieved    0.00%
+
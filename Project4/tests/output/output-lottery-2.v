@@ -0,0 +1,1257 @@
+At time 19:
+    THREAD_ARRIVED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 19:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 26 of 200). Will run for at most 3 ticks.
+
+At time 29:
+    THREAD_ARRIVED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 66:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 69:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 69:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 245 of 1800). Will run for at most 3 ticks.
+
+At time 116:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 119:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 119:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 812 of 1800). Will run for at most 3 ticks.
+
+At time 129:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 132:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 132:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 37 of 1800). Will run for at most 3 ticks.
+
+At time 142:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 145:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 145:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 631 of 1800). Will run for at most 3 ticks.
+
+At time 155:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 158:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 158:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads (ticket 1640 of 1800). Will run for at most 3 ticks.
+
+At time 205:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 208:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 208:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 847 of 1800). Will run for at most 3 ticks.
+
+At time 255:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 258:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 258:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 133 of 1800). Will run for at most 3 ticks.
+
+At time 268:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 271:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 271:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 1025 of 1800). Will run for at most 3 ticks.
+
+At time 281:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 283:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 283:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 635 of 1000). Will run for at most 3 ticks.
+
+At time 290:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 293:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 296:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 296:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 161 of 1800). Will run for at most 3 ticks.
+
+At time 306:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 309:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 309:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 1001 of 1800). Will run for at most 3 ticks.
+
+At time 319:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 322:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 322:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 1421 of 1800). Will run for at most 3 ticks.
+
+At time 332:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 335:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 335:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 398 of 1800). Will run for at most 3 ticks.
+
+At time 345:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 348:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 348:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 418 of 1000). Will run for at most 3 ticks.
+
+At time 358:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 360:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 360:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 49 of 200). Will run for at most 3 ticks.
+
+At time 368:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 371:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 407:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 410:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 410:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 525 of 1800). Will run for at most 3 ticks.
+
+At time 457:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 460:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 460:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 1445 of 1800). Will run for at most 3 ticks.
+
+At time 470:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 473:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 473:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 854 of 1800). Will run for at most 3 ticks.
+
+At time 483:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 486:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 486:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 485 of 1800). Will run for at most 3 ticks.
+
+At time 496:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 499:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 499:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 514 of 1800). Will run for at most 3 ticks.
+
+At time 509:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 512:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 512:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 1348 of 1800). Will run for at most 3 ticks.
+
+At time 522:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 525:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 525:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 824 of 1800). Will run for at most 3 ticks.
+
+At time 535:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 538:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 538:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 551 of 1800). Will run for at most 3 ticks.
+
+At time 548:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 551:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 551:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 579 of 1800). Will run for at most 3 ticks.
+
+At time 561:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 564:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 564:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 203 of 1800). Will run for at most 3 ticks.
+
+At time 574:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 576:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 576:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (ticket 119 of 1000). Will run for at most 3 ticks.
+
+At time 606:
+    IO_BURST_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 623:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 626:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 626:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 124 of 1800). Will run for at most 3 ticks.
+
+At time 673:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 676:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 676:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 1250 of 1800). Will run for at most 3 ticks.
+
+At time 686:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 687:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 687:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 647 of 1000). Will run for at most 3 ticks.
+
+At time 689:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 697:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 700:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 700:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 1422 of 1800). Will run for at most 3 ticks.
+
+At time 710:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 713:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 713:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 706 of 1800). Will run for at most 3 ticks.
+
+At time 723:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 726:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 726:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 3 threads (ticket 953 of 1800). Will run for at most 3 ticks.
+
+At time 773:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 776:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 776:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 717 of 1800). Will run for at most 3 ticks.
+
+At time 823:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 826:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 826:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 342 of 1800). Will run for at most 3 ticks.
+
+At time 836:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 839:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 839:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 1074 of 1800). Will run for at most 3 ticks.
+
+At time 849:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 852:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 852:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 1599 of 1800). Will run for at most 3 ticks.
+
+At time 862:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 865:
+    THREAD_PREEMPTED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 865:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 667 of 1800). Will run for at most 3 ticks.
+
+At time 875:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 878:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 878:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 3 threads (ticket 69 of 1800). Will run for at most 3 ticks.
+
+At time 888:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 890:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 890:
+    DISPATCHER_INVOKED
+    Thread 0 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 283 of 1000). Will run for at most 3 ticks.
+
+At time 900:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 902:
+    THREAD_COMPLETED
+    Thread 0 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 902:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 177 of 200). Will run for at most 3 ticks.
+
+At time 916:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 949:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 952:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 952:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 261 of 1000). Will run for at most 3 ticks.
+
+At time 999:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1002:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1002:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 520 of 1000). Will run for at most 3 ticks.
+
+At time 1012:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1015:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1015:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 19 of 1000). Will run for at most 3 ticks.
+
+At time 1025:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1028:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1028:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 506 of 1000). Will run for at most 3 ticks.
+
+At time 1038:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1041:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1041:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (ticket 998 of 1000). Will run for at most 3 ticks.
+
+At time 1088:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1091:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1091:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 608 of 1000). Will run for at most 3 ticks.
+
+At time 1138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1141:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1141:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (ticket 930 of 1000). Will run for at most 3 ticks.
+
+At time 1188:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1191:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1191:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (ticket 872 of 1000). Will run for at most 3 ticks.
+
+At time 1201:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1202:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1202:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (ticket 129 of 800). Will run for at most 3 ticks.
+
+At time 1216:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1249:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1252:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1252:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 795 of 1000). Will run for at most 3 ticks.
+
+At time 1262:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1265:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1265:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 494 of 1000). Will run for at most 3 ticks.
+
+At time 1275:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1278:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1278:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 550 of 1000). Will run for at most 3 ticks.
+
+At time 1288:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1291:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1291:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 145 of 200). Will run for at most 3 ticks.
+
+At time 1316:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1338:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1341:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1341:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 14 of 1000). Will run for at most 3 ticks.
+
+At time 1388:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1391:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1391:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 449 of 1000). Will run for at most 3 ticks.
+
+At time 1401:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1404:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1404:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 183 of 1000). Will run for at most 3 ticks.
+
+At time 1414:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1417:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1417:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 56 of 1000). Will run for at most 3 ticks.
+
+At time 1427:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1430:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1430:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 191 of 1000). Will run for at most 3 ticks.
+
+At time 1440:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1443:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1443:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 12 of 1000). Will run for at most 3 ticks.
+
+At time 1453:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1456:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1456:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 84 of 1000). Will run for at most 3 ticks.
+
+At time 1466:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1469:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1469:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 0 of 1000). Will run for at most 3 ticks.
+
+At time 1479:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1482:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1482:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 26 of 200). Will run for at most 3 ticks.
+
+At time 1504:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1529:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1531:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1531:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 1 threads (ticket 184 of 800). Will run for at most 3 ticks.
+
+At time 1551:
+    IO_BURST_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1579:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1579:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 182 of 200). Will run for at most 3 ticks.
+
+At time 1593:
+    IO_BURST_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1626:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1629:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1629:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 576 of 1000). Will run for at most 3 ticks.
+
+At time 1676:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1679:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1679:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 923 of 1000). Will run for at most 3 ticks.
+
+At time 1689:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1692:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1692:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 2 threads (ticket 24 of 1000). Will run for at most 3 ticks.
+
+At time 1739:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1742:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1742:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 764 of 1000). Will run for at most 3 ticks.
+
+At time 1789:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1792:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1792:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 749 of 1000). Will run for at most 3 ticks.
+
+At time 1802:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1805:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1805:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 763 of 1000). Will run for at most 3 ticks.
+
+At time 1815:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1818:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1818:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 986 of 1000). Will run for at most 3 ticks.
+
+At time 1828:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1831:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1831:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 564 of 1000). Will run for at most 3 ticks.
+
+At time 1841:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1844:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1844:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 485 of 1000). Will run for at most 3 ticks.
+
+At time 1854:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1857:
+    THREAD_PREEMPTED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1857:
+    DISPATCHER_INVOKED
+    Thread 1 in process 59 [SYSTEM]
+    Selected from 2 threads (ticket 246 of 1000). Will run for at most 3 ticks.
+
+At time 1867:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1870:
+    THREAD_COMPLETED
+    Thread 1 in process 59 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 1870:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 192 of 200). Will run for at most 3 ticks.
+
+At time 1917:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1920:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1920:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 132 of 200). Will run for at most 3 ticks.
+
+At time 1930:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1933:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1933:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 108 of 200). Will run for at most 3 ticks.
+
+At time 1943:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1946:
+    THREAD_PREEMPTED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1946:
+    DISPATCHER_INVOKED
+    Thread 0 in process 189 [NORMAL]
+    Selected from 1 threads (ticket 119 of 200). Will run for at most 3 ticks.
+
+At time 1956:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1957:
+    THREAD_COMPLETED
+    Thread 0 in process 189 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      548.00
+    Avg. turnaround time:   9248.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      468.12
+    Avg. turnaround time:  10466.62
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      502.00
+    Avg. turnaround time:  13777.50
+
+Total elapsed time:          16607
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         15421
+Total idle time:                59
+
+CPU utilization:            99.64%
+CPU efficiency:              6.79%
+
@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 13347  END: 13395 
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 15681  END: 15691 
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 9248   END: 9330  
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 298    END: 356   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 14822  END: 14850 
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 11295  END: 11328 
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 16607  END: 16607 
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 15972  END: 16025 
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 6850   END: 6908  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 14008  END: 14078 
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 15114  END: 15161 
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 1781   END: 1820  
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 13068  END: 13155 
+
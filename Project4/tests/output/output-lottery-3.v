@@ -0,0 +1,6317 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 13 of 100). Will run for at most 3 ticks.
+
+At time 10:
+    THREAD_ARRIVED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from NEW to READY
+
+At time 28:
+    THREAD_ARRIVED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    THREAD_ARRIVED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 51:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 51:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 7 threads (ticket 163 of 1200). Will run for at most 3 ticks.
+
+At time 53:
+    THREAD_ARRIVED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 70:
+    THREAD_ARRIVED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 82:
+    THREAD_ARRIVED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 87:
+    THREAD_ARRIVED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 99:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 102:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 102:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 13 threads (ticket 1082 of 2400). Will run for at most 3 ticks.
+
+At time 150:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 153:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 153:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 13 threads (ticket 50 of 2400). Will run for at most 3 ticks.
+
+At time 201:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 204:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 204:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 13 threads (ticket 842 of 2400). Will run for at most 3 ticks.
+
+At time 252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 255:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 255:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 13 threads (ticket 2187 of 2400). Will run for at most 3 ticks.
+
+At time 303:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 306:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 306:
+    DISPATCHER_INVOKED
+    Thread 0 in process 395 [NORMAL]
+    Selected from 13 threads (ticket 1129 of 2400). Will run for at most 3 ticks.
+
+At time 354:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 356:
+    THREAD_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 356:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads (ticket 163 of 2200). Will run for at most 3 ticks.
+
+At time 404:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 407:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 407:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 1253 of 2200). Will run for at most 3 ticks.
+
+At time 455:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 458:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 458:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 1397 of 2200). Will run for at most 3 ticks.
+
+At time 477:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 480:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 480:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads (ticket 196 of 2200). Will run for at most 3 ticks.
+
+At time 528:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 531:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 531:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 1223 of 2200). Will run for at most 3 ticks.
+
+At time 579:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 582:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 582:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads (ticket 1737 of 2200). Will run for at most 3 ticks.
+
+At time 630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 633:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 633:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 487 of 2200). Will run for at most 3 ticks.
+
+At time 681:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 684:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 684:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads (ticket 921 of 2200). Will run for at most 3 ticks.
+
+At time 732:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 735:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 735:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 549 of 2200). Will run for at most 3 ticks.
+
+At time 783:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 786:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 786:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 642 of 2200). Will run for at most 3 ticks.
+
+At time 805:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 808:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 808:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads (ticket 1767 of 2200). Will run for at most 3 ticks.
+
+At time 856:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 859:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 859:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads (ticket 1044 of 2200). Will run for at most 3 ticks.
+
+At time 907:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 910:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 910:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 593 of 2200). Will run for at most 3 ticks.
+
+At time 958:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 961:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 961:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 629 of 2200). Will run for at most 3 ticks.
+
+At time 980:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 983:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 983:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads (ticket 1647 of 2200). Will run for at most 3 ticks.
+
+At time 1031:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1034:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1034:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 12 threads (ticket 1007 of 2200). Will run for at most 3 ticks.
+
+At time 1082:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1085:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1085:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 673 of 2200). Will run for at most 3 ticks.
+
+At time 1133:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1136:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1136:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 707 of 2200). Will run for at most 3 ticks.
+
+At time 1155:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1158:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1158:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads (ticket 248 of 2200). Will run for at most 3 ticks.
+
+At time 1206:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1209:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1209:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 12 threads (ticket 262 of 2200). Will run for at most 3 ticks.
+
+At time 1228:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1231:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1231:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 12 threads (ticket 152 of 2200). Will run for at most 3 ticks.
+
+At time 1279:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1282:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1282:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads (ticket 1528 of 2200). Will run for at most 3 ticks.
+
+At time 1330:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1333:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1333:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads (ticket 1425 of 2200). Will run for at most 3 ticks.
+
+At time 1352:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1355:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1355:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 12 threads (ticket 1738 of 2200). Will run for at most 3 ticks.
+
+At time 1374:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1377:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1377:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads (ticket 863 of 2200). Will run for at most 3 ticks.
+
+At time 1425:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1428:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1428:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 12 threads (ticket 1165 of 2200). Will run for at most 3 ticks.
+
+At time 1476:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1479:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1479:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads (ticket 876 of 2200). Will run for at most 3 ticks.
+
+At time 1527:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1530:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1530:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 418 of 2200). Will run for at most 3 ticks.
+
+At time 1578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1581:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1581:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 1313 of 2200). Will run for at most 3 ticks.
+
+At time 1600:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1602:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1602:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1776 of 2000). Will run for at most 3 ticks.
+
+At time 1610:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1621:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1624:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1624:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 12 threads (ticket 815 of 2200). Will run for at most 3 ticks.
+
+At time 1672:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1675:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1675:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 12 threads (ticket 84 of 2200). Will run for at most 3 ticks.
+
+At time 1723:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1726:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1726:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 623 of 2200). Will run for at most 3 ticks.
+
+At time 1774:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1777:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1777:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 1947 of 2200). Will run for at most 3 ticks.
+
+At time 1796:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1799:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1799:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    Selected from 12 threads (ticket 575 of 2200). Will run for at most 3 ticks.
+
+At time 1818:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1820:
+    THREAD_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1820:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1040 of 2000). Will run for at most 3 ticks.
+
+At time 1839:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1842:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1842:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 39 of 2000). Will run for at most 3 ticks.
+
+At time 1890:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1893:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 1893:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1013 of 2000). Will run for at most 3 ticks.
+
+At time 1941:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1944:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1944:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 1997 of 2000). Will run for at most 3 ticks.
+
+At time 1992:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1995:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1995:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1095 of 1800). Will run for at most 3 ticks.
+
+At time 2018:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2043:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2046:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2046:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1860 of 2000). Will run for at most 3 ticks.
+
+At time 2065:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2068:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2068:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1744 of 2000). Will run for at most 3 ticks.
+
+At time 2087:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2090:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2090:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 324 of 2000). Will run for at most 3 ticks.
+
+At time 2138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2141:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2141:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 1591 of 2000). Will run for at most 3 ticks.
+
+At time 2189:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2192:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2192:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (ticket 790 of 1600). Will run for at most 3 ticks.
+
+At time 2195:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2240:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2243:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2243:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1101 of 2000). Will run for at most 3 ticks.
+
+At time 2291:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2294:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2294:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 1457 of 2000). Will run for at most 3 ticks.
+
+At time 2342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2345:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2345:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 28 of 2000). Will run for at most 3 ticks.
+
+At time 2393:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2396:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2396:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 899 of 2000). Will run for at most 3 ticks.
+
+At time 2444:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2447:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2447:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 366 of 2000). Will run for at most 3 ticks.
+
+At time 2495:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2498:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2498:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (ticket 113 of 2000). Will run for at most 3 ticks.
+
+At time 2546:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2548:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2548:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 364 of 1900). Will run for at most 3 ticks.
+
+At time 2561:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2596:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2599:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2599:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 24 of 2000). Will run for at most 3 ticks.
+
+At time 2647:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2650:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2650:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 169 of 2000). Will run for at most 3 ticks.
+
+At time 2698:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2701:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2701:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 1 of 2000). Will run for at most 3 ticks.
+
+At time 2749:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2752:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2752:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 268 of 2000). Will run for at most 3 ticks.
+
+At time 2800:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2803:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2803:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 462 of 2000). Will run for at most 3 ticks.
+
+At time 2851:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2854:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2854:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1822 of 2000). Will run for at most 3 ticks.
+
+At time 2902:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2905:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2905:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1152 of 2000). Will run for at most 3 ticks.
+
+At time 2953:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2956:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2956:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1847 of 2000). Will run for at most 3 ticks.
+
+At time 3004:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3007:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3007:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 48 of 2000). Will run for at most 3 ticks.
+
+At time 3055:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3058:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3058:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 1529 of 2000). Will run for at most 3 ticks.
+
+At time 3106:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3109:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3109:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 1498 of 2000). Will run for at most 3 ticks.
+
+At time 3128:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3131:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3131:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 1527 of 2000). Will run for at most 3 ticks.
+
+At time 3150:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3152:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3152:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1776 of 1800). Will run for at most 3 ticks.
+
+At time 3182:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3200:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3203:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3203:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1129 of 2000). Will run for at most 3 ticks.
+
+At time 3251:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3254:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3254:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 922 of 1900). Will run for at most 3 ticks.
+
+At time 3267:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3302:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3305:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3305:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 492 of 2000). Will run for at most 3 ticks.
+
+At time 3353:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3356:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3356:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 1922 of 2000). Will run for at most 3 ticks.
+
+At time 3404:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3407:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3407:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 1321 of 2000). Will run for at most 3 ticks.
+
+At time 3455:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3458:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3458:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 1082 of 2000). Will run for at most 3 ticks.
+
+At time 3506:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3509:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3509:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 1194 of 2000). Will run for at most 3 ticks.
+
+At time 3528:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3531:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3531:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 1144 of 2000). Will run for at most 3 ticks.
+
+At time 3550:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3551:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3551:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1101 of 1600). Will run for at most 3 ticks.
+
+At time 3558:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3599:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3602:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3602:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 1297 of 1800). Will run for at most 3 ticks.
+
+At time 3605:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3653:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3653:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 919 of 2000). Will run for at most 3 ticks.
+
+At time 3672:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3675:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 3675:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 1272 of 2000). Will run for at most 3 ticks.
+
+At time 3723:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3726:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3726:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1549 of 2000). Will run for at most 3 ticks.
+
+At time 3774:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3777:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3777:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1793 of 2000). Will run for at most 3 ticks.
+
+At time 3796:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3799:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3799:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 1346 of 2000). Will run for at most 3 ticks.
+
+At time 3847:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3850:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3850:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 10 threads (ticket 650 of 1800). Will run for at most 3 ticks.
+
+At time 3867:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3898:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3901:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3901:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 22 of 2000). Will run for at most 3 ticks.
+
+At time 3949:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3952:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 3952:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 286 of 2000). Will run for at most 3 ticks.
+
+At time 4000:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4003:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4003:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 988 of 2000). Will run for at most 3 ticks.
+
+At time 4051:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4054:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4054:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1457 of 2000). Will run for at most 3 ticks.
+
+At time 4102:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4105:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4105:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1561 of 2000). Will run for at most 3 ticks.
+
+At time 4124:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4127:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4127:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (ticket 541 of 2000). Will run for at most 3 ticks.
+
+At time 4175:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4178:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 4178:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 281 of 2000). Will run for at most 3 ticks.
+
+At time 4226:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4227:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4227:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1391 of 1800). Will run for at most 3 ticks.
+
+At time 4245:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4246:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4249:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4249:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 947 of 2000). Will run for at most 3 ticks.
+
+At time 4297:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4300:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4300:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 1933 of 2000). Will run for at most 3 ticks.
+
+At time 4348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4349:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4349:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1605 of 1800). Will run for at most 3 ticks.
+
+At time 4378:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4397:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4400:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4400:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1363 of 2000). Will run for at most 3 ticks.
+
+At time 4448:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4449:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4449:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 1214 of 1900). Will run for at most 3 ticks.
+
+At time 4475:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 4497:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4500:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4500:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 1759 of 2000). Will run for at most 3 ticks.
+
+At time 4548:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4551:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4551:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1530 of 2000). Will run for at most 3 ticks.
+
+At time 4599:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4602:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4602:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 86 of 2000). Will run for at most 3 ticks.
+
+At time 4650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4653:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4653:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (ticket 1646 of 1900). Will run for at most 3 ticks.
+
+At time 4669:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 4701:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4704:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4704:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 536 of 2000). Will run for at most 3 ticks.
+
+At time 4752:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4755:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4755:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1908 of 2000). Will run for at most 3 ticks.
+
+At time 4803:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4806:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4806:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 140 of 2000). Will run for at most 3 ticks.
+
+At time 4854:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4857:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4857:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 575 of 2000). Will run for at most 3 ticks.
+
+At time 4905:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4908:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4908:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 820 of 2000). Will run for at most 3 ticks.
+
+At time 4927:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4930:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4930:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 1435 of 2000). Will run for at most 3 ticks.
+
+At time 4978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 4981:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 4981:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 1296 of 2000). Will run for at most 3 ticks.
+
+At time 5000:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5003:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5003:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 1181 of 2000). Will run for at most 3 ticks.
+
+At time 5022:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5025:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5025:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 188 of 2000). Will run for at most 3 ticks.
+
+At time 5073:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5076:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5076:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 202 of 2000). Will run for at most 3 ticks.
+
+At time 5124:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5127:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5127:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 464 of 2000). Will run for at most 3 ticks.
+
+At time 5175:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5178:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5178:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 1401 of 2000). Will run for at most 3 ticks.
+
+At time 5226:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5229:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5229:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (ticket 565 of 1600). Will run for at most 3 ticks.
+
+At time 5232:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 5277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5280:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5280:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 10 threads (ticket 894 of 1800). Will run for at most 3 ticks.
+
+At time 5300:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5328:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5331:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5331:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1330 of 2000). Will run for at most 3 ticks.
+
+At time 5350:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5353:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5353:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1328 of 2000). Will run for at most 3 ticks.
+
+At time 5372:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5375:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5375:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 615 of 2000). Will run for at most 3 ticks.
+
+At time 5423:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5425:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5425:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 359 of 1600). Will run for at most 3 ticks.
+
+At time 5449:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 5473:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5476:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5476:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1607 of 2000). Will run for at most 3 ticks.
+
+At time 5495:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5498:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5498:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1480 of 2000). Will run for at most 3 ticks.
+
+At time 5546:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 5549:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 5549:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 303 of 2000). Will run for at most 3 ticks.
+
+At time 5597:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5600:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5600:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1573 of 2000). Will run for at most 3 ticks.
+
+At time 5648:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5651:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5651:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 998 of 2000). Will run for at most 3 ticks.
+
+At time 5699:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5702:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5702:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 528 of 2000). Will run for at most 3 ticks.
+
+At time 5750:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5753:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5753:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 1008 of 2000). Will run for at most 3 ticks.
+
+At time 5801:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5804:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5804:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 986 of 2000). Will run for at most 3 ticks.
+
+At time 5823:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5826:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5826:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 743 of 2000). Will run for at most 3 ticks.
+
+At time 5874:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5877:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5877:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 1027 of 2000). Will run for at most 3 ticks.
+
+At time 5925:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5928:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5928:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 453 of 2000). Will run for at most 3 ticks.
+
+At time 5976:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 5979:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 5979:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 565 of 2000). Will run for at most 3 ticks.
+
+At time 5998:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6001:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6001:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 820 of 2000). Will run for at most 3 ticks.
+
+At time 6049:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6052:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6052:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 11 threads (ticket 249 of 2000). Will run for at most 3 ticks.
+
+At time 6100:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6103:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6103:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 1620 of 2000). Will run for at most 3 ticks.
+
+At time 6151:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6154:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6154:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 1712 of 2000). Will run for at most 3 ticks.
+
+At time 6202:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6205:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6205:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 1741 of 2000). Will run for at most 3 ticks.
+
+At time 6224:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6227:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6227:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 111 of 2000). Will run for at most 3 ticks.
+
+At time 6275:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6278:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6278:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 943 of 2000). Will run for at most 3 ticks.
+
+At time 6326:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6329:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6329:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1422 of 2000). Will run for at most 3 ticks.
+
+At time 6377:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6380:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6380:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 45 of 2000). Will run for at most 3 ticks.
+
+At time 6428:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6431:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6431:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 11 threads (ticket 1765 of 2000). Will run for at most 3 ticks.
+
+At time 6479:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6482:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6482:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1316 of 2000). Will run for at most 3 ticks.
+
+At time 6530:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6533:
+    THREAD_PREEMPTED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6533:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1445 of 2000). Will run for at most 3 ticks.
+
+At time 6552:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6555:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6555:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 739 of 2000). Will run for at most 3 ticks.
+
+At time 6603:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6606:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6606:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 11 threads (ticket 95 of 2000). Will run for at most 3 ticks.
+
+At time 6654:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6657:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6657:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 11 threads (ticket 1026 of 2000). Will run for at most 3 ticks.
+
+At time 6705:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6708:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6708:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1228 of 2000). Will run for at most 3 ticks.
+
+At time 6756:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6759:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 6759:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 11 threads (ticket 732 of 2000). Will run for at most 3 ticks.
+
+At time 6807:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6808:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6808:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (ticket 710 of 1800). Will run for at most 3 ticks.
+
+At time 6836:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6856:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6859:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6859:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    Selected from 11 threads (ticket 1388 of 2000). Will run for at most 3 ticks.
+
+At time 6907:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 6908:
+    THREAD_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 6908:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 341 of 1900). Will run for at most 3 ticks.
+
+At time 6956:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 6959:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 6959:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 883 of 1900). Will run for at most 3 ticks.
+
+At time 7007:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7010:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7010:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (ticket 1127 of 1900). Will run for at most 3 ticks.
+
+At time 7058:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7061:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7061:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 872 of 1900). Will run for at most 3 ticks.
+
+At time 7109:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7112:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7112:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (ticket 44 of 1900). Will run for at most 3 ticks.
+
+At time 7160:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7163:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7163:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 819 of 1700). Will run for at most 3 ticks.
+
+At time 7164:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7211:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7214:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7214:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 821 of 1900). Will run for at most 3 ticks.
+
+At time 7262:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7264:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7264:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads (ticket 504 of 1700). Will run for at most 3 ticks.
+
+At time 7290:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7312:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7315:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 7315:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (ticket 177 of 1900). Will run for at most 3 ticks.
+
+At time 7363:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7366:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7366:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 623 of 1900). Will run for at most 3 ticks.
+
+At time 7414:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7417:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 7417:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 248 of 1900). Will run for at most 3 ticks.
+
+At time 7465:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7468:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7468:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 688 of 1900). Will run for at most 3 ticks.
+
+At time 7516:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7519:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 7519:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1570 of 1900). Will run for at most 3 ticks.
+
+At time 7567:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7570:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7570:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (ticket 1004 of 1900). Will run for at most 3 ticks.
+
+At time 7618:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7621:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7621:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (ticket 61 of 1900). Will run for at most 3 ticks.
+
+At time 7669:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7672:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7672:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1788 of 1900). Will run for at most 3 ticks.
+
+At time 7720:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7723:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7723:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 399 of 1900). Will run for at most 3 ticks.
+
+At time 7742:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7745:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7745:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 613 of 1900). Will run for at most 3 ticks.
+
+At time 7793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7796:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7796:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 792 of 1500). Will run for at most 3 ticks.
+
+At time 7802:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 7844:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7847:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7847:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1759 of 1900). Will run for at most 3 ticks.
+
+At time 7895:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7898:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7898:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 1099 of 1900). Will run for at most 3 ticks.
+
+At time 7946:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7949:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7949:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 773 of 1500). Will run for at most 3 ticks.
+
+At time 7964:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 7997:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8000:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8000:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 711 of 1900). Will run for at most 3 ticks.
+
+At time 8048:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8051:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8051:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 10 threads (ticket 516 of 1900). Will run for at most 3 ticks.
+
+At time 8099:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8102:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8102:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 842 of 1900). Will run for at most 3 ticks.
+
+At time 8150:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8153:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8153:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (ticket 1200 of 1900). Will run for at most 3 ticks.
+
+At time 8201:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8204:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8204:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 921 of 1900). Will run for at most 3 ticks.
+
+At time 8252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8255:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8255:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1725 of 1900). Will run for at most 3 ticks.
+
+At time 8303:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8306:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8306:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (ticket 1213 of 1900). Will run for at most 3 ticks.
+
+At time 8354:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8355:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8355:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 1045 of 1800). Will run for at most 3 ticks.
+
+At time 8377:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 8403:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8406:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8406:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 931 of 1900). Will run for at most 3 ticks.
+
+At time 8454:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8457:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8457:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 397 of 1900). Will run for at most 3 ticks.
+
+At time 8505:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8508:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8508:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 357 of 1700). Will run for at most 3 ticks.
+
+At time 8517:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 8556:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8559:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8559:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 924 of 1900). Will run for at most 3 ticks.
+
+At time 8607:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8610:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8610:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 10 threads (ticket 1661 of 1900). Will run for at most 3 ticks.
+
+At time 8658:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8661:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8661:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 1734 of 1900). Will run for at most 3 ticks.
+
+At time 8709:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8712:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8712:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 517 of 1900). Will run for at most 3 ticks.
+
+At time 8731:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8734:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8734:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 859 of 1900). Will run for at most 3 ticks.
+
+At time 8782:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8785:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 8785:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 10 threads (ticket 1072 of 1900). Will run for at most 3 ticks.
+
+At time 8833:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8836:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8836:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 405 of 1900). Will run for at most 3 ticks.
+
+At time 8884:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8887:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8887:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (ticket 91 of 1900). Will run for at most 3 ticks.
+
+At time 8935:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8936:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8936:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 1208 of 1700). Will run for at most 3 ticks.
+
+At time 8952:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 8984:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8987:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8987:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 10 threads (ticket 1199 of 1900). Will run for at most 3 ticks.
+
+At time 9035:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9037:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9037:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads (ticket 818 of 1700). Will run for at most 3 ticks.
+
+At time 9066:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9085:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9088:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 9088:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 10 threads (ticket 1166 of 1900). Will run for at most 3 ticks.
+
+At time 9107:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9110:
+    THREAD_PREEMPTED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 9110:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 10 threads (ticket 112 of 1900). Will run for at most 3 ticks.
+
+At time 9158:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9159:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9159:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads (ticket 696 of 1700). Will run for at most 3 ticks.
+
+At time 9167:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9207:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9210:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9210:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 10 threads (ticket 1428 of 1900). Will run for at most 3 ticks.
+
+At time 9258:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9259:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9259:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 178 of 1700). Will run for at most 3 ticks.
+
+At time 9278:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9281:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9281:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    Selected from 9 threads (ticket 1198 of 1700). Will run for at most 3 ticks.
+
+At time 9283:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9329:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 9330:
+    THREAD_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 9330:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 126 of 1500). Will run for at most 3 ticks.
+
+At time 9378:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9380:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9380:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads (ticket 82 of 1300). Will run for at most 3 ticks.
+
+At time 9388:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9428:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9431:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9431:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 9 threads (ticket 278 of 1500). Will run for at most 3 ticks.
+
+At time 9450:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9453:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9453:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 9 threads (ticket 1254 of 1500). Will run for at most 3 ticks.
+
+At time 9501:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9504:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9504:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 885 of 1500). Will run for at most 3 ticks.
+
+At time 9552:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9555:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9555:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 1336 of 1500). Will run for at most 3 ticks.
+
+At time 9574:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9575:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9575:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 8 threads (ticket 1236 of 1300). Will run for at most 3 ticks.
+
+At time 9596:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9623:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9626:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9626:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 30 of 1500). Will run for at most 3 ticks.
+
+At time 9674:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9677:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9677:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 910 of 1500). Will run for at most 3 ticks.
+
+At time 9696:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9699:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9699:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 750 of 1500). Will run for at most 3 ticks.
+
+At time 9747:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9750:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9750:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 634 of 1500). Will run for at most 3 ticks.
+
+At time 9798:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9801:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9801:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads (ticket 1109 of 1500). Will run for at most 3 ticks.
+
+At time 9849:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 9852:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 9852:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 363 of 1500). Will run for at most 3 ticks.
+
+At time 9900:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9903:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9903:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 772 of 1500). Will run for at most 3 ticks.
+
+At time 9922:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9925:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9925:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 760 of 1500). Will run for at most 3 ticks.
+
+At time 9944:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9947:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9947:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 698 of 1500). Will run for at most 3 ticks.
+
+At time 9995:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9998:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9998:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 584 of 1300). Will run for at most 3 ticks.
+
+At time 9999:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10046:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10049:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10049:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 8 threads (ticket 185 of 1300). Will run for at most 3 ticks.
+
+At time 10064:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10097:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10100:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10100:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 875 of 1500). Will run for at most 3 ticks.
+
+At time 10148:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10151:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10151:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 991 of 1500). Will run for at most 3 ticks.
+
+At time 10199:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10202:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10202:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 642 of 1500). Will run for at most 3 ticks.
+
+At time 10221:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10224:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10224:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 715 of 1500). Will run for at most 3 ticks.
+
+At time 10272:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10275:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10275:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 797 of 1500). Will run for at most 3 ticks.
+
+At time 10294:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10297:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10297:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 391 of 1500). Will run for at most 3 ticks.
+
+At time 10345:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10348:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10348:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 1358 of 1500). Will run for at most 3 ticks.
+
+At time 10367:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10368:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10368:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 337 of 1300). Will run for at most 3 ticks.
+
+At time 10378:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10387:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10390:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10390:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 1026 of 1500). Will run for at most 3 ticks.
+
+At time 10438:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10441:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10441:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 950 of 1500). Will run for at most 3 ticks.
+
+At time 10460:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10463:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10463:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 1190 of 1300). Will run for at most 3 ticks.
+
+At time 10492:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10511:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10514:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10514:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 9 threads (ticket 1432 of 1500). Will run for at most 3 ticks.
+
+At time 10562:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10565:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10565:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads (ticket 1178 of 1500). Will run for at most 3 ticks.
+
+At time 10613:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10616:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10616:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 1054 of 1500). Will run for at most 3 ticks.
+
+At time 10664:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10665:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10665:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 493 of 1300). Will run for at most 3 ticks.
+
+At time 10667:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10684:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10687:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10687:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 718 of 1500). Will run for at most 3 ticks.
+
+At time 10735:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10736:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10736:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 495 of 1300). Will run for at most 3 ticks.
+
+At time 10742:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10784:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10787:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10787:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 945 of 1500). Will run for at most 3 ticks.
+
+At time 10806:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10809:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10809:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 983 of 1500). Will run for at most 3 ticks.
+
+At time 10828:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10831:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10831:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 9 threads (ticket 1484 of 1500). Will run for at most 3 ticks.
+
+At time 10879:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10882:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 10882:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 559 of 1500). Will run for at most 3 ticks.
+
+At time 10930:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10933:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10933:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 9 threads (ticket 1150 of 1500). Will run for at most 3 ticks.
+
+At time 10981:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10982:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10982:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads (ticket 204 of 1400). Will run for at most 3 ticks.
+
+At time 10995:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 11001:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11004:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11004:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 856 of 1500). Will run for at most 3 ticks.
+
+At time 11052:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11055:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11055:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 349 of 1500). Will run for at most 3 ticks.
+
+At time 11103:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11106:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11106:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 9 threads (ticket 430 of 1500). Will run for at most 3 ticks.
+
+At time 11125:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11128:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11128:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 9 threads (ticket 1048 of 1500). Will run for at most 3 ticks.
+
+At time 11176:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11179:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11179:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 9 threads (ticket 1207 of 1500). Will run for at most 3 ticks.
+
+At time 11227:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11228:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11228:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 943 of 1300). Will run for at most 3 ticks.
+
+At time 11234:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11276:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11278:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11278:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    Selected from 8 threads (ticket 523 of 1300). Will run for at most 3 ticks.
+
+At time 11302:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11326:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11328:
+    THREAD_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 11328:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 8 threads (ticket 263 of 1300). Will run for at most 3 ticks.
+
+At time 11376:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11379:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11379:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 182 of 1300). Will run for at most 3 ticks.
+
+At time 11427:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11430:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11430:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 545 of 1300). Will run for at most 3 ticks.
+
+At time 11449:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11452:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11452:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 8 threads (ticket 240 of 1300). Will run for at most 3 ticks.
+
+At time 11500:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11502:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11502:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 7 threads (ticket 559 of 1200). Will run for at most 3 ticks.
+
+At time 11524:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 11550:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11553:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11553:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 442 of 1300). Will run for at most 3 ticks.
+
+At time 11601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11604:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11604:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads (ticket 915 of 1300). Will run for at most 3 ticks.
+
+At time 11652:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11655:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11655:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 21 of 1300). Will run for at most 3 ticks.
+
+At time 11703:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11706:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11706:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 7 threads (ticket 511 of 1100). Will run for at most 3 ticks.
+
+At time 11715:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11725:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11728:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11728:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 561 of 1300). Will run for at most 3 ticks.
+
+At time 11776:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11779:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11779:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads (ticket 1117 of 1300). Will run for at most 3 ticks.
+
+At time 11827:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 11830:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 11830:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 787 of 1300). Will run for at most 3 ticks.
+
+At time 11878:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11881:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11881:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 7 threads (ticket 364 of 1100). Will run for at most 3 ticks.
+
+At time 11900:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11903:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11903:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 7 threads (ticket 724 of 1100). Will run for at most 3 ticks.
+
+At time 11905:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11951:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11954:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11954:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 79 of 1300). Will run for at most 3 ticks.
+
+At time 12002:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12005:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12005:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads (ticket 748 of 1300). Will run for at most 3 ticks.
+
+At time 12053:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12056:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12056:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 1049 of 1300). Will run for at most 3 ticks.
+
+At time 12104:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12107:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12107:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 8 threads (ticket 1189 of 1300). Will run for at most 3 ticks.
+
+At time 12155:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12158:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12158:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 8 threads (ticket 1229 of 1300). Will run for at most 3 ticks.
+
+At time 12206:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12209:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12209:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 969 of 1300). Will run for at most 3 ticks.
+
+At time 12257:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12260:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12260:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 98 of 1300). Will run for at most 3 ticks.
+
+At time 12279:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12282:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12282:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 530 of 1300). Will run for at most 3 ticks.
+
+At time 12330:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12333:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12333:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 1048 of 1300). Will run for at most 3 ticks.
+
+At time 12381:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12384:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12384:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 470 of 1300). Will run for at most 3 ticks.
+
+At time 12432:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12435:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12435:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 411 of 1300). Will run for at most 3 ticks.
+
+At time 12454:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12457:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12457:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads (ticket 830 of 1300). Will run for at most 3 ticks.
+
+At time 12505:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12508:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12508:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads (ticket 825 of 1300). Will run for at most 3 ticks.
+
+At time 12527:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12530:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12530:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 915 of 1300). Will run for at most 3 ticks.
+
+At time 12578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12581:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12581:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 8 threads (ticket 1286 of 1300). Will run for at most 3 ticks.
+
+At time 12629:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12630:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12630:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (ticket 540 of 1200). Will run for at most 3 ticks.
+
+At time 12658:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 12678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12681:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12681:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 8 threads (ticket 628 of 1300). Will run for at most 3 ticks.
+
+At time 12729:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12732:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12732:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 1162 of 1300). Will run for at most 3 ticks.
+
+At time 12780:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12783:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12783:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 7 threads (ticket 1075 of 1100). Will run for at most 3 ticks.
+
+At time 12802:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 12831:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12834:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12834:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 8 threads (ticket 519 of 1300). Will run for at most 3 ticks.
+
+At time 12853:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 12856:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 12856:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 280 of 1300). Will run for at most 3 ticks.
+
+At time 12904:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12907:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12907:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 1064 of 1300). Will run for at most 3 ticks.
+
+At time 12955:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12958:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12958:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 1136 of 1300). Will run for at most 3 ticks.
+
+At time 12977:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12980:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12980:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 1065 of 1300). Will run for at most 3 ticks.
+
+At time 12999:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13002:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13002:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 168 of 1300). Will run for at most 3 ticks.
+
+At time 13050:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13053:
+    THREAD_PREEMPTED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13053:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 8 threads (ticket 1114 of 1300). Will run for at most 3 ticks.
+
+At time 13101:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13104:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13104:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    Selected from 8 threads (ticket 127 of 1300). Will run for at most 3 ticks.
+
+At time 13152:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13155:
+    THREAD_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 13155:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 7 threads (ticket 752 of 1100). Will run for at most 3 ticks.
+
+At time 13174:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13177:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13177:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 7 threads (ticket 277 of 1100). Will run for at most 3 ticks.
+
+At time 13225:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13228:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13228:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 7 threads (ticket 739 of 1100). Will run for at most 3 ticks.
+
+At time 13276:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13279:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13279:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 7 threads (ticket 123 of 1100). Will run for at most 3 ticks.
+
+At time 13298:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13300:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13300:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 6 threads (ticket 631 of 900). Will run for at most 3 ticks.
+
+At time 13321:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13351:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13351:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (ticket 14 of 1100). Will run for at most 3 ticks.
+
+At time 13370:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13373:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13373:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    Selected from 7 threads (ticket 111 of 1100). Will run for at most 3 ticks.
+
+At time 13392:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13395:
+    THREAD_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 13395:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads (ticket 832 of 900). Will run for at most 3 ticks.
+
+At time 13443:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13446:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13446:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 6 threads (ticket 431 of 900). Will run for at most 3 ticks.
+
+At time 13494:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13497:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13497:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 6 threads (ticket 180 of 900). Will run for at most 3 ticks.
+
+At time 13545:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13548:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13548:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads (ticket 332 of 900). Will run for at most 3 ticks.
+
+At time 13596:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13599:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13599:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads (ticket 824 of 900). Will run for at most 3 ticks.
+
+At time 13647:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13648:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13648:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 5 threads (ticket 627 of 800). Will run for at most 3 ticks.
+
+At time 13668:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 13696:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13699:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13699:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads (ticket 219 of 900). Will run for at most 3 ticks.
+
+At time 13747:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13750:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13750:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads (ticket 640 of 900). Will run for at most 3 ticks.
+
+At time 13798:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13801:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13801:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 6 threads (ticket 53 of 900). Will run for at most 3 ticks.
+
+At time 13849:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13852:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13852:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 6 threads (ticket 442 of 900). Will run for at most 3 ticks.
+
+At time 13900:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13903:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13903:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 6 threads (ticket 602 of 900). Will run for at most 3 ticks.
+
+At time 13951:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 13954:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 13954:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads (ticket 344 of 900). Will run for at most 3 ticks.
+
+At time 14002:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14005:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14005:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 6 threads (ticket 220 of 900). Will run for at most 3 ticks.
+
+At time 14024:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14027:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14027:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    Selected from 5 threads (ticket 503 of 700). Will run for at most 3 ticks.
+
+At time 14031:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14075:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14078:
+    THREAD_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 14078:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 5 threads (ticket 153 of 700). Will run for at most 3 ticks.
+
+At time 14126:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14129:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14129:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 5 threads (ticket 487 of 700). Will run for at most 3 ticks.
+
+At time 14148:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14151:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14151:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads (ticket 350 of 700). Will run for at most 3 ticks.
+
+At time 14199:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14201:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14201:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 4 threads (ticket 100 of 500). Will run for at most 3 ticks.
+
+At time 14229:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14249:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14252:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14252:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads (ticket 547 of 700). Will run for at most 3 ticks.
+
+At time 14300:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14303:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14303:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads (ticket 652 of 700). Will run for at most 3 ticks.
+
+At time 14322:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14325:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14325:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads (ticket 238 of 700). Will run for at most 3 ticks.
+
+At time 14373:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14376:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14376:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads (ticket 593 of 700). Will run for at most 3 ticks.
+
+At time 14424:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14427:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14427:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads (ticket 689 of 700). Will run for at most 3 ticks.
+
+At time 14446:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14449:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14449:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads (ticket 259 of 700). Will run for at most 3 ticks.
+
+At time 14497:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14500:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14500:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 5 threads (ticket 450 of 700). Will run for at most 3 ticks.
+
+At time 14548:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14551:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14551:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 5 threads (ticket 63 of 700). Will run for at most 3 ticks.
+
+At time 14599:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14602:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14602:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads (ticket 523 of 700). Will run for at most 3 ticks.
+
+At time 14650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14653:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14653:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 5 threads (ticket 107 of 700). Will run for at most 3 ticks.
+
+At time 14701:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14704:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14704:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 5 threads (ticket 335 of 700). Will run for at most 3 ticks.
+
+At time 14752:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14755:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14755:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 5 threads (ticket 432 of 700). Will run for at most 3 ticks.
+
+At time 14774:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14777:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14777:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads (ticket 694 of 700). Will run for at most 3 ticks.
+
+At time 14825:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14828:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14828:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    Selected from 5 threads (ticket 563 of 700). Will run for at most 3 ticks.
+
+At time 14847:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14850:
+    THREAD_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 14850:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 4 threads (ticket 332 of 500). Will run for at most 3 ticks.
+
+At time 14898:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14901:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14901:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads (ticket 452 of 500). Will run for at most 3 ticks.
+
+At time 14920:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14923:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 14923:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 4 threads (ticket 438 of 500). Will run for at most 3 ticks.
+
+At time 14942:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14944:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14944:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 3 threads (ticket 172 of 400). Will run for at most 3 ticks.
+
+At time 14957:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 14992:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14995:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14995:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 4 threads (ticket 301 of 500). Will run for at most 3 ticks.
+
+At time 15014:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15017:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15017:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 4 threads (ticket 446 of 500). Will run for at most 3 ticks.
+
+At time 15036:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15039:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15039:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 4 threads (ticket 99 of 500). Will run for at most 3 ticks.
+
+At time 15087:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15090:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15090:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 4 threads (ticket 496 of 500). Will run for at most 3 ticks.
+
+At time 15138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15141:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15141:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    Selected from 4 threads (ticket 384 of 500). Will run for at most 3 ticks.
+
+At time 15160:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15161:
+    THREAD_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 15161:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 3 threads (ticket 297 of 300). Will run for at most 3 ticks.
+
+At time 15209:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15212:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15212:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 3 threads (ticket 218 of 300). Will run for at most 3 ticks.
+
+At time 15231:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15234:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15234:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (ticket 141 of 300). Will run for at most 3 ticks.
+
+At time 15253:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15256:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15256:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (ticket 130 of 300). Will run for at most 3 ticks.
+
+At time 15275:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15278:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15278:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (ticket 122 of 300). Will run for at most 3 ticks.
+
+At time 15297:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15300:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15300:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 2 threads (ticket 190 of 200). Will run for at most 3 ticks.
+
+At time 15308:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 15319:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15322:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15322:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (ticket 265 of 300). Will run for at most 3 ticks.
+
+At time 15341:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15344:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15344:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 3 threads (ticket 106 of 300). Will run for at most 3 ticks.
+
+At time 15363:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15366:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15366:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads (ticket 151 of 200). Will run for at most 3 ticks.
+
+At time 15385:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15388:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15388:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads (ticket 149 of 200). Will run for at most 3 ticks.
+
+At time 15396:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 15407:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15410:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15410:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (ticket 149 of 300). Will run for at most 3 ticks.
+
+At time 15429:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15432:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15432:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (ticket 142 of 300). Will run for at most 3 ticks.
+
+At time 15451:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15454:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15454:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 3 threads (ticket 16 of 300). Will run for at most 3 ticks.
+
+At time 15502:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15505:
+    THREAD_PREEMPTED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15505:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 3 threads (ticket 267 of 300). Will run for at most 3 ticks.
+
+At time 15553:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15556:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15556:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 3 threads (ticket 234 of 300). Will run for at most 3 ticks.
+
+At time 15575:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15578:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15578:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (ticket 159 of 300). Will run for at most 3 ticks.
+
+At time 15597:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15600:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15600:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (ticket 157 of 300). Will run for at most 3 ticks.
+
+At time 15619:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15622:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15622:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 3 threads (ticket 118 of 300). Will run for at most 3 ticks.
+
+At time 15641:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15642:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15642:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    Selected from 2 threads (ticket 68 of 200). Will run for at most 3 ticks.
+
+At time 15666:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 15690:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15691:
+    THREAD_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 15691:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads (ticket 26 of 200). Will run for at most 3 ticks.
+
+At time 15739:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15742:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15742:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 2 threads (ticket 142 of 200). Will run for at most 3 ticks.
+
+At time 15761:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15764:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15764:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads (ticket 85 of 200). Will run for at most 3 ticks.
+
+At time 15783:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15786:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15786:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 2 threads (ticket 188 of 200). Will run for at most 3 ticks.
+
+At time 15805:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15808:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15808:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads (ticket 52 of 200). Will run for at most 3 ticks.
+
+At time 15827:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15829:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15829:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 1 threads (ticket 50 of 100). Will run for at most 3 ticks.
+
+At time 15836:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 15848:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15850:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15850:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 98 of 100). Will run for at most 3 ticks.
+
+At time 15853:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 15869:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15872:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15872:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 2 threads (ticket 123 of 200). Will run for at most 3 ticks.
+
+At time 15891:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15894:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15894:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads (ticket 51 of 200). Will run for at most 3 ticks.
+
+At time 15913:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15916:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15916:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 2 threads (ticket 195 of 200). Will run for at most 3 ticks.
+
+At time 15935:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15938:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15938:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 2 threads (ticket 81 of 200). Will run for at most 3 ticks.
+
+At time 15957:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15960:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15960:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 2 threads (ticket 138 of 200). Will run for at most 3 ticks.
+
+At time 15979:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 15982:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 15982:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 2 threads (ticket 108 of 200). Will run for at most 3 ticks.
+
+At time 16001:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16004:
+    THREAD_PREEMPTED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16004:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    Selected from 2 threads (ticket 153 of 200). Will run for at most 3 ticks.
+
+At time 16023:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16025:
+    THREAD_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 16025:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 15 of 100). Will run for at most 3 ticks.
+
+At time 16044:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16047:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16047:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 70 of 100). Will run for at most 3 ticks.
+
+At time 16066:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16069:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16069:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 69 of 100). Will run for at most 3 ticks.
+
+At time 16088:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16091:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16091:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 49 of 100). Will run for at most 3 ticks.
+
+At time 16110:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16113:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16113:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 27 of 100). Will run for at most 3 ticks.
+
+At time 16132:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16135:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16135:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 50 of 100). Will run for at most 3 ticks.
+
+At time 16154:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16157:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16157:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 15 of 100). Will run for at most 3 ticks.
+
+At time 16176:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16177:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16201:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 16201:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 37 of 100). Will run for at most 3 ticks.
+
+At time 16220:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16223:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16223:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 27 of 100). Will run for at most 3 ticks.
+
+At time 16242:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16245:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16245:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 8 of 100). Will run for at most 3 ticks.
+
+At time 16264:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16267:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16267:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 50 of 100). Will run for at most 3 ticks.
+
+At time 16286:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16289:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16289:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 1 of 100). Will run for at most 3 ticks.
+
+At time 16308:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16311:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16311:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 72 of 100). Will run for at most 3 ticks.
+
+At time 16330:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16332:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16342:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 16342:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 74 of 100). Will run for at most 3 ticks.
+
+At time 16361:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16364:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16364:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 41 of 100). Will run for at most 3 ticks.
+
+At time 16383:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16386:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16386:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 54 of 100). Will run for at most 3 ticks.
+
+At time 16405:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16408:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16408:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 83 of 100). Will run for at most 3 ticks.
+
+At time 16427:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16430:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16430:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 32 of 100). Will run for at most 3 ticks.
+
+At time 16449:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16452:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16452:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 65 of 100). Will run for at most 3 ticks.
+
+At time 16471:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16474:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16474:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 99 of 100). Will run for at most 3 ticks.
+
+At time 16493:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16496:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16496:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 39 of 100). Will run for at most 3 ticks.
+
+At time 16515:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16518:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16518:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 56 of 100). Will run for at most 3 ticks.
+
+At time 16537:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16540:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 16540:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 19 of 100). Will run for at most 3 ticks.
+
+At time 16559:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16562:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16587:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 16587:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    Selected from 1 threads (ticket 17 of 100). Will run for at most 3 ticks.
+
+At time 16606:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 16607:
+    THREAD_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
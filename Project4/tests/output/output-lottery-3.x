@@ -0,0 +1,19 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:            127
+    Process switches:           271
+    Dispatch time saved:       3683
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                855
+    NORMAL:                    2914
+    BATCH:                     5671
+
+CPU SHARES:
+    SYSTEM:               target    0.00%   achieved    0.00%
+    INTERACTIVE:          target   10.19%   achieved   10.74%
+    NORMAL:               target   56.39%   achieved   55.99%
+    BATCH:                target   33.42%   achieved   33.27%
+
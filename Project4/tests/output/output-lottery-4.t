@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 19415  END: 19474 
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 17850  END: 17929 
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 29890  END: 29940 
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 13767  END: 13789 
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 20558  END: 20608 
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 33330  END: 33389 
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 33414  END: 33485 
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 31780  END: 31819 
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 30765  END: 30788 
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 33345  END: 33437 
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 26028  END: 26099 
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 16675  END: 16700 
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 22913  END: 23008 
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 20176  END: 20220 
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 17619  END: 17686 
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 11331  END: 11378 
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 33202  END: 33247 
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 26571  END: 26630 
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 31225  END: 31301 
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 33212  END: 33222 
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 8777   END: 8794  
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 15061  END: 15110 
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 14838  END: 14893 
+
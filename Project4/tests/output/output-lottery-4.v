@@ -0,0 +1,12082 @@
+At time 10:
+    THREAD_ARRIVED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 1 threads (ticket 26 of 200). Will run for at most 3 ticks.
+
+At time 17:
+    THREAD_ARRIVED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 22:
+    THREAD_ARRIVED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 23:
+    THREAD_ARRIVED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 25:
+    THREAD_ARRIVED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 44:
+    THREAD_ARRIVED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 45:
+    THREAD_ARRIVED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 49:
+    THREAD_ARRIVED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    THREAD_ARRIVED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 58:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 58:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 13 threads (ticket 1091 of 8000). Will run for at most 3 ticks.
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 67:
+    THREAD_ARRIVED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 76:
+    THREAD_ARRIVED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 79:
+    THREAD_ARRIVED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 92:
+    THREAD_ARRIVED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 95:
+    THREAD_ARRIVED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 103:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 106:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 106:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5595 of 12400). Will run for at most 3 ticks.
+
+At time 130:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 133:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 133:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 260 of 12400). Will run for at most 3 ticks.
+
+At time 178:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 181:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 181:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 4351 of 12400). Will run for at most 3 ticks.
+
+At time 205:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 208:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 208:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 11300 of 12400). Will run for at most 3 ticks.
+
+At time 253:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 256:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 256:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5837 of 12400). Will run for at most 3 ticks.
+
+At time 301:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 304:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 304:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 922 of 12400). Will run for at most 3 ticks.
+
+At time 349:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 352:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 352:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 7066 of 12400). Will run for at most 3 ticks.
+
+At time 397:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 400:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 400:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (ticket 7876 of 12400). Will run for at most 3 ticks.
+
+At time 445:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 448:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 448:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 1109 of 12400). Will run for at most 3 ticks.
+
+At time 493:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 495:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 495:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 6785 of 12200). Will run for at most 3 ticks.
+
+At time 510:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 540:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 543:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 543:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 9791 of 12400). Will run for at most 3 ticks.
+
+At time 588:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 591:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 591:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (ticket 2748 of 12400). Will run for at most 3 ticks.
+
+At time 636:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 639:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 639:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 5191 of 12400). Will run for at most 3 ticks.
+
+At time 684:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 687:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 687:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3097 of 12400). Will run for at most 3 ticks.
+
+At time 732:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 735:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 735:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 3619 of 12400). Will run for at most 3 ticks.
+
+At time 780:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 783:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 783:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 9960 of 12400). Will run for at most 3 ticks.
+
+At time 828:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 831:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 831:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5884 of 12400). Will run for at most 3 ticks.
+
+At time 855:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 858:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 858:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3347 of 12400). Will run for at most 3 ticks.
+
+At time 903:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 906:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 906:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3546 of 12400). Will run for at most 3 ticks.
+
+At time 930:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 933:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 933:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 9287 of 12400). Will run for at most 3 ticks.
+
+At time 978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 981:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 981:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5680 of 12400). Will run for at most 3 ticks.
+
+At time 1026:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1029:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1029:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 3796 of 12400). Will run for at most 3 ticks.
+
+At time 1074:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1077:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1077:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3989 of 12400). Will run for at most 3 ticks.
+
+At time 1122:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1125:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1125:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 1403 of 12400). Will run for at most 3 ticks.
+
+At time 1170:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1173:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1173:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 1479 of 12400). Will run for at most 3 ticks.
+
+At time 1197:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1200:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1200:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 857 of 12400). Will run for at most 3 ticks.
+
+At time 1245:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1248:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1248:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 8615 of 12400). Will run for at most 3 ticks.
+
+At time 1293:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1296:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1296:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (ticket 8032 of 12400). Will run for at most 3 ticks.
+
+At time 1341:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1344:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1344:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 9798 of 12400). Will run for at most 3 ticks.
+
+At time 1389:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1392:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1392:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 4867 of 12400). Will run for at most 3 ticks.
+
+At time 1437:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1440:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1440:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 6571 of 12400). Will run for at most 3 ticks.
+
+At time 1485:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1488:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1488:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 4939 of 12400). Will run for at most 3 ticks.
+
+At time 1533:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1536:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1536:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (ticket 2208 of 11600). Will run for at most 3 ticks.
+
+At time 1565:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1581:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1583:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1583:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (ticket 6925 of 11600). Will run for at most 3 ticks.
+
+At time 1600:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1628:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1631:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1631:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 11016 of 12400). Will run for at most 3 ticks.
+
+At time 1676:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1679:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1679:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 4595 of 12400). Will run for at most 3 ticks.
+
+At time 1724:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1725:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1725:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 445 of 11600). Will run for at most 3 ticks.
+
+At time 1749:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1770:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1773:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1773:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3512 of 12400). Will run for at most 3 ticks.
+
+At time 1818:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1821:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1821:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 10977 of 12400). Will run for at most 3 ticks.
+
+At time 1866:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1869:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1869:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3246 of 12400). Will run for at most 3 ticks.
+
+At time 1914:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1917:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1917:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 6454 of 12400). Will run for at most 3 ticks.
+
+At time 1962:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1964:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1964:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 226 of 11600). Will run for at most 3 ticks.
+
+At time 1984:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2009:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2012:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2012:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 6282 of 12400). Will run for at most 3 ticks.
+
+At time 2036:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2039:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2039:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 12386 of 12400). Will run for at most 3 ticks.
+
+At time 2084:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2087:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2087:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (ticket 7547 of 12400). Will run for at most 3 ticks.
+
+At time 2132:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2135:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2135:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 11536 of 12400). Will run for at most 3 ticks.
+
+At time 2180:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2183:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2183:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 10816 of 12400). Will run for at most 3 ticks.
+
+At time 2207:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2210:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2210:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 2009 of 12400). Will run for at most 3 ticks.
+
+At time 2255:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2258:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2258:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 9866 of 12400). Will run for at most 3 ticks.
+
+At time 2303:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2304:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2304:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 5734 of 11600). Will run for at most 3 ticks.
+
+At time 2325:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2328:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2331:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2331:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 6829 of 12400). Will run for at most 3 ticks.
+
+At time 2376:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2379:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2379:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 9037 of 12400). Will run for at most 3 ticks.
+
+At time 2403:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2406:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2406:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 173 of 12400). Will run for at most 3 ticks.
+
+At time 2451:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2454:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2454:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5577 of 12400). Will run for at most 3 ticks.
+
+At time 2478:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2481:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2481:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 2272 of 12400). Will run for at most 3 ticks.
+
+At time 2526:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2529:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2529:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 703 of 12400). Will run for at most 3 ticks.
+
+At time 2574:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2577:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2577:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 2226 of 11600). Will run for at most 3 ticks.
+
+At time 2588:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2622:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2625:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2625:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 151 of 12400). Will run for at most 3 ticks.
+
+At time 2649:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2652:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2652:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 1048 of 12400). Will run for at most 3 ticks.
+
+At time 2697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2700:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2700:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 7 of 12400). Will run for at most 3 ticks.
+
+At time 2745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2747:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2747:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 1556 of 11600). Will run for at most 3 ticks.
+
+At time 2754:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2792:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2795:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2795:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 2864 of 12400). Will run for at most 3 ticks.
+
+At time 2840:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2843:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2843:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 11299 of 12400). Will run for at most 3 ticks.
+
+At time 2888:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2891:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2891:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 7147 of 12400). Will run for at most 3 ticks.
+
+At time 2936:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2939:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2939:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 11455 of 12400). Will run for at most 3 ticks.
+
+At time 2984:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2987:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2987:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 302 of 12400). Will run for at most 3 ticks.
+
+At time 3032:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3035:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3035:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (ticket 9484 of 12400). Will run for at most 3 ticks.
+
+At time 3080:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3083:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3083:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 9290 of 12400). Will run for at most 3 ticks.
+
+At time 3128:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3131:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3131:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (ticket 9468 of 12400). Will run for at most 3 ticks.
+
+At time 3176:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3179:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3179:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 12237 of 12400). Will run for at most 3 ticks.
+
+At time 3224:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3227:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3227:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 7000 of 12400). Will run for at most 3 ticks.
+
+At time 3272:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3275:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3275:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 6020 of 12400). Will run for at most 3 ticks.
+
+At time 3320:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3323:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3323:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 3051 of 12400). Will run for at most 3 ticks.
+
+At time 3347:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3350:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3350:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 11921 of 12400). Will run for at most 3 ticks.
+
+At time 3374:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3377:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3377:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (ticket 7667 of 11600). Will run for at most 3 ticks.
+
+At time 3380:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3422:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3424:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3424:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 6278 of 11600). Will run for at most 3 ticks.
+
+At time 3431:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3469:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3472:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3472:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (ticket 6925 of 11600). Will run for at most 3 ticks.
+
+At time 3502:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3517:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3520:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3520:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 7093 of 12400). Will run for at most 3 ticks.
+
+At time 3565:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3568:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3568:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 8533 of 12400). Will run for at most 3 ticks.
+
+At time 3613:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3616:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3616:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 8937 of 12400). Will run for at most 3 ticks.
+
+At time 3640:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3643:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3643:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5698 of 12400). Will run for at most 3 ticks.
+
+At time 3688:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3690:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3690:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 7377 of 11600). Will run for at most 3 ticks.
+
+At time 3694:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3714:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3717:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3717:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 9606 of 12400). Will run for at most 3 ticks.
+
+At time 3762:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3764:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3764:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (ticket 10942 of 12200). Will run for at most 3 ticks.
+
+At time 3784:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3809:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3811:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3811:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 7808 of 11600). Will run for at most 3 ticks.
+
+At time 3814:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3856:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3859:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3859:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 4190 of 11600). Will run for at most 3 ticks.
+
+At time 3886:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3904:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3907:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3907:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 141 of 12400). Will run for at most 3 ticks.
+
+At time 3931:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3934:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3934:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 1773 of 12400). Will run for at most 3 ticks.
+
+At time 3958:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3961:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3961:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 6130 of 12400). Will run for at most 3 ticks.
+
+At time 4006:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4009:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4009:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 9035 of 12400). Will run for at most 3 ticks.
+
+At time 4054:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4057:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4057:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 9679 of 12400). Will run for at most 3 ticks.
+
+At time 4102:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4105:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4105:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 3358 of 12400). Will run for at most 3 ticks.
+
+At time 4150:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4153:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4153:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 1744 of 12400). Will run for at most 3 ticks.
+
+At time 4198:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4201:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4201:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (ticket 9587 of 12400). Will run for at most 3 ticks.
+
+At time 4246:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4249:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4249:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5875 of 12400). Will run for at most 3 ticks.
+
+At time 4294:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4297:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4297:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 11987 of 12400). Will run for at most 3 ticks.
+
+At time 4342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4345:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4345:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 11062 of 12400). Will run for at most 3 ticks.
+
+At time 4390:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4393:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4393:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 8453 of 12400). Will run for at most 3 ticks.
+
+At time 4438:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4441:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4441:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 7925 of 12400). Will run for at most 3 ticks.
+
+At time 4486:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4489:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4489:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 10907 of 12400). Will run for at most 3 ticks.
+
+At time 4534:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4537:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4537:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (ticket 9486 of 12400). Will run for at most 3 ticks.
+
+At time 4582:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4585:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4585:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 535 of 12400). Will run for at most 3 ticks.
+
+At time 4630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4633:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4633:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 10747 of 12400). Will run for at most 3 ticks.
+
+At time 4678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4681:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4681:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 3327 of 12400). Will run for at most 3 ticks.
+
+At time 4705:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4708:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4708:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 11832 of 12400). Will run for at most 3 ticks.
+
+At time 4753:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4756:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4756:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 870 of 12400). Will run for at most 3 ticks.
+
+At time 4801:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4804:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4804:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (ticket 3509 of 12200). Will run for at most 3 ticks.
+
+At time 4828:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4829:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4830:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4830:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (ticket 5004 of 12200). Will run for at most 3 ticks.
+
+At time 4854:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4875:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4878:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4878:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 8902 of 12400). Will run for at most 3 ticks.
+
+At time 4923:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4926:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4926:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 8039 of 12400). Will run for at most 3 ticks.
+
+At time 4971:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4974:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4974:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 7327 of 12400). Will run for at most 3 ticks.
+
+At time 5019:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5022:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5022:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (ticket 1168 of 12400). Will run for at most 3 ticks.
+
+At time 5067:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5070:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5070:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (ticket 1253 of 12400). Will run for at most 3 ticks.
+
+At time 5094:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5097:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5097:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 2693 of 11600). Will run for at most 3 ticks.
+
+At time 5104:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5142:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5145:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5145:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 8690 of 12400). Will run for at most 3 ticks.
+
+At time 5190:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5193:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5193:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 4384 of 12400). Will run for at most 3 ticks.
+
+At time 5238:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5241:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5241:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 6161 of 12400). Will run for at most 3 ticks.
+
+At time 5286:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5289:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5289:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 8247 of 12400). Will run for at most 3 ticks.
+
+At time 5334:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5337:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5337:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 8238 of 12400). Will run for at most 3 ticks.
+
+At time 5361:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5364:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5364:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (ticket 3818 of 12400). Will run for at most 3 ticks.
+
+At time 5409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5412:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5412:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 2783 of 12400). Will run for at most 3 ticks.
+
+At time 5457:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5460:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5460:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 9968 of 12400). Will run for at most 3 ticks.
+
+At time 5505:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5506:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5506:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 8585 of 11600). Will run for at most 3 ticks.
+
+At time 5516:
+    IO_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5551:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5553:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5553:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 1760 of 11600). Will run for at most 3 ticks.
+
+At time 5579:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5598:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5599:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5599:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 9125 of 11600). Will run for at most 3 ticks.
+
+At time 5623:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5626:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5626:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 5789 of 11600). Will run for at most 3 ticks.
+
+At time 5629:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5671:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5674:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5674:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (ticket 3277 of 12400). Will run for at most 3 ticks.
+
+At time 5719:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5720:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5720:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 6151 of 12200). Will run for at most 3 ticks.
+
+At time 5739:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5765:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5768:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5768:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 6115 of 12400). Will run for at most 3 ticks.
+
+At time 5813:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5816:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5816:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (ticket 4607 of 12400). Will run for at most 3 ticks.
+
+At time 5861:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5864:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5864:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 6372 of 12400). Will run for at most 3 ticks.
+
+At time 5909:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5910:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5910:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 2632 of 11600). Will run for at most 3 ticks.
+
+At time 5937:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5955:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5958:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5958:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3505 of 12400). Will run for at most 3 ticks.
+
+At time 5982:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5985:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5985:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5086 of 12400). Will run for at most 3 ticks.
+
+At time 6030:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6033:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6033:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 1548 of 12400). Will run for at most 3 ticks.
+
+At time 6057:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6060:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6060:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 10046 of 12400). Will run for at most 3 ticks.
+
+At time 6084:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6087:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6087:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 9930 of 11600). Will run for at most 3 ticks.
+
+At time 6089:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6111:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6114:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6114:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 10800 of 12400). Will run for at most 3 ticks.
+
+At time 6138:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6141:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6141:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 688 of 12400). Will run for at most 3 ticks.
+
+At time 6186:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6189:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6189:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 5847 of 12400). Will run for at most 3 ticks.
+
+At time 6234:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6237:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6237:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 8819 of 12400). Will run for at most 3 ticks.
+
+At time 6282:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6285:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6285:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 280 of 12400). Will run for at most 3 ticks.
+
+At time 6309:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6312:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6312:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 10947 of 12400). Will run for at most 3 ticks.
+
+At time 6357:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6360:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6360:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 8161 of 12400). Will run for at most 3 ticks.
+
+At time 6405:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6406:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6406:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 8386 of 11600). Will run for at most 3 ticks.
+
+At time 6420:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6451:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6454:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6454:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (ticket 4584 of 12400). Will run for at most 3 ticks.
+
+At time 6499:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6502:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6502:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 590 of 12400). Will run for at most 3 ticks.
+
+At time 6547:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6549:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6549:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 5953 of 11600). Will run for at most 3 ticks.
+
+At time 6550:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6594:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6597:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6597:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 7615 of 12400). Will run for at most 3 ticks.
+
+At time 6642:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6645:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6645:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (ticket 4538 of 12400). Will run for at most 3 ticks.
+
+At time 6690:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6693:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6693:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 4894 of 12400). Will run for at most 3 ticks.
+
+At time 6738:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6741:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6741:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 8609 of 12400). Will run for at most 3 ticks.
+
+At time 6786:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6789:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6789:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 2227 of 12400). Will run for at most 3 ticks.
+
+At time 6834:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6837:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6837:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5763 of 12400). Will run for at most 3 ticks.
+
+At time 6882:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6885:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6885:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 7359 of 12400). Will run for at most 3 ticks.
+
+At time 6930:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6933:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6933:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5696 of 12400). Will run for at most 3 ticks.
+
+At time 6978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6981:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6981:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 290 of 12400). Will run for at most 3 ticks.
+
+At time 7026:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7027:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7027:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 5594 of 11600). Will run for at most 3 ticks.
+
+At time 7034:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7072:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7075:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7075:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5358 of 12400). Will run for at most 3 ticks.
+
+At time 7120:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7123:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7123:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3682 of 12400). Will run for at most 3 ticks.
+
+At time 7168:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7171:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7171:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 1160 of 12400). Will run for at most 3 ticks.
+
+At time 7216:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7219:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7219:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (ticket 4066 of 12400). Will run for at most 3 ticks.
+
+At time 7264:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7265:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7265:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 1514 of 11600). Will run for at most 3 ticks.
+
+At time 7292:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7310:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7311:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7311:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 4206 of 11600). Will run for at most 3 ticks.
+
+At time 7335:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7338:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7338:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 9591 of 11600). Will run for at most 3 ticks.
+
+At time 7341:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7362:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7365:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7365:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 6557 of 12400). Will run for at most 3 ticks.
+
+At time 7410:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7413:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7413:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 399 of 12400). Will run for at most 3 ticks.
+
+At time 7458:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7461:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7461:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 11672 of 12400). Will run for at most 3 ticks.
+
+At time 7506:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7509:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7509:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 2607 of 12400). Will run for at most 3 ticks.
+
+At time 7554:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7557:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7557:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 4003 of 12400). Will run for at most 3 ticks.
+
+At time 7602:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7603:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7603:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (ticket 6131 of 11600). Will run for at most 3 ticks.
+
+At time 7608:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7648:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7651:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7651:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 11481 of 12400). Will run for at most 3 ticks.
+
+At time 7696:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7699:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7699:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 7173 of 12400). Will run for at most 3 ticks.
+
+At time 7744:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7747:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7747:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 6397 of 12400). Will run for at most 3 ticks.
+
+At time 7792:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7795:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7795:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 4645 of 12400). Will run for at most 3 ticks.
+
+At time 7819:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7822:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7822:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3373 of 12400). Will run for at most 3 ticks.
+
+At time 7867:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7870:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7870:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 5499 of 12400). Will run for at most 3 ticks.
+
+At time 7894:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7897:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7897:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 7835 of 12400). Will run for at most 3 ticks.
+
+At time 7942:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7945:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7945:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 6014 of 12400). Will run for at most 3 ticks.
+
+At time 7990:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7993:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7993:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 11259 of 12400). Will run for at most 3 ticks.
+
+At time 8038:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8041:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8041:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 7918 of 12400). Will run for at most 3 ticks.
+
+At time 8086:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8089:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8089:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (ticket 7200 of 12400). Will run for at most 3 ticks.
+
+At time 8134:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8137:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8137:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 6076 of 12400). Will run for at most 3 ticks.
+
+At time 8182:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8185:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8185:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 2592 of 12400). Will run for at most 3 ticks.
+
+At time 8230:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8233:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8233:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 2609 of 12400). Will run for at most 3 ticks.
+
+At time 8257:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8260:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8260:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 6033 of 12400). Will run for at most 3 ticks.
+
+At time 8305:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8308:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8308:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 10841 of 12400). Will run for at most 3 ticks.
+
+At time 8353:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8356:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8356:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 11321 of 12400). Will run for at most 3 ticks.
+
+At time 8401:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8404:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8404:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 3375 of 12400). Will run for at most 3 ticks.
+
+At time 8449:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8452:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8452:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (ticket 5610 of 12400). Will run for at most 3 ticks.
+
+At time 8476:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8479:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8479:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (ticket 7001 of 12400). Will run for at most 3 ticks.
+
+At time 8524:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8527:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8527:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 2601 of 12200). Will run for at most 3 ticks.
+
+At time 8535:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 8572:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8575:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8575:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 596 of 12400). Will run for at most 3 ticks.
+
+At time 8599:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8602:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8602:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (ticket 8812 of 12400). Will run for at most 3 ticks.
+
+At time 8647:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8650:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8650:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 7829 of 12400). Will run for at most 3 ticks.
+
+At time 8695:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8698:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8698:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (ticket 5971 of 12400). Will run for at most 3 ticks.
+
+At time 8743:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8746:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8746:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (ticket 7615 of 12400). Will run for at most 3 ticks.
+
+At time 8791:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8794:
+    THREAD_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 8794:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 685 of 11600). Will run for at most 3 ticks.
+
+At time 8818:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8821:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8821:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (ticket 4427 of 10800). Will run for at most 3 ticks.
+
+At time 8828:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 8866:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8867:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8867:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 8122 of 10800). Will run for at most 3 ticks.
+
+At time 8876:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 8912:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8915:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8915:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (ticket 1220 of 11600). Will run for at most 3 ticks.
+
+At time 8960:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8963:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8963:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (ticket 7616 of 10800). Will run for at most 3 ticks.
+
+At time 8978:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9008:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9011:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9011:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads (ticket 981 of 11600). Will run for at most 3 ticks.
+
+At time 9035:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9038:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9038:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 737 of 11600). Will run for at most 3 ticks.
+
+At time 9083:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9086:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9086:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 2152 of 11600). Will run for at most 3 ticks.
+
+At time 9131:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9134:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9134:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 9701 of 11600). Will run for at most 3 ticks.
+
+At time 9179:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9182:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9182:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (ticket 6850 of 11600). Will run for at most 3 ticks.
+
+At time 9227:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9230:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9230:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 10338 of 11600). Will run for at most 3 ticks.
+
+At time 9275:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9278:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9278:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (ticket 11035 of 11600). Will run for at most 3 ticks.
+
+At time 9323:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9326:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9326:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 235 of 11600). Will run for at most 3 ticks.
+
+At time 9371:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9374:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9374:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (ticket 7040 of 11600). Will run for at most 3 ticks.
+
+At time 9419:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9422:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9422:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 5805 of 11600). Will run for at most 3 ticks.
+
+At time 9467:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9470:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9470:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 4909 of 11600). Will run for at most 3 ticks.
+
+At time 9494:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9497:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9497:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (ticket 8579 of 11600). Will run for at most 3 ticks.
+
+At time 9542:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9545:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9545:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (ticket 2809 of 11600). Will run for at most 3 ticks.
+
+At time 9590:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9593:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9593:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 5972 of 11600). Will run for at most 3 ticks.
+
+At time 9638:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9641:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9641:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 5879 of 11600). Will run for at most 3 ticks.
+
+At time 9665:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9668:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9668:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 5399 of 11600). Will run for at most 3 ticks.
+
+At time 9713:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9716:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9716:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 5214 of 11600). Will run for at most 3 ticks.
+
+At time 9740:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9743:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9743:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 1658 of 11600). Will run for at most 3 ticks.
+
+At time 9788:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9791:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9791:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (ticket 6774 of 11600). Will run for at most 3 ticks.
+
+At time 9836:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9838:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9838:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 7539 of 11400). Will run for at most 3 ticks.
+
+At time 9850:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9883:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9886:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9886:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 4966 of 11600). Will run for at most 3 ticks.
+
+At time 9931:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9934:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9934:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 5533 of 11600). Will run for at most 3 ticks.
+
+At time 9979:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9982:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9982:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 6169 of 11600). Will run for at most 3 ticks.
+
+At time 10027:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10030:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10030:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (ticket 3025 of 11600). Will run for at most 3 ticks.
+
+At time 10075:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10078:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10078:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (ticket 10502 of 11600). Will run for at most 3 ticks.
+
+At time 10123:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10126:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10126:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (ticket 3015 of 11600). Will run for at most 3 ticks.
+
+At time 10171:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10174:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10174:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (ticket 7940 of 11600). Will run for at most 3 ticks.
+
+At time 10219:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10222:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10222:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 6843 of 10800). Will run for at most 3 ticks.
+
+At time 10235:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10267:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10269:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10269:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (ticket 9886 of 10800). Will run for at most 3 ticks.
+
+At time 10275:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10314:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10317:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10317:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (ticket 11079 of 11600). Will run for at most 3 ticks.
+
+At time 10362:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10364:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10364:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (ticket 8481 of 10800). Will run for at most 3 ticks.
+
+At time 10389:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10412:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10412:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads (ticket 8151 of 11600). Will run for at most 3 ticks.
+
+At time 10457:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10460:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10460:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 4403 of 11600). Will run for at most 3 ticks.
+
+At time 10505:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10508:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10508:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 5555 of 11600). Will run for at most 3 ticks.
+
+At time 10553:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10556:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10556:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 4425 of 11600). Will run for at most 3 ticks.
+
+At time 10601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10604:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10604:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (ticket 7312 of 11600). Will run for at most 3 ticks.
+
+At time 10649:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10652:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10652:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (ticket 7608 of 11600). Will run for at most 3 ticks.
+
+At time 10697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10700:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10700:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 11481 of 11600). Will run for at most 3 ticks.
+
+At time 10745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10748:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10748:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (ticket 4323 of 11600). Will run for at most 3 ticks.
+
+At time 10793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10796:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10796:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (ticket 8895 of 11600). Will run for at most 3 ticks.
+
+At time 10841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10844:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10844:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 1697 of 11600). Will run for at most 3 ticks.
+
+At time 10889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10892:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10892:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (ticket 6626 of 11600). Will run for at most 3 ticks.
+
+At time 10937:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10940:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10940:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 2705 of 11600). Will run for at most 3 ticks.
+
+At time 10985:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10988:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10988:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 3327 of 11600). Will run for at most 3 ticks.
+
+At time 11033:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11036:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11036:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads (ticket 8109 of 11600). Will run for at most 3 ticks.
+
+At time 11081:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11084:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11084:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 9174 of 11400). Will run for at most 3 ticks.
+
+At time 11089:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11129:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11132:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11132:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (ticket 8415 of 11600). Will run for at most 3 ticks.
+
+At time 11156:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11159:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11159:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (ticket 4352 of 10800). Will run for at most 3 ticks.
+
+At time 11166:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 11204:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11207:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11207:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 2351 of 11600). Will run for at most 3 ticks.
+
+At time 11252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11255:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11255:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 1630 of 11600). Will run for at most 3 ticks.
+
+At time 11279:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11282:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11282:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 4531 of 10800). Will run for at most 3 ticks.
+
+At time 11311:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 11327:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11330:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11330:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (ticket 2147 of 11600). Will run for at most 3 ticks.
+
+At time 11375:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11378:
+    THREAD_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 11378:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (ticket 5031 of 10800). Will run for at most 3 ticks.
+
+At time 11423:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11425:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11425:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 20 threads (ticket 3402 of 10000). Will run for at most 3 ticks.
+
+At time 11430:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 11470:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11473:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11473:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (ticket 7608 of 10800). Will run for at most 3 ticks.
+
+At time 11518:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11521:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11521:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 180 of 10800). Will run for at most 3 ticks.
+
+At time 11566:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11569:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11569:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 5025 of 10800). Will run for at most 3 ticks.
+
+At time 11593:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11596:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11596:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (ticket 4667 of 10800). Will run for at most 3 ticks.
+
+At time 11641:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11644:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11644:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 9283 of 10800). Will run for at most 3 ticks.
+
+At time 11689:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11692:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11692:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 21 threads (ticket 6543 of 10800). Will run for at most 3 ticks.
+
+At time 11737:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11740:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11740:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (ticket 3583 of 10800). Will run for at most 3 ticks.
+
+At time 11785:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11788:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11788:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 21 threads (ticket 7108 of 10800). Will run for at most 3 ticks.
+
+At time 11833:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11836:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11836:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 662 of 10800). Will run for at most 3 ticks.
+
+At time 11881:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11884:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11884:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 21 threads (ticket 6217 of 10800). Will run for at most 3 ticks.
+
+At time 11929:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11932:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11932:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 8716 of 10800). Will run for at most 3 ticks.
+
+At time 11977:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11980:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11980:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 20 threads (ticket 9150 of 10000). Will run for at most 3 ticks.
+
+At time 11993:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 12004:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12007:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12007:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (ticket 10214 of 10800). Will run for at most 3 ticks.
+
+At time 12052:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12055:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12055:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 8055 of 10800). Will run for at most 3 ticks.
+
+At time 12100:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12103:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12103:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (ticket 822 of 10800). Will run for at most 3 ticks.
+
+At time 12148:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12151:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12151:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (ticket 4405 of 10800). Will run for at most 3 ticks.
+
+At time 12196:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12199:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12199:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 8708 of 10800). Will run for at most 3 ticks.
+
+At time 12244:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12247:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12247:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (ticket 3906 of 10800). Will run for at most 3 ticks.
+
+At time 12292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12295:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12295:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (ticket 3419 of 10800). Will run for at most 3 ticks.
+
+At time 12319:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12322:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12322:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 21 threads (ticket 6902 of 10800). Will run for at most 3 ticks.
+
+At time 12367:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12368:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12368:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads (ticket 6734 of 10600). Will run for at most 3 ticks.
+
+At time 12383:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 12413:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12416:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12416:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (ticket 7609 of 10800). Will run for at most 3 ticks.
+
+At time 12461:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12463:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12463:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (ticket 9898 of 10000). Will run for at most 3 ticks.
+
+At time 12465:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 12508:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12511:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12511:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (ticket 4868 of 10800). Will run for at most 3 ticks.
+
+At time 12535:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12538:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12538:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 5217 of 10800). Will run for at most 3 ticks.
+
+At time 12583:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12586:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12586:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 9658 of 10800). Will run for at most 3 ticks.
+
+At time 12631:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12634:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12634:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (ticket 10558 of 10800). Will run for at most 3 ticks.
+
+At time 12679:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12682:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12682:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (ticket 4314 of 10800). Will run for at most 3 ticks.
+
+At time 12727:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12730:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12730:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 21 threads (ticket 2331 of 10800). Will run for at most 3 ticks.
+
+At time 12775:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12778:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12778:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (ticket 8843 of 10800). Will run for at most 3 ticks.
+
+At time 12823:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12826:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12826:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 9443 of 10800). Will run for at most 3 ticks.
+
+At time 12871:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12874:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12874:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 21 threads (ticket 8847 of 10800). Will run for at most 3 ticks.
+
+At time 12919:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12922:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12922:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 1400 of 10800). Will run for at most 3 ticks.
+
+At time 12967:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12968:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12968:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 20 threads (ticket 8569 of 10000). Will run for at most 3 ticks.
+
+At time 12989:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13013:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13015:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13015:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 20 threads (ticket 980 of 10000). Will run for at most 3 ticks.
+
+At time 13045:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13063:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13063:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (ticket 7390 of 10800). Will run for at most 3 ticks.
+
+At time 13108:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13109:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13109:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 20 threads (ticket 2518 of 10000). Will run for at most 3 ticks.
+
+At time 13133:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13154:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13157:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13157:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 7265 of 10800). Will run for at most 3 ticks.
+
+At time 13181:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13184:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13184:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 1215 of 10800). Will run for at most 3 ticks.
+
+At time 13229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13232:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13232:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 7575 of 10800). Will run for at most 3 ticks.
+
+At time 13277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13279:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13279:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 20 threads (ticket 128 of 10000). Will run for at most 3 ticks.
+
+At time 13301:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13303:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13305:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13305:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 20 threads (ticket 1011 of 10000). Will run for at most 3 ticks.
+
+At time 13316:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13350:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13353:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13353:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 9988 of 10800). Will run for at most 3 ticks.
+
+At time 13398:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13401:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13401:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 5178 of 10800). Will run for at most 3 ticks.
+
+At time 13425:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13428:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13428:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 21 threads (ticket 2169 of 10800). Will run for at most 3 ticks.
+
+At time 13473:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13476:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13476:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (ticket 3985 of 10800). Will run for at most 3 ticks.
+
+At time 13521:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13524:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13524:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 9889 of 10800). Will run for at most 3 ticks.
+
+At time 13569:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13572:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13572:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 8473 of 10800). Will run for at most 3 ticks.
+
+At time 13617:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13620:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13620:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (ticket 2631 of 10800). Will run for at most 3 ticks.
+
+At time 13665:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13668:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13668:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 21 threads (ticket 7685 of 10800). Will run for at most 3 ticks.
+
+At time 13713:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13716:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13716:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 639 of 10800). Will run for at most 3 ticks.
+
+At time 13761:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13764:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13764:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (ticket 5314 of 10800). Will run for at most 3 ticks.
+
+At time 13788:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13789:
+    THREAD_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 13789:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 20 threads (ticket 6688 of 10000). Will run for at most 3 ticks.
+
+At time 13834:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13837:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13837:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads (ticket 3516 of 9200). Will run for at most 3 ticks.
+
+At time 13840:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13882:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13885:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13885:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (ticket 2451 of 10000). Will run for at most 3 ticks.
+
+At time 13930:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13933:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13933:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads (ticket 6623 of 9200). Will run for at most 3 ticks.
+
+At time 13961:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13981:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13981:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 20 threads (ticket 2195 of 10000). Will run for at most 3 ticks.
+
+At time 14026:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14029:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14029:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (ticket 6969 of 10000). Will run for at most 3 ticks.
+
+At time 14074:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14077:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14077:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 20 threads (ticket 5011 of 10000). Will run for at most 3 ticks.
+
+At time 14122:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14125:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14125:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 20 threads (ticket 2001 of 10000). Will run for at most 3 ticks.
+
+At time 14170:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14173:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14173:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (ticket 7826 of 10000). Will run for at most 3 ticks.
+
+At time 14218:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14221:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14221:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (ticket 9323 of 10000). Will run for at most 3 ticks.
+
+At time 14266:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14269:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14269:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 20 threads (ticket 3404 of 10000). Will run for at most 3 ticks.
+
+At time 14314:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14317:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14317:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 20 threads (ticket 8476 of 10000). Will run for at most 3 ticks.
+
+At time 14362:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14365:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14365:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (ticket 9845 of 10000). Will run for at most 3 ticks.
+
+At time 14410:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14413:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14413:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 19 threads (ticket 3412 of 9200). Will run for at most 3 ticks.
+
+At time 14419:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 14458:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14461:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14461:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (ticket 6433 of 10000). Will run for at most 3 ticks.
+
+At time 14506:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14509:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14509:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 20 threads (ticket 908 of 10000). Will run for at most 3 ticks.
+
+At time 14554:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14557:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14557:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (ticket 7481 of 10000). Will run for at most 3 ticks.
+
+At time 14602:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14605:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14605:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 20 threads (ticket 1538 of 10000). Will run for at most 3 ticks.
+
+At time 14650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14653:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14653:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 20 threads (ticket 4791 of 10000). Will run for at most 3 ticks.
+
+At time 14698:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14701:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14701:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads (ticket 6182 of 10000). Will run for at most 3 ticks.
+
+At time 14746:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14749:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14749:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 20 threads (ticket 9914 of 10000). Will run for at most 3 ticks.
+
+At time 14794:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14797:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14797:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 20 threads (ticket 8048 of 10000). Will run for at most 3 ticks.
+
+At time 14842:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14845:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14845:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads (ticket 6514 of 9800). Will run for at most 3 ticks.
+
+At time 14859:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14890:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14893:
+    THREAD_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 14893:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads (ticket 8328 of 9200). Will run for at most 3 ticks.
+
+At time 14938:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14941:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14941:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads (ticket 8068 of 9200). Will run for at most 3 ticks.
+
+At time 14965:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14967:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14967:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 18 threads (ticket 3620 of 8400). Will run for at most 3 ticks.
+
+At time 14980:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 15012:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15015:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15015:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 19 threads (ticket 5552 of 9200). Will run for at most 3 ticks.
+
+At time 15060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15063:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15063:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads (ticket 8222 of 9200). Will run for at most 3 ticks.
+
+At time 15108:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15110:
+    THREAD_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 15110:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads (ticket 1664 of 8400). Will run for at most 3 ticks.
+
+At time 15155:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15157:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15157:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 17 threads (ticket 8135 of 8200). Will run for at most 3 ticks.
+
+At time 15169:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 15202:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15205:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15205:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 18 threads (ticket 6452 of 8400). Will run for at most 3 ticks.
+
+At time 15250:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15253:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15253:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads (ticket 8319 of 8400). Will run for at most 3 ticks.
+
+At time 15298:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15301:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15301:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 18 threads (ticket 6116 of 8400). Will run for at most 3 ticks.
+
+At time 15346:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15349:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15349:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 18 threads (ticket 3961 of 8400). Will run for at most 3 ticks.
+
+At time 15394:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15397:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15397:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads (ticket 3663 of 8400). Will run for at most 3 ticks.
+
+At time 15442:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15445:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15445:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads (ticket 3423 of 8400). Will run for at most 3 ticks.
+
+At time 15469:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15472:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15472:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads (ticket 7991 of 8400). Will run for at most 3 ticks.
+
+At time 15517:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15520:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15520:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads (ticket 7442 of 8400). Will run for at most 3 ticks.
+
+At time 15544:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15547:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15547:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 18 threads (ticket 2986 of 8400). Will run for at most 3 ticks.
+
+At time 15592:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15595:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15595:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 18 threads (ticket 6369 of 8400). Will run for at most 3 ticks.
+
+At time 15640:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15643:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15643:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 18 threads (ticket 6258 of 8400). Will run for at most 3 ticks.
+
+At time 15667:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15670:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15670:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 18 threads (ticket 4199 of 8400). Will run for at most 3 ticks.
+
+At time 15715:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15718:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15718:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 18 threads (ticket 3999 of 8400). Will run for at most 3 ticks.
+
+At time 15763:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15766:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15766:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 18 threads (ticket 458 of 8400). Will run for at most 3 ticks.
+
+At time 15811:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15814:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15814:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads (ticket 7484 of 8400). Will run for at most 3 ticks.
+
+At time 15859:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15862:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15862:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 18 threads (ticket 6577 of 8400). Will run for at most 3 ticks.
+
+At time 15907:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15910:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15910:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 18 threads (ticket 4452 of 8400). Will run for at most 3 ticks.
+
+At time 15955:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15958:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15958:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 18 threads (ticket 4410 of 8400). Will run for at most 3 ticks.
+
+At time 15982:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15985:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15985:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 18 threads (ticket 3330 of 8400). Will run for at most 3 ticks.
+
+At time 16030:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16033:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16033:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 18 threads (ticket 2891 of 8400). Will run for at most 3 ticks.
+
+At time 16078:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16081:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16081:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 18 threads (ticket 1119 of 8400). Will run for at most 3 ticks.
+
+At time 16126:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16129:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16129:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 18 threads (ticket 6004 of 8400). Will run for at most 3 ticks.
+
+At time 16174:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16176:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16176:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads (ticket 3259 of 7600). Will run for at most 3 ticks.
+
+At time 16194:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 16221:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16222:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16222:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 17 threads (ticket 7149 of 7600). Will run for at most 3 ticks.
+
+At time 16235:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 16267:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16270:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16270:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 18 threads (ticket 2199 of 8400). Will run for at most 3 ticks.
+
+At time 16315:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16318:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16318:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 17 threads (ticket 3807 of 7600). Will run for at most 3 ticks.
+
+At time 16343:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 16363:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16366:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16366:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads (ticket 8310 of 8400). Will run for at most 3 ticks.
+
+At time 16411:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16414:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16414:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 18 threads (ticket 5188 of 8400). Will run for at most 3 ticks.
+
+At time 16459:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16462:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16462:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 18 threads (ticket 2145 of 8400). Will run for at most 3 ticks.
+
+At time 16507:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16510:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16510:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads (ticket 8227 of 8400). Will run for at most 3 ticks.
+
+At time 16555:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16558:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16558:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 18 threads (ticket 3412 of 8400). Will run for at most 3 ticks.
+
+At time 16603:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16606:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16606:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads (ticket 5803 of 8400). Will run for at most 3 ticks.
+
+At time 16651:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16654:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16654:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 18 threads (ticket 4544 of 8400). Will run for at most 3 ticks.
+
+At time 16699:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16700:
+    THREAD_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 16700:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 17 threads (ticket 5814 of 7600). Will run for at most 3 ticks.
+
+At time 16745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16748:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16748:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 17 threads (ticket 1190 of 7600). Will run for at most 3 ticks.
+
+At time 16793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16796:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16796:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 17 threads (ticket 5343 of 7600). Will run for at most 3 ticks.
+
+At time 16841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16843:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16843:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 16 threads (ticket 4740 of 6800). Will run for at most 3 ticks.
+
+At time 16851:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 16867:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16870:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16870:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (ticket 3375 of 6800). Will run for at most 3 ticks.
+
+At time 16896:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 16915:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16918:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16918:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads (ticket 1841 of 6800). Will run for at most 3 ticks.
+
+At time 16927:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 16963:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16966:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16966:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 17 threads (ticket 3871 of 7600). Will run for at most 3 ticks.
+
+At time 17011:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17014:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17014:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 17 threads (ticket 1175 of 7600). Will run for at most 3 ticks.
+
+At time 17059:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17062:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17062:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 17 threads (ticket 2823 of 7600). Will run for at most 3 ticks.
+
+At time 17107:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17108:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17108:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (ticket 2013 of 7400). Will run for at most 3 ticks.
+
+At time 17136:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 17153:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17156:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17156:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 17 threads (ticket 630 of 7600). Will run for at most 3 ticks.
+
+At time 17201:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17204:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17204:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 17 threads (ticket 3821 of 7600). Will run for at most 3 ticks.
+
+At time 17249:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17252:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17252:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 17 threads (ticket 112 of 7600). Will run for at most 3 ticks.
+
+At time 17297:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17300:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17300:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 17 threads (ticket 5507 of 7600). Will run for at most 3 ticks.
+
+At time 17324:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17325:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17325:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads (ticket 5068 of 6800). Will run for at most 3 ticks.
+
+At time 17328:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 17370:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17373:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17373:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 17 threads (ticket 3131 of 7600). Will run for at most 3 ticks.
+
+At time 17418:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17421:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17421:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 17 threads (ticket 4166 of 7600). Will run for at most 3 ticks.
+
+At time 17445:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17448:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17448:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 17 threads (ticket 6337 of 7600). Will run for at most 3 ticks.
+
+At time 17493:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17496:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17496:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 17 threads (ticket 2499 of 7600). Will run for at most 3 ticks.
+
+At time 17541:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17544:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17544:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 17 threads (ticket 4989 of 7600). Will run for at most 3 ticks.
+
+At time 17589:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17592:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17592:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 17 threads (ticket 7543 of 7600). Will run for at most 3 ticks.
+
+At time 17637:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17640:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17640:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 17 threads (ticket 3025 of 7600). Will run for at most 3 ticks.
+
+At time 17685:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17686:
+    THREAD_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 17686:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (ticket 3825 of 6800). Will run for at most 3 ticks.
+
+At time 17710:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17713:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17713:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 16 threads (ticket 1323 of 6800). Will run for at most 3 ticks.
+
+At time 17758:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17760:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17760:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 15 threads (ticket 1030 of 6000). Will run for at most 3 ticks.
+
+At time 17785:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 17805:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17808:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17808:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (ticket 3272 of 6800). Will run for at most 3 ticks.
+
+At time 17853:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17856:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17856:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 16 threads (ticket 1446 of 6800). Will run for at most 3 ticks.
+
+At time 17901:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17904:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17904:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 16 threads (ticket 86 of 6800). Will run for at most 3 ticks.
+
+At time 17928:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17929:
+    THREAD_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 17929:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads (ticket 2224 of 6000). Will run for at most 3 ticks.
+
+At time 17974:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17977:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17977:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 15 threads (ticket 4066 of 6000). Will run for at most 3 ticks.
+
+At time 18022:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18025:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18025:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 15 threads (ticket 5786 of 6000). Will run for at most 3 ticks.
+
+At time 18070:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18073:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18073:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads (ticket 2843 of 6000). Will run for at most 3 ticks.
+
+At time 18118:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18121:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18121:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 15 threads (ticket 5376 of 6000). Will run for at most 3 ticks.
+
+At time 18166:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18169:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18169:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads (ticket 2601 of 6000). Will run for at most 3 ticks.
+
+At time 18214:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18217:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18217:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 15 threads (ticket 3867 of 6000). Will run for at most 3 ticks.
+
+At time 18262:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18265:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18265:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 15 threads (ticket 3589 of 6000). Will run for at most 3 ticks.
+
+At time 18310:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18313:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18313:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (ticket 2080 of 6000). Will run for at most 3 ticks.
+
+At time 18358:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18361:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18361:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (ticket 1896 of 6000). Will run for at most 3 ticks.
+
+At time 18385:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18388:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18388:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 15 threads (ticket 526 of 6000). Will run for at most 3 ticks.
+
+At time 18433:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18436:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18436:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (ticket 2020 of 6000). Will run for at most 3 ticks.
+
+At time 18481:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18484:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18484:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 15 threads (ticket 3217 of 6000). Will run for at most 3 ticks.
+
+At time 18529:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18532:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18532:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads (ticket 2799 of 6000). Will run for at most 3 ticks.
+
+At time 18577:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18579:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18579:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 14 threads (ticket 4026 of 5200). Will run for at most 3 ticks.
+
+At time 18598:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 18624:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18627:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18627:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 15 threads (ticket 4644 of 6000). Will run for at most 3 ticks.
+
+At time 18672:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18675:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18675:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 15 threads (ticket 5801 of 6000). Will run for at most 3 ticks.
+
+At time 18720:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18723:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18723:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 15 threads (ticket 968 of 6000). Will run for at most 3 ticks.
+
+At time 18768:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18771:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18771:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 15 threads (ticket 4426 of 6000). Will run for at most 3 ticks.
+
+At time 18816:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18819:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18819:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 15 threads (ticket 2796 of 6000). Will run for at most 3 ticks.
+
+At time 18864:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18867:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18867:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (ticket 2002 of 6000). Will run for at most 3 ticks.
+
+At time 18912:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18915:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18915:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 15 threads (ticket 3493 of 6000). Will run for at most 3 ticks.
+
+At time 18960:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18963:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18963:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 15 threads (ticket 2801 of 6000). Will run for at most 3 ticks.
+
+At time 19008:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19011:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19011:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 15 threads (ticket 5377 of 6000). Will run for at most 3 ticks.
+
+At time 19056:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19059:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19059:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 15 threads (ticket 547 of 6000). Will run for at most 3 ticks.
+
+At time 19104:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19107:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19107:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (ticket 1933 of 6000). Will run for at most 3 ticks.
+
+At time 19152:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19155:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19155:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 15 threads (ticket 3330 of 6000). Will run for at most 3 ticks.
+
+At time 19200:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19203:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19203:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 15 threads (ticket 4708 of 6000). Will run for at most 3 ticks.
+
+At time 19227:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19228:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19228:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 14 threads (ticket 4052 of 5800). Will run for at most 3 ticks.
+
+At time 19251:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 19273:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19276:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19276:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 15 threads (ticket 4153 of 6000). Will run for at most 3 ticks.
+
+At time 19300:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19303:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19303:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 15 threads (ticket 4280 of 6000). Will run for at most 3 ticks.
+
+At time 19327:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19330:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19330:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 15 threads (ticket 3296 of 6000). Will run for at most 3 ticks.
+
+At time 19375:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19378:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19378:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 14 threads (ticket 5103 of 5800). Will run for at most 3 ticks.
+
+At time 19393:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 19423:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19426:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19426:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (ticket 2130 of 6000). Will run for at most 3 ticks.
+
+At time 19471:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19474:
+    THREAD_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 19474:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 14 threads (ticket 2779 of 5200). Will run for at most 3 ticks.
+
+At time 19519:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19522:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19522:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 14 threads (ticket 3193 of 5200). Will run for at most 3 ticks.
+
+At time 19546:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19549:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19549:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 13 threads (ticket 4222 of 4400). Will run for at most 3 ticks.
+
+At time 19566:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 19594:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19596:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19596:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 13 threads (ticket 2142 of 5000). Will run for at most 3 ticks.
+
+At time 19611:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 19641:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19644:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19644:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 14 threads (ticket 2903 of 5200). Will run for at most 3 ticks.
+
+At time 19689:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19692:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19692:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 14 threads (ticket 2753 of 5200). Will run for at most 3 ticks.
+
+At time 19737:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19740:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19740:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 14 threads (ticket 1389 of 5200). Will run for at most 3 ticks.
+
+At time 19785:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19788:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19788:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 14 threads (ticket 3810 of 5200). Will run for at most 3 ticks.
+
+At time 19833:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19836:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19836:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 14 threads (ticket 74 of 5200). Will run for at most 3 ticks.
+
+At time 19881:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19884:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19884:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 14 threads (ticket 4112 of 5200). Will run for at most 3 ticks.
+
+At time 19929:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19932:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19932:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 14 threads (ticket 4380 of 5200). Will run for at most 3 ticks.
+
+At time 19977:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19980:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19980:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 14 threads (ticket 589 of 5200). Will run for at most 3 ticks.
+
+At time 20025:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20028:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20028:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 14 threads (ticket 3192 of 5200). Will run for at most 3 ticks.
+
+At time 20073:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20076:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20076:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 14 threads (ticket 4237 of 5200). Will run for at most 3 ticks.
+
+At time 20121:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20124:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20124:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 13 threads (ticket 1183 of 5000). Will run for at most 3 ticks.
+
+At time 20150:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 20169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20172:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20172:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 14 threads (ticket 4966 of 5200). Will run for at most 3 ticks.
+
+At time 20217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20220:
+    THREAD_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 20220:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 13 threads (ticket 416 of 4400). Will run for at most 3 ticks.
+
+At time 20265:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20268:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20268:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 13 threads (ticket 587 of 4400). Will run for at most 3 ticks.
+
+At time 20292:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20295:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20295:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 13 threads (ticket 1451 of 4400). Will run for at most 3 ticks.
+
+At time 20340:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20343:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20343:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 12 threads (ticket 378 of 3600). Will run for at most 3 ticks.
+
+At time 20373:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 20388:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20391:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20391:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 13 threads (ticket 3338 of 4400). Will run for at most 3 ticks.
+
+At time 20436:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20439:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20439:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 13 threads (ticket 3017 of 4400). Will run for at most 3 ticks.
+
+At time 20463:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20466:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20466:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 13 threads (ticket 1742 of 4400). Will run for at most 3 ticks.
+
+At time 20511:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20514:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20514:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 13 threads (ticket 467 of 4400). Will run for at most 3 ticks.
+
+At time 20559:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20562:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20562:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 13 threads (ticket 4352 of 4400). Will run for at most 3 ticks.
+
+At time 20607:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20608:
+    THREAD_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 20608:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 807 of 3600). Will run for at most 3 ticks.
+
+At time 20653:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20656:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20656:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 12 threads (ticket 2509 of 3600). Will run for at most 3 ticks.
+
+At time 20701:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20704:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20704:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 1726 of 3600). Will run for at most 3 ticks.
+
+At time 20749:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20752:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20752:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 830 of 3600). Will run for at most 3 ticks.
+
+At time 20797:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20800:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20800:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 1694 of 3600). Will run for at most 3 ticks.
+
+At time 20845:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20848:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20848:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 12 threads (ticket 1842 of 3600). Will run for at most 3 ticks.
+
+At time 20893:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20896:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20896:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 12 threads (ticket 3563 of 3600). Will run for at most 3 ticks.
+
+At time 20941:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20944:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20944:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 12 threads (ticket 2254 of 3600). Will run for at most 3 ticks.
+
+At time 20968:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20971:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20971:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (ticket 2764 of 3600). Will run for at most 3 ticks.
+
+At time 21016:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21018:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21018:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 11 threads (ticket 438 of 2800). Will run for at most 3 ticks.
+
+At time 21035:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 21063:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21066:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21066:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 2897 of 3600). Will run for at most 3 ticks.
+
+At time 21090:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21093:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21093:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (ticket 695 of 3600). Will run for at most 3 ticks.
+
+At time 21138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21141:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21141:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (ticket 841 of 3600). Will run for at most 3 ticks.
+
+At time 21165:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21168:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21168:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 1044 of 3600). Will run for at most 3 ticks.
+
+At time 21213:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21216:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21216:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 12 threads (ticket 2395 of 3600). Will run for at most 3 ticks.
+
+At time 21261:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21264:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21264:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 3097 of 3600). Will run for at most 3 ticks.
+
+At time 21309:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21312:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21312:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 12 threads (ticket 2175 of 3600). Will run for at most 3 ticks.
+
+At time 21357:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21360:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21360:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 3018 of 3600). Will run for at most 3 ticks.
+
+At time 21405:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21408:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21408:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 1645 of 3600). Will run for at most 3 ticks.
+
+At time 21453:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21456:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21456:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 3050 of 3600). Will run for at most 3 ticks.
+
+At time 21501:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21504:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21504:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 157 of 3600). Will run for at most 3 ticks.
+
+At time 21549:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21552:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21552:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 1037 of 3600). Will run for at most 3 ticks.
+
+At time 21576:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21579:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21579:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 78 of 3600). Will run for at most 3 ticks.
+
+At time 21603:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21606:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21606:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 12 threads (ticket 2045 of 3600). Will run for at most 3 ticks.
+
+At time 21651:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21652:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21652:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1800 of 3400). Will run for at most 3 ticks.
+
+At time 21657:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 21676:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21679:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21679:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 2655 of 3600). Will run for at most 3 ticks.
+
+At time 21724:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21727:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21727:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 12 threads (ticket 1529 of 3600). Will run for at most 3 ticks.
+
+At time 21772:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21775:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21775:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (ticket 277 of 3600). Will run for at most 3 ticks.
+
+At time 21820:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21823:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21823:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 3309 of 3600). Will run for at most 3 ticks.
+
+At time 21868:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21871:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21871:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1116 of 2800). Will run for at most 3 ticks.
+
+At time 21881:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 21916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21919:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21919:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 1723 of 3600). Will run for at most 3 ticks.
+
+At time 21964:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21967:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21967:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 3213 of 3600). Will run for at most 3 ticks.
+
+At time 22012:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22015:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22015:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 1645 of 3600). Will run for at most 3 ticks.
+
+At time 22060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22063:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22063:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 1567 of 3600). Will run for at most 3 ticks.
+
+At time 22087:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22090:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22090:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (ticket 827 of 3600). Will run for at most 3 ticks.
+
+At time 22135:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22138:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22138:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 12 threads (ticket 1855 of 3600). Will run for at most 3 ticks.
+
+At time 22183:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22184:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22184:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1953 of 3400). Will run for at most 3 ticks.
+
+At time 22208:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 22229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22232:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22232:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (ticket 297 of 3600). Will run for at most 3 ticks.
+
+At time 22277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22280:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22280:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 1235 of 3600). Will run for at most 3 ticks.
+
+At time 22325:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22328:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22328:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 1068 of 3600). Will run for at most 3 ticks.
+
+At time 22352:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22355:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22355:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 12 threads (ticket 2844 of 3600). Will run for at most 3 ticks.
+
+At time 22400:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22403:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22403:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 12 threads (ticket 2915 of 3600). Will run for at most 3 ticks.
+
+At time 22427:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22430:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22430:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 2248 of 3600). Will run for at most 3 ticks.
+
+At time 22475:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22478:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22478:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 12 threads (ticket 2402 of 3600). Will run for at most 3 ticks.
+
+At time 22523:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22526:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22526:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (ticket 867 of 3600). Will run for at most 3 ticks.
+
+At time 22571:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22574:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22574:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 12 threads (ticket 2955 of 3600). Will run for at most 3 ticks.
+
+At time 22619:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22622:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22622:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 12 threads (ticket 3449 of 3600). Will run for at most 3 ticks.
+
+At time 22646:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22649:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22649:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 1432 of 3600). Will run for at most 3 ticks.
+
+At time 22694:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22697:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22697:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (ticket 771 of 3600). Will run for at most 3 ticks.
+
+At time 22742:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22745:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22745:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 1797 of 3600). Will run for at most 3 ticks.
+
+At time 22790:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22793:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22793:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 2266 of 3600). Will run for at most 3 ticks.
+
+At time 22838:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22841:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22841:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 1776 of 3600). Will run for at most 3 ticks.
+
+At time 22886:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22887:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22887:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1500 of 2800). Will run for at most 3 ticks.
+
+At time 22915:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 22932:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22935:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22935:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 12 threads (ticket 126 of 3600). Will run for at most 3 ticks.
+
+At time 22959:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22962:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22962:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (ticket 2262 of 3600). Will run for at most 3 ticks.
+
+At time 23007:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23008:
+    THREAD_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 23008:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1835 of 2800). Will run for at most 3 ticks.
+
+At time 23053:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23056:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23056:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 153 of 2800). Will run for at most 3 ticks.
+
+At time 23101:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23104:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23104:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 876 of 2800). Will run for at most 3 ticks.
+
+At time 23149:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23152:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23152:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 1453 of 2800). Will run for at most 3 ticks.
+
+At time 23197:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23200:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23200:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 828 of 2800). Will run for at most 3 ticks.
+
+At time 23245:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23247:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23247:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 1581 of 2000). Will run for at most 3 ticks.
+
+At time 23275:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 23292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23295:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23295:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 1505 of 2800). Will run for at most 3 ticks.
+
+At time 23340:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23343:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23343:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 839 of 2800). Will run for at most 3 ticks.
+
+At time 23367:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23370:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23370:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 1646 of 2800). Will run for at most 3 ticks.
+
+At time 23415:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23418:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23418:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 47 of 2800). Will run for at most 3 ticks.
+
+At time 23463:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23464:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23464:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 10 threads (ticket 1272 of 2600). Will run for at most 3 ticks.
+
+At time 23469:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23509:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23512:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23512:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1482 of 2800). Will run for at most 3 ticks.
+
+At time 23557:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23560:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23560:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 605 of 2800). Will run for at most 3 ticks.
+
+At time 23605:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23608:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23608:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 2135 of 2800). Will run for at most 3 ticks.
+
+At time 23653:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23656:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23656:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 1918 of 2800). Will run for at most 3 ticks.
+
+At time 23680:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23683:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23683:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1274 of 2800). Will run for at most 3 ticks.
+
+At time 23728:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23731:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23731:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 587 of 2800). Will run for at most 3 ticks.
+
+At time 23776:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23779:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23779:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1386 of 2800). Will run for at most 3 ticks.
+
+At time 23824:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23827:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23827:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 587 of 2800). Will run for at most 3 ticks.
+
+At time 23872:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23875:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23875:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1530 of 2800). Will run for at most 3 ticks.
+
+At time 23899:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23902:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23902:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1186 of 2800). Will run for at most 3 ticks.
+
+At time 23947:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23950:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23950:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 2637 of 2800). Will run for at most 3 ticks.
+
+At time 23995:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23998:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23998:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1495 of 2800). Will run for at most 3 ticks.
+
+At time 24043:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24046:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24046:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 406 of 2800). Will run for at most 3 ticks.
+
+At time 24070:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24072:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24072:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 362 of 2600). Will run for at most 3 ticks.
+
+At time 24085:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 24117:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24120:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24120:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 10 threads (ticket 384 of 2600). Will run for at most 3 ticks.
+
+At time 24148:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 24165:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24168:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24168:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 1663 of 2800). Will run for at most 3 ticks.
+
+At time 24213:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24216:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24216:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1563 of 2800). Will run for at most 3 ticks.
+
+At time 24261:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24263:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24263:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 10 threads (ticket 1562 of 2600). Will run for at most 3 ticks.
+
+At time 24283:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 24308:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24311:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24311:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 1877 of 2800). Will run for at most 3 ticks.
+
+At time 24335:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24338:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24338:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 585 of 2800). Will run for at most 3 ticks.
+
+At time 24383:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24386:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24386:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 1767 of 2800). Will run for at most 3 ticks.
+
+At time 24431:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24434:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24434:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 2570 of 2800). Will run for at most 3 ticks.
+
+At time 24479:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24482:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24482:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 1436 of 2800). Will run for at most 3 ticks.
+
+At time 24527:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24528:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24528:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 10 threads (ticket 1930 of 2000). Will run for at most 3 ticks.
+
+At time 24556:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 24573:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24576:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24576:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1795 of 2800). Will run for at most 3 ticks.
+
+At time 24621:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24624:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24624:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 901 of 2800). Will run for at most 3 ticks.
+
+At time 24669:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24672:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24672:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 90 of 2800). Will run for at most 3 ticks.
+
+At time 24696:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24697:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24697:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 10 threads (ticket 2559 of 2600). Will run for at most 3 ticks.
+
+At time 24726:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 24742:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24745:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24745:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1710 of 2800). Will run for at most 3 ticks.
+
+At time 24790:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24793:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24793:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 689 of 2800). Will run for at most 3 ticks.
+
+At time 24838:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24841:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24841:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1148 of 2800). Will run for at most 3 ticks.
+
+At time 24886:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24889:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24889:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1350 of 2800). Will run for at most 3 ticks.
+
+At time 24934:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24936:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24936:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads (ticket 2224 of 2600). Will run for at most 3 ticks.
+
+At time 24959:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 24981:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24984:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24984:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 218 of 2800). Will run for at most 3 ticks.
+
+At time 25029:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25032:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25032:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 706 of 2800). Will run for at most 3 ticks.
+
+At time 25056:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25059:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25059:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1688 of 2800). Will run for at most 3 ticks.
+
+At time 25104:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25107:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25107:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 2004 of 2800). Will run for at most 3 ticks.
+
+At time 25152:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25155:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25155:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 832 of 2800). Will run for at most 3 ticks.
+
+At time 25200:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25201:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25201:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads (ticket 1126 of 2600). Will run for at most 3 ticks.
+
+At time 25221:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 25246:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25249:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25249:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 1752 of 2600). Will run for at most 3 ticks.
+
+At time 25263:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 25294:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25297:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25297:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1804 of 2800). Will run for at most 3 ticks.
+
+At time 25342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25345:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25345:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1878 of 2800). Will run for at most 3 ticks.
+
+At time 25369:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25372:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25372:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 2646 of 2800). Will run for at most 3 ticks.
+
+At time 25417:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25420:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25420:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1946 of 2800). Will run for at most 3 ticks.
+
+At time 25465:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25468:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25468:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 666 of 2800). Will run for at most 3 ticks.
+
+At time 25513:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25516:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25516:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 2731 of 2800). Will run for at most 3 ticks.
+
+At time 25561:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25564:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25564:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1702 of 2800). Will run for at most 3 ticks.
+
+At time 25609:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25612:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25612:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 2782 of 2800). Will run for at most 3 ticks.
+
+At time 25657:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25660:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25660:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 1412 of 2800). Will run for at most 3 ticks.
+
+At time 25684:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25687:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25687:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1740 of 2800). Will run for at most 3 ticks.
+
+At time 25732:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25734:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25734:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads (ticket 1440 of 2600). Will run for at most 3 ticks.
+
+At time 25735:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 25779:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25782:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25782:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (ticket 1531 of 2800). Will run for at most 3 ticks.
+
+At time 25827:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25830:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25830:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 611 of 2800). Will run for at most 3 ticks.
+
+At time 25875:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25878:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25878:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 510 of 2800). Will run for at most 3 ticks.
+
+At time 25902:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25905:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25905:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (ticket 59 of 2800). Will run for at most 3 ticks.
+
+At time 25929:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25932:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25932:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads (ticket 1636 of 2800). Will run for at most 3 ticks.
+
+At time 25977:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25978:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25978:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 1354 of 2600). Will run for at most 3 ticks.
+
+At time 25988:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 26023:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26026:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26026:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1150 of 2800). Will run for at most 3 ticks.
+
+At time 26071:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26074:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26074:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (ticket 1008 of 2800). Will run for at most 3 ticks.
+
+At time 26098:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26099:
+    THREAD_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 26099:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 852 of 2600). Will run for at most 3 ticks.
+
+At time 26144:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26147:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26147:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 10 threads (ticket 1727 of 2600). Will run for at most 3 ticks.
+
+At time 26192:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26195:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26195:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads (ticket 1193 of 2600). Will run for at most 3 ticks.
+
+At time 26240:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26243:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26243:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 1368 of 2600). Will run for at most 3 ticks.
+
+At time 26288:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26291:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26291:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 10 threads (ticket 455 of 2600). Will run for at most 3 ticks.
+
+At time 26336:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26337:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26337:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 387 of 1800). Will run for at most 3 ticks.
+
+At time 26360:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 26382:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26385:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26385:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 2354 of 2600). Will run for at most 3 ticks.
+
+At time 26430:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26433:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26433:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 10 threads (ticket 2477 of 2600). Will run for at most 3 ticks.
+
+At time 26478:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26481:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26481:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 10 threads (ticket 2004 of 2600). Will run for at most 3 ticks.
+
+At time 26526:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26529:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26529:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 1269 of 2600). Will run for at most 3 ticks.
+
+At time 26574:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26577:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26577:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 1456 of 2600). Will run for at most 3 ticks.
+
+At time 26601:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26604:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26604:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 10 threads (ticket 299 of 2600). Will run for at most 3 ticks.
+
+At time 26628:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26630:
+    THREAD_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 26630:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 303 of 2400). Will run for at most 3 ticks.
+
+At time 26675:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26678:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26678:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 1815 of 2400). Will run for at most 3 ticks.
+
+At time 26723:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26726:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26726:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 1710 of 2400). Will run for at most 3 ticks.
+
+At time 26771:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26774:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26774:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 1452 of 2400). Will run for at most 3 ticks.
+
+At time 26819:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26820:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26820:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 8 threads (ticket 1157 of 2200). Will run for at most 3 ticks.
+
+At time 26821:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 26865:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26868:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26868:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 1261 of 2400). Will run for at most 3 ticks.
+
+At time 26892:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26895:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26895:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 2246 of 2400). Will run for at most 3 ticks.
+
+At time 26940:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26943:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26943:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 1586 of 2400). Will run for at most 3 ticks.
+
+At time 26988:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26990:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26990:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 101 of 2200). Will run for at most 3 ticks.
+
+At time 27015:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 27035:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27038:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27038:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 8 threads (ticket 197 of 2200). Will run for at most 3 ticks.
+
+At time 27048:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 27083:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27086:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27086:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 1587 of 2400). Will run for at most 3 ticks.
+
+At time 27110:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27113:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27113:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 1947 of 2400). Will run for at most 3 ticks.
+
+At time 27158:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27161:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27161:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 1829 of 2400). Will run for at most 3 ticks.
+
+At time 27185:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27188:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27188:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 1341 of 2400). Will run for at most 3 ticks.
+
+At time 27233:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27236:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27236:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 316 of 2400). Will run for at most 3 ticks.
+
+At time 27281:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27284:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27284:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 2316 of 2400). Will run for at most 3 ticks.
+
+At time 27329:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27332:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27332:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 1445 of 2400). Will run for at most 3 ticks.
+
+At time 27377:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27380:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27380:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 1208 of 2400). Will run for at most 3 ticks.
+
+At time 27404:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27407:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27407:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 518 of 2400). Will run for at most 3 ticks.
+
+At time 27452:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27455:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27455:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 1625 of 2400). Will run for at most 3 ticks.
+
+At time 27500:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27501:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27501:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 2080 of 2200). Will run for at most 3 ticks.
+
+At time 27517:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 27525:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27528:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27528:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 8 threads (ticket 315 of 2200). Will run for at most 3 ticks.
+
+At time 27542:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 27573:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27576:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27576:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 2321 of 2400). Will run for at most 3 ticks.
+
+At time 27621:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27623:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27623:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads (ticket 498 of 2200). Will run for at most 3 ticks.
+
+At time 27642:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 27668:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27671:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27671:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 899 of 2400). Will run for at most 3 ticks.
+
+At time 27716:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27719:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27719:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 343 of 2400). Will run for at most 3 ticks.
+
+At time 27764:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27767:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27767:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 2362 of 2400). Will run for at most 3 ticks.
+
+At time 27812:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27815:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27815:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 4 of 2400). Will run for at most 3 ticks.
+
+At time 27860:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27863:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27863:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 216 of 2400). Will run for at most 3 ticks.
+
+At time 27887:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27890:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27890:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 1123 of 2400). Will run for at most 3 ticks.
+
+At time 27935:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27938:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27938:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 2258 of 2400). Will run for at most 3 ticks.
+
+At time 27983:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27986:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27986:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 1587 of 2400). Will run for at most 3 ticks.
+
+At time 28031:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28034:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28034:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 886 of 2400). Will run for at most 3 ticks.
+
+At time 28079:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28080:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28080:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 149 of 2200). Will run for at most 3 ticks.
+
+At time 28095:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 28125:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28127:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28127:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 8 threads (ticket 1304 of 2200). Will run for at most 3 ticks.
+
+At time 28129:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 28172:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28175:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28175:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 18 of 2400). Will run for at most 3 ticks.
+
+At time 28220:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28223:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28223:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 992 of 2400). Will run for at most 3 ticks.
+
+At time 28268:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28271:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28271:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 2158 of 2400). Will run for at most 3 ticks.
+
+At time 28316:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28319:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28319:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 428 of 2400). Will run for at most 3 ticks.
+
+At time 28364:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28367:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28367:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 790 of 2400). Will run for at most 3 ticks.
+
+At time 28412:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28415:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28415:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 2328 of 2400). Will run for at most 3 ticks.
+
+At time 28460:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28463:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28463:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 940 of 2400). Will run for at most 3 ticks.
+
+At time 28508:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28511:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28511:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 130 of 2400). Will run for at most 3 ticks.
+
+At time 28556:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28559:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28559:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 251 of 2400). Will run for at most 3 ticks.
+
+At time 28604:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28607:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28607:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 1203 of 2400). Will run for at most 3 ticks.
+
+At time 28652:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28653:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28653:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 8 threads (ticket 765 of 1600). Will run for at most 3 ticks.
+
+At time 28657:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 28698:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28701:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28701:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 273 of 2400). Will run for at most 3 ticks.
+
+At time 28746:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28749:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28749:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 1486 of 2400). Will run for at most 3 ticks.
+
+At time 28794:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28796:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28796:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 8 threads (ticket 1225 of 2200). Will run for at most 3 ticks.
+
+At time 28803:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 28841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28844:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28844:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 531 of 2400). Will run for at most 3 ticks.
+
+At time 28889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28892:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28892:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 1541 of 2200). Will run for at most 3 ticks.
+
+At time 28914:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 28916:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28919:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28919:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 1801 of 2400). Will run for at most 3 ticks.
+
+At time 28964:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28967:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28967:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 96 of 2400). Will run for at most 3 ticks.
+
+At time 29012:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29015:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29015:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 891 of 2400). Will run for at most 3 ticks.
+
+At time 29060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29063:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29063:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 898 of 2400). Will run for at most 3 ticks.
+
+At time 29087:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29090:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29090:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 2129 of 2400). Will run for at most 3 ticks.
+
+At time 29135:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29136:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29136:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 207 of 2200). Will run for at most 3 ticks.
+
+At time 29149:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29184:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29184:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 1562 of 2400). Will run for at most 3 ticks.
+
+At time 29229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29232:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29232:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 2354 of 2400). Will run for at most 3 ticks.
+
+At time 29277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29280:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29280:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 2260 of 2400). Will run for at most 3 ticks.
+
+At time 29304:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29307:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29307:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 2133 of 2400). Will run for at most 3 ticks.
+
+At time 29352:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29355:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29355:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 1163 of 2400). Will run for at most 3 ticks.
+
+At time 29400:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29403:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29403:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 1403 of 2400). Will run for at most 3 ticks.
+
+At time 29427:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29430:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29430:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 1873 of 2400). Will run for at most 3 ticks.
+
+At time 29475:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29476:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29476:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 8 threads (ticket 1199 of 2200). Will run for at most 3 ticks.
+
+At time 29484:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29521:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29524:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29524:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 1532 of 2400). Will run for at most 3 ticks.
+
+At time 29548:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29551:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29551:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (ticket 2134 of 2400). Will run for at most 3 ticks.
+
+At time 29596:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29599:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29599:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 189 of 2400). Will run for at most 3 ticks.
+
+At time 29644:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29647:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29647:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads (ticket 2383 of 2400). Will run for at most 3 ticks.
+
+At time 29692:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29695:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29695:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 8 threads (ticket 607 of 2200). Will run for at most 3 ticks.
+
+At time 29702:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29740:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29743:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29743:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 238 of 2400). Will run for at most 3 ticks.
+
+At time 29767:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29770:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29770:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 8 threads (ticket 1765 of 2200). Will run for at most 3 ticks.
+
+At time 29782:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29815:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29818:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29818:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 125 of 2400). Will run for at most 3 ticks.
+
+At time 29863:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29866:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29866:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 9 threads (ticket 2238 of 2400). Will run for at most 3 ticks.
+
+At time 29890:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29893:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29893:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 9 threads (ticket 993 of 2400). Will run for at most 3 ticks.
+
+At time 29938:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29940:
+    THREAD_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 29940:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 8 threads (ticket 94 of 1600). Will run for at most 3 ticks.
+
+At time 29985:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29988:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29988:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 1211 of 1600). Will run for at most 3 ticks.
+
+At time 30033:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30034:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 30034:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 7 threads (ticket 918 of 1400). Will run for at most 3 ticks.
+
+At time 30047:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 30058:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30061:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30061:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads (ticket 519 of 1600). Will run for at most 3 ticks.
+
+At time 30106:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30109:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30109:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads (ticket 571 of 1600). Will run for at most 3 ticks.
+
+At time 30133:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30136:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30136:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 396 of 1600). Will run for at most 3 ticks.
+
+At time 30181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30184:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30184:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 8 threads (ticket 83 of 1600). Will run for at most 3 ticks.
+
+At time 30229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30232:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30232:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 384 of 1600). Will run for at most 3 ticks.
+
+At time 30277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30280:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30280:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 8 threads (ticket 1417 of 1600). Will run for at most 3 ticks.
+
+At time 30325:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30326:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 30326:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 7 threads (ticket 742 of 1400). Will run for at most 3 ticks.
+
+At time 30351:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 30371:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30374:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30374:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 8 threads (ticket 1056 of 1600). Will run for at most 3 ticks.
+
+At time 30419:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30422:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30422:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads (ticket 400 of 1600). Will run for at most 3 ticks.
+
+At time 30467:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30470:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30470:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 8 threads (ticket 186 of 1600). Will run for at most 3 ticks.
+
+At time 30515:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30517:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 30517:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 7 threads (ticket 605 of 1400). Will run for at most 3 ticks.
+
+At time 30542:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 30562:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30565:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30565:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 1233 of 1600). Will run for at most 3 ticks.
+
+At time 30589:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30592:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30592:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads (ticket 501 of 1600). Will run for at most 3 ticks.
+
+At time 30637:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30640:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30640:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 8 threads (ticket 1542 of 1600). Will run for at most 3 ticks.
+
+At time 30664:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30667:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30667:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 8 threads (ticket 580 of 1600). Will run for at most 3 ticks.
+
+At time 30691:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30694:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30694:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 8 threads (ticket 242 of 1600). Will run for at most 3 ticks.
+
+At time 30739:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30742:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30742:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 8 threads (ticket 1594 of 1600). Will run for at most 3 ticks.
+
+At time 30787:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30788:
+    THREAD_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 30788:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 7 threads (ticket 298 of 1400). Will run for at most 3 ticks.
+
+At time 30833:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30836:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30836:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 7 threads (ticket 1060 of 1400). Will run for at most 3 ticks.
+
+At time 30881:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30884:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30884:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 7 threads (ticket 1253 of 1400). Will run for at most 3 ticks.
+
+At time 30929:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30932:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30932:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 7 threads (ticket 297 of 1400). Will run for at most 3 ticks.
+
+At time 30956:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30957:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 30957:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 6 threads (ticket 450 of 1200). Will run for at most 3 ticks.
+
+At time 30980:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31002:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31005:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31005:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 7 threads (ticket 317 of 1400). Will run for at most 3 ticks.
+
+At time 31029:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31032:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31032:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 7 threads (ticket 681 of 1400). Will run for at most 3 ticks.
+
+At time 31077:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31080:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31080:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 7 threads (ticket 1199 of 1400). Will run for at most 3 ticks.
+
+At time 31125:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31127:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31127:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (ticket 917 of 1200). Will run for at most 3 ticks.
+
+At time 31131:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31151:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31154:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31154:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 7 threads (ticket 725 of 1400). Will run for at most 3 ticks.
+
+At time 31199:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31202:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31202:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 7 threads (ticket 1286 of 1400). Will run for at most 3 ticks.
+
+At time 31226:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31227:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31227:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 6 threads (ticket 227 of 1200). Will run for at most 3 ticks.
+
+At time 31239:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31272:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31275:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31275:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 7 threads (ticket 1347 of 1400). Will run for at most 3 ticks.
+
+At time 31299:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31301:
+    THREAD_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 31301:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 6 threads (ticket 247 of 1200). Will run for at most 3 ticks.
+
+At time 31346:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31349:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31349:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (ticket 182 of 1200). Will run for at most 3 ticks.
+
+At time 31373:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31376:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31376:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (ticket 1039 of 1200). Will run for at most 3 ticks.
+
+At time 31421:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31424:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31424:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (ticket 1006 of 1200). Will run for at most 3 ticks.
+
+At time 31448:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31450:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31450:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 5 threads (ticket 615 of 1000). Will run for at most 3 ticks.
+
+At time 31451:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31495:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31498:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31498:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (ticket 760 of 1200). Will run for at most 3 ticks.
+
+At time 31543:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31546:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31546:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 6 threads (ticket 990 of 1200). Will run for at most 3 ticks.
+
+At time 31570:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31573:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31573:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 6 threads (ticket 293 of 1200). Will run for at most 3 ticks.
+
+At time 31618:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31621:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31621:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 6 threads (ticket 1040 of 1200). Will run for at most 3 ticks.
+
+At time 31645:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31648:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31648:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (ticket 422 of 1200). Will run for at most 3 ticks.
+
+At time 31693:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31696:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31696:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (ticket 678 of 1200). Will run for at most 3 ticks.
+
+At time 31741:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31744:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31744:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 6 threads (ticket 1086 of 1200). Will run for at most 3 ticks.
+
+At time 31789:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31792:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31792:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 6 threads (ticket 1181 of 1200). Will run for at most 3 ticks.
+
+At time 31816:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31819:
+    THREAD_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 31819:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (ticket 512 of 1000). Will run for at most 3 ticks.
+
+At time 31864:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31865:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31865:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 4 threads (ticket 410 of 800). Will run for at most 3 ticks.
+
+At time 31892:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31910:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31913:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31913:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (ticket 768 of 1000). Will run for at most 3 ticks.
+
+At time 31958:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31960:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31960:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 4 threads (ticket 140 of 800). Will run for at most 3 ticks.
+
+At time 31976:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 32005:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32008:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32008:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 5 threads (ticket 238 of 1000). Will run for at most 3 ticks.
+
+At time 32032:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32035:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32035:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (ticket 725 of 1000). Will run for at most 3 ticks.
+
+At time 32059:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32062:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32062:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (ticket 94 of 1000). Will run for at most 3 ticks.
+
+At time 32107:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32110:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32110:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 829 of 1000). Will run for at most 3 ticks.
+
+At time 32155:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32158:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32158:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (ticket 120 of 1000). Will run for at most 3 ticks.
+
+At time 32203:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32206:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32206:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (ticket 111 of 1000). Will run for at most 3 ticks.
+
+At time 32230:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32233:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32233:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (ticket 685 of 1000). Will run for at most 3 ticks.
+
+At time 32278:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32281:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32281:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 561 of 1000). Will run for at most 3 ticks.
+
+At time 32326:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32329:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32329:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 985 of 1000). Will run for at most 3 ticks.
+
+At time 32353:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32356:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32356:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 494 of 1000). Will run for at most 3 ticks.
+
+At time 32380:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32383:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32383:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 4 threads (ticket 569 of 800). Will run for at most 3 ticks.
+
+At time 32396:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 32428:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32431:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32431:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 733 of 1000). Will run for at most 3 ticks.
+
+At time 32476:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32479:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32479:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 902 of 1000). Will run for at most 3 ticks.
+
+At time 32503:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32506:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32506:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (ticket 529 of 1000). Will run for at most 3 ticks.
+
+At time 32551:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32554:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32554:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 998 of 1000). Will run for at most 3 ticks.
+
+At time 32599:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32602:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32602:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 919 of 1000). Will run for at most 3 ticks.
+
+At time 32626:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32629:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32629:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 776 of 1000). Will run for at most 3 ticks.
+
+At time 32653:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32656:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32656:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 659 of 1000). Will run for at most 3 ticks.
+
+At time 32680:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32683:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32683:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (ticket 182 of 1000). Will run for at most 3 ticks.
+
+At time 32728:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32731:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32731:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 742 of 1000). Will run for at most 3 ticks.
+
+At time 32776:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32779:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32779:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (ticket 60 of 1000). Will run for at most 3 ticks.
+
+At time 32824:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32827:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32827:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (ticket 133 of 1000). Will run for at most 3 ticks.
+
+At time 32851:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32854:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32854:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (ticket 454 of 1000). Will run for at most 3 ticks.
+
+At time 32899:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32902:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32902:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 5 threads (ticket 313 of 1000). Will run for at most 3 ticks.
+
+At time 32926:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32929:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32929:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 813 of 1000). Will run for at most 3 ticks.
+
+At time 32974:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32977:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32977:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (ticket 470 of 1000). Will run for at most 3 ticks.
+
+At time 33022:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33025:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 33025:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 4 threads (ticket 507 of 800). Will run for at most 3 ticks.
+
+At time 33053:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 33070:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33073:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33073:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 955 of 1000). Will run for at most 3 ticks.
+
+At time 33097:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33100:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33100:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 5 threads (ticket 336 of 1000). Will run for at most 3 ticks.
+
+At time 33145:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33148:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33148:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 548 of 1000). Will run for at most 3 ticks.
+
+At time 33193:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33196:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33196:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (ticket 414 of 1000). Will run for at most 3 ticks.
+
+At time 33220:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33222:
+    THREAD_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 33222:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 4 threads (ticket 772 of 800). Will run for at most 3 ticks.
+
+At time 33246:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33247:
+    THREAD_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 33247:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 3 threads (ticket 257 of 600). Will run for at most 3 ticks.
+
+At time 33292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33295:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33295:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 3 threads (ticket 95 of 600). Will run for at most 3 ticks.
+
+At time 33340:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33343:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33343:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 3 threads (ticket 335 of 600). Will run for at most 3 ticks.
+
+At time 33388:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33389:
+    THREAD_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 33389:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 2 threads (ticket 171 of 400). Will run for at most 3 ticks.
+
+At time 33434:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33437:
+    THREAD_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 33437:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 1 threads (ticket 198 of 200). Will run for at most 3 ticks.
+
+At time 33482:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33485:
+    THREAD_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,19 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:            134
+    Process switches:           625
+    Dispatch time saved:       2814
+
+MAX READY WAIT:
+    SYSTEM:                    3244
+    INTERACTIVE:                  0
+    NORMAL:                    9270
+    BATCH:                        0
+
+CPU SHARES:
+    SYSTEM:               target   58.08%   achieved   55.86%
+    INTERACTIVE:          target    0.00%   achieved    0.00%
+    NORMAL:               target   41.92%   achieved   44.14%
+    BATCH:                target    0.00%   achieved    0.00%
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:       57.00
+    Avg. turnaround time:   1676.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       36.00
+    Avg. turnaround time:   1750.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1812
+Total service time:            170
+Total I/O time:                185
+Total dispatch time:          1580
+Total idle time:                62
+
+CPU utilization:            96.58%
+CPU efficiency:              9.38%
+
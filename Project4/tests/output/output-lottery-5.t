@@ -0,0 +1,8 @@
+SIMULATION COMPLETED!
+
+Process 35 [INTERACTIVE]:
+    Thread  0:    ARR: 80     CPU: 109    I/O: 151    TRT: 1676   END: 1756  
+
+Process 140 [NORMAL]:
+    Thread  0:    ARR: 62     CPU: 61     I/O: 34     TRT: 1750   END: 1812  
+
@@ -0,0 +1,987 @@
+At time 62:
+    THREAD_ARRIVED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 62:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 26 of 200). Will run for at most 3 ticks.
+
+At time 80:
+    THREAD_ARRIVED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 98:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 101:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 101:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 81 of 600). Will run for at most 3 ticks.
+
+At time 137:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 140:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 140:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 270 of 600). Will run for at most 3 ticks.
+
+At time 154:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 157:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 157:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 4 of 200). Will run for at most 3 ticks.
+
+At time 185:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 193:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 195:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 195:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (ticket 140 of 400). Will run for at most 3 ticks.
+
+At time 202:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 231:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 234:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 234:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (ticket 546 of 600). Will run for at most 3 ticks.
+
+At time 270:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 273:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 273:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 282 of 600). Will run for at most 3 ticks.
+
+At time 309:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 312:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 312:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 44 of 600). Will run for at most 3 ticks.
+
+At time 326:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 329:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 329:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 341 of 600). Will run for at most 3 ticks.
+
+At time 343:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 346:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 346:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 381 of 600). Will run for at most 3 ticks.
+
+At time 360:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 363:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 363:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 53 of 600). Will run for at most 3 ticks.
+
+At time 377:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 380:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 380:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 333 of 600). Will run for at most 3 ticks.
+
+At time 394:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 397:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 397:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (ticket 473 of 600). Will run for at most 3 ticks.
+
+At time 433:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 436:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 436:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 132 of 600). Will run for at most 3 ticks.
+
+At time 472:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 475:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 475:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 251 of 600). Will run for at most 3 ticks.
+
+At time 489:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 492:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 492:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 149 of 600). Will run for at most 3 ticks.
+
+At time 506:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 508:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 508:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 58 of 200). Will run for at most 3 ticks.
+
+At time 517:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 544:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 547:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 547:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 481 of 600). Will run for at most 3 ticks.
+
+At time 583:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 586:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 586:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 284 of 600). Will run for at most 3 ticks.
+
+At time 600:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 603:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 603:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (ticket 161 of 600). Will run for at most 3 ticks.
+
+At time 639:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 642:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 642:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (ticket 171 of 600). Will run for at most 3 ticks.
+
+At time 656:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 659:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 659:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 449 of 600). Will run for at most 3 ticks.
+
+At time 695:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 696:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 696:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 91 of 200). Will run for at most 3 ticks.
+
+At time 717:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 732:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 735:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 735:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 183 of 600). Will run for at most 3 ticks.
+
+At time 771:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 774:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 774:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 193 of 600). Will run for at most 3 ticks.
+
+At time 788:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 791:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 791:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 67 of 600). Will run for at most 3 ticks.
+
+At time 805:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 808:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 808:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 71 of 600). Will run for at most 3 ticks.
+
+At time 822:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 825:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 825:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 41 of 600). Will run for at most 3 ticks.
+
+At time 839:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 842:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 842:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (ticket 416 of 600). Will run for at most 3 ticks.
+
+At time 878:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 881:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 881:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (ticket 259 of 400). Will run for at most 3 ticks.
+
+At time 897:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 917:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 920:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 920:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 158 of 200). Will run for at most 3 ticks.
+
+At time 929:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 956:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 959:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 959:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 235 of 600). Will run for at most 3 ticks.
+
+At time 995:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 998:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 998:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 317 of 600). Will run for at most 3 ticks.
+
+At time 1012:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1015:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1015:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 239 of 600). Will run for at most 3 ticks.
+
+At time 1029:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1032:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1032:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 114 of 600). Will run for at most 3 ticks.
+
+At time 1046:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1049:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1049:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 358 of 600). Will run for at most 3 ticks.
+
+At time 1063:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1066:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1066:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (ticket 533 of 600). Will run for at most 3 ticks.
+
+At time 1102:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1105:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1105:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 222 of 600). Will run for at most 3 ticks.
+
+At time 1141:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1144:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1144:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 23 of 600). Will run for at most 3 ticks.
+
+At time 1158:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1159:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1159:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 56 of 200). Will run for at most 3 ticks.
+
+At time 1165:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1195:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1198:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1198:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 531 of 600). Will run for at most 3 ticks.
+
+At time 1234:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1236:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1236:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 52 of 200). Will run for at most 3 ticks.
+
+At time 1244:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1272:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1275:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1275:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 312 of 600). Will run for at most 3 ticks.
+
+At time 1311:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1314:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1314:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 11 of 600). Will run for at most 3 ticks.
+
+At time 1328:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1330:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1330:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 101 of 200). Will run for at most 3 ticks.
+
+At time 1353:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1366:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1369:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1369:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 599 of 600). Will run for at most 3 ticks.
+
+At time 1405:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1407:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1407:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 121 of 200). Will run for at most 3 ticks.
+
+At time 1429:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1443:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1446:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1446:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (ticket 558 of 600). Will run for at most 3 ticks.
+
+At time 1460:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1463:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1463:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (ticket 523 of 600). Will run for at most 3 ticks.
+
+At time 1477:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1479:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1479:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (ticket 64 of 400). Will run for at most 3 ticks.
+
+At time 1490:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1515:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1518:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1518:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 477 of 600). Will run for at most 3 ticks.
+
+At time 1532:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1535:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1535:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 296 of 600). Will run for at most 3 ticks.
+
+At time 1549:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1552:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1552:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 330 of 600). Will run for at most 3 ticks.
+
+At time 1566:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1569:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1569:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 437 of 600). Will run for at most 3 ticks.
+
+At time 1583:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1586:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1586:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (ticket 8 of 600). Will run for at most 3 ticks.
+
+At time 1622:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1625:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1625:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 269 of 600). Will run for at most 3 ticks.
+
+At time 1661:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1662:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1662:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 36 of 200). Will run for at most 3 ticks.
+
+At time 1687:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1698:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1701:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1701:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 34 of 600). Will run for at most 3 ticks.
+
+At time 1737:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1740:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1740:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (ticket 115 of 600). Will run for at most 3 ticks.
+
+At time 1754:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1756:
+    THREAD_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 1756:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 2 of 200). Will run for at most 3 ticks.
+
+At time 1792:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1795:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1795:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (ticket 16 of 200). Will run for at most 3 ticks.
+
+At time 1809:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1812:
+    THREAD_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,19 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             28
+    Process switches:            33
+    Dispatch time saved:        616
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                 92
+    NORMAL:                     160
+    BATCH:                        0
+
+CPU SHARES:
+    SYSTEM:               target    0.00%   achieved    0.00%
+    INTERACTIVE:          target   64.31%   achieved   64.12%
+    NORMAL:               target   35.69%   achieved   35.88%
+    BATCH:                target    0.00%   achieved    0.00%
+
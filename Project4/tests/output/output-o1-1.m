@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       33.33
+    Avg. turnaround time:   4027.67
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:       65.25
+    Avg. turnaround time:   2222.25
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           4960
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:          4251
+Total idle time:                81
+
+CPU utilization:            98.37%
+CPU efficiency:             12.66%
+
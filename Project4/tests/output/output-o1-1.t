@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 3626   END: 3676  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 4918   END: 4960  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 3539   END: 3596  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 4672   END: 4772  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 962    END: 1022  
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 2102   END: 2175  
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 1153   END: 1203  
+
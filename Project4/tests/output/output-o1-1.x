@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:            122
+    Process switches:           111
+    Dispatch time saved:       3904
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                189
+    NORMAL:                     175
+    BATCH:                        0
+
@@ -0,0 +1,9 @@
+SIMULATION COMPLETED!
+
+Process 59 [SYSTEM]:
+    Thread  0:    ARR: 33     CPU: 54     I/O: 60     TRT: 2350   END: 2383  
+    Thread  1:    ARR: 29     CPU: 123    I/O: 97     TRT: 2910   END: 2939  
+
+Process 189 [NORMAL]:
+    Thread  0:    ARR: 19     CPU: 46     I/O: 34     TRT: 2525   END: 2544  
+
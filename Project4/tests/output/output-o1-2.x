@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             38
+    Process switches:            48
+    Dispatch time saved:       1406
+
+MAX READY WAIT:
+    SYSTEM:                     220
+    INTERACTIVE:                  0
+    NORMAL:                     110
+    BATCH:                        0
+
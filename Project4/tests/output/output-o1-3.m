@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:       62.00
+    Avg. turnaround time:  17642.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      243.25
+    Avg. turnaround time:  12036.88
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      431.75
+    Avg. turnaround time:  13602.50
+
+Total elapsed time:          18864
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         17678
+Total idle time:                59
+
+CPU utilization:            99.69%
+CPU efficiency:              5.97%
+
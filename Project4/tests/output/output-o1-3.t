@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 18183  END: 18231 
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 14659  END: 14669 
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 17642  END: 17724 
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 314    END: 372   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 14107  END: 14135 
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 13348  END: 13381 
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 18864  END: 18864 
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 16097  END: 16150 
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 4790   END: 4848  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 13039  END: 13109 
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 17777  END: 17824 
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 2495   END: 2534  
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 17032  END: 17119 
+
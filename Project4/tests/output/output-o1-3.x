@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:            122
+    Process switches:           320
+    Dispatch time saved:       3538
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                885
+    NORMAL:                    1083
+    BATCH:                      860
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      385.00
+    Avg. turnaround time:  25577.00
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:      937.50
+    Avg. turnaround time:  30182.80
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:          36783
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:         34584
+Total idle time:                65
+
+CPU utilization:            99.82%
+CPU efficiency:              5.80%
+
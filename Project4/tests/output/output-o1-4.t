@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 30307  END: 30366 
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 19635  END: 19714 
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 36733  END: 36783 
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 23702  END: 23724 
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 29807  END: 29857 
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 31312  END: 31371 
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 34708  END: 34779 
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 30131  END: 30170 
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 27083  END: 27106 
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 34783  END: 34875 
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 30247  END: 30318 
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 12094  END: 12119 
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 35728  END: 35823 
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 33730  END: 33774 
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 23323  END: 23390 
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 15038  END: 15085 
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 28505  END: 28550 
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 22811  END: 22870 
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 26716  END: 26792 
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 35532  END: 35542 
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 15636  END: 15653 
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 28842  END: 28891 
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 27926  END: 27981 
+
@@ -0,0 +1,13387 @@
+At time 10:
+    THREAD_ARRIVED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 1 threads (level = 25, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 17:
+    THREAD_ARRIVED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 22:
+    THREAD_ARRIVED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 23:
+    THREAD_ARRIVED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 25:
+    THREAD_ARRIVED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 44:
+    THREAD_ARRIVED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 45:
+    THREAD_ARRIVED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 49:
+    THREAD_ARRIVED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    THREAD_ARRIVED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 55:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 55:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 13 threads (level = 5, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 67:
+    THREAD_ARRIVED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 76:
+    THREAD_ARRIVED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 79:
+    THREAD_ARRIVED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 92:
+    THREAD_ARRIVED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 95:
+    THREAD_ARRIVED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 100:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 103:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 103:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 148:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 151:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 151:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 2). Will run for at most 3 ticks.
+
+At time 196:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 198:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 198:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 5, bonus = 0, expired = 2). Will run for at most 3 ticks.
+
+At time 215:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 243:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 243:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 243:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 288:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 290:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 290:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 5, bonus = 0, expired = 2). Will run for at most 3 ticks.
+
+At time 297:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 335:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 335:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 335:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 2). Will run for at most 3 ticks.
+
+At time 380:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 383:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 383:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 3). Will run for at most 3 ticks.
+
+At time 428:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 431:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 431:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 4). Will run for at most 3 ticks.
+
+At time 476:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 479:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 479:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 5). Will run for at most 3 ticks.
+
+At time 503:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 506:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 506:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 6). Will run for at most 3 ticks.
+
+At time 551:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 554:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 554:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 7). Will run for at most 3 ticks.
+
+At time 599:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 602:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 602:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 8). Will run for at most 3 ticks.
+
+At time 647:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 650:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 650:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 9). Will run for at most 3 ticks.
+
+At time 695:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 698:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 698:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 10). Will run for at most 3 ticks.
+
+At time 743:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 746:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 746:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 11). Will run for at most 3 ticks.
+
+At time 791:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 794:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 794:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 12). Will run for at most 3 ticks.
+
+At time 818:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 821:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 821:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 866:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 868:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 868:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 883:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 913:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 913:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 913:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 13). Will run for at most 3 ticks.
+
+At time 958:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 961:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 961:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 14). Will run for at most 3 ticks.
+
+At time 1006:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1009:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1009:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 15). Will run for at most 3 ticks.
+
+At time 1033:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1036:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1036:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 16). Will run for at most 3 ticks.
+
+At time 1060:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1063:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1063:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 17). Will run for at most 3 ticks.
+
+At time 1108:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1111:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1111:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 18). Will run for at most 3 ticks.
+
+At time 1156:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1159:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1159:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 19). Will run for at most 3 ticks.
+
+At time 1204:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1207:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1207:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 20). Will run for at most 3 ticks.
+
+At time 1252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1255:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1255:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 21). Will run for at most 3 ticks.
+
+At time 1300:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1303:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1303:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 22). Will run for at most 3 ticks.
+
+At time 1348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1351:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1351:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 1396:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1399:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1399:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 1444:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1447:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1447:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 1492:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1495:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1495:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 1540:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1543:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1543:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 1588:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1591:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1591:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 1615:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1618:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1618:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 6). Will run for at most 3 ticks.
+
+At time 1663:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1666:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1666:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 7). Will run for at most 3 ticks.
+
+At time 1711:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1714:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1714:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 8). Will run for at most 3 ticks.
+
+At time 1759:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1762:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1762:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 9). Will run for at most 3 ticks.
+
+At time 1807:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1808:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1808:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 9). Will run for at most 3 ticks.
+
+At time 1829:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1853:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1853:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1853:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 9). Will run for at most 3 ticks.
+
+At time 1898:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1901:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1901:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 10). Will run for at most 3 ticks.
+
+At time 1946:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1949:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 1949:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 11). Will run for at most 3 ticks.
+
+At time 1973:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1974:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1974:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 11). Will run for at most 3 ticks.
+
+At time 1998:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2019:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2019:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2019:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 11). Will run for at most 3 ticks.
+
+At time 2064:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2067:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2067:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 12). Will run for at most 3 ticks.
+
+At time 2112:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2115:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2115:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 13). Will run for at most 3 ticks.
+
+At time 2160:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2163:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2163:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 2208:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2211:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2211:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 2235:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2238:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2238:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 16). Will run for at most 3 ticks.
+
+At time 2262:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2265:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2265:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 17). Will run for at most 3 ticks.
+
+At time 2310:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2313:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2313:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 18). Will run for at most 3 ticks.
+
+At time 2358:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2361:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2361:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 19). Will run for at most 3 ticks.
+
+At time 2406:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2409:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2409:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 20). Will run for at most 3 ticks.
+
+At time 2454:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2457:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2457:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 21). Will run for at most 3 ticks.
+
+At time 2502:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2505:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2505:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 22). Will run for at most 3 ticks.
+
+At time 2550:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2551:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2551:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 22 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 2570:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2596:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2599:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2599:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 2644:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2647:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2647:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 2692:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2695:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2695:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 2740:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2743:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2743:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 2788:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2791:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2791:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 2836:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2839:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2839:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 6). Will run for at most 3 ticks.
+
+At time 2884:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2887:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2887:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 7). Will run for at most 3 ticks.
+
+At time 2911:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2913:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2913:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 7). Will run for at most 3 ticks.
+
+At time 2933:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2958:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2958:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 2958:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 7). Will run for at most 3 ticks.
+
+At time 3003:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3006:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3006:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 8). Will run for at most 3 ticks.
+
+At time 3051:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3054:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3054:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 9). Will run for at most 3 ticks.
+
+At time 3099:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3102:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3102:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 10). Will run for at most 3 ticks.
+
+At time 3126:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3129:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3129:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 11). Will run for at most 3 ticks.
+
+At time 3174:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3177:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3177:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 12). Will run for at most 3 ticks.
+
+At time 3222:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3225:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3225:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 13). Will run for at most 3 ticks.
+
+At time 3270:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3273:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3273:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 14). Will run for at most 3 ticks.
+
+At time 3318:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3321:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3321:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 3366:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3368:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3368:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 3392:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3392:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3392:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3392:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 15). Will run for at most 3 ticks.
+
+At time 3416:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3419:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3419:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 16). Will run for at most 3 ticks.
+
+At time 3443:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3446:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3446:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 16). Will run for at most 3 ticks.
+
+At time 3471:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3491:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3491:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3491:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 16). Will run for at most 3 ticks.
+
+At time 3536:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3539:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3539:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 17). Will run for at most 3 ticks.
+
+At time 3584:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3587:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3587:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 18). Will run for at most 3 ticks.
+
+At time 3632:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3635:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3635:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 19). Will run for at most 3 ticks.
+
+At time 3680:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3682:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3682:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 19). Will run for at most 3 ticks.
+
+At time 3702:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3727:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3727:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3727:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 19). Will run for at most 3 ticks.
+
+At time 3772:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3775:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3775:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 20). Will run for at most 3 ticks.
+
+At time 3799:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3802:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3802:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 21). Will run for at most 3 ticks.
+
+At time 3847:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3850:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3850:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 22). Will run for at most 3 ticks.
+
+At time 3895:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3898:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3898:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 3943:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3946:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 3946:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 3991:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3993:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3993:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 3997:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4038:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4041:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4041:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 4086:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4089:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4089:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 5, bonus = 0, expired = 2). Will run for at most 3 ticks.
+
+At time 4113:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4116:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4116:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4116:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 2, bonus = 3, expired = 2). Will run for at most 3 ticks.
+
+At time 4127:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4140:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4143:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4143:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 3). Will run for at most 3 ticks.
+
+At time 4167:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4170:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4170:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 4215:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4218:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4218:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 4263:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4266:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4266:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 4269:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4311:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4314:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4314:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 4343:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4359:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4359:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4359:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 5). Will run for at most 3 ticks.
+
+At time 4404:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4407:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4407:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 6). Will run for at most 3 ticks.
+
+At time 4452:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4455:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4455:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 7). Will run for at most 3 ticks.
+
+At time 4500:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4503:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4503:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 8). Will run for at most 3 ticks.
+
+At time 4527:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4530:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4530:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 9). Will run for at most 3 ticks.
+
+At time 4575:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4578:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4578:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 10). Will run for at most 3 ticks.
+
+At time 4623:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4626:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4626:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 11). Will run for at most 3 ticks.
+
+At time 4671:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4674:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4674:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 12). Will run for at most 3 ticks.
+
+At time 4698:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4701:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 4701:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 13). Will run for at most 3 ticks.
+
+At time 4746:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4749:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4749:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 14). Will run for at most 3 ticks.
+
+At time 4794:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4797:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4797:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 15). Will run for at most 3 ticks.
+
+At time 4821:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4824:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4824:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 16). Will run for at most 3 ticks.
+
+At time 4869:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4872:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4872:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 17). Will run for at most 3 ticks.
+
+At time 4917:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4920:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4920:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 18). Will run for at most 3 ticks.
+
+At time 4965:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4968:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4968:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 19). Will run for at most 3 ticks.
+
+At time 5013:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5016:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5016:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 20). Will run for at most 3 ticks.
+
+At time 5061:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5064:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5064:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 21). Will run for at most 3 ticks.
+
+At time 5109:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5112:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5112:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 22). Will run for at most 3 ticks.
+
+At time 5157:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5160:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5160:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 5205:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5208:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5208:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 5232:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5235:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5235:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 5280:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5283:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5283:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 5313:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5328:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5328:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5328:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 1). Will run for at most 3 ticks.
+
+At time 5373:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5376:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5376:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 5421:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5424:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5424:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 3). Will run for at most 3 ticks.
+
+At time 5469:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5472:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5472:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 4). Will run for at most 3 ticks.
+
+At time 5517:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5520:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5520:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 5565:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5566:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5566:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (level = 7, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 5576:
+    IO_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5611:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5611:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5611:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 5656:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5659:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5659:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 6). Will run for at most 3 ticks.
+
+At time 5704:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5707:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5707:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 7). Will run for at most 3 ticks.
+
+At time 5731:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5734:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5734:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 8). Will run for at most 3 ticks.
+
+At time 5779:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5782:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5782:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 9). Will run for at most 3 ticks.
+
+At time 5827:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5830:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5830:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 10). Will run for at most 3 ticks.
+
+At time 5875:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5878:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5878:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 11). Will run for at most 3 ticks.
+
+At time 5902:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5905:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5905:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 12). Will run for at most 3 ticks.
+
+At time 5950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5953:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 5953:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 13). Will run for at most 3 ticks.
+
+At time 5998:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6001:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6001:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 24, bonus = 1, expired = 14). Will run for at most 3 ticks.
+
+At time 6025:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6028:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6028:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 15). Will run for at most 3 ticks.
+
+At time 6073:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6076:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6076:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 16). Will run for at most 3 ticks.
+
+At time 6121:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6124:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6124:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (level = 25, bonus = 0, expired = 16). Will run for at most 3 ticks.
+
+At time 6132:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6172:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6172:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 17). Will run for at most 3 ticks.
+
+At time 6217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6220:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6220:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 18). Will run for at most 3 ticks.
+
+At time 6244:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6247:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6247:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 19). Will run for at most 3 ticks.
+
+At time 6292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6295:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6295:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 20). Will run for at most 3 ticks.
+
+At time 6340:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6342:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6342:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 20). Will run for at most 3 ticks.
+
+At time 6354:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6387:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6387:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6387:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 20). Will run for at most 3 ticks.
+
+At time 6432:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6435:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6435:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 21). Will run for at most 3 ticks.
+
+At time 6480:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6483:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6483:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 22). Will run for at most 3 ticks.
+
+At time 6528:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6531:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6531:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 6576:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6579:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6579:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 6603:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6606:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6606:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 1). Will run for at most 3 ticks.
+
+At time 6651:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6654:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6654:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 6699:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6702:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6702:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 3). Will run for at most 3 ticks.
+
+At time 6747:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6750:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6750:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 4). Will run for at most 3 ticks.
+
+At time 6795:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6797:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6797:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 6822:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6842:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6842:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6842:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 4). Will run for at most 3 ticks.
+
+At time 6887:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6890:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6890:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 6935:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6938:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6938:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 6). Will run for at most 3 ticks.
+
+At time 6983:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6986:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 6986:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 7). Will run for at most 3 ticks.
+
+At time 7010:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7013:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7013:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 8). Will run for at most 3 ticks.
+
+At time 7058:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7061:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7061:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 9). Will run for at most 3 ticks.
+
+At time 7106:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7109:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7109:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 10). Will run for at most 3 ticks.
+
+At time 7154:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7157:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7157:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 11). Will run for at most 3 ticks.
+
+At time 7181:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7184:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7184:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 12). Will run for at most 3 ticks.
+
+At time 7229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7232:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7232:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (level = 25, bonus = 0, expired = 12). Will run for at most 3 ticks.
+
+At time 7239:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7277:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7277:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 12). Will run for at most 3 ticks.
+
+At time 7322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7325:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 7325:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 7370:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7373:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7373:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 14). Will run for at most 3 ticks.
+
+At time 7418:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7421:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7421:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 15). Will run for at most 3 ticks.
+
+At time 7466:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7469:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7469:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 16). Will run for at most 3 ticks.
+
+At time 7514:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7517:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7517:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 17). Will run for at most 3 ticks.
+
+At time 7562:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7565:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7565:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 18). Will run for at most 3 ticks.
+
+At time 7589:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7590:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7590:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 18). Will run for at most 3 ticks.
+
+At time 7605:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7635:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7635:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7635:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 18). Will run for at most 3 ticks.
+
+At time 7680:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7683:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7683:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 19). Will run for at most 3 ticks.
+
+At time 7728:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7731:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7731:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 19). Will run for at most 3 ticks.
+
+At time 7736:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7776:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7779:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7779:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 19). Will run for at most 3 ticks.
+
+At time 7805:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7824:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7824:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7824:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 19). Will run for at most 3 ticks.
+
+At time 7869:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7872:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7872:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 20). Will run for at most 3 ticks.
+
+At time 7896:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7899:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7899:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 21). Will run for at most 3 ticks.
+
+At time 7944:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7947:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7947:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 22). Will run for at most 3 ticks.
+
+At time 7971:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7974:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 7974:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 8019:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8022:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8022:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 1). Will run for at most 3 ticks.
+
+At time 8067:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8070:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8070:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 2). Will run for at most 3 ticks.
+
+At time 8115:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8118:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8118:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 5, bonus = 0, expired = 2). Will run for at most 3 ticks.
+
+At time 8131:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 8163:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8163:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8163:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 2). Will run for at most 3 ticks.
+
+At time 8208:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8211:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8211:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 3). Will run for at most 3 ticks.
+
+At time 8256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8259:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8259:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 4). Will run for at most 3 ticks.
+
+At time 8304:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8307:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8307:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 8331:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8334:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8334:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 6). Will run for at most 3 ticks.
+
+At time 8379:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8382:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8382:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 7). Will run for at most 3 ticks.
+
+At time 8406:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8409:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8409:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 8). Will run for at most 3 ticks.
+
+At time 8454:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8457:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8457:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 9). Will run for at most 3 ticks.
+
+At time 8502:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8505:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8505:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 10). Will run for at most 3 ticks.
+
+At time 8550:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8553:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8553:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 11). Will run for at most 3 ticks.
+
+At time 8577:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8580:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8580:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 12). Will run for at most 3 ticks.
+
+At time 8625:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8628:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 8628:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 8673:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8676:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8676:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 14). Will run for at most 3 ticks.
+
+At time 8721:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8724:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8724:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 15). Will run for at most 3 ticks.
+
+At time 8769:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8772:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8772:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 16). Will run for at most 3 ticks.
+
+At time 8817:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8820:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8820:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 17). Will run for at most 3 ticks.
+
+At time 8865:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8868:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8868:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 18). Will run for at most 3 ticks.
+
+At time 8892:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8895:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8895:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 19). Will run for at most 3 ticks.
+
+At time 8940:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8943:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 8943:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 20). Will run for at most 3 ticks.
+
+At time 8967:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 8969:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 8969:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 20). Will run for at most 3 ticks.
+
+At time 8981:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 9014:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9014:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9014:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 20). Will run for at most 3 ticks.
+
+At time 9059:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9062:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9062:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 21). Will run for at most 3 ticks.
+
+At time 9107:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9110:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9110:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 22). Will run for at most 3 ticks.
+
+At time 9134:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 9137:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 9137:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 9182:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9185:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9185:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 1). Will run for at most 3 ticks.
+
+At time 9230:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9233:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9233:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 2). Will run for at most 3 ticks.
+
+At time 9278:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9281:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9281:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 3). Will run for at most 3 ticks.
+
+At time 9305:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9308:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9308:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 4). Will run for at most 3 ticks.
+
+At time 9353:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9356:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9356:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 9380:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9383:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9383:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 6). Will run for at most 3 ticks.
+
+At time 9428:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9431:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9431:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 7). Will run for at most 3 ticks.
+
+At time 9476:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9479:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9479:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 8). Will run for at most 3 ticks.
+
+At time 9503:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9505:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9505:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 8). Will run for at most 3 ticks.
+
+At time 9512:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9550:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9550:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9550:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 8). Will run for at most 3 ticks.
+
+At time 9595:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9598:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9598:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 9). Will run for at most 3 ticks.
+
+At time 9643:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9644:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9644:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 9). Will run for at most 3 ticks.
+
+At time 9674:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9689:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9689:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9689:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 9). Will run for at most 3 ticks.
+
+At time 9734:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9737:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9737:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 10). Will run for at most 3 ticks.
+
+At time 9782:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9785:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9785:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 11). Will run for at most 3 ticks.
+
+At time 9830:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9832:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 9832:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 11). Will run for at most 3 ticks.
+
+At time 9835:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 9877:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9877:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9877:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 11). Will run for at most 3 ticks.
+
+At time 9922:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9925:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9925:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 12). Will run for at most 3 ticks.
+
+At time 9970:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9973:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 9973:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 10018:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10021:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10021:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 14). Will run for at most 3 ticks.
+
+At time 10066:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10069:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10069:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 15). Will run for at most 3 ticks.
+
+At time 10114:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10117:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10117:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 16). Will run for at most 3 ticks.
+
+At time 10141:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10144:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10144:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 17). Will run for at most 3 ticks.
+
+At time 10189:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10192:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10192:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 18). Will run for at most 3 ticks.
+
+At time 10237:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10240:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10240:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 19). Will run for at most 3 ticks.
+
+At time 10285:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10288:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10288:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 20). Will run for at most 3 ticks.
+
+At time 10312:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10315:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10315:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 21). Will run for at most 3 ticks.
+
+At time 10360:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10363:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10363:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (level = 28, bonus = -3, expired = 21). Will run for at most 3 ticks.
+
+At time 10377:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 10387:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10387:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10387:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 21). Will run for at most 3 ticks.
+
+At time 10411:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10414:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10414:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (level = 28, bonus = -3, expired = 22). Will run for at most 3 ticks.
+
+At time 10438:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 10441:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 10441:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 10486:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10488:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10488:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 10518:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10533:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10533:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10533:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 1, bonus = 4, expired = 0). Will run for at most 3 ticks.
+
+At time 10578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10581:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10581:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 1, bonus = 4, expired = 0). Will run for at most 3 ticks.
+
+At time 10605:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10608:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10608:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 1, bonus = 4, expired = 0). Will run for at most 3 ticks.
+
+At time 10632:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10635:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10635:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 10659:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10662:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 10662:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 10665:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 10707:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10707:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10707:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 10752:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10755:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10755:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 10779:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10782:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10782:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 10806:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10809:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10809:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 10833:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10836:
+    THREAD_PREEMPTED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10836:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 1). Will run for at most 3 ticks.
+
+At time 10881:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10884:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10884:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 10929:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10932:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10932:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 3). Will run for at most 3 ticks.
+
+At time 10956:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 10959:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 10959:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 4). Will run for at most 3 ticks.
+
+At time 11004:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11007:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11007:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 5). Will run for at most 3 ticks.
+
+At time 11031:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11032:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11032:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 7, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 11056:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11059:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 11059:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11059:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 23 threads (level = 2, bonus = 3, expired = 6). Will run for at most 3 ticks.
+
+At time 11083:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11086:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11086:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 7). Will run for at most 3 ticks.
+
+At time 11131:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11134:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11134:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 7, bonus = -2, expired = 8). Will run for at most 3 ticks.
+
+At time 11179:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11182:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11182:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 9). Will run for at most 3 ticks.
+
+At time 11206:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11208:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11208:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 9). Will run for at most 3 ticks.
+
+At time 11234:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 11253:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11253:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11253:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 23 threads (level = 5, bonus = 0, expired = 9). Will run for at most 3 ticks.
+
+At time 11298:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11301:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11301:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 10). Will run for at most 3 ticks.
+
+At time 11346:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11349:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11349:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 11). Will run for at most 3 ticks.
+
+At time 11394:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11397:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11397:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 11). Will run for at most 3 ticks.
+
+At time 11399:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 11421:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11424:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11424:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 23 threads (level = 8, bonus = -3, expired = 12). Will run for at most 3 ticks.
+
+At time 11448:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 11451:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 11451:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 23 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 11496:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11499:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11499:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 11523:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11526:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11526:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 11571:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11572:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 11572:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 11596:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 11617:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11617:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11617:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 23 threads (level = 23, bonus = 2, expired = 15). Will run for at most 3 ticks.
+
+At time 11662:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11665:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11665:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 16). Will run for at most 3 ticks.
+
+At time 11710:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11713:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11713:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 17). Will run for at most 3 ticks.
+
+At time 11758:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11761:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11761:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 18). Will run for at most 3 ticks.
+
+At time 11806:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11809:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11809:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 23 threads (level = 26, bonus = -1, expired = 19). Will run for at most 3 ticks.
+
+At time 11854:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11857:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11857:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 20). Will run for at most 3 ticks.
+
+At time 11902:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11905:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11905:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 23 threads (level = 27, bonus = -2, expired = 21). Will run for at most 3 ticks.
+
+At time 11950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11953:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11953:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 23 threads (level = 28, bonus = -3, expired = 22). Will run for at most 3 ticks.
+
+At time 11977:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11980:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 11980:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 12025:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12028:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12028:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 12053:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 12073:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12073:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12073:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    Selected from 23 threads (level = 1, bonus = 4, expired = 0). Will run for at most 3 ticks.
+
+At time 12118:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12119:
+    THREAD_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 12119:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 12164:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12167:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12167:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 3, bonus = 2, expired = 1). Will run for at most 3 ticks.
+
+At time 12212:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12215:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12215:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 12260:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12263:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12263:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 12287:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12290:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12290:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 12335:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12338:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12338:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 12383:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12386:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12386:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 7, bonus = -2, expired = 6). Will run for at most 3 ticks.
+
+At time 12431:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12434:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12434:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 7). Will run for at most 3 ticks.
+
+At time 12479:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12480:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12480:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (level = 8, bonus = -3, expired = 7). Will run for at most 3 ticks.
+
+At time 12507:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 12525:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12525:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12525:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (level = 5, bonus = 0, expired = 7). Will run for at most 3 ticks.
+
+At time 12570:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12573:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12573:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (level = 8, bonus = -3, expired = 7). Will run for at most 3 ticks.
+
+At time 12588:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 12618:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12618:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12618:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (level = 4, bonus = 1, expired = 7). Will run for at most 3 ticks.
+
+At time 12663:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12666:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12666:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 8). Will run for at most 3 ticks.
+
+At time 12711:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12712:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 12712:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 21 threads (level = 8, bonus = -3, expired = 8). Will run for at most 3 ticks.
+
+At time 12717:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 12736:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12739:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12739:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 9). Will run for at most 3 ticks.
+
+At time 12784:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12787:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12787:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 10). Will run for at most 3 ticks.
+
+At time 12832:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12835:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12835:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 11). Will run for at most 3 ticks.
+
+At time 12880:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12883:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 12883:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (level = 24, bonus = 1, expired = 12). Will run for at most 3 ticks.
+
+At time 12928:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12931:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12931:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 13). Will run for at most 3 ticks.
+
+At time 12976:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12979:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12979:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 13003:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13004:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13004:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 21 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 13032:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13049:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13049:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13049:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (level = 23, bonus = 2, expired = 14). Will run for at most 3 ticks.
+
+At time 13094:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13097:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13097:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 13121:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13124:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13124:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 21 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 13152:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13169:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13169:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (level = 24, bonus = 1, expired = 15). Will run for at most 3 ticks.
+
+At time 13214:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13215:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13215:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 21 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 13235:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13239:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13239:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13239:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (level = 22, bonus = 3, expired = 15). Will run for at most 3 ticks.
+
+At time 13263:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13266:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13266:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 16). Will run for at most 3 ticks.
+
+At time 13311:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13314:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13314:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 17). Will run for at most 3 ticks.
+
+At time 13338:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13341:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13341:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 18). Will run for at most 3 ticks.
+
+At time 13386:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13389:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13389:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 19). Will run for at most 3 ticks.
+
+At time 13434:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13437:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13437:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 20). Will run for at most 3 ticks.
+
+At time 13482:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13483:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13483:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 21 threads (level = 28, bonus = -3, expired = 20). Will run for at most 3 ticks.
+
+At time 13506:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13507:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13507:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13507:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads (level = 25, bonus = 0, expired = 20). Will run for at most 3 ticks.
+
+At time 13531:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13534:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 13534:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (level = 28, bonus = -3, expired = 21). Will run for at most 3 ticks.
+
+At time 13558:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 13561:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13561:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 21 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 13576:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 13606:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13609:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13609:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 13654:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13657:
+    THREAD_PREEMPTED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13657:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 13702:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13705:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13705:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (level = 4, bonus = 1, expired = 3). Will run for at most 3 ticks.
+
+At time 13750:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13753:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13753:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 21 threads (level = 6, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 13766:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 13798:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13798:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13798:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 22 threads (level = 3, bonus = 2, expired = 3). Will run for at most 3 ticks.
+
+At time 13843:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13846:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13846:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 13891:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13894:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13894:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 13939:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13942:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 13942:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 6, bonus = -1, expired = 6). Will run for at most 3 ticks.
+
+At time 13987:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 13988:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 13988:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 21 threads (level = 8, bonus = -3, expired = 6). Will run for at most 3 ticks.
+
+At time 14018:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 14033:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14033:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14033:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 3, bonus = 2, expired = 6). Will run for at most 3 ticks.
+
+At time 14078:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14081:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14081:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 7). Will run for at most 3 ticks.
+
+At time 14126:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14127:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14127:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 21 threads (level = 8, bonus = -3, expired = 7). Will run for at most 3 ticks.
+
+At time 14134:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 14172:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14172:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14172:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 7, bonus = -2, expired = 7). Will run for at most 3 ticks.
+
+At time 14217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14220:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14220:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 8). Will run for at most 3 ticks.
+
+At time 14265:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14268:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14268:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 9). Will run for at most 3 ticks.
+
+At time 14313:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14316:
+    THREAD_PREEMPTED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14316:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 22 threads (level = 8, bonus = -3, expired = 10). Will run for at most 3 ticks.
+
+At time 14361:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14364:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14364:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 9, bonus = -4, expired = 11). Will run for at most 3 ticks.
+
+At time 14409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14412:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14412:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 22 threads (level = 22, bonus = 3, expired = 12). Will run for at most 3 ticks.
+
+At time 14457:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14460:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14460:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 22 threads (level = 24, bonus = 1, expired = 13). Will run for at most 3 ticks.
+
+At time 14505:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14508:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14508:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 22 threads (level = 24, bonus = 1, expired = 14). Will run for at most 3 ticks.
+
+At time 14553:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14556:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14556:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 22 threads (level = 25, bonus = 0, expired = 15). Will run for at most 3 ticks.
+
+At time 14601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14604:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14604:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 16). Will run for at most 3 ticks.
+
+At time 14649:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14652:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14652:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 17). Will run for at most 3 ticks.
+
+At time 14697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14700:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14700:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 18). Will run for at most 3 ticks.
+
+At time 14745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14748:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14748:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 19). Will run for at most 3 ticks.
+
+At time 14793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14794:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14794:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 21 threads (level = 27, bonus = -2, expired = 19). Will run for at most 3 ticks.
+
+At time 14799:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 14818:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14818:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14818:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 22 threads (level = 26, bonus = -1, expired = 19). Will run for at most 3 ticks.
+
+At time 14842:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14845:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14845:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 20). Will run for at most 3 ticks.
+
+At time 14890:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14893:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14893:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 22 threads (level = 27, bonus = -2, expired = 21). Will run for at most 3 ticks.
+
+At time 14938:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14941:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 14941:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 22 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 14986:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 14989:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 14989:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 22 threads (level = 3, bonus = 2, expired = 1). Will run for at most 3 ticks.
+
+At time 15034:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15037:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15037:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    Selected from 22 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 15082:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15085:
+    THREAD_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 15085:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 15130:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15132:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15132:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 15154:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 15177:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15177:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15177:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 21 threads (level = 2, bonus = 3, expired = 2). Will run for at most 3 ticks.
+
+At time 15222:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15225:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15225:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 21 threads (level = 4, bonus = 1, expired = 3). Will run for at most 3 ticks.
+
+At time 15270:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15273:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15273:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (level = 6, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 15318:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15320:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15320:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 20 threads (level = 6, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 15321:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 15365:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15368:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15368:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (level = 6, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 15397:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 15413:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15413:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15413:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 21 threads (level = 4, bonus = 1, expired = 4). Will run for at most 3 ticks.
+
+At time 15458:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15461:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15461:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 21 threads (level = 6, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 15506:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15509:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15509:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 21 threads (level = 8, bonus = -3, expired = 6). Will run for at most 3 ticks.
+
+At time 15554:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15557:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15557:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 21 threads (level = 8, bonus = -3, expired = 7). Will run for at most 3 ticks.
+
+At time 15602:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15605:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15605:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    Selected from 21 threads (level = 8, bonus = -3, expired = 8). Will run for at most 3 ticks.
+
+At time 15650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15653:
+    THREAD_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 15653:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 20 threads (level = 9, bonus = -4, expired = 8). Will run for at most 3 ticks.
+
+At time 15698:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15699:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 15699:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 9, bonus = -4, expired = 8). Will run for at most 3 ticks.
+
+At time 15713:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 15744:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15744:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15744:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 20 threads (level = 7, bonus = -2, expired = 8). Will run for at most 3 ticks.
+
+At time 15789:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15792:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15792:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 9, bonus = -4, expired = 9). Will run for at most 3 ticks.
+
+At time 15837:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 15840:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 15840:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 20 threads (level = 23, bonus = 2, expired = 10). Will run for at most 3 ticks.
+
+At time 15885:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15888:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15888:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 20 threads (level = 24, bonus = 1, expired = 11). Will run for at most 3 ticks.
+
+At time 15933:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15936:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15936:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 20 threads (level = 24, bonus = 1, expired = 12). Will run for at most 3 ticks.
+
+At time 15981:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15984:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 15984:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 20 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 16029:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16032:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16032:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 16077:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16078:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16078:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 16083:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16123:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16126:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16126:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 16171:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16174:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16174:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 16). Will run for at most 3 ticks.
+
+At time 16198:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16200:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16200:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 19 threads (level = 27, bonus = -2, expired = 16). Will run for at most 3 ticks.
+
+At time 16223:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16245:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16245:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16245:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 20 threads (level = 24, bonus = 1, expired = 16). Will run for at most 3 ticks.
+
+At time 16290:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16293:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16293:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 17). Will run for at most 3 ticks.
+
+At time 16338:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16341:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16341:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 18). Will run for at most 3 ticks.
+
+At time 16386:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16389:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16389:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 20 threads (level = 28, bonus = -3, expired = 19). Will run for at most 3 ticks.
+
+At time 16413:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16415:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 16415:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 16430:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 16460:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16463:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16463:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 16508:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16511:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16511:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 16556:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16559:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16559:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 3). Will run for at most 3 ticks.
+
+At time 16604:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16607:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16607:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 4). Will run for at most 3 ticks.
+
+At time 16652:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16655:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16655:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (level = 7, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 16700:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16703:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16703:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (level = 8, bonus = -3, expired = 6). Will run for at most 3 ticks.
+
+At time 16748:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16751:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16751:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 20 threads (level = 8, bonus = -3, expired = 7). Will run for at most 3 ticks.
+
+At time 16796:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16799:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16799:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 9, bonus = -4, expired = 8). Will run for at most 3 ticks.
+
+At time 16844:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16847:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16847:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 9, bonus = -4, expired = 9). Will run for at most 3 ticks.
+
+At time 16871:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 16874:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 16874:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 20 threads (level = 23, bonus = 2, expired = 10). Will run for at most 3 ticks.
+
+At time 16919:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16922:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16922:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 20 threads (level = 24, bonus = 1, expired = 11). Will run for at most 3 ticks.
+
+At time 16946:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16949:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16949:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 20 threads (level = 25, bonus = 0, expired = 12). Will run for at most 3 ticks.
+
+At time 16994:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16997:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 16997:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 20 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 17042:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17045:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17045:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 17090:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17093:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17093:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 17138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17141:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17141:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 16). Will run for at most 3 ticks.
+
+At time 17186:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17189:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17189:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 17). Will run for at most 3 ticks.
+
+At time 17213:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17216:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17216:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 18). Will run for at most 3 ticks.
+
+At time 17240:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17243:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17243:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads (level = 28, bonus = -3, expired = 19). Will run for at most 3 ticks.
+
+At time 17288:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17291:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17291:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 17336:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17339:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17339:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 17384:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17387:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17387:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 17432:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17435:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17435:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 3). Will run for at most 3 ticks.
+
+At time 17480:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17483:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17483:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 4). Will run for at most 3 ticks.
+
+At time 17528:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17531:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17531:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (level = 7, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 17576:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17579:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17579:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (level = 8, bonus = -3, expired = 6). Will run for at most 3 ticks.
+
+At time 17624:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17627:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17627:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 20 threads (level = 8, bonus = -3, expired = 7). Will run for at most 3 ticks.
+
+At time 17672:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17675:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17675:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 9, bonus = -4, expired = 8). Will run for at most 3 ticks.
+
+At time 17720:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17723:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17723:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 9, bonus = -4, expired = 9). Will run for at most 3 ticks.
+
+At time 17747:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 17750:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 17750:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 20 threads (level = 23, bonus = 2, expired = 10). Will run for at most 3 ticks.
+
+At time 17795:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17798:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17798:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 20 threads (level = 24, bonus = 1, expired = 11). Will run for at most 3 ticks.
+
+At time 17822:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17825:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17825:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 20 threads (level = 25, bonus = 0, expired = 12). Will run for at most 3 ticks.
+
+At time 17870:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17871:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 17871:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 19 threads (level = 25, bonus = 0, expired = 12). Will run for at most 3 ticks.
+
+At time 17881:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 17916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17916:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17916:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 20 threads (level = 24, bonus = 1, expired = 12). Will run for at most 3 ticks.
+
+At time 17961:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 17964:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 17964:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 20 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 18009:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18010:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18010:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads (level = 26, bonus = -1, expired = 13). Will run for at most 3 ticks.
+
+At time 18023:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18055:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18055:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18055:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 20 threads (level = 24, bonus = 1, expired = 13). Will run for at most 3 ticks.
+
+At time 18100:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18103:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18103:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads (level = 26, bonus = -1, expired = 13). Will run for at most 3 ticks.
+
+At time 18115:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18148:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18148:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18148:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 20 threads (level = 23, bonus = 2, expired = 13). Will run for at most 3 ticks.
+
+At time 18193:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18196:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18196:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 18241:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18244:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18244:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 15). Will run for at most 3 ticks.
+
+At time 18289:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18292:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18292:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 16). Will run for at most 3 ticks.
+
+At time 18337:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18340:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18340:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 17). Will run for at most 3 ticks.
+
+At time 18364:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18367:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18367:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 19 threads (level = 27, bonus = -2, expired = 17). Will run for at most 3 ticks.
+
+At time 18381:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18391:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18391:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18391:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 17). Will run for at most 3 ticks.
+
+At time 18415:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18418:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18418:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 18). Will run for at most 3 ticks.
+
+At time 18442:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18444:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18444:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 19 threads (level = 28, bonus = -3, expired = 18). Will run for at most 3 ticks.
+
+At time 18464:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 18489:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18489:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18489:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 20 threads (level = 25, bonus = 0, expired = 18). Will run for at most 3 ticks.
+
+At time 18534:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18537:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18537:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads (level = 28, bonus = -3, expired = 19). Will run for at most 3 ticks.
+
+At time 18582:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 18585:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 18585:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 18630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18633:
+    THREAD_PREEMPTED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18633:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 18678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18681:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18681:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 18726:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18729:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18729:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 3). Will run for at most 3 ticks.
+
+At time 18774:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18777:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18777:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 20 threads (level = 5, bonus = 0, expired = 4). Will run for at most 3 ticks.
+
+At time 18822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18825:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18825:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (level = 7, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 18870:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18873:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 18873:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads (level = 8, bonus = -3, expired = 5). Will run for at most 3 ticks.
+
+At time 18880:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 18918:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18918:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18918:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 20 threads (level = 7, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 18963:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 18966:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 18966:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 20 threads (level = 8, bonus = -3, expired = 6). Will run for at most 3 ticks.
+
+At time 19011:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19014:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19014:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 20 threads (level = 9, bonus = -4, expired = 7). Will run for at most 3 ticks.
+
+At time 19059:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19062:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19062:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 9, bonus = -4, expired = 8). Will run for at most 3 ticks.
+
+At time 19107:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19110:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19110:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 10, bonus = -5, expired = 9). Will run for at most 3 ticks.
+
+At time 19134:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19137:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19137:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 19 threads (level = 23, bonus = 2, expired = 9). Will run for at most 3 ticks.
+
+At time 19144:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 19182:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19182:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19182:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 9, bonus = -4, expired = 9). Will run for at most 3 ticks.
+
+At time 19227:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19230:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19230:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 20 threads (level = 23, bonus = 2, expired = 10). Will run for at most 3 ticks.
+
+At time 19275:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19278:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19278:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 20 threads (level = 23, bonus = 2, expired = 11). Will run for at most 3 ticks.
+
+At time 19302:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19305:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19305:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 20 threads (level = 24, bonus = 1, expired = 12). Will run for at most 3 ticks.
+
+At time 19350:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19353:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19353:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 20 threads (level = 25, bonus = 0, expired = 13). Will run for at most 3 ticks.
+
+At time 19398:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19401:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19401:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 19446:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19449:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19449:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 15). Will run for at most 3 ticks.
+
+At time 19494:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19497:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19497:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 20 threads (level = 26, bonus = -1, expired = 16). Will run for at most 3 ticks.
+
+At time 19521:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19524:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19524:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 17). Will run for at most 3 ticks.
+
+At time 19569:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19572:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19572:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 20 threads (level = 27, bonus = -2, expired = 18). Will run for at most 3 ticks.
+
+At time 19617:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19620:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19620:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 20 threads (level = 28, bonus = -3, expired = 19). Will run for at most 3 ticks.
+
+At time 19665:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 19668:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 19668:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    Selected from 20 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 19713:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19714:
+    THREAD_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 19714:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 19759:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19762:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19762:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 19807:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19809:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 19809:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 18 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 19820:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 19854:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19854:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19854:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 19899:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19902:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19902:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads (level = 5, bonus = 0, expired = 2). Will run for at most 3 ticks.
+
+At time 19947:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19950:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19950:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 19 threads (level = 5, bonus = 0, expired = 3). Will run for at most 3 ticks.
+
+At time 19995:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 19998:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 19998:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads (level = 7, bonus = -2, expired = 4). Will run for at most 3 ticks.
+
+At time 20043:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20046:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20046:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads (level = 9, bonus = -4, expired = 5). Will run for at most 3 ticks.
+
+At time 20091:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20093:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20093:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 18 threads (level = 9, bonus = -4, expired = 5). Will run for at most 3 ticks.
+
+At time 20099:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 20138:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20138:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20138:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads (level = 8, bonus = -3, expired = 5). Will run for at most 3 ticks.
+
+At time 20183:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20186:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20186:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads (level = 9, bonus = -4, expired = 6). Will run for at most 3 ticks.
+
+At time 20231:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20234:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20234:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 10, bonus = -5, expired = 7). Will run for at most 3 ticks.
+
+At time 20279:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20282:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20282:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 10, bonus = -5, expired = 8). Will run for at most 3 ticks.
+
+At time 20306:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20309:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20309:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 19 threads (level = 24, bonus = 1, expired = 9). Will run for at most 3 ticks.
+
+At time 20354:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20356:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20356:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 18 threads (level = 24, bonus = 1, expired = 9). Will run for at most 3 ticks.
+
+At time 20360:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 20380:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20380:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20380:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 19 threads (level = 23, bonus = 2, expired = 9). Will run for at most 3 ticks.
+
+At time 20404:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20407:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20407:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 19 threads (level = 24, bonus = 1, expired = 10). Will run for at most 3 ticks.
+
+At time 20431:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20434:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20434:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 19 threads (level = 25, bonus = 0, expired = 11). Will run for at most 3 ticks.
+
+At time 20479:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20482:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20482:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 18 threads (level = 25, bonus = 0, expired = 11). Will run for at most 3 ticks.
+
+At time 20492:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 20527:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20527:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20527:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 19 threads (level = 24, bonus = 1, expired = 11). Will run for at most 3 ticks.
+
+At time 20572:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20575:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20575:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 19 threads (level = 25, bonus = 0, expired = 12). Will run for at most 3 ticks.
+
+At time 20620:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20623:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20623:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads (level = 26, bonus = -1, expired = 13). Will run for at most 3 ticks.
+
+At time 20668:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20671:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20671:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 19 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 20716:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20719:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20719:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads (level = 27, bonus = -2, expired = 15). Will run for at most 3 ticks.
+
+At time 20743:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20746:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20746:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads (level = 27, bonus = -2, expired = 16). Will run for at most 3 ticks.
+
+At time 20791:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20794:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20794:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 19 threads (level = 27, bonus = -2, expired = 17). Will run for at most 3 ticks.
+
+At time 20839:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20842:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20842:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 19 threads (level = 28, bonus = -3, expired = 18). Will run for at most 3 ticks.
+
+At time 20887:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20890:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20890:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 20935:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20938:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 20938:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 20983:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 20985:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 20985:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 18 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 20990:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 21030:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21030:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21030:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 21075:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21078:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21078:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 19 threads (level = 5, bonus = 0, expired = 2). Will run for at most 3 ticks.
+
+At time 21123:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21126:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21126:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads (level = 5, bonus = 0, expired = 3). Will run for at most 3 ticks.
+
+At time 21171:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21174:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21174:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads (level = 7, bonus = -2, expired = 4). Will run for at most 3 ticks.
+
+At time 21219:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21222:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21222:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads (level = 8, bonus = -3, expired = 5). Will run for at most 3 ticks.
+
+At time 21267:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21270:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21270:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads (level = 9, bonus = -4, expired = 6). Will run for at most 3 ticks.
+
+At time 21315:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21316:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21316:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 18 threads (level = 10, bonus = -5, expired = 6). Will run for at most 3 ticks.
+
+At time 21325:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 21361:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21361:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21361:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads (level = 8, bonus = -3, expired = 6). Will run for at most 3 ticks.
+
+At time 21406:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21409:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21409:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 10, bonus = -5, expired = 7). Will run for at most 3 ticks.
+
+At time 21454:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21457:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21457:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 10, bonus = -5, expired = 8). Will run for at most 3 ticks.
+
+At time 21481:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21482:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21482:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 18 threads (level = 24, bonus = 1, expired = 8). Will run for at most 3 ticks.
+
+At time 21503:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 21527:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21527:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21527:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 8, bonus = -3, expired = 8). Will run for at most 3 ticks.
+
+At time 21572:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 21575:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 21575:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 19 threads (level = 24, bonus = 1, expired = 9). Will run for at most 3 ticks.
+
+At time 21620:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21622:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21622:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 18 threads (level = 24, bonus = 1, expired = 9). Will run for at most 3 ticks.
+
+At time 21629:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 21667:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21669:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 21669:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 18 threads (level = 24, bonus = 1, expired = 9). Will run for at most 3 ticks.
+
+At time 21671:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 21714:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21717:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21717:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 19 threads (level = 24, bonus = 1, expired = 10). Will run for at most 3 ticks.
+
+At time 21741:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21744:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21744:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 19 threads (level = 24, bonus = 1, expired = 11). Will run for at most 3 ticks.
+
+At time 21789:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21792:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21792:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 19 threads (level = 25, bonus = 0, expired = 12). Will run for at most 3 ticks.
+
+At time 21837:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21840:
+    THREAD_PREEMPTED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21840:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 19 threads (level = 26, bonus = -1, expired = 13). Will run for at most 3 ticks.
+
+At time 21885:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21888:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21888:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 19 threads (level = 27, bonus = -2, expired = 14). Will run for at most 3 ticks.
+
+At time 21933:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21936:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21936:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 19 threads (level = 27, bonus = -2, expired = 15). Will run for at most 3 ticks.
+
+At time 21981:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21984:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 21984:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads (level = 27, bonus = -2, expired = 16). Will run for at most 3 ticks.
+
+At time 22029:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22031:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22031:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads (level = 28, bonus = -3, expired = 16). Will run for at most 3 ticks.
+
+At time 22032:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 22076:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22079:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22079:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 19 threads (level = 28, bonus = -3, expired = 17). Will run for at most 3 ticks.
+
+At time 22124:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22127:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22127:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 19 threads (level = 29, bonus = -4, expired = 18). Will run for at most 3 ticks.
+
+At time 22172:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22175:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22175:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 22220:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22223:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22223:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 19 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 22268:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22271:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22271:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 19 threads (level = 5, bonus = 0, expired = 2). Will run for at most 3 ticks.
+
+At time 22316:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22319:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22319:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads (level = 6, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 22364:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22367:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22367:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 18 threads (level = 8, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 22393:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 22412:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22412:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22412:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 19 threads (level = 3, bonus = 2, expired = 3). Will run for at most 3 ticks.
+
+At time 22457:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22460:
+    THREAD_PREEMPTED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22460:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 8, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 22505:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22508:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22508:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 19 threads (level = 8, bonus = -3, expired = 5). Will run for at most 3 ticks.
+
+At time 22553:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22556:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22556:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 19 threads (level = 9, bonus = -4, expired = 6). Will run for at most 3 ticks.
+
+At time 22601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22604:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22604:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 19 threads (level = 9, bonus = -4, expired = 7). Will run for at most 3 ticks.
+
+At time 22649:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22652:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22652:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 19 threads (level = 10, bonus = -5, expired = 8). Will run for at most 3 ticks.
+
+At time 22697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 22700:
+    THREAD_PREEMPTED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 22700:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 19 threads (level = 24, bonus = 1, expired = 9). Will run for at most 3 ticks.
+
+At time 22745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22748:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22748:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 19 threads (level = 24, bonus = 1, expired = 10). Will run for at most 3 ticks.
+
+At time 22772:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22775:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22775:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 19 threads (level = 25, bonus = 0, expired = 11). Will run for at most 3 ticks.
+
+At time 22820:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22823:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22823:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    Selected from 19 threads (level = 26, bonus = -1, expired = 12). Will run for at most 3 ticks.
+
+At time 22868:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22870:
+    THREAD_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 22870:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 18 threads (level = 27, bonus = -2, expired = 12). Will run for at most 3 ticks.
+
+At time 22915:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22918:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 22918:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 18 threads (level = 27, bonus = -2, expired = 13). Will run for at most 3 ticks.
+
+At time 22963:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 22964:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 22964:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 17 threads (level = 27, bonus = -2, expired = 13). Will run for at most 3 ticks.
+
+At time 22993:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23009:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23009:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23009:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 18 threads (level = 24, bonus = 1, expired = 13). Will run for at most 3 ticks.
+
+At time 23054:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23057:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23057:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 18 threads (level = 27, bonus = -2, expired = 14). Will run for at most 3 ticks.
+
+At time 23102:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23103:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23103:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 17 threads (level = 28, bonus = -3, expired = 14). Will run for at most 3 ticks.
+
+At time 23104:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23127:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23127:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23127:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 18 threads (level = 27, bonus = -2, expired = 14). Will run for at most 3 ticks.
+
+At time 23151:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23154:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23154:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 18 threads (level = 28, bonus = -3, expired = 15). Will run for at most 3 ticks.
+
+At time 23199:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23202:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23202:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 18 threads (level = 28, bonus = -3, expired = 16). Will run for at most 3 ticks.
+
+At time 23247:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23250:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23250:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 18 threads (level = 29, bonus = -4, expired = 17). Will run for at most 3 ticks.
+
+At time 23295:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23296:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23296:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 17 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 23312:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23341:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23344:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23344:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    Selected from 18 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 23389:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23390:
+    THREAD_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 23390:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 17 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 23435:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23438:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23438:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 17 threads (level = 6, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 23483:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23486:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23486:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 17 threads (level = 8, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 23531:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23534:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23534:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 17 threads (level = 8, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 23579:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23582:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23582:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 17 threads (level = 9, bonus = -4, expired = 5). Will run for at most 3 ticks.
+
+At time 23627:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23630:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23630:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 17 threads (level = 9, bonus = -4, expired = 6). Will run for at most 3 ticks.
+
+At time 23675:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23678:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 23678:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    Selected from 17 threads (level = 10, bonus = -5, expired = 7). Will run for at most 3 ticks.
+
+At time 23723:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 23724:
+    THREAD_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 23724:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 16 threads (level = 24, bonus = 1, expired = 7). Will run for at most 3 ticks.
+
+At time 23769:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23772:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23772:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads (level = 24, bonus = 1, expired = 8). Will run for at most 3 ticks.
+
+At time 23796:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23797:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23797:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 15 threads (level = 25, bonus = 0, expired = 8). Will run for at most 3 ticks.
+
+At time 23822:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23842:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23842:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23842:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads (level = 22, bonus = 3, expired = 8). Will run for at most 3 ticks.
+
+At time 23887:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23890:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23890:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 16 threads (level = 25, bonus = 0, expired = 9). Will run for at most 3 ticks.
+
+At time 23935:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23938:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23938:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 16 threads (level = 25, bonus = 0, expired = 10). Will run for at most 3 ticks.
+
+At time 23962:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 23965:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 23965:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 16 threads (level = 27, bonus = -2, expired = 11). Will run for at most 3 ticks.
+
+At time 24010:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24013:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24013:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 16 threads (level = 27, bonus = -2, expired = 12). Will run for at most 3 ticks.
+
+At time 24037:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24040:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24040:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 16 threads (level = 28, bonus = -3, expired = 13). Will run for at most 3 ticks.
+
+At time 24085:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24088:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24088:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 16 threads (level = 28, bonus = -3, expired = 14). Will run for at most 3 ticks.
+
+At time 24133:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24136:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24136:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads (level = 28, bonus = -3, expired = 15). Will run for at most 3 ticks.
+
+At time 24181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24183:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24183:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 15 threads (level = 5, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 24202:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 24228:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24231:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24231:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 16 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 24276:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24279:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24279:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (level = 6, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 24324:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24326:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24326:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 15 threads (level = 8, bonus = -3, expired = 2). Will run for at most 3 ticks.
+
+At time 24344:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 24371:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24371:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24371:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (level = 4, bonus = 1, expired = 2). Will run for at most 3 ticks.
+
+At time 24416:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24419:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24419:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 16 threads (level = 8, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 24464:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24467:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24467:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads (level = 9, bonus = -4, expired = 4). Will run for at most 3 ticks.
+
+At time 24512:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24515:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24515:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads (level = 9, bonus = -4, expired = 5). Will run for at most 3 ticks.
+
+At time 24560:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24563:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24563:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (level = 9, bonus = -4, expired = 6). Will run for at most 3 ticks.
+
+At time 24608:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 24611:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 24611:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads (level = 22, bonus = 3, expired = 7). Will run for at most 3 ticks.
+
+At time 24656:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24659:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24659:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 16 threads (level = 25, bonus = 0, expired = 8). Will run for at most 3 ticks.
+
+At time 24683:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24686:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24686:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 16 threads (level = 25, bonus = 0, expired = 9). Will run for at most 3 ticks.
+
+At time 24731:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24734:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24734:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 16 threads (level = 25, bonus = 0, expired = 10). Will run for at most 3 ticks.
+
+At time 24758:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24761:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24761:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads (level = 26, bonus = -1, expired = 11). Will run for at most 3 ticks.
+
+At time 24785:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24788:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24788:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 16 threads (level = 27, bonus = -2, expired = 12). Will run for at most 3 ticks.
+
+At time 24833:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24834:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 24834:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 15 threads (level = 28, bonus = -3, expired = 12). Will run for at most 3 ticks.
+
+At time 24842:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 24858:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24858:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24858:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 16 threads (level = 26, bonus = -1, expired = 12). Will run for at most 3 ticks.
+
+At time 24882:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24885:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24885:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 16 threads (level = 28, bonus = -3, expired = 13). Will run for at most 3 ticks.
+
+At time 24930:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24933:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24933:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 16 threads (level = 28, bonus = -3, expired = 14). Will run for at most 3 ticks.
+
+At time 24978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24981:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 24981:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 16 threads (level = 29, bonus = -4, expired = 15). Will run for at most 3 ticks.
+
+At time 25005:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25008:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25008:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 16 threads (level = 5, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 25053:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25055:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25055:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 15 threads (level = 5, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 25080:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 25100:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25100:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25100:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 16 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 25145:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25148:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25148:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 25193:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25196:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25196:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 15 threads (level = 6, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 25205:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 25241:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25241:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25241:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 25286:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25289:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25289:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 16 threads (level = 6, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 25334:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25337:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25337:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 16 threads (level = 9, bonus = -4, expired = 3). Will run for at most 3 ticks.
+
+At time 25361:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25364:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25364:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads (level = 9, bonus = -4, expired = 4). Will run for at most 3 ticks.
+
+At time 25409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25411:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25411:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 15 threads (level = 10, bonus = -5, expired = 4). Will run for at most 3 ticks.
+
+At time 25424:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 25456:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25456:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25456:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads (level = 8, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 25501:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25504:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25504:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (level = 10, bonus = -5, expired = 5). Will run for at most 3 ticks.
+
+At time 25549:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25550:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25550:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 15 threads (level = 10, bonus = -5, expired = 5). Will run for at most 3 ticks.
+
+At time 25574:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 25595:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25595:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25595:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (level = 7, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 25640:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25643:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25643:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads (level = 10, bonus = -5, expired = 6). Will run for at most 3 ticks.
+
+At time 25688:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 25691:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 25691:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads (level = 22, bonus = 3, expired = 7). Will run for at most 3 ticks.
+
+At time 25736:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25739:
+    THREAD_PREEMPTED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25739:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 16 threads (level = 25, bonus = 0, expired = 8). Will run for at most 3 ticks.
+
+At time 25763:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25766:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25766:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 16 threads (level = 25, bonus = 0, expired = 9). Will run for at most 3 ticks.
+
+At time 25811:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25814:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25814:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 16 threads (level = 25, bonus = 0, expired = 10). Will run for at most 3 ticks.
+
+At time 25838:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25841:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25841:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads (level = 26, bonus = -1, expired = 11). Will run for at most 3 ticks.
+
+At time 25865:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25868:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 25868:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 15 threads (level = 27, bonus = -2, expired = 11). Will run for at most 3 ticks.
+
+At time 25890:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 25913:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25913:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25913:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 16 threads (level = 24, bonus = 1, expired = 11). Will run for at most 3 ticks.
+
+At time 25958:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 25961:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 25961:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 16 threads (level = 27, bonus = -2, expired = 12). Will run for at most 3 ticks.
+
+At time 26006:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26009:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26009:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 16 threads (level = 28, bonus = -3, expired = 13). Will run for at most 3 ticks.
+
+At time 26033:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26036:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26036:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 16 threads (level = 29, bonus = -4, expired = 14). Will run for at most 3 ticks.
+
+At time 26081:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26083:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26083:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 15 threads (level = 29, bonus = -4, expired = 14). Will run for at most 3 ticks.
+
+At time 26108:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 26128:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26128:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26128:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 16 threads (level = 26, bonus = -1, expired = 14). Will run for at most 3 ticks.
+
+At time 26173:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26176:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26176:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 16 threads (level = 29, bonus = -4, expired = 15). Will run for at most 3 ticks.
+
+At time 26221:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26224:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26224:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 16 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 26269:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26272:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26272:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 16 threads (level = 4, bonus = 1, expired = 1). Will run for at most 3 ticks.
+
+At time 26317:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26320:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26320:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 16 threads (level = 6, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 26365:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26368:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26368:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 16 threads (level = 8, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 26413:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26416:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26416:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (level = 8, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 26461:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26464:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26464:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 15 threads (level = 9, bonus = -4, expired = 4). Will run for at most 3 ticks.
+
+At time 26492:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 26509:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26509:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26509:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 16 threads (level = 5, bonus = 0, expired = 4). Will run for at most 3 ticks.
+
+At time 26554:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26557:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26557:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 16 threads (level = 9, bonus = -4, expired = 5). Will run for at most 3 ticks.
+
+At time 26602:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26604:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26604:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 15 threads (level = 10, bonus = -5, expired = 5). Will run for at most 3 ticks.
+
+At time 26606:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 26649:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26649:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26649:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 16 threads (level = 9, bonus = -4, expired = 5). Will run for at most 3 ticks.
+
+At time 26694:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26697:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26697:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 16 threads (level = 10, bonus = -5, expired = 6). Will run for at most 3 ticks.
+
+At time 26742:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 26745:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 26745:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    Selected from 16 threads (level = 23, bonus = 2, expired = 7). Will run for at most 3 ticks.
+
+At time 26790:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26792:
+    THREAD_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 26792:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 15 threads (level = 25, bonus = 0, expired = 7). Will run for at most 3 ticks.
+
+At time 26816:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26819:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26819:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 15 threads (level = 25, bonus = 0, expired = 8). Will run for at most 3 ticks.
+
+At time 26864:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26867:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26867:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 15 threads (level = 25, bonus = 0, expired = 9). Will run for at most 3 ticks.
+
+At time 26891:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26894:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26894:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 15 threads (level = 26, bonus = -1, expired = 10). Will run for at most 3 ticks.
+
+At time 26918:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26919:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 26919:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 14 threads (level = 27, bonus = -2, expired = 10). Will run for at most 3 ticks.
+
+At time 26942:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 26964:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 26964:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 26964:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 15 threads (level = 24, bonus = 1, expired = 10). Will run for at most 3 ticks.
+
+At time 27009:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27012:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27012:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 15 threads (level = 27, bonus = -2, expired = 11). Will run for at most 3 ticks.
+
+At time 27057:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27060:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27060:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    Selected from 15 threads (level = 27, bonus = -2, expired = 12). Will run for at most 3 ticks.
+
+At time 27105:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27106:
+    THREAD_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 27106:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 14 threads (level = 28, bonus = -3, expired = 12). Will run for at most 3 ticks.
+
+At time 27130:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27133:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27133:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 14 threads (level = 29, bonus = -4, expired = 13). Will run for at most 3 ticks.
+
+At time 27157:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27159:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 27159:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 13 threads (level = 3, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 27172:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 27204:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27207:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27207:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 14 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 27252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27255:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27255:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 14 threads (level = 5, bonus = 0, expired = 2). Will run for at most 3 ticks.
+
+At time 27300:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27303:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27303:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 14 threads (level = 6, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 27348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27351:
+    THREAD_PREEMPTED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27351:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 14 threads (level = 9, bonus = -4, expired = 4). Will run for at most 3 ticks.
+
+At time 27396:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27399:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27399:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 14 threads (level = 9, bonus = -4, expired = 5). Will run for at most 3 ticks.
+
+At time 27444:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27447:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27447:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 14 threads (level = 10, bonus = -5, expired = 6). Will run for at most 3 ticks.
+
+At time 27492:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27495:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27495:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 14 threads (level = 24, bonus = 1, expired = 7). Will run for at most 3 ticks.
+
+At time 27540:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27543:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27543:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 14 threads (level = 25, bonus = 0, expired = 8). Will run for at most 3 ticks.
+
+At time 27588:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27591:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27591:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 14 threads (level = 25, bonus = 0, expired = 9). Will run for at most 3 ticks.
+
+At time 27636:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27639:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27639:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 14 threads (level = 26, bonus = -1, expired = 10). Will run for at most 3 ticks.
+
+At time 27663:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27666:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27666:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 14 threads (level = 27, bonus = -2, expired = 11). Will run for at most 3 ticks.
+
+At time 27711:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27714:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27714:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 14 threads (level = 28, bonus = -3, expired = 12). Will run for at most 3 ticks.
+
+At time 27759:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27762:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27762:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 14 threads (level = 29, bonus = -4, expired = 13). Will run for at most 3 ticks.
+
+At time 27786:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 27789:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 27789:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 14 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 27834:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27837:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27837:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 14 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 27882:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27885:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27885:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 14 threads (level = 6, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 27930:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27933:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 27933:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    Selected from 14 threads (level = 7, bonus = -2, expired = 3). Will run for at most 3 ticks.
+
+At time 27978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 27981:
+    THREAD_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 27981:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 13 threads (level = 9, bonus = -4, expired = 3). Will run for at most 3 ticks.
+
+At time 28026:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28029:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28029:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 13 threads (level = 9, bonus = -4, expired = 4). Will run for at most 3 ticks.
+
+At time 28074:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28077:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28077:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 12 threads (level = 10, bonus = -5, expired = 4). Will run for at most 3 ticks.
+
+At time 28083:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 28122:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28122:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28122:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 13 threads (level = 9, bonus = -4, expired = 4). Will run for at most 3 ticks.
+
+At time 28167:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28170:
+    THREAD_PREEMPTED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28170:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 13 threads (level = 10, bonus = -5, expired = 5). Will run for at most 3 ticks.
+
+At time 28215:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28218:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28218:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 13 threads (level = 24, bonus = 1, expired = 6). Will run for at most 3 ticks.
+
+At time 28263:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28266:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28266:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 13 threads (level = 25, bonus = 0, expired = 7). Will run for at most 3 ticks.
+
+At time 28290:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28291:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28291:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 12 threads (level = 26, bonus = -1, expired = 7). Will run for at most 3 ticks.
+
+At time 28303:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 28336:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28336:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28336:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 13 threads (level = 24, bonus = 1, expired = 7). Will run for at most 3 ticks.
+
+At time 28381:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28384:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28384:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 13 threads (level = 26, bonus = -1, expired = 8). Will run for at most 3 ticks.
+
+At time 28408:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28411:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28411:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 12 threads (level = 26, bonus = -1, expired = 8). Will run for at most 3 ticks.
+
+At time 28425:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 28456:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28456:
+    THREAD_PREEMPTED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28456:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 13 threads (level = 25, bonus = 0, expired = 8). Will run for at most 3 ticks.
+
+At time 28501:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28504:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28504:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    Selected from 13 threads (level = 26, bonus = -1, expired = 9). Will run for at most 3 ticks.
+
+At time 28549:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28550:
+    THREAD_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 28550:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 12 threads (level = 27, bonus = -2, expired = 9). Will run for at most 3 ticks.
+
+At time 28574:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28577:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28577:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 12 threads (level = 28, bonus = -3, expired = 10). Will run for at most 3 ticks.
+
+At time 28622:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28625:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28625:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 12 threads (level = 29, bonus = -4, expired = 11). Will run for at most 3 ticks.
+
+At time 28649:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28652:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28652:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 11 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 28659:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 28697:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28700:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28700:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 12 threads (level = 5, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 28745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28748:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28748:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 12 threads (level = 6, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 28793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28796:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28796:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 12 threads (level = 9, bonus = -4, expired = 3). Will run for at most 3 ticks.
+
+At time 28841:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28844:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 28844:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    Selected from 12 threads (level = 9, bonus = -4, expired = 4). Will run for at most 3 ticks.
+
+At time 28889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28891:
+    THREAD_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 28891:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 11 threads (level = 10, bonus = -5, expired = 4). Will run for at most 3 ticks.
+
+At time 28936:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 28937:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 28937:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads (level = 24, bonus = 1, expired = 4). Will run for at most 3 ticks.
+
+At time 28950:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 28982:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 28982:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 28982:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 11 threads (level = 9, bonus = -4, expired = 4). Will run for at most 3 ticks.
+
+At time 29027:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29030:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29030:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 11 threads (level = 24, bonus = 1, expired = 5). Will run for at most 3 ticks.
+
+At time 29075:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29078:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29078:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads (level = 24, bonus = 1, expired = 6). Will run for at most 3 ticks.
+
+At time 29102:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29105:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29105:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 11 threads (level = 25, bonus = 0, expired = 7). Will run for at most 3 ticks.
+
+At time 29129:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29132:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29132:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (level = 28, bonus = -3, expired = 8). Will run for at most 3 ticks.
+
+At time 29177:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29178:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29178:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 10 threads (level = 29, bonus = -4, expired = 8). Will run for at most 3 ticks.
+
+At time 29193:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 29223:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29223:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29223:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (level = 26, bonus = -1, expired = 8). Will run for at most 3 ticks.
+
+At time 29268:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29271:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29271:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 11 threads (level = 29, bonus = -4, expired = 9). Will run for at most 3 ticks.
+
+At time 29316:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29319:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29319:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (level = 29, bonus = -4, expired = 10). Will run for at most 3 ticks.
+
+At time 29343:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29346:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29346:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 11 threads (level = 4, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 29391:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29394:
+    THREAD_PREEMPTED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29394:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 11 threads (level = 6, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 29439:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29442:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29442:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 11 threads (level = 6, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 29487:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29490:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29490:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 11 threads (level = 9, bonus = -4, expired = 3). Will run for at most 3 ticks.
+
+At time 29535:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29538:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29538:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 11 threads (level = 10, bonus = -5, expired = 4). Will run for at most 3 ticks.
+
+At time 29583:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29586:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29586:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 11 threads (level = 25, bonus = 0, expired = 5). Will run for at most 3 ticks.
+
+At time 29631:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29634:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29634:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 11 threads (level = 25, bonus = 0, expired = 6). Will run for at most 3 ticks.
+
+At time 29658:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29661:
+    THREAD_PREEMPTED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29661:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 11 threads (level = 26, bonus = -1, expired = 7). Will run for at most 3 ticks.
+
+At time 29685:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29688:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29688:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 11 threads (level = 27, bonus = -2, expired = 8). Will run for at most 3 ticks.
+
+At time 29733:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29736:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29736:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 11 threads (level = 29, bonus = -4, expired = 9). Will run for at most 3 ticks.
+
+At time 29781:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29784:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29784:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 11 threads (level = 29, bonus = -4, expired = 10). Will run for at most 3 ticks.
+
+At time 29808:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29811:
+    THREAD_PREEMPTED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 29811:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    Selected from 11 threads (level = 5, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 29856:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29857:
+    THREAD_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 29857:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 10 threads (level = 6, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 29902:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29905:
+    THREAD_PREEMPTED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29905:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 10 threads (level = 7, bonus = -2, expired = 1). Will run for at most 3 ticks.
+
+At time 29950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29953:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 29953:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 10 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 29998:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 29999:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 29999:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 9 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 30002:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 30044:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30047:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30047:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 10 threads (level = 10, bonus = -5, expired = 3). Will run for at most 3 ticks.
+
+At time 30092:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30095:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30095:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 10 threads (level = 25, bonus = 0, expired = 4). Will run for at most 3 ticks.
+
+At time 30140:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30143:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30143:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    Selected from 10 threads (level = 25, bonus = 0, expired = 5). Will run for at most 3 ticks.
+
+At time 30167:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30170:
+    THREAD_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 30170:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 9 threads (level = 26, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 30194:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30197:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30197:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 9 threads (level = 27, bonus = -2, expired = 6). Will run for at most 3 ticks.
+
+At time 30242:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30245:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30245:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 9 threads (level = 29, bonus = -4, expired = 7). Will run for at most 3 ticks.
+
+At time 30290:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30293:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30293:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    Selected from 9 threads (level = 29, bonus = -4, expired = 8). Will run for at most 3 ticks.
+
+At time 30317:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30318:
+    THREAD_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 30318:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    Selected from 8 threads (level = 6, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 30363:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30366:
+    THREAD_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 30366:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 7 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 30411:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30414:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30414:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 7 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 30459:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30462:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30462:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 7 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 30507:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30510:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30510:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 7 threads (level = 25, bonus = 0, expired = 3). Will run for at most 3 ticks.
+
+At time 30555:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30558:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30558:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 7 threads (level = 26, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 30582:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30585:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30585:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 7 threads (level = 27, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 30630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30633:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30633:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 7 threads (level = 29, bonus = -4, expired = 6). Will run for at most 3 ticks.
+
+At time 30678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30681:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30681:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 7 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 30726:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30728:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 30728:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 30736:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 30773:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30773:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30773:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 7 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 30818:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30821:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30821:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 7 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 30866:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30869:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30869:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 7 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 30914:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 30917:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 30917:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 7 threads (level = 26, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 30962:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30965:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30965:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 7 threads (level = 26, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 30989:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 30992:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 30992:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 7 threads (level = 27, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 31037:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31040:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31040:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 7 threads (level = 30, bonus = -5, expired = 6). Will run for at most 3 ticks.
+
+At time 31085:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31088:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31088:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 7 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 31133:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31136:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31136:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 7 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 31181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31184:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31184:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 7 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 31229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31232:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31232:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 6 threads (level = 26, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 31262:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 31277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31277:
+    THREAD_PREEMPTED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31277:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 7 threads (level = 8, bonus = -3, expired = 2). Will run for at most 3 ticks.
+
+At time 31322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31325:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31325:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    Selected from 7 threads (level = 26, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 31370:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31371:
+    THREAD_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 31371:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 3). Will run for at most 3 ticks.
+
+At time 31395:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31398:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31398:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (level = 28, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 31443:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31446:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31446:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (level = 30, bonus = -5, expired = 5). Will run for at most 3 ticks.
+
+At time 31491:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31494:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31494:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 31539:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31542:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31542:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (level = 8, bonus = -3, expired = 1). Will run for at most 3 ticks.
+
+At time 31587:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31590:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31590:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 31635:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31638:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31638:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 3). Will run for at most 3 ticks.
+
+At time 31683:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31684:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31684:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 31697:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31729:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31729:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31729:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (level = 26, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 31774:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31777:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31777:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (level = 28, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 31822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31825:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 31825:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (level = 30, bonus = -5, expired = 5). Will run for at most 3 ticks.
+
+At time 31870:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 31871:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 31871:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 5 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 31898:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 31916:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31919:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31919:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (level = 8, bonus = -3, expired = 1). Will run for at most 3 ticks.
+
+At time 31964:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 31967:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 31967:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 32012:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32015:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32015:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (level = 26, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 32060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32063:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32063:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (level = 28, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 32108:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32110:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32110:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 32135:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 32155:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32155:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32155:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (level = 26, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 32200:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32203:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32203:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (level = 28, bonus = -3, expired = 5). Will run for at most 3 ticks.
+
+At time 32248:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32250:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32250:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 5 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 32266:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 32295:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32298:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32298:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (level = 9, bonus = -4, expired = 1). Will run for at most 3 ticks.
+
+At time 32343:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32346:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32346:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 32391:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32394:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32394:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (level = 26, bonus = -1, expired = 3). Will run for at most 3 ticks.
+
+At time 32439:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32442:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32442:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (level = 26, bonus = -1, expired = 4). Will run for at most 3 ticks.
+
+At time 32487:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32490:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32490:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (level = 26, bonus = -1, expired = 5). Will run for at most 3 ticks.
+
+At time 32535:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32538:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32538:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 32583:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32585:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32585:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 32604:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 32630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32630:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32630:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (level = 6, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 32675:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32678:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32678:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (level = 9, bonus = -4, expired = 1). Will run for at most 3 ticks.
+
+At time 32723:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32726:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32726:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 32771:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 32774:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 32774:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 3). Will run for at most 3 ticks.
+
+At time 32819:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32822:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32822:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 4). Will run for at most 3 ticks.
+
+At time 32867:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32869:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 32869:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (level = 27, bonus = -2, expired = 4). Will run for at most 3 ticks.
+
+At time 32870:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 32914:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32917:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32917:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 32962:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 32965:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 32965:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 33010:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33013:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33013:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (level = 9, bonus = -4, expired = 1). Will run for at most 3 ticks.
+
+At time 33058:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33061:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33061:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 33106:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33108:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 33108:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (level = 27, bonus = -2, expired = 2). Will run for at most 3 ticks.
+
+At time 33125:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 33153:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33153:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33153:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (level = 9, bonus = -4, expired = 2). Will run for at most 3 ticks.
+
+At time 33198:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33201:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33201:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 3). Will run for at most 3 ticks.
+
+At time 33246:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33249:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33249:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 4). Will run for at most 3 ticks.
+
+At time 33294:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33297:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33297:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 33342:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33345:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33345:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 33390:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33393:
+    THREAD_PREEMPTED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33393:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 6 threads (level = 9, bonus = -4, expired = 1). Will run for at most 3 ticks.
+
+At time 33438:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33441:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33441:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 6 threads (level = 10, bonus = -5, expired = 2). Will run for at most 3 ticks.
+
+At time 33486:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33489:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33489:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 3). Will run for at most 3 ticks.
+
+At time 33534:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33537:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33537:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 4). Will run for at most 3 ticks.
+
+At time 33582:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33585:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33585:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 6 threads (level = 27, bonus = -2, expired = 5). Will run for at most 3 ticks.
+
+At time 33630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33633:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33633:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 33678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33681:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 33681:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 5 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 33698:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 33726:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33726:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33726:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    Selected from 6 threads (level = 6, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 33771:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33774:
+    THREAD_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 33774:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 33819:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33822:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33822:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 5 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 33867:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 33870:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 33870:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 2). Will run for at most 3 ticks.
+
+At time 33915:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33918:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33918:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 33963:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 33966:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 33966:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 34011:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34014:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34014:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 34059:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34062:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34062:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 5 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 34107:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34110:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34110:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 2). Will run for at most 3 ticks.
+
+At time 34155:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34158:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34158:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 34203:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34206:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 34206:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 4 threads (level = 28, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 34219:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 34251:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34251:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34251:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (level = 27, bonus = -2, expired = 3). Will run for at most 3 ticks.
+
+At time 34296:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34299:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34299:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 34344:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34347:
+    THREAD_PREEMPTED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34347:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 34392:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34395:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 34395:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 4 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 34405:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 34440:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34443:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34443:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 34488:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34491:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34491:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 5 threads (level = 27, bonus = -2, expired = 2). Will run for at most 3 ticks.
+
+At time 34536:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34539:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34539:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 34584:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34587:
+    THREAD_PREEMPTED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34587:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (level = 28, bonus = -3, expired = 4). Will run for at most 3 ticks.
+
+At time 34632:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34635:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 34635:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 4 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 34663:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 34680:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34683:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34683:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 5 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 34728:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34731:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34731:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    Selected from 5 threads (level = 26, bonus = -1, expired = 2). Will run for at most 3 ticks.
+
+At time 34776:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34779:
+    THREAD_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 34779:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 4 threads (level = 28, bonus = -3, expired = 2). Will run for at most 3 ticks.
+
+At time 34824:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34827:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 34827:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    Selected from 4 threads (level = 28, bonus = -3, expired = 3). Will run for at most 3 ticks.
+
+At time 34872:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 34875:
+    THREAD_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 34875:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 3 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 34920:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34923:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34923:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 3 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 34968:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 34971:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 34971:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 3 threads (level = 28, bonus = -3, expired = 2). Will run for at most 3 ticks.
+
+At time 35016:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 35019:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 35019:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 3 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 35064:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35067:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35067:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 3 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 35112:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35115:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35115:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 3 threads (level = 28, bonus = -3, expired = 2). Will run for at most 3 ticks.
+
+At time 35160:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 35163:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 35163:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 3 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 35208:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35210:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 35210:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 2 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 35238:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 35255:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35255:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35255:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 3 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 35300:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35303:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35303:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 3 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 35348:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35351:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35351:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 3 threads (level = 28, bonus = -3, expired = 2). Will run for at most 3 ticks.
+
+At time 35396:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 35399:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 35399:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 3 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 35444:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35447:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35447:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 3 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 35492:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35495:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35495:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    Selected from 3 threads (level = 29, bonus = -4, expired = 2). Will run for at most 3 ticks.
+
+At time 35540:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 35542:
+    THREAD_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 35542:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 35587:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35590:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35590:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 2 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 35635:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35638:
+    THREAD_PREEMPTED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35638:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 2 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 35683:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35686:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35686:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 2 threads (level = 10, bonus = -5, expired = 1). Will run for at most 3 ticks.
+
+At time 35731:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35732:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 35732:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 35760:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 35777:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35777:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35777:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    Selected from 2 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 35822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35823:
+    THREAD_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 35823:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 35868:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35871:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35871:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 35895:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35898:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35898:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 35922:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35925:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 35925:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 35949:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 35950:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 35978:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 35978:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 36002:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36005:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36005:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 36029:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36032:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36032:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 36056:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36059:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36059:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 36083:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36086:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36086:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 36110:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36113:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36113:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 36137:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36140:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36140:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 36164:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36167:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36167:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 36191:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36194:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36194:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36218:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36219:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 36242:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 36242:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 7, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 36266:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36269:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36269:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 36293:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36296:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36296:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 36320:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36323:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36323:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 8, bonus = -3, expired = 0). Will run for at most 3 ticks.
+
+At time 36347:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36350:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36350:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 36374:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36377:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36377:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 36401:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36404:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36404:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 9, bonus = -4, expired = 0). Will run for at most 3 ticks.
+
+At time 36428:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36431:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36431:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36455:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36458:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36458:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36482:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36485:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36485:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36509:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36510:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 36514:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 36514:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36538:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36541:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36541:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36565:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36568:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36568:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36592:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36595:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36595:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36619:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36622:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36622:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36646:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36649:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36649:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36673:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36676:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36676:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36700:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36703:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36703:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36727:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36730:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36730:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36754:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36757:
+    THREAD_PREEMPTED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to READY
+
+At time 36757:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    Selected from 1 threads (level = 10, bonus = -5, expired = 0). Will run for at most 3 ticks.
+
+At time 36781:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 36783:
+    THREAD_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:            166
+    Process switches:           680
+    Dispatch time saved:       3486
+
+MAX READY WAIT:
+    SYSTEM:                    1727
+    INTERACTIVE:                  0
+    NORMAL:                    1670
+    BATCH:                        0
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:       54.00
+    Avg. turnaround time:   2304.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       36.00
+    Avg. turnaround time:   1969.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           2384
+Total service time:            170
+Total I/O time:                185
+Total dispatch time:          2068
+Total idle time:               146
+
+CPU utilization:            93.88%
+CPU efficiency:              7.13%
+
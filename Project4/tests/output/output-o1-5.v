@@ -0,0 +1,1062 @@
+At time 62:
+    THREAD_ARRIVED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 62:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (level = 25, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 80:
+    THREAD_ARRIVED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 98:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 98:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 98:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 134:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 137:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 137:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 25, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 173:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 176:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 176:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 212:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 215:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 215:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (level = 26, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 243:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 251:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 251:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 251:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 13, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 287:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 290:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 290:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 26, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 326:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 328:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 328:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 14, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 335:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 364:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 367:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 367:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 25, bonus = 0, expired = 1). Will run for at most 3 ticks.
+
+At time 403:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 406:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 406:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 14, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 442:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 445:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 445:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 26, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 481:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 484:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 484:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 14, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 520:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 523:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 523:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 26, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 559:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 562:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 562:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 14, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 598:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 601:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 601:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 26, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 637:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 640:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 640:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 676:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 679:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 679:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 26, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 715:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 718:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 718:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 754:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 757:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 757:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 27, bonus = -2, expired = 1). Will run for at most 3 ticks.
+
+At time 793:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 796:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 796:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 832:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 835:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 835:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 27, bonus = -2, expired = 1). Will run for at most 3 ticks.
+
+At time 871:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 874:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 874:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 890:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 910:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 913:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 913:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 26, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 949:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 952:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 952:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 988:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 990:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 990:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (level = 26, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 999:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1026:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1026:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1026:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 1062:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1065:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1065:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 26, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 1101:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1104:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1104:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 1140:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1143:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1143:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 26, bonus = -1, expired = 1). Will run for at most 3 ticks.
+
+At time 1179:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1182:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1182:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 1218:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1219:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1219:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (level = 27, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 1240:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1255:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1255:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1255:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 14, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 1291:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1294:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1294:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 27, bonus = -2, expired = 1). Will run for at most 3 ticks.
+
+At time 1330:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1333:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1333:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 14, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 1369:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1372:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1372:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 27, bonus = -2, expired = 1). Will run for at most 3 ticks.
+
+At time 1408:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1411:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1411:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 14, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 1447:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1450:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1450:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 27, bonus = -2, expired = 1). Will run for at most 3 ticks.
+
+At time 1486:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1489:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1489:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 1525:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1528:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1528:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 28, bonus = -3, expired = 1). Will run for at most 3 ticks.
+
+At time 1564:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1567:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1567:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 1603:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1606:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1606:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 28, bonus = -3, expired = 1). Will run for at most 3 ticks.
+
+At time 1642:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1644:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1644:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 1655:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1680:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1683:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1683:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (level = 27, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 1692:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1719:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1719:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1719:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 1755:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1758:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1758:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 27, bonus = -2, expired = 1). Will run for at most 3 ticks.
+
+At time 1794:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1797:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1797:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 1833:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1836:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1836:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 27, bonus = -2, expired = 1). Will run for at most 3 ticks.
+
+At time 1872:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1875:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1875:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 1911:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1914:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1914:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 28, bonus = -3, expired = 1). Will run for at most 3 ticks.
+
+At time 1950:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1953:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1953:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 1989:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1992:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1992:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (level = 28, bonus = -3, expired = 1). Will run for at most 3 ticks.
+
+At time 2028:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2031:
+    THREAD_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2031:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 2067:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2070:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2070:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 2084:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2087:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2087:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 17, bonus = -2, expired = 0). Will run for at most 3 ticks.
+
+At time 2101:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2102:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2108:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2108:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 2122:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2124:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2132:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2132:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 15, bonus = 0, expired = 0). Will run for at most 3 ticks.
+
+At time 2146:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2149:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2149:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 16, bonus = -1, expired = 0). Will run for at most 3 ticks.
+
+At time 2163:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2165:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2188:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2188:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 14, bonus = 1, expired = 0). Will run for at most 3 ticks.
+
+At time 2202:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2204:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2226:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2226:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 12, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 2240:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2243:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2243:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 12, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 2257:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2260:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2260:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 12, bonus = 3, expired = 0). Will run for at most 3 ticks.
+
+At time 2274:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2277:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2277:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 13, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 2291:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2294:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2294:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 13, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 2308:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2311:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2311:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 13, bonus = 2, expired = 0). Will run for at most 3 ticks.
+
+At time 2325:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2326:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2351:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2351:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 11, bonus = 4, expired = 0). Will run for at most 3 ticks.
+
+At time 2365:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2368:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2368:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (level = 11, bonus = 4, expired = 0). Will run for at most 3 ticks.
+
+At time 2382:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2384:
+    THREAD_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
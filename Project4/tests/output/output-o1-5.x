@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             14
+    Process switches:            52
+    Dispatch time saved:        308
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                 75
+    NORMAL:                      75
+    BATCH:                        0
+
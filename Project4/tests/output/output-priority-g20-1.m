@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       52.33
+    Avg. turnaround time:   1017.67
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      126.50
+    Avg. turnaround time:    598.25
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1319
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:           649
+Total idle time:                42
+
+CPU utilization:            96.82%
+CPU efficiency:             47.61%
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 945    END: 995   
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 1277   END: 1319  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 831    END: 888   
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 1162   END: 1262  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 353    END: 413   
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 539    END: 612   
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 339    END: 389   
+
@@ -0,0 +1,702 @@
+At time 42:
+    THREAD_ARRIVED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 42:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 0 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 57:
+    THREAD_ARRIVED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 60:
+    THREAD_ARRIVED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 73:
+    THREAD_ARRIVED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 77:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 100:
+    THREAD_ARRIVED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 107:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 107:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst.
+
+At time 110:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 116:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 116:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst.
+
+At time 119:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 120:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 133:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 133:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 1 N: 3 B: 0]. Will run to completion of burst.
+
+At time 139:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 154:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 168:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 189:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 189:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    [S: 0 I: 3 N: 3 B: 0] -> [S: 0 I: 3 N: 2 B: 0]. Will run to completion of burst.
+
+At time 192:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 196:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 196:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    [S: 0 I: 3 N: 2 B: 0] -> [S: 0 I: 3 N: 1 B: 0]. Will run to completion of burst.
+
+At time 199:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 208:
+    IO_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 211:
+    IO_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 227:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 227:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 3 N: 3 B: 0] -> [S: 0 I: 3 N: 2 B: 0]. Will run to completion of burst.
+
+At time 230:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 246:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 246:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 3 N: 2 B: 0] -> [S: 0 I: 2 N: 2 B: 0]. Will run to completion of burst.
+
+At time 251:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 261:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 281:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 307:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 307:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst.
+
+At time 310:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 330:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 332:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 332:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst.
+
+At time 335:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 349:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 349:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 1 N: 3 B: 0]. Will run to completion of burst.
+
+At time 352:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 375:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 384:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 389:
+    THREAD_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 389:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    [S: 0 I: 3 N: 3 B: 0] -> [S: 0 I: 3 N: 2 B: 0]. Will run to completion of burst.
+
+At time 392:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 413:
+    THREAD_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 413:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    [S: 0 I: 3 N: 2 B: 0] -> [S: 0 I: 3 N: 1 B: 0]. Will run to completion of burst.
+
+At time 416:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 430:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 430:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 3 N: 1 B: 0] -> [S: 0 I: 3 N: 0 B: 0]. Will run to completion of burst.
+
+At time 433:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 454:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 457:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 457:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 3 N: 1 B: 0] -> [S: 0 I: 2 N: 1 B: 0]. Will run to completion of burst.
+
+At time 479:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 492:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 522:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 522:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 2 B: 0] -> [S: 0 I: 1 N: 2 B: 0]. Will run to completion of burst.
+
+At time 525:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 539:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 539:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 2 B: 0] -> [S: 0 I: 0 N: 2 B: 0]. Will run to completion of burst.
+
+At time 542:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 547:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 548:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 571:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 571:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    [S: 0 I: 2 N: 2 B: 0] -> [S: 0 I: 2 N: 1 B: 0]. Will run to completion of burst.
+
+At time 584:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 606:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 612:
+    THREAD_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 612:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 3 N: 1 B: 0] -> [S: 0 I: 3 N: 0 B: 0]. Will run to completion of burst.
+
+At time 615:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 644:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 644:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 3 N: 0 B: 0] -> [S: 0 I: 2 N: 0 B: 0]. Will run to completion of burst.
+
+At time 652:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 679:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 690:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 690:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 1 B: 0] -> [S: 0 I: 1 N: 1 B: 0]. Will run to completion of burst.
+
+At time 693:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 709:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 709:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst.
+
+At time 712:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 717:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 731:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 735:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 735:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 2 N: 1 B: 0] -> [S: 0 I: 2 N: 0 B: 0]. Will run to completion of burst.
+
+At time 757:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 770:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 788:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 788:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 3 N: 0 B: 0] -> [S: 0 I: 2 N: 0 B: 0]. Will run to completion of burst.
+
+At time 795:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 823:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 846:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 846:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 1 B: 0] -> [S: 0 I: 1 N: 1 B: 0]. Will run to completion of burst.
+
+At time 849:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 854:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 866:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 866:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 1 B: 0] -> [S: 0 I: 1 N: 1 B: 0]. Will run to completion of burst.
+
+At time 869:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 888:
+    THREAD_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 888:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 1 N: 0 B: 0]. Will run to completion of burst.
+
+At time 891:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 923:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 932:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 932:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 0 B: 0] -> [S: 0 I: 1 N: 0 B: 0]. Will run to completion of burst.
+
+At time 953:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 967:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 995:
+    THREAD_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 995:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst.
+
+At time 998:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1027:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1027:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 1043:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1062:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1063:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1063:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 0 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 1087:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1098:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1107:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1107:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 1127:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1142:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1163:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1163:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 0 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 1185:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1198:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1219:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1219:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 1222:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1254:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1262:
+    THREAD_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1262:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 0 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 1297:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1319:
+    THREAD_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
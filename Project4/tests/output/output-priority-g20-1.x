@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             18
+    Process switches:            17
+    Dispatch time saved:        576
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                181
+    NORMAL:                     181
+    BATCH:                        0
+
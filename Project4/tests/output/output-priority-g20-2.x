@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:              8
+    Process switches:             6
+    Dispatch time saved:        296
+
+MAX READY WAIT:
+    SYSTEM:                     138
+    INTERACTIVE:                  0
+    NORMAL:                     121
+    BATCH:                        0
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      476.00
+    Avg. turnaround time:   3911.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      371.00
+    Avg. turnaround time:   2686.62
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      374.50
+    Avg. turnaround time:   2896.25
+
+Total elapsed time:           4319
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:          3167
+Total idle time:                25
+
+CPU utilization:            99.42%
+CPU efficiency:             26.09%
+
@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 4148   END: 4196  
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 1706   END: 1716  
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 3911   END: 3993  
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 452    END: 510   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 4099   END: 4127  
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 1745   END: 1778  
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 4319   END: 4319  
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 3499   END: 3552  
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 2061   END: 2119  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 3420   END: 3490  
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 3798   END: 3845  
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 297    END: 336   
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 3534   END: 3621  
+
@@ -0,0 +1,1382 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 10:
+    THREAD_ARRIVED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from NEW to READY
+
+At time 28:
+    THREAD_ARRIVED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    THREAD_ARRIVED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 53:
+    THREAD_ARRIVED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 67:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 67:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 6 B: 3] -> [S: 0 I: 0 N: 5 B: 3]. Will run to completion of burst.
+
+At time 70:
+    THREAD_ARRIVED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 82:
+    THREAD_ARRIVED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 87:
+    THREAD_ARRIVED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 89:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 115:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 121:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 121:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    [S: 0 I: 1 N: 7 B: 4] -> [S: 0 I: 1 N: 7 B: 3]. Will run to completion of burst.
+
+At time 144:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 169:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 196:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 196:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 8 B: 3] -> [S: 0 I: 1 N: 7 B: 3]. Will run to completion of burst.
+
+At time 212:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 244:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 274:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 274:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 7 B: 4] -> [S: 0 I: 1 N: 6 B: 4]. Will run to completion of burst.
+
+At time 294:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 336:
+    THREAD_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 336:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 7 B: 4] -> [S: 0 I: 1 N: 6 B: 4]. Will run to completion of burst.
+
+At time 355:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 383:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 383:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 1 N: 6 B: 4] -> [S: 0 I: 1 N: 5 B: 4]. Will run to completion of burst.
+
+At time 401:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 431:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 460:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 460:
+    DISPATCHER_INVOKED
+    Thread 0 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 6 B: 4] -> [S: 0 I: 1 N: 5 B: 4]. Will run to completion of burst.
+
+At time 490:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 508:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 510:
+    THREAD_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 510:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 6 B: 4] -> [S: 0 I: 0 N: 6 B: 4]. Will run to completion of burst.
+
+At time 558:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 579:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 579:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 6 B: 4] -> [S: 0 I: 0 N: 5 B: 4]. Will run to completion of burst.
+
+At time 582:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 627:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 638:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 638:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 1 N: 5 B: 4] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 646:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 686:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 697:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 697:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    [S: 0 I: 1 N: 6 B: 3] -> [S: 0 I: 1 N: 6 B: 2]. Will run to completion of burst.
+
+At time 710:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 716:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 728:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 728:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 6 B: 3] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 741:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 776:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 806:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 806:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 1 N: 5 B: 4] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 809:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 854:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 882:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 882:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 6 B: 3] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 902:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 930:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 939:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 939:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    [S: 0 I: 1 N: 5 B: 4] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 956:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 987:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1015:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1015:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 6 B: 3] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 1043:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1063:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1089:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1089:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 5 B: 4] -> [S: 0 I: 1 N: 4 B: 4]. Will run to completion of burst.
+
+At time 1097:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1137:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1156:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1156:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 1 N: 5 B: 4] -> [S: 0 I: 1 N: 4 B: 4]. Will run to completion of burst.
+
+At time 1164:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1204:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1208:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1208:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 5 B: 4] -> [S: 0 I: 0 N: 5 B: 4]. Will run to completion of burst.
+
+At time 1237:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1269:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1269:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 6 B: 4] -> [S: 0 I: 0 N: 5 B: 4]. Will run to completion of burst.
+
+At time 1276:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1317:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1345:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1345:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 1 N: 5 B: 4] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 1366:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1393:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1415:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1415:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    [S: 0 I: 1 N: 6 B: 3] -> [S: 0 I: 1 N: 6 B: 2]. Will run to completion of burst.
+
+At time 1428:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1434:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1438:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1438:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 6 B: 3] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 1464:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1486:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1511:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1511:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 1 N: 5 B: 4] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 1539:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1559:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1579:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1579:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 6 B: 3] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 1592:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 1627:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1652:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1652:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    [S: 0 I: 1 N: 5 B: 4] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 1668:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1700:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1716:
+    THREAD_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 1716:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 6 B: 3] -> [S: 0 I: 1 N: 5 B: 3]. Will run to completion of burst.
+
+At time 1764:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1778:
+    THREAD_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1778:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 5 B: 3] -> [S: 0 I: 1 N: 4 B: 3]. Will run to completion of burst.
+
+At time 1826:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1841:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1841:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 3] -> [S: 0 I: 1 N: 3 B: 3]. Will run to completion of burst.
+
+At time 1856:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1913:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1913:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 3] -> [S: 0 I: 0 N: 4 B: 3]. Will run to completion of burst.
+
+At time 1914:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1961:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1988:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1988:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 3] -> [S: 0 I: 0 N: 4 B: 3]. Will run to completion of burst.
+
+At time 1991:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2036:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2037:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2037:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 1 N: 4 B: 3] -> [S: 0 I: 1 N: 4 B: 2]. Will run to completion of burst.
+
+At time 2047:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2085:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2090:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2090:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    [S: 0 I: 1 N: 5 B: 2] -> [S: 0 I: 1 N: 5 B: 1]. Will run to completion of burst.
+
+At time 2109:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2112:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2119:
+    THREAD_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 2119:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 5 B: 2] -> [S: 0 I: 1 N: 4 B: 2]. Will run to completion of burst.
+
+At time 2167:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2175:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2175:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 2201:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2223:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2232:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2232:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 5 B: 1] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 2240:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2280:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2281:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2281:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 3 B: 2]. Will run to completion of burst.
+
+At time 2305:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2329:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2335:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2335:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 3 B: 2]. Will run to completion of burst.
+
+At time 2344:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2383:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2397:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2397:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 0 N: 4 B: 2]. Will run to completion of burst.
+
+At time 2426:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2445:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2447:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2447:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 2] -> [S: 0 I: 0 N: 4 B: 2]. Will run to completion of burst.
+
+At time 2471:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2495:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2509:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2509:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 2533:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2557:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2587:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2587:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 5 B: 1] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 2617:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2635:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2644:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2644:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 2653:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2692:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 2714:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2714:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 5 B: 1] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 2738:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 2762:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2774:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2774:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 3 B: 2]. Will run to completion of burst.
+
+At time 2803:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2822:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2825:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2825:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 3 B: 2]. Will run to completion of burst.
+
+At time 2849:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2873:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2879:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2879:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 0 N: 4 B: 2]. Will run to completion of burst.
+
+At time 2880:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2927:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2957:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2957:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 2] -> [S: 0 I: 0 N: 4 B: 2]. Will run to completion of burst.
+
+At time 2963:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3005:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3019:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3019:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 3040:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3067:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3081:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3081:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 5 B: 1] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 3084:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3129:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3148:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3148:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 3150:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3196:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3204:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3204:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 5 B: 1] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 3211:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3252:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3253:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3253:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 3 B: 2]. Will run to completion of burst.
+
+At time 3259:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3301:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3327:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3327:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 3 B: 2]. Will run to completion of burst.
+
+At time 3355:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3375:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3385:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3385:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 0 N: 4 B: 2]. Will run to completion of burst.
+
+At time 3391:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3433:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3436:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3436:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 2] -> [S: 0 I: 0 N: 4 B: 2]. Will run to completion of burst.
+
+At time 3451:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 3484:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3490:
+    THREAD_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3490:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 1 N: 4 B: 2] -> [S: 0 I: 1 N: 4 B: 1]. Will run to completion of burst.
+
+At time 3538:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3552:
+    THREAD_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 3552:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 4 B: 1] -> [S: 0 I: 1 N: 3 B: 1]. Will run to completion of burst.
+
+At time 3600:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3621:
+    THREAD_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3621:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 1 N: 3 B: 1] -> [S: 0 I: 1 N: 3 B: 0]. Will run to completion of burst.
+
+At time 3669:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3697:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3697:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 1 N: 3 B: 0] -> [S: 0 I: 1 N: 2 B: 0]. Will run to completion of burst.
+
+At time 3721:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3745:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3775:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3775:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 1 N: 2 B: 1] -> [S: 0 I: 1 N: 1 B: 1]. Will run to completion of burst.
+
+At time 3779:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3823:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3845:
+    THREAD_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3845:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 1 N: 2 B: 1] -> [S: 0 I: 1 N: 1 B: 1]. Will run to completion of burst.
+
+At time 3893:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3920:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3920:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 1] -> [S: 0 I: 0 N: 1 B: 1]. Will run to completion of burst.
+
+At time 3939:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3968:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 3993:
+    THREAD_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 3993:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 2 B: 1] -> [S: 0 I: 0 N: 2 B: 0]. Will run to completion of burst.
+
+At time 4041:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4058:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4058:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 2 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst.
+
+At time 4068:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 4106:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4127:
+    THREAD_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 4127:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 1] -> [S: 0 I: 0 N: 0 B: 1]. Will run to completion of burst.
+
+At time 4175:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4196:
+    THREAD_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 4196:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 4244:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4274:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4299:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 4299:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 4318:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4319:
+    THREAD_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
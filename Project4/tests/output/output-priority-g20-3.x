@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:              5
+    Process switches:            64
+    Dispatch time saved:        145
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                685
+    NORMAL:                     786
+    BATCH:                      775
+
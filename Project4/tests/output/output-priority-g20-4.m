@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      411.31
+    Avg. turnaround time:   5602.92
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:      881.40
+    Avg. turnaround time:   6477.60
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           8042
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:          5898
+Total idle time:                10
+
+CPU utilization:            99.88%
+CPU efficiency:             26.54%
+
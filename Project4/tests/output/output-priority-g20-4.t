@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 7072   END: 7131  
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 5517   END: 5596  
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 7992   END: 8042  
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 4001   END: 4023  
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 6254   END: 6304  
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 6618   END: 6677  
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 7651   END: 7722  
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 7155   END: 7194  
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 6384   END: 6407  
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 7409   END: 7501  
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 4817   END: 4888  
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 7407   END: 7432  
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 7579   END: 7674  
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 7786   END: 7830  
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 4463   END: 4530  
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 2898   END: 2945  
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 6493   END: 6538  
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 3588   END: 3647  
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 6703   END: 6779  
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 7958   END: 7968  
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 1409   END: 1426  
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 6141   END: 6190  
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 4319   END: 4374  
+
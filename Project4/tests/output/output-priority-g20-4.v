@@ -0,0 +1,2782 @@
+At time 10:
+    THREAD_ARRIVED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 17:
+    THREAD_ARRIVED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 22:
+    THREAD_ARRIVED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 23:
+    THREAD_ARRIVED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 25:
+    THREAD_ARRIVED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 44:
+    THREAD_ARRIVED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 45:
+    THREAD_ARRIVED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 49:
+    THREAD_ARRIVED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    THREAD_ARRIVED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 67:
+    THREAD_ARRIVED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 69:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 69:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    [S: 11 I: 0 N: 5 B: 0] -> [S: 10 I: 0 N: 5 B: 0]. Will run to completion of burst.
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 76:
+    THREAD_ARRIVED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 79:
+    THREAD_ARRIVED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 81:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 92:
+    THREAD_ARRIVED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 95:
+    THREAD_ARRIVED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 114:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 127:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 127:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 137:
+    IO_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 172:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 184:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 184:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 187:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 229:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 231:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 231:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 248:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 276:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 299:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 299:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 306:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 323:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 327:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 327:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 351:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 372:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 384:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 384:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 413:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 429:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 457:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 457:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 462:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 481:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 489:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 489:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 509:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 534:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 556:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 556:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 586:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 601:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 619:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 619:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 12 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 626:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 664:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 666:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 666:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 681:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 711:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 737:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 737:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 12 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 763:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 782:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 786:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 786:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 805:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 831:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 835:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 835:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 12 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 856:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 880:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 888:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 888:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 912:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 933:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 956:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 956:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 12 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 959:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1001:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1010:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1010:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 13 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 1035:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1055:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1085:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1085:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 13 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 1100:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1130:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1150:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1150:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 13 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 1162:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1195:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1213:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1213:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 13 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 1218:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1258:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1266:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1266:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 13 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 1286:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1290:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1294:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1294:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 13 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 1309:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1339:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1357:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1357:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    [S: 13 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 1383:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1402:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1426:
+    THREAD_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 1426:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 1471:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1489:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1489:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 1491:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1534:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1536:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1536:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 1543:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1581:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1591:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1591:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 1598:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1615:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1627:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1627:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 1657:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1672:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1698:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1698:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 1699:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1743:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1765:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1765:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 1786:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1789:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1795:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1795:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 1806:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1840:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1844:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1844:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 1871:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1902:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1902:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 1929:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1947:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1962:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1962:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 11 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 1970:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2007:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2019:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2019:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 2048:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2064:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2083:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2083:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 11 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 2107:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2128:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2136:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2136:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 2140:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2181:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2210:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2210:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 11 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 2233:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2255:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2268:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2268:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 2282:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2313:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2335:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2335:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 2363:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2380:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2402:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2402:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 2418:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2447:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2464:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2464:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 2479:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2509:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2518:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2518:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 2532:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2563:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2587:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2587:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 2611:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2615:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2630:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2630:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 12 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 2635:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2675:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2702:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2702:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 9 B: 0] -> [S: 11 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 2716:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2747:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2768:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2768:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 2775:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2813:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2830:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2830:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 2855:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2875:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2894:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2894:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 2903:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2918:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2945:
+    THREAD_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 2945:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 2990:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3002:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3002:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 3009:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3047:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3061:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3061:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 3074:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3085:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3107:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3107:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 3137:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3152:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3178:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3178:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 3183:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3223:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3226:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3226:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 3241:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3271:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3290:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3290:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 9 B: 0] -> [S: 10 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 3295:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3335:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3356:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3356:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst.
+
+At time 3382:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3401:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3404:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3404:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 3431:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3449:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3465:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3465:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 11 I: 0 N: 9 B: 0] -> [S: 11 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 3475:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3510:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3517:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3517:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 11 I: 0 N: 9 B: 0] -> [S: 10 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 3530:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3562:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3576:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3576:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 3582:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3621:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3647:
+    THREAD_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3647:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 11 I: 0 N: 9 B: 0] -> [S: 11 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 3692:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3694:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3694:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    [S: 11 I: 0 N: 8 B: 0] -> [S: 11 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 3713:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3739:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3768:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3768:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 11 I: 0 N: 8 B: 0] -> [S: 11 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 3781:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3813:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3820:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3820:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 11 I: 0 N: 8 B: 0] -> [S: 11 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 3843:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3865:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3866:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3866:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 11 I: 0 N: 8 B: 0] -> [S: 11 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 3886:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3890:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3907:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3907:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 11 I: 0 N: 8 B: 0] -> [S: 11 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 3908:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3952:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3965:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3965:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    [S: 11 I: 0 N: 8 B: 0] -> [S: 10 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 3966:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4010:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4023:
+    THREAD_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4023:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 10 I: 0 N: 9 B: 0] -> [S: 9 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 4068:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4074:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4074:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 9 I: 0 N: 9 B: 0] -> [S: 8 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 4087:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4119:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4132:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4132:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 9 I: 0 N: 9 B: 0] -> [S: 8 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 4156:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4177:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4200:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4200:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 9 I: 0 N: 9 B: 0] -> [S: 8 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 4202:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4245:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4264:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4264:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 9 I: 0 N: 9 B: 0] -> [S: 8 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 4267:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4288:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4305:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4305:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    [S: 9 I: 0 N: 9 B: 0] -> [S: 8 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 4316:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4350:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4374:
+    THREAD_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4374:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 9 I: 0 N: 9 B: 0] -> [S: 8 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 4419:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4425:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4425:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 8 I: 0 N: 9 B: 0] -> [S: 8 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 4438:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4470:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4481:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4481:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    [S: 9 I: 0 N: 8 B: 0] -> [S: 8 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 4501:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4526:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4530:
+    THREAD_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4530:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 8 I: 0 N: 9 B: 0] -> [S: 7 I: 0 N: 9 B: 0]. Will run to completion of burst.
+
+At time 4575:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4604:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4604:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 7 I: 0 N: 9 B: 0] -> [S: 7 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 4626:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4649:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4658:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4658:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 8 I: 0 N: 8 B: 0] -> [S: 8 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 4668:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4703:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4706:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4706:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 8 I: 0 N: 8 B: 0] -> [S: 7 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 4718:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4751:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4779:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4779:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 7 I: 0 N: 9 B: 0] -> [S: 7 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 4792:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4824:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4830:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4830:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    [S: 8 I: 0 N: 8 B: 0] -> [S: 8 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 4852:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4875:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4888:
+    THREAD_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 4888:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 8 I: 0 N: 8 B: 0] -> [S: 8 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 4933:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4958:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4958:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 8 I: 0 N: 7 B: 0] -> [S: 8 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 4987:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5003:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5026:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5026:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 8 I: 0 N: 7 B: 0] -> [S: 8 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 5033:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5050:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5064:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5064:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 8 I: 0 N: 7 B: 0] -> [S: 8 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 5089:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5109:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5130:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5130:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 8 I: 0 N: 7 B: 0] -> [S: 7 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 5137:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5175:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5183:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5183:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 7 I: 0 N: 8 B: 0] -> [S: 6 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 5213:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5228:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5234:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5234:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 7 I: 0 N: 8 B: 0] -> [S: 6 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 5262:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5279:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5288:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5288:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 7 I: 0 N: 8 B: 0] -> [S: 6 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 5294:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5333:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5359:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5359:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 7 I: 0 N: 8 B: 0] -> [S: 6 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 5376:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5383:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5400:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5400:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 7 I: 0 N: 8 B: 0] -> [S: 6 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 5425:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5445:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5474:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5474:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 7 I: 0 N: 8 B: 0] -> [S: 7 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 5492:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5519:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5538:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5538:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 8 I: 0 N: 7 B: 0] -> [S: 7 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 5546:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5583:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5596:
+    THREAD_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 5596:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 7 I: 0 N: 8 B: 0] -> [S: 7 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 5641:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5646:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5646:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 7 I: 0 N: 7 B: 0] -> [S: 7 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 5648:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5691:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5699:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5699:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 7 I: 0 N: 7 B: 0] -> [S: 6 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 5703:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5744:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 5762:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5762:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 6 I: 0 N: 8 B: 0] -> [S: 6 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 5792:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 5807:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5817:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5817:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 7 I: 0 N: 7 B: 0] -> [S: 7 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 5829:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5841:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5862:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5862:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 7 I: 0 N: 7 B: 0] -> [S: 7 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 5876:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5907:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5914:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5914:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 7 I: 0 N: 7 B: 0] -> [S: 7 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 5938:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5939:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5951:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5951:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 7 I: 0 N: 7 B: 0] -> [S: 7 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 5966:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5996:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6015:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6015:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 7 I: 0 N: 7 B: 0] -> [S: 6 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 6042:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6060:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6072:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6072:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 6 I: 0 N: 8 B: 0] -> [S: 5 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 6075:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6117:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6140:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6140:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 6 I: 0 N: 8 B: 0] -> [S: 5 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 6148:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6185:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6190:
+    THREAD_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 6190:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 6 I: 0 N: 8 B: 0] -> [S: 5 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 6235:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6261:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6261:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 5 I: 0 N: 8 B: 0] -> [S: 4 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 6285:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6289:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6304:
+    THREAD_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 6304:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 5 I: 0 N: 8 B: 0] -> [S: 4 I: 0 N: 8 B: 0]. Will run to completion of burst.
+
+At time 6349:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6355:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6355:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 4 I: 0 N: 8 B: 0] -> [S: 4 I: 0 N: 7 B: 0]. Will run to completion of burst.
+
+At time 6364:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6400:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6407:
+    THREAD_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6407:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 5 I: 0 N: 7 B: 0] -> [S: 5 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 6452:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6468:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6468:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 5 I: 0 N: 6 B: 0] -> [S: 5 I: 0 N: 5 B: 0]. Will run to completion of burst.
+
+At time 6491:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6513:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6538:
+    THREAD_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6538:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 5 I: 0 N: 6 B: 0] -> [S: 4 I: 0 N: 6 B: 0]. Will run to completion of burst.
+
+At time 6583:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6613:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6613:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 4 I: 0 N: 6 B: 0] -> [S: 4 I: 0 N: 5 B: 0]. Will run to completion of burst.
+
+At time 6623:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6658:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6677:
+    THREAD_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6677:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 5 I: 0 N: 5 B: 0] -> [S: 5 I: 0 N: 4 B: 0]. Will run to completion of burst.
+
+At time 6701:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6723:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6723:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 5 I: 0 N: 4 B: 0] -> [S: 5 I: 0 N: 3 B: 0]. Will run to completion of burst.
+
+At time 6736:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6768:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6779:
+    THREAD_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6779:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 5 I: 0 N: 4 B: 0] -> [S: 5 I: 0 N: 3 B: 0]. Will run to completion of burst.
+
+At time 6803:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6826:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6826:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 5 I: 0 N: 3 B: 0] -> [S: 4 I: 0 N: 3 B: 0]. Will run to completion of burst.
+
+At time 6851:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6871:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6886:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6886:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 4 I: 0 N: 4 B: 0] -> [S: 4 I: 0 N: 3 B: 0]. Will run to completion of burst.
+
+At time 6911:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 6931:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6933:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6933:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 5 I: 0 N: 3 B: 0] -> [S: 4 I: 0 N: 3 B: 0]. Will run to completion of burst.
+
+At time 6949:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6978:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 6995:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6995:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 4 I: 0 N: 4 B: 0] -> [S: 3 I: 0 N: 4 B: 0]. Will run to completion of burst.
+
+At time 7014:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7040:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7062:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7062:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 4 I: 0 N: 4 B: 0] -> [S: 3 I: 0 N: 4 B: 0]. Will run to completion of burst.
+
+At time 7090:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7107:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7131:
+    THREAD_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 7131:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 4 I: 0 N: 4 B: 0] -> [S: 4 I: 0 N: 3 B: 0]. Will run to completion of burst.
+
+At time 7176:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7194:
+    THREAD_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7194:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 4 I: 0 N: 3 B: 0] -> [S: 3 I: 0 N: 3 B: 0]. Will run to completion of burst.
+
+At time 7239:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7261:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7261:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 3 I: 0 N: 3 B: 0] -> [S: 3 I: 0 N: 2 B: 0]. Will run to completion of burst.
+
+At time 7289:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7306:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7333:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7333:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 4 I: 0 N: 2 B: 0] -> [S: 4 I: 0 N: 1 B: 0]. Will run to completion of burst.
+
+At time 7361:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7378:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7386:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7386:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 4 I: 0 N: 2 B: 0] -> [S: 3 I: 0 N: 2 B: 0]. Will run to completion of burst.
+
+At time 7387:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7431:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7432:
+    THREAD_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 7432:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 3 I: 0 N: 3 B: 0] -> [S: 3 I: 0 N: 2 B: 0]. Will run to completion of burst.
+
+At time 7477:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7501:
+    THREAD_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7501:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 3 I: 0 N: 2 B: 0] -> [S: 2 I: 0 N: 2 B: 0]. Will run to completion of burst.
+
+At time 7546:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7558:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7558:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 2 I: 0 N: 2 B: 0] -> [S: 1 I: 0 N: 2 B: 0]. Will run to completion of burst.
+
+At time 7575:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7603:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7628:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7628:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 2 I: 0 N: 2 B: 0] -> [S: 1 I: 0 N: 2 B: 0]. Will run to completion of burst.
+
+At time 7651:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7673:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7674:
+    THREAD_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 7674:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 2 I: 0 N: 2 B: 0] -> [S: 2 I: 0 N: 1 B: 0]. Will run to completion of burst.
+
+At time 7719:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7722:
+    THREAD_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7722:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 2 I: 0 N: 1 B: 0] -> [S: 2 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 7767:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7782:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7782:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 2 I: 0 N: 0 B: 0] -> [S: 1 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 7795:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7827:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7830:
+    THREAD_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 7830:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 1 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst.
+
+At time 7875:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 7903:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7903:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 7907:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 7948:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7968:
+    THREAD_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7968:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 1 I: 0 N: 0 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst.
+
+At time 8013:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 8042:
+    THREAD_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
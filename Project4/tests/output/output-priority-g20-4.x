@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             17
+    Process switches:           122
+    Dispatch time saved:        357
+
+MAX READY WAIT:
+    SYSTEM:                    1296
+    INTERACTIVE:                  0
+    NORMAL:                    1342
+    BATCH:                        0
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       52.33
+    Avg. turnaround time:    482.00
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      568.00
+    Avg. turnaround time:    898.75
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1114
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:           370
+Total idle time:               116
+
+CPU utilization:            89.59%
+CPU efficiency:             56.37%
+
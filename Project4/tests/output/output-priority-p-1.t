@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 394    END: 444   
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 696    END: 738   
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 356    END: 413   
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 1014   END: 1114  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 850    END: 910   
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 895    END: 968   
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 836    END: 886   
+
@@ -0,0 +1,747 @@
+At time 42:
+    THREAD_ARRIVED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 42:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 0 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 57:
+    THREAD_ARRIVED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 60:
+    THREAD_ARRIVED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 73:
+    THREAD_ARRIVED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 77:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 100:
+    THREAD_ARRIVED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 107:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 107:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 110:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 116:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 116:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 119:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 120:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 133:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 133:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 136:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 139:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 154:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 162:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 162:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 165:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 185:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 187:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 187:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 190:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 204:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 204:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 207:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 207:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 230:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 237:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 237:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 240:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 254:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 254:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 257:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 262:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 263:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 286:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 286:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 289:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 299:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 300:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 300:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 303:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 319:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 319:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 322:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 327:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 341:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 345:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 345:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 348:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 367:
+    IO_BURST_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 371:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 371:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 374:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 379:
+    IO_BURST_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 391:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 391:
+    DISPATCHER_INVOKED
+    Thread 2 in process 642 [INTERACTIVE]
+    [S: 0 I: 2 N: 4 B: 0] -> [S: 0 I: 1 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 394:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 413:
+    THREAD_COMPLETED
+    Thread 2 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 413:
+    DISPATCHER_INVOKED
+    Thread 0 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 416:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 416:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 444:
+    THREAD_COMPLETED
+    Thread 0 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 444:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 447:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 476:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 476:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 0] -> [S: 0 I: 0 N: 3 B: 0]. Will run to completion of burst or until preempted.
+
+At time 492:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 511:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 511:
+    THREAD_PREEMPTED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 511:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 546:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 555:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 555:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 0] -> [S: 0 I: 0 N: 3 B: 0]. Will run to completion of burst or until preempted.
+
+At time 575:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 590:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 590:
+    THREAD_PREEMPTED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 590:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 625:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 646:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 646:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 0] -> [S: 0 I: 0 N: 3 B: 0]. Will run to completion of burst or until preempted.
+
+At time 649:
+    IO_BURST_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 681:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 681:
+    THREAD_PREEMPTED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 681:
+    DISPATCHER_INVOKED
+    Thread 1 in process 642 [INTERACTIVE]
+    [S: 0 I: 1 N: 4 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 716:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 738:
+    THREAD_COMPLETED
+    Thread 1 in process 642 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 738:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 0] -> [S: 0 I: 0 N: 3 B: 0]. Will run to completion of burst or until preempted.
+
+At time 773:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 789:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 789:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 3 B: 0] -> [S: 0 I: 0 N: 2 B: 0]. Will run to completion of burst or until preempted.
+
+At time 792:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 804:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 813:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 813:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 3 B: 0] -> [S: 0 I: 0 N: 2 B: 0]. Will run to completion of burst or until preempted.
+
+At time 816:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 820:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 820:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 2 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 823:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 832:
+    IO_BURST_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 835:
+    IO_BURST_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 851:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 851:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 3 B: 0] -> [S: 0 I: 0 N: 2 B: 0]. Will run to completion of burst or until preempted.
+
+At time 854:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 875:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 878:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 878:
+    DISPATCHER_INVOKED
+    Thread 3 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 3 B: 0] -> [S: 0 I: 0 N: 2 B: 0]. Will run to completion of burst or until preempted.
+
+At time 881:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 886:
+    THREAD_COMPLETED
+    Thread 3 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 886:
+    DISPATCHER_INVOKED
+    Thread 1 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 2 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 889:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 900:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 910:
+    THREAD_COMPLETED
+    Thread 1 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 910:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 2 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 913:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 927:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 927:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 930:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 951:
+    IO_BURST_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 959:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 959:
+    DISPATCHER_INVOKED
+    Thread 2 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 962:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 967:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 968:
+    THREAD_COMPLETED
+    Thread 2 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 968:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 971:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 989:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 996:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 996:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 999:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1008:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1029:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1029:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1032:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1033:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1057:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1057:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1060:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1081:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1103:
+    IO_BURST_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1103:
+    DISPATCHER_INVOKED
+    Thread 0 in process 740 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1106:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1114:
+    THREAD_COMPLETED
+    Thread 0 in process 740 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
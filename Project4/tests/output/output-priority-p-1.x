@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             30
+    Process switches:             8
+    Dispatch time saved:        960
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                 67
+    NORMAL:                     673
+    BATCH:                        0
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             10
+    Process switches:             7
+    Dispatch time saved:        370
+
+MAX READY WAIT:
+    SYSTEM:                     113
+    INTERACTIVE:                  0
+    NORMAL:                     323
+    BATCH:                        0
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:       62.00
+    Avg. turnaround time:    759.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      441.88
+    Avg. turnaround time:   2267.38
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:     2430.00
+    Avg. turnaround time:   3832.75
+
+Total elapsed time:           4157
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:          2971
+Total idle time:                59
+
+CPU utilization:            98.58%
+CPU efficiency:             27.11%
+
@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 3083   END: 3131  
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 3604   END: 3614  
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 759    END: 841   
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 1200   END: 1258  
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 3034   END: 3062  
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 1758   END: 1791  
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 4157   END: 4157  
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 3893   END: 3946  
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 3677   END: 3735  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 2700   END: 2770  
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 2871   END: 2918  
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 1045   END: 1084  
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 2448   END: 2535  
+
@@ -0,0 +1,1502 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 10:
+    THREAD_ARRIVED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from NEW to READY
+
+At time 28:
+    THREAD_ARRIVED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 33:
+    THREAD_ARRIVED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    THREAD_ARRIVED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 48:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 48:
+    THREAD_PREEMPTED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 48:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 2] -> [S: 0 I: 0 N: 4 B: 2]. Will run to completion of burst or until preempted.
+
+At time 53:
+    THREAD_ARRIVED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 58:
+    THREAD_ARRIVED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from NEW to READY
+
+At time 70:
+    THREAD_ARRIVED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 82:
+    THREAD_ARRIVED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 87:
+    THREAD_ARRIVED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 96:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 96:
+    THREAD_PREEMPTED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 96:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 8 B: 4] -> [S: 0 I: 0 N: 8 B: 4]. Will run to completion of burst or until preempted.
+
+At time 144:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 165:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 165:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 4] -> [S: 0 I: 0 N: 7 B: 4]. Will run to completion of burst or until preempted.
+
+At time 168:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 213:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 213:
+    THREAD_PREEMPTED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 213:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 8 B: 4] -> [S: 0 I: 0 N: 8 B: 4]. Will run to completion of burst or until preempted.
+
+At time 261:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 274:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 274:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 4] -> [S: 0 I: 0 N: 7 B: 4]. Will run to completion of burst or until preempted.
+
+At time 281:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 322:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 322:
+    THREAD_PREEMPTED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 322:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 8 B: 4] -> [S: 0 I: 0 N: 8 B: 4]. Will run to completion of burst or until preempted.
+
+At time 370:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 397:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 397:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 4] -> [S: 0 I: 0 N: 7 B: 4]. Will run to completion of burst or until preempted.
+
+At time 400:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 445:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 445:
+    THREAD_PREEMPTED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 445:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 8 B: 4] -> [S: 0 I: 0 N: 8 B: 4]. Will run to completion of burst or until preempted.
+
+At time 493:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 495:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 495:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 4] -> [S: 0 I: 0 N: 7 B: 4]. Will run to completion of burst or until preempted.
+
+At time 519:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 543:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 543:
+    THREAD_PREEMPTED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 543:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 8 B: 4] -> [S: 0 I: 0 N: 8 B: 4]. Will run to completion of burst or until preempted.
+
+At time 591:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 621:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 621:
+    DISPATCHER_INVOKED
+    Thread 0 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 4] -> [S: 0 I: 0 N: 7 B: 4]. Will run to completion of burst or until preempted.
+
+At time 627:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 669:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 669:
+    THREAD_PREEMPTED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 669:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 8 B: 4] -> [S: 0 I: 0 N: 8 B: 4]. Will run to completion of burst or until preempted.
+
+At time 717:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 720:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 720:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 4] -> [S: 0 I: 0 N: 7 B: 4]. Will run to completion of burst or until preempted.
+
+At time 735:
+    IO_BURST_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 768:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 768:
+    THREAD_PREEMPTED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 768:
+    DISPATCHER_INVOKED
+    Thread 0 in process 341 [INTERACTIVE]
+    [S: 0 I: 1 N: 8 B: 4] -> [S: 0 I: 0 N: 8 B: 4]. Will run to completion of burst or until preempted.
+
+At time 816:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 841:
+    THREAD_COMPLETED
+    Thread 0 in process 341 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 841:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 4] -> [S: 0 I: 0 N: 7 B: 4]. Will run to completion of burst or until preempted.
+
+At time 889:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 919:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 919:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 4] -> [S: 0 I: 0 N: 6 B: 4]. Will run to completion of burst or until preempted.
+
+At time 922:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 967:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 973:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 973:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 4] -> [S: 0 I: 0 N: 6 B: 4]. Will run to completion of burst or until preempted.
+
+At time 992:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 996:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1022:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1022:
+    DISPATCHER_INVOKED
+    Thread 2 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 4] -> [S: 0 I: 0 N: 6 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1042:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1070:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1084:
+    THREAD_COMPLETED
+    Thread 2 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1084:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 4] -> [S: 0 I: 0 N: 6 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1103:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1131:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1131:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 6 B: 4] -> [S: 0 I: 0 N: 5 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1149:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1179:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1208:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1208:
+    DISPATCHER_INVOKED
+    Thread 0 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 6 B: 4] -> [S: 0 I: 0 N: 5 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1238:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1258:
+    THREAD_COMPLETED
+    Thread 0 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1258:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 6 B: 4] -> [S: 0 I: 0 N: 5 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1306:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1317:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1317:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1325:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1336:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1361:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1361:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1389:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1409:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1418:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1418:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1435:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1437:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1463:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1463:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1471:
+    IO_BURST_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1511:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1530:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1530:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1538:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1578:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1582:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1582:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1611:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1630:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1658:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1658:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1677:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1679:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1685:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1685:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1711:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1733:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1758:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1758:
+    DISPATCHER_INVOKED
+    Thread 2 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1774:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1777:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1791:
+    THREAD_COMPLETED
+    Thread 2 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1791:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 4] -> [S: 0 I: 0 N: 4 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1839:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1854:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1854:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1869:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1902:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1926:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1926:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1927:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1974:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1975:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1975:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 1985:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1994:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2003:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2003:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2012:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2051:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2052:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2052:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2076:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2100:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2106:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2106:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2115:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2154:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2168:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2168:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2197:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2216:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2230:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2230:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2249:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2254:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2268:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2268:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2270:
+    IO_BURST_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2316:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2328:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2328:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2357:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2376:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2379:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2379:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2403:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2427:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2433:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2433:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2434:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2481:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2495:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2495:
+    DISPATCHER_INVOKED
+    Thread 3 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2514:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2516:
+    IO_BURST_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2535:
+    THREAD_COMPLETED
+    Thread 3 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2535:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 4] -> [S: 0 I: 0 N: 3 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2583:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2584:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2584:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 3 B: 4] -> [S: 0 I: 0 N: 2 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2590:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2632:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2658:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2658:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 3 B: 4] -> [S: 0 I: 0 N: 2 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2686:
+    IO_BURST_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2706:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2716:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2716:
+    DISPATCHER_INVOKED
+    Thread 0 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 3 B: 4] -> [S: 0 I: 0 N: 2 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2722:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2764:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2770:
+    THREAD_COMPLETED
+    Thread 0 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2770:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 3 B: 4] -> [S: 0 I: 0 N: 2 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2818:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2848:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2848:
+    DISPATCHER_INVOKED
+    Thread 1 in process 613 [NORMAL]
+    [S: 0 I: 0 N: 2 B: 4] -> [S: 0 I: 0 N: 1 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2852:
+    IO_BURST_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 2896:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2918:
+    THREAD_COMPLETED
+    Thread 1 in process 613 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2918:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 2 B: 4] -> [S: 0 I: 0 N: 1 B: 4]. Will run to completion of burst or until preempted.
+
+At time 2966:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2993:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2993:
+    DISPATCHER_INVOKED
+    Thread 1 in process 395 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 4] -> [S: 0 I: 0 N: 0 B: 4]. Will run to completion of burst or until preempted.
+
+At time 3012:
+    IO_BURST_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 3041:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3062:
+    THREAD_COMPLETED
+    Thread 1 in process 395 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3062:
+    DISPATCHER_INVOKED
+    Thread 0 in process 203 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 4] -> [S: 0 I: 0 N: 0 B: 4]. Will run to completion of burst or until preempted.
+
+At time 3110:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3131:
+    THREAD_COMPLETED
+    Thread 0 in process 203 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 3131:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    [S: 0 I: 0 N: 0 B: 4] -> [S: 0 I: 0 N: 0 B: 3]. Will run to completion of burst or until preempted.
+
+At time 3179:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3206:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3206:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 3] -> [S: 0 I: 0 N: 0 B: 2]. Will run to completion of burst or until preempted.
+
+At time 3222:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3254:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3273:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3273:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 3] -> [S: 0 I: 0 N: 0 B: 2]. Will run to completion of burst or until preempted.
+
+At time 3292:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3295:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3303:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3303:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 3] -> [S: 0 I: 0 N: 0 B: 2]. Will run to completion of burst or until preempted.
+
+At time 3316:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3322:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3334:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3334:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    [S: 0 I: 0 N: 0 B: 3] -> [S: 0 I: 0 N: 0 B: 2]. Will run to completion of burst or until preempted.
+
+At time 3347:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3382:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3410:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3410:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 3] -> [S: 0 I: 0 N: 0 B: 2]. Will run to completion of burst or until preempted.
+
+At time 3438:
+    IO_BURST_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3458:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3486:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3486:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 3] -> [S: 0 I: 0 N: 0 B: 2]. Will run to completion of burst or until preempted.
+
+At time 3505:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3506:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3527:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3527:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 3] -> [S: 0 I: 0 N: 0 B: 2]. Will run to completion of burst or until preempted.
+
+At time 3540:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3546:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3550:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3550:
+    DISPATCHER_INVOKED
+    Thread 0 in process 297 [BATCH]
+    [S: 0 I: 0 N: 0 B: 3] -> [S: 0 I: 0 N: 0 B: 2]. Will run to completion of burst or until preempted.
+
+At time 3576:
+    IO_BURST_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3598:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3614:
+    THREAD_COMPLETED
+    Thread 0 in process 297 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 3614:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 3] -> [S: 0 I: 0 N: 0 B: 2]. Will run to completion of burst or until preempted.
+
+At time 3662:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3682:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3682:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 2] -> [S: 0 I: 0 N: 0 B: 1]. Will run to completion of burst or until preempted.
+
+At time 3695:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3701:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3706:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3706:
+    DISPATCHER_INVOKED
+    Thread 2 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 2] -> [S: 0 I: 0 N: 0 B: 1]. Will run to completion of burst or until preempted.
+
+At time 3725:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3728:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3735:
+    THREAD_COMPLETED
+    Thread 2 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 3735:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 2] -> [S: 0 I: 0 N: 0 B: 1]. Will run to completion of burst or until preempted.
+
+At time 3754:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3763:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3763:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3771:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3782:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3812:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3812:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3831:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3842:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3853:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3853:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3872:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3877:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3886:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3886:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3889:
+    IO_BURST_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3905:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3913:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3913:
+    DISPATCHER_INVOKED
+    Thread 1 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3920:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 3932:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3946:
+    THREAD_COMPLETED
+    Thread 1 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 3946:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3965:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 3993:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4017:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 4017:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4036:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4053:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4063:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 4063:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4082:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4112:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4137:
+    IO_BURST_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from BLOCKED to READY
+
+At time 4137:
+    DISPATCHER_INVOKED
+    Thread 0 in process 404 [BATCH]
+    [S: 0 I: 0 N: 0 B: 1] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4156:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 4157:
+    THREAD_COMPLETED
+    Thread 0 in process 404 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
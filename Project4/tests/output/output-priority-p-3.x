@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             25
+    Process switches:            52
+    Dispatch time saved:        725
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                 93
+    NORMAL:                     871
+    BATCH:                     3264
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      374.85
+    Avg. turnaround time:   3126.92
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:     4145.40
+    Avg. turnaround time:   7105.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           7851
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:          5694
+Total idle time:                23
+
+CPU utilization:            99.71%
+CPU efficiency:             27.18%
+
@@ -0,0 +1,41 @@
+SIMULATION COMPLETED!
+
+Process 71 [SYSTEM]:
+    Thread  0:    ARR: 59     CPU: 99     I/O: 89     TRT: 3875   END: 3934  
+
+Process 104 [SYSTEM]:
+    Thread  0:    ARR: 79     CPU: 57     I/O: 74     TRT: 3161   END: 3240  
+    Thread  1:    ARR: 50     CPU: 239    I/O: 142    TRT: 4389   END: 4439  
+    Thread  2:    ARR: 22     CPU: 64     I/O: 12     TRT: 2239   END: 2261  
+    Thread  3:    ARR: 50     CPU: 89     I/O: 97     TRT: 3521   END: 3571  
+
+Process 242 [NORMAL]:
+    Thread  0:    ARR: 59     CPU: 89     I/O: 84     TRT: 7122   END: 7181  
+    Thread  1:    ARR: 71     CPU: 132    I/O: 126    TRT: 7663   END: 7734  
+    Thread  2:    ARR: 39     CPU: 87     I/O: 88     TRT: 7385   END: 7424  
+
+Process 320 [NORMAL]:
+    Thread  0:    ARR: 23     CPU: 73     I/O: 56     TRT: 7338   END: 7361  
+    Thread  1:    ARR: 92     CPU: 124    I/O: 91     TRT: 7541   END: 7633  
+    Thread  2:    ARR: 71     CPU: 79     I/O: 40     TRT: 6239   END: 6310  
+
+Process 428 [SYSTEM]:
+    Thread  0:    ARR: 25     CPU: 63     I/O: 120    TRT: 4001   END: 4026  
+    Thread  1:    ARR: 95     CPU: 149    I/O: 104    TRT: 4104   END: 4199  
+
+Process 461 [SYSTEM]:
+    Thread  0:    ARR: 44     CPU: 126    I/O: 119    TRT: 4203   END: 4247  
+    Thread  1:    ARR: 67     CPU: 63     I/O: 81     TRT: 2645   END: 2712  
+    Thread  2:    ARR: 47     CPU: 43     I/O: 54     TRT: 1702   END: 1749  
+
+Process 687 [NORMAL]:
+    Thread  0:    ARR: 45     CPU: 80     I/O: 76     TRT: 7035   END: 7080  
+    Thread  1:    ARR: 59     CPU: 57     I/O: 53     TRT: 5679   END: 5738  
+    Thread  2:    ARR: 76     CPU: 74     I/O: 100    TRT: 7207   END: 7283  
+    Thread  3:    ARR: 10     CPU: 147    I/O: 112    TRT: 7841   END: 7851  
+
+Process 729 [SYSTEM]:
+    Thread  0:    ARR: 17     CPU: 37     I/O: 10     TRT: 845    END: 862   
+    Thread  1:    ARR: 49     CPU: 87     I/O: 45     TRT: 3408   END: 3457  
+    Thread  2:    ARR: 55     CPU: 76     I/O: 62     TRT: 2557   END: 2612  
+
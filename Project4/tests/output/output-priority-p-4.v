@@ -0,0 +1,2812 @@
+At time 10:
+    THREAD_ARRIVED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 17:
+    THREAD_ARRIVED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 22:
+    THREAD_ARRIVED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 23:
+    THREAD_ARRIVED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 25:
+    THREAD_ARRIVED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 39:
+    THREAD_ARRIVED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 44:
+    THREAD_ARRIVED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 45:
+    THREAD_ARRIVED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 47:
+    THREAD_ARRIVED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 49:
+    THREAD_ARRIVED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 50:
+    THREAD_ARRIVED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    THREAD_ARRIVED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 55:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 55:
+    THREAD_PREEMPTED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 55:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    [S: 9 I: 0 N: 4 B: 0] -> [S: 8 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 59:
+    THREAD_ARRIVED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 67:
+    THREAD_ARRIVED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 71:
+    THREAD_ARRIVED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 76:
+    THREAD_ARRIVED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 79:
+    THREAD_ARRIVED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 92:
+    THREAD_ARRIVED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 95:
+    THREAD_ARRIVED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 100:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 113:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 113:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 123:
+    IO_BURST_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 158:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 170:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 170:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 173:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 215:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 217:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 217:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 234:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 262:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 285:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 285:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 292:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 309:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 313:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 313:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 337:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 358:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 370:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 370:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 399:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 415:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 443:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 443:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 448:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 467:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 475:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 475:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 495:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 520:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 542:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 542:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 572:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 587:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 605:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 605:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 612:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 650:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 676:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 676:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 702:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 721:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 725:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 725:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 746:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 770:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 793:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 793:
+    DISPATCHER_INVOKED
+    Thread 0 in process 729 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 796:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 838:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 862:
+    THREAD_COMPLETED
+    Thread 0 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 862:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    [S: 12 I: 0 N: 10 B: 0] -> [S: 11 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 907:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 925:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 925:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 927:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 970:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 972:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 972:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 979:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1017:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1027:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1027:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1034:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1051:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1063:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1063:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1093:
+    IO_BURST_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1108:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1134:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1134:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1135:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1179:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1201:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1201:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1222:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1225:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1231:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1231:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1242:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1276:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1280:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1280:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1307:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1325:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1338:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1338:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1365:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1383:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1395:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1395:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1424:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1440:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1448:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1448:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1452:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1493:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1506:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1506:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1520:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1551:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1572:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1572:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1579:
+    IO_BURST_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1617:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1634:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1634:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1659:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1679:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1698:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1698:
+    DISPATCHER_INVOKED
+    Thread 2 in process 461 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1707:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1722:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1749:
+    THREAD_COMPLETED
+    Thread 2 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 1749:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 11 I: 0 N: 10 B: 0] -> [S: 10 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1794:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1806:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1806:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1813:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1851:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1865:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1865:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1878:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1889:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1911:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1911:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1941:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 1956:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 1982:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1982:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1987:
+    IO_BURST_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2027:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2030:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2030:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2045:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2075:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2096:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2096:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2122:
+    IO_BURST_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2141:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2144:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2144:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2171:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2189:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2203:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2203:
+    DISPATCHER_INVOKED
+    Thread 2 in process 104 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2209:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2248:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2261:
+    THREAD_COMPLETED
+    Thread 2 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 2261:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 10 I: 0 N: 10 B: 0] -> [S: 9 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2306:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2312:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2312:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 9 I: 0 N: 10 B: 0] -> [S: 8 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2325:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2357:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2370:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2370:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 9 I: 0 N: 10 B: 0] -> [S: 8 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2394:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2415:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2438:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2438:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 9 I: 0 N: 10 B: 0] -> [S: 8 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2440:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2483:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2502:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2502:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 9 I: 0 N: 10 B: 0] -> [S: 8 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2505:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2526:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2543:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2543:
+    DISPATCHER_INVOKED
+    Thread 2 in process 729 [SYSTEM]
+    [S: 9 I: 0 N: 10 B: 0] -> [S: 8 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2554:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2588:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2612:
+    THREAD_COMPLETED
+    Thread 2 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 2612:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 9 I: 0 N: 10 B: 0] -> [S: 8 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2657:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2663:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2663:
+    DISPATCHER_INVOKED
+    Thread 1 in process 461 [SYSTEM]
+    [S: 8 I: 0 N: 10 B: 0] -> [S: 7 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2676:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2708:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2712:
+    THREAD_COMPLETED
+    Thread 1 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 2712:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 8 I: 0 N: 10 B: 0] -> [S: 7 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2757:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2786:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2786:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 7 I: 0 N: 10 B: 0] -> [S: 6 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2808:
+    IO_BURST_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2831:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2859:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2859:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 7 I: 0 N: 10 B: 0] -> [S: 6 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2872:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2883:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2891:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2891:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 7 I: 0 N: 10 B: 0] -> [S: 6 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2921:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2936:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2942:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2942:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 7 I: 0 N: 10 B: 0] -> [S: 6 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 2970:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 2987:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 2996:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2996:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 7 I: 0 N: 10 B: 0] -> [S: 6 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3002:
+    IO_BURST_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3041:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3067:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3067:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 7 I: 0 N: 10 B: 0] -> [S: 6 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3084:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3091:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3108:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3108:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 7 I: 0 N: 10 B: 0] -> [S: 6 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3133:
+    IO_BURST_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3153:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3182:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3182:
+    DISPATCHER_INVOKED
+    Thread 0 in process 104 [SYSTEM]
+    [S: 7 I: 0 N: 10 B: 0] -> [S: 6 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3200:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3227:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3240:
+    THREAD_COMPLETED
+    Thread 0 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 3240:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 7 I: 0 N: 10 B: 0] -> [S: 6 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3285:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3303:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3303:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 6 I: 0 N: 10 B: 0] -> [S: 5 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3327:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3333:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3339:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3339:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 6 I: 0 N: 10 B: 0] -> [S: 5 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3342:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3384:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3407:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3407:
+    DISPATCHER_INVOKED
+    Thread 1 in process 729 [SYSTEM]
+    [S: 6 I: 0 N: 10 B: 0] -> [S: 5 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3415:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3452:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3457:
+    THREAD_COMPLETED
+    Thread 1 in process 729 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 3457:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 6 I: 0 N: 10 B: 0] -> [S: 5 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3502:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3528:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3528:
+    DISPATCHER_INVOKED
+    Thread 3 in process 104 [SYSTEM]
+    [S: 5 I: 0 N: 10 B: 0] -> [S: 4 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3552:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3556:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3571:
+    THREAD_COMPLETED
+    Thread 3 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 3571:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 5 I: 0 N: 10 B: 0] -> [S: 4 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3616:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3622:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3622:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 4 I: 0 N: 10 B: 0] -> [S: 3 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3631:
+    IO_BURST_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3667:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3697:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3697:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 4 I: 0 N: 10 B: 0] -> [S: 3 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3707:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3721:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3736:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3736:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 4 I: 0 N: 10 B: 0] -> [S: 3 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3761:
+    IO_BURST_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3781:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3798:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3798:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 4 I: 0 N: 10 B: 0] -> [S: 3 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3817:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3843:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3865:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 3865:
+    DISPATCHER_INVOKED
+    Thread 0 in process 71 [SYSTEM]
+    [S: 4 I: 0 N: 10 B: 0] -> [S: 3 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3893:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 3910:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3934:
+    THREAD_COMPLETED
+    Thread 0 in process 71 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 3934:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 4 I: 0 N: 10 B: 0] -> [S: 3 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 3979:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4001:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4001:
+    DISPATCHER_INVOKED
+    Thread 0 in process 428 [SYSTEM]
+    [S: 3 I: 0 N: 10 B: 0] -> [S: 2 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4025:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4026:
+    THREAD_COMPLETED
+    Thread 0 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4026:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 2 I: 0 N: 10 B: 0] -> [S: 1 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4029:
+    IO_BURST_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4071:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4083:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4083:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 2 I: 0 N: 10 B: 0] -> [S: 1 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4100:
+    IO_BURST_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4128:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4153:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4153:
+    DISPATCHER_INVOKED
+    Thread 1 in process 428 [SYSTEM]
+    [S: 2 I: 0 N: 10 B: 0] -> [S: 1 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4176:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4198:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4199:
+    THREAD_COMPLETED
+    Thread 1 in process 428 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4199:
+    DISPATCHER_INVOKED
+    Thread 0 in process 461 [SYSTEM]
+    [S: 2 I: 0 N: 10 B: 0] -> [S: 1 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4244:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4247:
+    THREAD_COMPLETED
+    Thread 0 in process 461 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4247:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 1 I: 0 N: 10 B: 0] -> [S: 0 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4292:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4320:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4320:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 10 B: 0] -> [S: 0 I: 0 N: 9 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4324:
+    IO_BURST_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from BLOCKED to READY
+
+At time 4365:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4365:
+    THREAD_PREEMPTED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 4365:
+    DISPATCHER_INVOKED
+    Thread 1 in process 104 [SYSTEM]
+    [S: 1 I: 0 N: 10 B: 0] -> [S: 0 I: 0 N: 10 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4410:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 4439:
+    THREAD_COMPLETED
+    Thread 1 in process 104 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 4439:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 10 B: 0] -> [S: 0 I: 0 N: 9 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4484:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4488:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4488:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4507:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4533:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4541:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4541:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4565:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4565:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4579:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4579:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4591:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4603:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4612:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4612:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4637:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4657:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4687:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4687:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4702:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4732:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4752:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4752:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4764:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4797:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4815:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4815:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4820:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4860:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4868:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4868:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4888:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4913:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4931:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4931:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4955:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 4957:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 4957:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 4957:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 4972:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5002:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5021:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5021:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5045:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5066:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5095:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5095:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5118:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5119:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5123:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5123:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5138:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5147:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5169:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5169:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5197:
+    IO_BURST_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5214:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5236:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5236:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5252:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5281:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5298:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5298:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5313:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5343:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5352:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5352:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5366:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5397:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5421:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5421:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5449:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5466:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5493:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5493:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5507:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5517:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5532:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5532:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5540:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5577:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5593:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5593:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5603:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5638:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5645:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5645:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5658:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5669:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5688:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5688:
+    DISPATCHER_INVOKED
+    Thread 1 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5693:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5712:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5738:
+    THREAD_COMPLETED
+    Thread 1 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 5738:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 9 B: 0] -> [S: 0 I: 0 N: 8 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5783:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5785:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5785:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5804:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5830:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5859:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5859:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5872:
+    IO_BURST_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5904:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5911:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5911:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5934:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 5956:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5957:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 5957:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 5977:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6002:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6015:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6015:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6016:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6039:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6058:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6058:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6063:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6103:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6112:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6112:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6122:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6157:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6160:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6160:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6172:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6184:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6201:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6201:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6202:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6246:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6252:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6252:
+    DISPATCHER_INVOKED
+    Thread 2 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6274:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6297:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6310:
+    THREAD_COMPLETED
+    Thread 2 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 6310:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 8 B: 0] -> [S: 0 I: 0 N: 7 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6355:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6380:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6380:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6409:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6425:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6448:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6448:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6455:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6493:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6514:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6514:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6521:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6538:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6549:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6549:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6569:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6594:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6599:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6599:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6601:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6644:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6652:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6652:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6656:
+    IO_BURST_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6676:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6690:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6690:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6715:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6735:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6745:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6745:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6757:
+    IO_BURST_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6769:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6790:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6790:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6804:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6835:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6842:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6842:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6867:
+    IO_BURST_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6887:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6906:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6906:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6930:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6933:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6949:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 6949:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 6957:
+    IO_BURST_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 6994:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7010:
+    CPU_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7010:
+    DISPATCHER_INVOKED
+    Thread 0 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7033:
+    IO_BURST_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7055:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7080:
+    THREAD_COMPLETED
+    Thread 0 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7080:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 7 B: 0] -> [S: 0 I: 0 N: 6 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7104:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7117:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7117:
+    DISPATCHER_INVOKED
+    Thread 0 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 6 B: 0] -> [S: 0 I: 0 N: 5 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7132:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7162:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7181:
+    THREAD_COMPLETED
+    Thread 0 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7181:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 6 B: 0] -> [S: 0 I: 0 N: 5 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7205:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7227:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7227:
+    DISPATCHER_INVOKED
+    Thread 2 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7240:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7272:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7283:
+    THREAD_COMPLETED
+    Thread 2 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7283:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 5 B: 0] -> [S: 0 I: 0 N: 4 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7328:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7330:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7330:
+    DISPATCHER_INVOKED
+    Thread 0 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 0] -> [S: 0 I: 0 N: 3 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7346:
+    IO_BURST_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7354:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7361:
+    THREAD_COMPLETED
+    Thread 0 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7361:
+    DISPATCHER_INVOKED
+    Thread 2 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 4 B: 0] -> [S: 0 I: 0 N: 3 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7406:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7424:
+    THREAD_COMPLETED
+    Thread 2 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7424:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 3 B: 0] -> [S: 0 I: 0 N: 2 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7469:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7492:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7492:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 2 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7517:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7537:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7564:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7564:
+    DISPATCHER_INVOKED
+    Thread 1 in process 320 [NORMAL]
+    [S: 0 I: 0 N: 2 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7592:
+    IO_BURST_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7609:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7633:
+    THREAD_COMPLETED
+    Thread 1 in process 320 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7633:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 2 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7678:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7686:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7686:
+    DISPATCHER_INVOKED
+    Thread 1 in process 242 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7687:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7731:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7734:
+    THREAD_COMPLETED
+    Thread 1 in process 242 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 7734:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7779:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7794:
+    CPU_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 7807:
+    IO_BURST_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 7807:
+    DISPATCHER_INVOKED
+    Thread 3 in process 687 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 7831:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 7851:
+    THREAD_COMPLETED
+    Thread 3 in process 687 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
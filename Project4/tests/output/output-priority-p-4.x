@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             31
+    Process switches:           110
+    Dispatch time saved:        651
+
+MAX READY WAIT:
+    SYSTEM:                     736
+    INTERACTIVE:                  0
+    NORMAL:                    4821
+    BATCH:                        0
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:       54.00
+    Avg. turnaround time:    811.00
+
+NORMAL THREADS:
+    Total Count:                  1
+    Avg. response time:       36.00
+    Avg. turnaround time:   1002.00
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           1064
+Total service time:            170
+Total I/O time:                185
+Total dispatch time:           798
+Total idle time:                96
+
+CPU utilization:            90.98%
+CPU efficiency:             15.98%
+
@@ -0,0 +1,432 @@
+At time 62:
+    THREAD_ARRIVED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 62:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 80:
+    THREAD_ARRIVED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 98:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 98:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 98:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 134:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 140:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 140:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 168:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 176:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 176:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 176:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 212:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 241:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 241:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 250:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 277:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 277:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 277:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 313:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 320:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 320:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 341:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 356:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 356:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 356:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 392:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 410:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 410:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 419:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 446:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 446:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 446:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 482:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 501:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 501:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 507:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 537:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 537:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 537:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 573:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 575:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 575:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 583:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 611:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 611:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 611:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 647:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 652:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 652:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 675:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 688:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 688:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 688:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 724:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 726:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 726:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 748:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 762:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 762:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 762:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 798:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 814:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 814:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 839:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 850:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 850:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 850:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    [S: 0 I: 1 N: 1 B: 0] -> [S: 0 I: 0 N: 1 B: 0]. Will run to completion of burst or until preempted.
+
+At time 886:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 891:
+    THREAD_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 891:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 927:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 932:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 939:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 939:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 953:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 974:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 990:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 990:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1004:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1027:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1038:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1038:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    [S: 0 I: 0 N: 1 B: 0] -> [S: 0 I: 0 N: 0 B: 0]. Will run to completion of burst or until preempted.
+
+At time 1052:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1064:
+    THREAD_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:              3
+    Process switches:            21
+    Dispatch time saved:         66
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                 66
+    NORMAL:                     101
+    BATCH:                        0
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  3
+    Avg. response time:       80.00
+    Avg. turnaround time:   3349.33
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:      110.25
+    Avg. turnaround time:   2492.50
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:           4488
+Total service time:            628
+Total I/O time:                517
+Total dispatch time:          3796
+Total idle time:                64
+
+CPU utilization:            98.57%
+CPU efficiency:             13.99%
+
@@ -0,0 +1,13 @@
+SIMULATION COMPLETED!
+
+Process 642 [INTERACTIVE]:
+    Thread  0:    ARR: 50     CPU: 104    I/O: 86     TRT: 2892   END: 2942  
+    Thread  1:    ARR: 42     CPU: 200    I/O: 148    TRT: 4351   END: 4393  
+    Thread  2:    ARR: 57     CPU: 99     I/O: 82     TRT: 2805   END: 2862  
+
+Process 740 [NORMAL]:
+    Thread  0:    ARR: 100    CPU: 126    I/O: 119    TRT: 4388   END: 4488  
+    Thread  1:    ARR: 60     CPU: 25     I/O: 15     TRT: 1465   END: 1525  
+    Thread  2:    ARR: 73     CPU: 48     I/O: 48     TRT: 2537   END: 2610  
+    Thread  3:    ARR: 50     CPU: 26     I/O: 19     TRT: 1580   END: 1630  
+
@@ -0,0 +1,19 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:            122
+    Process switches:            98
+    Dispatch time saved:       3904
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                167
+    NORMAL:                     190
+    BATCH:                        0
+
+CPU SHARES:
+    SYSTEM:               target    0.00%   achieved    0.00%
+    INTERACTIVE:          target   65.61%   achieved   64.17%
+    NORMAL:               target   34.39%   achieved   35.83%
+    BATCH:                target    0.00%   achieved    0.00%
+
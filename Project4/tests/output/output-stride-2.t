@@ -0,0 +1,9 @@
+SIMULATION COMPLETED!
+
+Process 59 [SYSTEM]:
+    Thread  0:    ARR: 33     CPU: 54     I/O: 60     TRT: 895    END: 928   
+    Thread  1:    ARR: 29     CPU: 123    I/O: 97     TRT: 1828   END: 1857  
+
+Process 189 [NORMAL]:
+    Thread  0:    ARR: 19     CPU: 46     I/O: 34     TRT: 1938   END: 1957  
+
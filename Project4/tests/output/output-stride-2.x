@@ -0,0 +1,19 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             54
+    Process switches:            25
+    Dispatch time saved:       1998
+
+MAX READY WAIT:
+    SYSTEM:                     110
+    INTERACTIVE:                  0
+    NORMAL:                     213
+    BATCH:                        0
+
+CPU SHARES:
+    SYSTEM:               target   79.84%   achieved   79.37%
+    INTERACTIVE:          target    0.00%   achieved    0.00%
+    NORMAL:               target   20.16%   achieved   20.63%
+    BATCH:                target    0.00%   achieved    0.00%
+
@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  1
+    Avg. response time:      468.00
+    Avg. turnaround time:  10348.00
+
+NORMAL THREADS:
+    Total Count:                  8
+    Avg. response time:      271.75
+    Avg. turnaround time:  10801.00
+
+BATCH THREADS:
+    Total Count:                  4
+    Avg. response time:      205.25
+    Avg. turnaround time:  14752.75
+
+Total elapsed time:          17508
+Total service time:           1127
+Total I/O time:                891
+Total dispatch time:         16291
+Total idle time:                90
+
+CPU utilization:            99.49%
+CPU efficiency:              6.44%
+
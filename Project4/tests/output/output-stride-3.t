@@ -0,0 +1,27 @@
+SIMULATION COMPLETED!
+
+Process 203 [NORMAL]:
+    Thread  0:    ARR: 48     CPU: 135    I/O: 115    TRT: 16100  END: 16148 
+
+Process 297 [BATCH]:
+    Thread  0:    ARR: 10     CPU: 71     I/O: 44     TRT: 16311  END: 16321 
+
+Process 341 [INTERACTIVE]:
+    Thread  0:    ARR: 82     CPU: 121    I/O: 58     TRT: 10348  END: 10430 
+
+Process 395 [NORMAL]:
+    Thread  0:    ARR: 58     CPU: 2      I/O: 0      TRT: 342    END: 400   
+    Thread  1:    ARR: 28     CPU: 105    I/O: 119    TRT: 14521  END: 14549 
+    Thread  2:    ARR: 33     CPU: 70     I/O: 28     TRT: 11311  END: 11344 
+
+Process 404 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 182    I/O: 153    TRT: 17508  END: 17508 
+    Thread  1:    ARR: 53     CPU: 96     I/O: 81     TRT: 16691  END: 16744 
+    Thread  2:    ARR: 58     CPU: 26     I/O: 39     TRT: 8501   END: 8559  
+
+Process 613 [NORMAL]:
+    Thread  0:    ARR: 70     CPU: 74     I/O: 84     TRT: 11572  END: 11642 
+    Thread  1:    ARR: 47     CPU: 119    I/O: 102    TRT: 15526  END: 15573 
+    Thread  2:    ARR: 39     CPU: 14     I/O: 0      TRT: 2051   END: 2090  
+    Thread  3:    ARR: 87     CPU: 112    I/O: 68     TRT: 14985  END: 15072 
+
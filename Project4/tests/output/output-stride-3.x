@@ -0,0 +1,19 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             97
+    Process switches:           301
+    Dispatch time saved:       2813
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                470
+    NORMAL:                     626
+    BATCH:                     1316
+
+CPU SHARES:
+    SYSTEM:               target    0.00%   achieved    0.00%
+    INTERACTIVE:          target   11.06%   achieved   10.74%
+    NORMAL:               target   55.63%   achieved   55.99%
+    BATCH:                target   33.31%   achieved   33.27%
+
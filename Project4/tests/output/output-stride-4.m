@@ -0,0 +1,31 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                 13
+    Avg. response time:      495.15
+    Avg. turnaround time:  17438.46
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                 10
+    Avg. response time:      547.90
+    Avg. turnaround time:  31909.20
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:          34430
+Total service time:           2134
+Total I/O time:               1835
+Total dispatch time:         32286
+Total idle time:                10
+
+CPU utilization:            99.97%
+CPU efficiency:              6.20%
+
@@ -0,0 +1,19 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             89
+    Process switches:           670
+    Dispatch time saved:       1869
+
+MAX READY WAIT:
+    SYSTEM:                    1065
+    INTERACTIVE:                  0
+    NORMAL:                    3472
+    BATCH:                        0
+
+CPU SHARES:
+    SYSTEM:               target   56.25%   achieved   55.86%
+    INTERACTIVE:          target    0.00%   achieved    0.00%
+    NORMAL:               target   43.75%   achieved   44.14%
+    BATCH:                target    0.00%   achieved    0.00%
+
@@ -0,0 +1,987 @@
+At time 62:
+    THREAD_ARRIVED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 62:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (pass = 0, tickets = 200). Will run for at most 3 ticks.
+
+At time 80:
+    THREAD_ARRIVED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 98:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 101:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 101:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 0, tickets = 400). Will run for at most 3 ticks.
+
+At time 137:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 140:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 140:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 7863, tickets = 400). Will run for at most 3 ticks.
+
+At time 154:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 157:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 157:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (pass = 15726, tickets = 200). Will run for at most 3 ticks.
+
+At time 185:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 193:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 195:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 195:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (pass = 15726, tickets = 400). Will run for at most 3 ticks.
+
+At time 202:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 231:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 234:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 234:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 23589, tickets = 400). Will run for at most 3 ticks.
+
+At time 248:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 251:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 251:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 26210, tickets = 200). Will run for at most 3 ticks.
+
+At time 287:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 290:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 290:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 31452, tickets = 400). Will run for at most 3 ticks.
+
+At time 326:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 329:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 329:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 39315, tickets = 400). Will run for at most 3 ticks.
+
+At time 343:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 346:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 346:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 41936, tickets = 200). Will run for at most 3 ticks.
+
+At time 382:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 385:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 385:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 47178, tickets = 400). Will run for at most 3 ticks.
+
+At time 421:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 424:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 424:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 55041, tickets = 400). Will run for at most 3 ticks.
+
+At time 438:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 441:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 441:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 57662, tickets = 200). Will run for at most 3 ticks.
+
+At time 477:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 480:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 480:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 62904, tickets = 400). Will run for at most 3 ticks.
+
+At time 516:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 519:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 519:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 70767, tickets = 400). Will run for at most 3 ticks.
+
+At time 533:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 536:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 536:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 73388, tickets = 200). Will run for at most 3 ticks.
+
+At time 572:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 575:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 575:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 78630, tickets = 400). Will run for at most 3 ticks.
+
+At time 611:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 614:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 614:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 86493, tickets = 400). Will run for at most 3 ticks.
+
+At time 628:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 630:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 630:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (pass = 89114, tickets = 200). Will run for at most 3 ticks.
+
+At time 639:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 666:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 669:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 669:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 91735, tickets = 400). Will run for at most 3 ticks.
+
+At time 705:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 708:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 708:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 99598, tickets = 400). Will run for at most 3 ticks.
+
+At time 722:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 725:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 725:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 104840, tickets = 200). Will run for at most 3 ticks.
+
+At time 761:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 764:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 764:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 107461, tickets = 400). Will run for at most 3 ticks.
+
+At time 800:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 801:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 801:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (pass = 120566, tickets = 200). Will run for at most 3 ticks.
+
+At time 822:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 837:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 840:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 840:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (pass = 120566, tickets = 400). Will run for at most 3 ticks.
+
+At time 856:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 876:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 879:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 879:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 128429, tickets = 400). Will run for at most 3 ticks.
+
+At time 893:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 896:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 896:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 136292, tickets = 200). Will run for at most 3 ticks.
+
+At time 932:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 935:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 935:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 136292, tickets = 400). Will run for at most 3 ticks.
+
+At time 971:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 974:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 974:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 144155, tickets = 400). Will run for at most 3 ticks.
+
+At time 988:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 991:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 991:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 152018, tickets = 200). Will run for at most 3 ticks.
+
+At time 1027:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1030:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1030:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 152018, tickets = 400). Will run for at most 3 ticks.
+
+At time 1066:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1069:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1069:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 159881, tickets = 400). Will run for at most 3 ticks.
+
+At time 1083:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1086:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1086:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (pass = 167744, tickets = 200). Will run for at most 3 ticks.
+
+At time 1095:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1122:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1125:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1125:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 167744, tickets = 400). Will run for at most 3 ticks.
+
+At time 1161:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1164:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1164:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 175607, tickets = 400). Will run for at most 3 ticks.
+
+At time 1178:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1181:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1181:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 183470, tickets = 200). Will run for at most 3 ticks.
+
+At time 1217:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1220:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1220:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 183470, tickets = 400). Will run for at most 3 ticks.
+
+At time 1256:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1259:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1259:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 191333, tickets = 400). Will run for at most 3 ticks.
+
+At time 1273:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1276:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1276:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 199196, tickets = 200). Will run for at most 3 ticks.
+
+At time 1312:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1315:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1315:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 199196, tickets = 400). Will run for at most 3 ticks.
+
+At time 1351:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1354:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1354:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 207059, tickets = 400). Will run for at most 3 ticks.
+
+At time 1368:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1371:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1371:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 214922, tickets = 200). Will run for at most 3 ticks.
+
+At time 1407:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1410:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1410:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 214922, tickets = 400). Will run for at most 3 ticks.
+
+At time 1446:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1447:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1447:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (pass = 230648, tickets = 200). Will run for at most 3 ticks.
+
+At time 1453:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1483:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1486:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1486:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 230648, tickets = 400). Will run for at most 3 ticks.
+
+At time 1522:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1524:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1524:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (pass = 246374, tickets = 200). Will run for at most 3 ticks.
+
+At time 1532:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1560:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1562:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1562:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (pass = 246374, tickets = 400). Will run for at most 3 ticks.
+
+At time 1573:
+    IO_BURST_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 1598:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1601:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1601:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 254237, tickets = 400). Will run for at most 3 ticks.
+
+At time 1615:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1617:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1617:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (pass = 256858, tickets = 200). Will run for at most 3 ticks.
+
+At time 1640:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1653:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1656:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1656:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 259479, tickets = 400). Will run for at most 3 ticks.
+
+At time 1692:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1694:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 1694:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 1 threads (pass = 272584, tickets = 200). Will run for at most 3 ticks.
+
+At time 1716:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 1730:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1733:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1733:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 272584, tickets = 400). Will run for at most 3 ticks.
+
+At time 1769:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1772:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1772:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 280447, tickets = 400). Will run for at most 3 ticks.
+
+At time 1786:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1789:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1789:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 288310, tickets = 200). Will run for at most 3 ticks.
+
+At time 1825:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1828:
+    THREAD_PREEMPTED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 1828:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 288310, tickets = 400). Will run for at most 3 ticks.
+
+At time 1864:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1867:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1867:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 2 threads (pass = 296173, tickets = 400). Will run for at most 3 ticks.
+
+At time 1881:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1884:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1884:
+    DISPATCHER_INVOKED
+    Thread 0 in process 140 [NORMAL]
+    Selected from 2 threads (pass = 304036, tickets = 200). Will run for at most 3 ticks.
+
+At time 1920:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1923:
+    THREAD_COMPLETED
+    Thread 0 in process 140 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 1923:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (pass = 304036, tickets = 400). Will run for at most 3 ticks.
+
+At time 1959:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1962:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 1962:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (pass = 311899, tickets = 400). Will run for at most 3 ticks.
+
+At time 1976:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 1977:
+    CPU_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to BLOCKED
+
+At time 2002:
+    IO_BURST_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from BLOCKED to READY
+
+At time 2002:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (pass = 314520, tickets = 400). Will run for at most 3 ticks.
+
+At time 2016:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2019:
+    THREAD_PREEMPTED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to READY
+
+At time 2019:
+    DISPATCHER_INVOKED
+    Thread 0 in process 35 [INTERACTIVE]
+    Selected from 1 threads (pass = 322383, tickets = 400). Will run for at most 3 ticks.
+
+At time 2033:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 2035:
+    THREAD_COMPLETED
+    Thread 0 in process 35 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
+
@@ -0,0 +1,19 @@
+SIMULATION COMPLETED!
+
+DISPATCH OVERHEAD:
+    Thread switches:             19
+    Process switches:            42
+    Dispatch time saved:        418
+
+MAX READY WAIT:
+    SYSTEM:                       0
+    INTERACTIVE:                 75
+    NORMAL:                      92
+    BATCH:                        0
+
+CPU SHARES:
+    SYSTEM:               target    0.00%   achieved    0.00%
+    INTERACTIVE:          target   68.43%   achieved   64.12%
+    NORMAL:               target   31.57%   achieved   35.88%
+    BATCH:                target    0.00%   achieved    0.00%
+